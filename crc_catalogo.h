@@ -0,0 +1,7681 @@
+/* crc_catalogo.h -- gerado por `crc_lfsr --gen-catalogo`; não editar à mão.
+ * Tabelas slice-by-8 e constantes de dobra de cada modelo de crc_models[]. */
+
+/* CRC-3/GSM */
+static const uint64_t crc_cat_t0[8][256] = {
+  {
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+  },
+  {
+    0, 0xc000000000000000, 0xe000000000000000, 0x2000000000000000,
+    0xa000000000000000, 0x6000000000000000, 0x4000000000000000, 0x8000000000000000,
+    0x2000000000000000, 0xe000000000000000, 0xc000000000000000, 0,
+    0x8000000000000000, 0x4000000000000000, 0x6000000000000000, 0xa000000000000000,
+    0x4000000000000000, 0x8000000000000000, 0xa000000000000000, 0x6000000000000000,
+    0xe000000000000000, 0x2000000000000000, 0, 0xc000000000000000,
+    0x6000000000000000, 0xa000000000000000, 0x8000000000000000, 0x4000000000000000,
+    0xc000000000000000, 0, 0x2000000000000000, 0xe000000000000000,
+    0x8000000000000000, 0x4000000000000000, 0x6000000000000000, 0xa000000000000000,
+    0x2000000000000000, 0xe000000000000000, 0xc000000000000000, 0,
+    0xa000000000000000, 0x6000000000000000, 0x4000000000000000, 0x8000000000000000,
+    0, 0xc000000000000000, 0xe000000000000000, 0x2000000000000000,
+    0xc000000000000000, 0, 0x2000000000000000, 0xe000000000000000,
+    0x6000000000000000, 0xa000000000000000, 0x8000000000000000, 0x4000000000000000,
+    0xe000000000000000, 0x2000000000000000, 0, 0xc000000000000000,
+    0x4000000000000000, 0x8000000000000000, 0xa000000000000000, 0x6000000000000000,
+    0x6000000000000000, 0xa000000000000000, 0x8000000000000000, 0x4000000000000000,
+    0xc000000000000000, 0, 0x2000000000000000, 0xe000000000000000,
+    0x4000000000000000, 0x8000000000000000, 0xa000000000000000, 0x6000000000000000,
+    0xe000000000000000, 0x2000000000000000, 0, 0xc000000000000000,
+    0x2000000000000000, 0xe000000000000000, 0xc000000000000000, 0,
+    0x8000000000000000, 0x4000000000000000, 0x6000000000000000, 0xa000000000000000,
+    0, 0xc000000000000000, 0xe000000000000000, 0x2000000000000000,
+    0xa000000000000000, 0x6000000000000000, 0x4000000000000000, 0x8000000000000000,
+    0xe000000000000000, 0x2000000000000000, 0, 0xc000000000000000,
+    0x4000000000000000, 0x8000000000000000, 0xa000000000000000, 0x6000000000000000,
+    0xc000000000000000, 0, 0x2000000000000000, 0xe000000000000000,
+    0x6000000000000000, 0xa000000000000000, 0x8000000000000000, 0x4000000000000000,
+    0xa000000000000000, 0x6000000000000000, 0x4000000000000000, 0x8000000000000000,
+    0, 0xc000000000000000, 0xe000000000000000, 0x2000000000000000,
+    0x8000000000000000, 0x4000000000000000, 0x6000000000000000, 0xa000000000000000,
+    0x2000000000000000, 0xe000000000000000, 0xc000000000000000, 0,
+    0xc000000000000000, 0, 0x2000000000000000, 0xe000000000000000,
+    0x6000000000000000, 0xa000000000000000, 0x8000000000000000, 0x4000000000000000,
+    0xe000000000000000, 0x2000000000000000, 0, 0xc000000000000000,
+    0x4000000000000000, 0x8000000000000000, 0xa000000000000000, 0x6000000000000000,
+    0x8000000000000000, 0x4000000000000000, 0x6000000000000000, 0xa000000000000000,
+    0x2000000000000000, 0xe000000000000000, 0xc000000000000000, 0,
+    0xa000000000000000, 0x6000000000000000, 0x4000000000000000, 0x8000000000000000,
+    0, 0xc000000000000000, 0xe000000000000000, 0x2000000000000000,
+    0x4000000000000000, 0x8000000000000000, 0xa000000000000000, 0x6000000000000000,
+    0xe000000000000000, 0x2000000000000000, 0, 0xc000000000000000,
+    0x6000000000000000, 0xa000000000000000, 0x8000000000000000, 0x4000000000000000,
+    0xc000000000000000, 0, 0x2000000000000000, 0xe000000000000000,
+    0, 0xc000000000000000, 0xe000000000000000, 0x2000000000000000,
+    0xa000000000000000, 0x6000000000000000, 0x4000000000000000, 0x8000000000000000,
+    0x2000000000000000, 0xe000000000000000, 0xc000000000000000, 0,
+    0x8000000000000000, 0x4000000000000000, 0x6000000000000000, 0xa000000000000000,
+    0xa000000000000000, 0x6000000000000000, 0x4000000000000000, 0x8000000000000000,
+    0, 0xc000000000000000, 0xe000000000000000, 0x2000000000000000,
+    0x8000000000000000, 0x4000000000000000, 0x6000000000000000, 0xa000000000000000,
+    0x2000000000000000, 0xe000000000000000, 0xc000000000000000, 0,
+    0xe000000000000000, 0x2000000000000000, 0, 0xc000000000000000,
+    0x4000000000000000, 0x8000000000000000, 0xa000000000000000, 0x6000000000000000,
+    0xc000000000000000, 0, 0x2000000000000000, 0xe000000000000000,
+    0x6000000000000000, 0xa000000000000000, 0x8000000000000000, 0x4000000000000000,
+    0x2000000000000000, 0xe000000000000000, 0xc000000000000000, 0,
+    0x8000000000000000, 0x4000000000000000, 0x6000000000000000, 0xa000000000000000,
+    0, 0xc000000000000000, 0xe000000000000000, 0x2000000000000000,
+    0xa000000000000000, 0x6000000000000000, 0x4000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0xa000000000000000, 0x8000000000000000, 0x4000000000000000,
+    0xc000000000000000, 0, 0x2000000000000000, 0xe000000000000000,
+    0x4000000000000000, 0x8000000000000000, 0xa000000000000000, 0x6000000000000000,
+    0xe000000000000000, 0x2000000000000000, 0, 0xc000000000000000,
+  },
+  {
+    0, 0xe000000000000000, 0xa000000000000000, 0x4000000000000000,
+    0x2000000000000000, 0xc000000000000000, 0x8000000000000000, 0x6000000000000000,
+    0x4000000000000000, 0xa000000000000000, 0xe000000000000000, 0,
+    0x6000000000000000, 0x8000000000000000, 0xc000000000000000, 0x2000000000000000,
+    0x8000000000000000, 0x6000000000000000, 0x2000000000000000, 0xc000000000000000,
+    0xa000000000000000, 0x4000000000000000, 0, 0xe000000000000000,
+    0xc000000000000000, 0x2000000000000000, 0x6000000000000000, 0x8000000000000000,
+    0xe000000000000000, 0, 0x4000000000000000, 0xa000000000000000,
+    0x6000000000000000, 0x8000000000000000, 0xc000000000000000, 0x2000000000000000,
+    0x4000000000000000, 0xa000000000000000, 0xe000000000000000, 0,
+    0x2000000000000000, 0xc000000000000000, 0x8000000000000000, 0x6000000000000000,
+    0, 0xe000000000000000, 0xa000000000000000, 0x4000000000000000,
+    0xe000000000000000, 0, 0x4000000000000000, 0xa000000000000000,
+    0xc000000000000000, 0x2000000000000000, 0x6000000000000000, 0x8000000000000000,
+    0xa000000000000000, 0x4000000000000000, 0, 0xe000000000000000,
+    0x8000000000000000, 0x6000000000000000, 0x2000000000000000, 0xc000000000000000,
+    0xc000000000000000, 0x2000000000000000, 0x6000000000000000, 0x8000000000000000,
+    0xe000000000000000, 0, 0x4000000000000000, 0xa000000000000000,
+    0x8000000000000000, 0x6000000000000000, 0x2000000000000000, 0xc000000000000000,
+    0xa000000000000000, 0x4000000000000000, 0, 0xe000000000000000,
+    0x4000000000000000, 0xa000000000000000, 0xe000000000000000, 0,
+    0x6000000000000000, 0x8000000000000000, 0xc000000000000000, 0x2000000000000000,
+    0, 0xe000000000000000, 0xa000000000000000, 0x4000000000000000,
+    0x2000000000000000, 0xc000000000000000, 0x8000000000000000, 0x6000000000000000,
+    0xa000000000000000, 0x4000000000000000, 0, 0xe000000000000000,
+    0x8000000000000000, 0x6000000000000000, 0x2000000000000000, 0xc000000000000000,
+    0xe000000000000000, 0, 0x4000000000000000, 0xa000000000000000,
+    0xc000000000000000, 0x2000000000000000, 0x6000000000000000, 0x8000000000000000,
+    0x2000000000000000, 0xc000000000000000, 0x8000000000000000, 0x6000000000000000,
+    0, 0xe000000000000000, 0xa000000000000000, 0x4000000000000000,
+    0x6000000000000000, 0x8000000000000000, 0xc000000000000000, 0x2000000000000000,
+    0x4000000000000000, 0xa000000000000000, 0xe000000000000000, 0,
+    0xe000000000000000, 0, 0x4000000000000000, 0xa000000000000000,
+    0xc000000000000000, 0x2000000000000000, 0x6000000000000000, 0x8000000000000000,
+    0xa000000000000000, 0x4000000000000000, 0, 0xe000000000000000,
+    0x8000000000000000, 0x6000000000000000, 0x2000000000000000, 0xc000000000000000,
+    0x6000000000000000, 0x8000000000000000, 0xc000000000000000, 0x2000000000000000,
+    0x4000000000000000, 0xa000000000000000, 0xe000000000000000, 0,
+    0x2000000000000000, 0xc000000000000000, 0x8000000000000000, 0x6000000000000000,
+    0, 0xe000000000000000, 0xa000000000000000, 0x4000000000000000,
+    0x8000000000000000, 0x6000000000000000, 0x2000000000000000, 0xc000000000000000,
+    0xa000000000000000, 0x4000000000000000, 0, 0xe000000000000000,
+    0xc000000000000000, 0x2000000000000000, 0x6000000000000000, 0x8000000000000000,
+    0xe000000000000000, 0, 0x4000000000000000, 0xa000000000000000,
+    0, 0xe000000000000000, 0xa000000000000000, 0x4000000000000000,
+    0x2000000000000000, 0xc000000000000000, 0x8000000000000000, 0x6000000000000000,
+    0x4000000000000000, 0xa000000000000000, 0xe000000000000000, 0,
+    0x6000000000000000, 0x8000000000000000, 0xc000000000000000, 0x2000000000000000,
+    0x2000000000000000, 0xc000000000000000, 0x8000000000000000, 0x6000000000000000,
+    0, 0xe000000000000000, 0xa000000000000000, 0x4000000000000000,
+    0x6000000000000000, 0x8000000000000000, 0xc000000000000000, 0x2000000000000000,
+    0x4000000000000000, 0xa000000000000000, 0xe000000000000000, 0,
+    0xa000000000000000, 0x4000000000000000, 0, 0xe000000000000000,
+    0x8000000000000000, 0x6000000000000000, 0x2000000000000000, 0xc000000000000000,
+    0xe000000000000000, 0, 0x4000000000000000, 0xa000000000000000,
+    0xc000000000000000, 0x2000000000000000, 0x6000000000000000, 0x8000000000000000,
+    0x4000000000000000, 0xa000000000000000, 0xe000000000000000, 0,
+    0x6000000000000000, 0x8000000000000000, 0xc000000000000000, 0x2000000000000000,
+    0, 0xe000000000000000, 0xa000000000000000, 0x4000000000000000,
+    0x2000000000000000, 0xc000000000000000, 0x8000000000000000, 0x6000000000000000,
+    0xc000000000000000, 0x2000000000000000, 0x6000000000000000, 0x8000000000000000,
+    0xe000000000000000, 0, 0x4000000000000000, 0xa000000000000000,
+    0x8000000000000000, 0x6000000000000000, 0x2000000000000000, 0xc000000000000000,
+    0xa000000000000000, 0x4000000000000000, 0, 0xe000000000000000,
+  },
+  {
+    0, 0xa000000000000000, 0x2000000000000000, 0x8000000000000000,
+    0x4000000000000000, 0xe000000000000000, 0x6000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0x2000000000000000, 0xa000000000000000, 0,
+    0xc000000000000000, 0x6000000000000000, 0xe000000000000000, 0x4000000000000000,
+    0x6000000000000000, 0xc000000000000000, 0x4000000000000000, 0xe000000000000000,
+    0x2000000000000000, 0x8000000000000000, 0, 0xa000000000000000,
+    0xe000000000000000, 0x4000000000000000, 0xc000000000000000, 0x6000000000000000,
+    0xa000000000000000, 0, 0x8000000000000000, 0x2000000000000000,
+    0xc000000000000000, 0x6000000000000000, 0xe000000000000000, 0x4000000000000000,
+    0x8000000000000000, 0x2000000000000000, 0xa000000000000000, 0,
+    0x4000000000000000, 0xe000000000000000, 0x6000000000000000, 0xc000000000000000,
+    0, 0xa000000000000000, 0x2000000000000000, 0x8000000000000000,
+    0xa000000000000000, 0, 0x8000000000000000, 0x2000000000000000,
+    0xe000000000000000, 0x4000000000000000, 0xc000000000000000, 0x6000000000000000,
+    0x2000000000000000, 0x8000000000000000, 0, 0xa000000000000000,
+    0x6000000000000000, 0xc000000000000000, 0x4000000000000000, 0xe000000000000000,
+    0xe000000000000000, 0x4000000000000000, 0xc000000000000000, 0x6000000000000000,
+    0xa000000000000000, 0, 0x8000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0xc000000000000000, 0x4000000000000000, 0xe000000000000000,
+    0x2000000000000000, 0x8000000000000000, 0, 0xa000000000000000,
+    0x8000000000000000, 0x2000000000000000, 0xa000000000000000, 0,
+    0xc000000000000000, 0x6000000000000000, 0xe000000000000000, 0x4000000000000000,
+    0, 0xa000000000000000, 0x2000000000000000, 0x8000000000000000,
+    0x4000000000000000, 0xe000000000000000, 0x6000000000000000, 0xc000000000000000,
+    0x2000000000000000, 0x8000000000000000, 0, 0xa000000000000000,
+    0x6000000000000000, 0xc000000000000000, 0x4000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0, 0x8000000000000000, 0x2000000000000000,
+    0xe000000000000000, 0x4000000000000000, 0xc000000000000000, 0x6000000000000000,
+    0x4000000000000000, 0xe000000000000000, 0x6000000000000000, 0xc000000000000000,
+    0, 0xa000000000000000, 0x2000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0x6000000000000000, 0xe000000000000000, 0x4000000000000000,
+    0x8000000000000000, 0x2000000000000000, 0xa000000000000000, 0,
+    0xa000000000000000, 0, 0x8000000000000000, 0x2000000000000000,
+    0xe000000000000000, 0x4000000000000000, 0xc000000000000000, 0x6000000000000000,
+    0x2000000000000000, 0x8000000000000000, 0, 0xa000000000000000,
+    0x6000000000000000, 0xc000000000000000, 0x4000000000000000, 0xe000000000000000,
+    0xc000000000000000, 0x6000000000000000, 0xe000000000000000, 0x4000000000000000,
+    0x8000000000000000, 0x2000000000000000, 0xa000000000000000, 0,
+    0x4000000000000000, 0xe000000000000000, 0x6000000000000000, 0xc000000000000000,
+    0, 0xa000000000000000, 0x2000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0xc000000000000000, 0x4000000000000000, 0xe000000000000000,
+    0x2000000000000000, 0x8000000000000000, 0, 0xa000000000000000,
+    0xe000000000000000, 0x4000000000000000, 0xc000000000000000, 0x6000000000000000,
+    0xa000000000000000, 0, 0x8000000000000000, 0x2000000000000000,
+    0, 0xa000000000000000, 0x2000000000000000, 0x8000000000000000,
+    0x4000000000000000, 0xe000000000000000, 0x6000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0x2000000000000000, 0xa000000000000000, 0,
+    0xc000000000000000, 0x6000000000000000, 0xe000000000000000, 0x4000000000000000,
+    0x4000000000000000, 0xe000000000000000, 0x6000000000000000, 0xc000000000000000,
+    0, 0xa000000000000000, 0x2000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0x6000000000000000, 0xe000000000000000, 0x4000000000000000,
+    0x8000000000000000, 0x2000000000000000, 0xa000000000000000, 0,
+    0x2000000000000000, 0x8000000000000000, 0, 0xa000000000000000,
+    0x6000000000000000, 0xc000000000000000, 0x4000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0, 0x8000000000000000, 0x2000000000000000,
+    0xe000000000000000, 0x4000000000000000, 0xc000000000000000, 0x6000000000000000,
+    0x8000000000000000, 0x2000000000000000, 0xa000000000000000, 0,
+    0xc000000000000000, 0x6000000000000000, 0xe000000000000000, 0x4000000000000000,
+    0, 0xa000000000000000, 0x2000000000000000, 0x8000000000000000,
+    0x4000000000000000, 0xe000000000000000, 0x6000000000000000, 0xc000000000000000,
+    0xe000000000000000, 0x4000000000000000, 0xc000000000000000, 0x6000000000000000,
+    0xa000000000000000, 0, 0x8000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0xc000000000000000, 0x4000000000000000, 0xe000000000000000,
+    0x2000000000000000, 0x8000000000000000, 0, 0xa000000000000000,
+  },
+  {
+    0, 0x2000000000000000, 0x4000000000000000, 0x6000000000000000,
+    0x8000000000000000, 0xa000000000000000, 0xc000000000000000, 0xe000000000000000,
+    0x6000000000000000, 0x4000000000000000, 0x2000000000000000, 0,
+    0xe000000000000000, 0xc000000000000000, 0xa000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0xe000000000000000, 0x8000000000000000, 0xa000000000000000,
+    0x4000000000000000, 0x6000000000000000, 0, 0x2000000000000000,
+    0xa000000000000000, 0x8000000000000000, 0xe000000000000000, 0xc000000000000000,
+    0x2000000000000000, 0, 0x6000000000000000, 0x4000000000000000,
+    0xe000000000000000, 0xc000000000000000, 0xa000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0x4000000000000000, 0x2000000000000000, 0,
+    0x8000000000000000, 0xa000000000000000, 0xc000000000000000, 0xe000000000000000,
+    0, 0x2000000000000000, 0x4000000000000000, 0x6000000000000000,
+    0x2000000000000000, 0, 0x6000000000000000, 0x4000000000000000,
+    0xa000000000000000, 0x8000000000000000, 0xe000000000000000, 0xc000000000000000,
+    0x4000000000000000, 0x6000000000000000, 0, 0x2000000000000000,
+    0xc000000000000000, 0xe000000000000000, 0x8000000000000000, 0xa000000000000000,
+    0xa000000000000000, 0x8000000000000000, 0xe000000000000000, 0xc000000000000000,
+    0x2000000000000000, 0, 0x6000000000000000, 0x4000000000000000,
+    0xc000000000000000, 0xe000000000000000, 0x8000000000000000, 0xa000000000000000,
+    0x4000000000000000, 0x6000000000000000, 0, 0x2000000000000000,
+    0x6000000000000000, 0x4000000000000000, 0x2000000000000000, 0,
+    0xe000000000000000, 0xc000000000000000, 0xa000000000000000, 0x8000000000000000,
+    0, 0x2000000000000000, 0x4000000000000000, 0x6000000000000000,
+    0x8000000000000000, 0xa000000000000000, 0xc000000000000000, 0xe000000000000000,
+    0x4000000000000000, 0x6000000000000000, 0, 0x2000000000000000,
+    0xc000000000000000, 0xe000000000000000, 0x8000000000000000, 0xa000000000000000,
+    0x2000000000000000, 0, 0x6000000000000000, 0x4000000000000000,
+    0xa000000000000000, 0x8000000000000000, 0xe000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0xa000000000000000, 0xc000000000000000, 0xe000000000000000,
+    0, 0x2000000000000000, 0x4000000000000000, 0x6000000000000000,
+    0xe000000000000000, 0xc000000000000000, 0xa000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0x4000000000000000, 0x2000000000000000, 0,
+    0x2000000000000000, 0, 0x6000000000000000, 0x4000000000000000,
+    0xa000000000000000, 0x8000000000000000, 0xe000000000000000, 0xc000000000000000,
+    0x4000000000000000, 0x6000000000000000, 0, 0x2000000000000000,
+    0xc000000000000000, 0xe000000000000000, 0x8000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0xc000000000000000, 0xa000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0x4000000000000000, 0x2000000000000000, 0,
+    0x8000000000000000, 0xa000000000000000, 0xc000000000000000, 0xe000000000000000,
+    0, 0x2000000000000000, 0x4000000000000000, 0x6000000000000000,
+    0xc000000000000000, 0xe000000000000000, 0x8000000000000000, 0xa000000000000000,
+    0x4000000000000000, 0x6000000000000000, 0, 0x2000000000000000,
+    0xa000000000000000, 0x8000000000000000, 0xe000000000000000, 0xc000000000000000,
+    0x2000000000000000, 0, 0x6000000000000000, 0x4000000000000000,
+    0, 0x2000000000000000, 0x4000000000000000, 0x6000000000000000,
+    0x8000000000000000, 0xa000000000000000, 0xc000000000000000, 0xe000000000000000,
+    0x6000000000000000, 0x4000000000000000, 0x2000000000000000, 0,
+    0xe000000000000000, 0xc000000000000000, 0xa000000000000000, 0x8000000000000000,
+    0x8000000000000000, 0xa000000000000000, 0xc000000000000000, 0xe000000000000000,
+    0, 0x2000000000000000, 0x4000000000000000, 0x6000000000000000,
+    0xe000000000000000, 0xc000000000000000, 0xa000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0x4000000000000000, 0x2000000000000000, 0,
+    0x4000000000000000, 0x6000000000000000, 0, 0x2000000000000000,
+    0xc000000000000000, 0xe000000000000000, 0x8000000000000000, 0xa000000000000000,
+    0x2000000000000000, 0, 0x6000000000000000, 0x4000000000000000,
+    0xa000000000000000, 0x8000000000000000, 0xe000000000000000, 0xc000000000000000,
+    0x6000000000000000, 0x4000000000000000, 0x2000000000000000, 0,
+    0xe000000000000000, 0xc000000000000000, 0xa000000000000000, 0x8000000000000000,
+    0, 0x2000000000000000, 0x4000000000000000, 0x6000000000000000,
+    0x8000000000000000, 0xa000000000000000, 0xc000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0x8000000000000000, 0xe000000000000000, 0xc000000000000000,
+    0x2000000000000000, 0, 0x6000000000000000, 0x4000000000000000,
+    0xc000000000000000, 0xe000000000000000, 0x8000000000000000, 0xa000000000000000,
+    0x4000000000000000, 0x6000000000000000, 0, 0x2000000000000000,
+  },
+  {
+    0, 0x4000000000000000, 0x8000000000000000, 0xc000000000000000,
+    0x6000000000000000, 0x2000000000000000, 0xe000000000000000, 0xa000000000000000,
+    0xc000000000000000, 0x8000000000000000, 0x4000000000000000, 0,
+    0xa000000000000000, 0xe000000000000000, 0x2000000000000000, 0x6000000000000000,
+    0xe000000000000000, 0xa000000000000000, 0x6000000000000000, 0x2000000000000000,
+    0x8000000000000000, 0xc000000000000000, 0, 0x4000000000000000,
+    0x2000000000000000, 0x6000000000000000, 0xa000000000000000, 0xe000000000000000,
+    0x4000000000000000, 0, 0xc000000000000000, 0x8000000000000000,
+    0xa000000000000000, 0xe000000000000000, 0x2000000000000000, 0x6000000000000000,
+    0xc000000000000000, 0x8000000000000000, 0x4000000000000000, 0,
+    0x6000000000000000, 0x2000000000000000, 0xe000000000000000, 0xa000000000000000,
+    0, 0x4000000000000000, 0x8000000000000000, 0xc000000000000000,
+    0x4000000000000000, 0, 0xc000000000000000, 0x8000000000000000,
+    0x2000000000000000, 0x6000000000000000, 0xa000000000000000, 0xe000000000000000,
+    0x8000000000000000, 0xc000000000000000, 0, 0x4000000000000000,
+    0xe000000000000000, 0xa000000000000000, 0x6000000000000000, 0x2000000000000000,
+    0x2000000000000000, 0x6000000000000000, 0xa000000000000000, 0xe000000000000000,
+    0x4000000000000000, 0, 0xc000000000000000, 0x8000000000000000,
+    0xe000000000000000, 0xa000000000000000, 0x6000000000000000, 0x2000000000000000,
+    0x8000000000000000, 0xc000000000000000, 0, 0x4000000000000000,
+    0xc000000000000000, 0x8000000000000000, 0x4000000000000000, 0,
+    0xa000000000000000, 0xe000000000000000, 0x2000000000000000, 0x6000000000000000,
+    0, 0x4000000000000000, 0x8000000000000000, 0xc000000000000000,
+    0x6000000000000000, 0x2000000000000000, 0xe000000000000000, 0xa000000000000000,
+    0x8000000000000000, 0xc000000000000000, 0, 0x4000000000000000,
+    0xe000000000000000, 0xa000000000000000, 0x6000000000000000, 0x2000000000000000,
+    0x4000000000000000, 0, 0xc000000000000000, 0x8000000000000000,
+    0x2000000000000000, 0x6000000000000000, 0xa000000000000000, 0xe000000000000000,
+    0x6000000000000000, 0x2000000000000000, 0xe000000000000000, 0xa000000000000000,
+    0, 0x4000000000000000, 0x8000000000000000, 0xc000000000000000,
+    0xa000000000000000, 0xe000000000000000, 0x2000000000000000, 0x6000000000000000,
+    0xc000000000000000, 0x8000000000000000, 0x4000000000000000, 0,
+    0x4000000000000000, 0, 0xc000000000000000, 0x8000000000000000,
+    0x2000000000000000, 0x6000000000000000, 0xa000000000000000, 0xe000000000000000,
+    0x8000000000000000, 0xc000000000000000, 0, 0x4000000000000000,
+    0xe000000000000000, 0xa000000000000000, 0x6000000000000000, 0x2000000000000000,
+    0xa000000000000000, 0xe000000000000000, 0x2000000000000000, 0x6000000000000000,
+    0xc000000000000000, 0x8000000000000000, 0x4000000000000000, 0,
+    0x6000000000000000, 0x2000000000000000, 0xe000000000000000, 0xa000000000000000,
+    0, 0x4000000000000000, 0x8000000000000000, 0xc000000000000000,
+    0xe000000000000000, 0xa000000000000000, 0x6000000000000000, 0x2000000000000000,
+    0x8000000000000000, 0xc000000000000000, 0, 0x4000000000000000,
+    0x2000000000000000, 0x6000000000000000, 0xa000000000000000, 0xe000000000000000,
+    0x4000000000000000, 0, 0xc000000000000000, 0x8000000000000000,
+    0, 0x4000000000000000, 0x8000000000000000, 0xc000000000000000,
+    0x6000000000000000, 0x2000000000000000, 0xe000000000000000, 0xa000000000000000,
+    0xc000000000000000, 0x8000000000000000, 0x4000000000000000, 0,
+    0xa000000000000000, 0xe000000000000000, 0x2000000000000000, 0x6000000000000000,
+    0x6000000000000000, 0x2000000000000000, 0xe000000000000000, 0xa000000000000000,
+    0, 0x4000000000000000, 0x8000000000000000, 0xc000000000000000,
+    0xa000000000000000, 0xe000000000000000, 0x2000000000000000, 0x6000000000000000,
+    0xc000000000000000, 0x8000000000000000, 0x4000000000000000, 0,
+    0x8000000000000000, 0xc000000000000000, 0, 0x4000000000000000,
+    0xe000000000000000, 0xa000000000000000, 0x6000000000000000, 0x2000000000000000,
+    0x4000000000000000, 0, 0xc000000000000000, 0x8000000000000000,
+    0x2000000000000000, 0x6000000000000000, 0xa000000000000000, 0xe000000000000000,
+    0xc000000000000000, 0x8000000000000000, 0x4000000000000000, 0,
+    0xa000000000000000, 0xe000000000000000, 0x2000000000000000, 0x6000000000000000,
+    0, 0x4000000000000000, 0x8000000000000000, 0xc000000000000000,
+    0x6000000000000000, 0x2000000000000000, 0xe000000000000000, 0xa000000000000000,
+    0x2000000000000000, 0x6000000000000000, 0xa000000000000000, 0xe000000000000000,
+    0x4000000000000000, 0, 0xc000000000000000, 0x8000000000000000,
+    0xe000000000000000, 0xa000000000000000, 0x6000000000000000, 0x2000000000000000,
+    0x8000000000000000, 0xc000000000000000, 0, 0x4000000000000000,
+  },
+  {
+    0, 0x8000000000000000, 0x6000000000000000, 0xe000000000000000,
+    0xc000000000000000, 0x4000000000000000, 0xa000000000000000, 0x2000000000000000,
+    0xe000000000000000, 0x6000000000000000, 0x8000000000000000, 0,
+    0x2000000000000000, 0xa000000000000000, 0x4000000000000000, 0xc000000000000000,
+    0xa000000000000000, 0x2000000000000000, 0xc000000000000000, 0x4000000000000000,
+    0x6000000000000000, 0xe000000000000000, 0, 0x8000000000000000,
+    0x4000000000000000, 0xc000000000000000, 0x2000000000000000, 0xa000000000000000,
+    0x8000000000000000, 0, 0xe000000000000000, 0x6000000000000000,
+    0x2000000000000000, 0xa000000000000000, 0x4000000000000000, 0xc000000000000000,
+    0xe000000000000000, 0x6000000000000000, 0x8000000000000000, 0,
+    0xc000000000000000, 0x4000000000000000, 0xa000000000000000, 0x2000000000000000,
+    0, 0x8000000000000000, 0x6000000000000000, 0xe000000000000000,
+    0x8000000000000000, 0, 0xe000000000000000, 0x6000000000000000,
+    0x4000000000000000, 0xc000000000000000, 0x2000000000000000, 0xa000000000000000,
+    0x6000000000000000, 0xe000000000000000, 0, 0x8000000000000000,
+    0xa000000000000000, 0x2000000000000000, 0xc000000000000000, 0x4000000000000000,
+    0x4000000000000000, 0xc000000000000000, 0x2000000000000000, 0xa000000000000000,
+    0x8000000000000000, 0, 0xe000000000000000, 0x6000000000000000,
+    0xa000000000000000, 0x2000000000000000, 0xc000000000000000, 0x4000000000000000,
+    0x6000000000000000, 0xe000000000000000, 0, 0x8000000000000000,
+    0xe000000000000000, 0x6000000000000000, 0x8000000000000000, 0,
+    0x2000000000000000, 0xa000000000000000, 0x4000000000000000, 0xc000000000000000,
+    0, 0x8000000000000000, 0x6000000000000000, 0xe000000000000000,
+    0xc000000000000000, 0x4000000000000000, 0xa000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0xe000000000000000, 0, 0x8000000000000000,
+    0xa000000000000000, 0x2000000000000000, 0xc000000000000000, 0x4000000000000000,
+    0x8000000000000000, 0, 0xe000000000000000, 0x6000000000000000,
+    0x4000000000000000, 0xc000000000000000, 0x2000000000000000, 0xa000000000000000,
+    0xc000000000000000, 0x4000000000000000, 0xa000000000000000, 0x2000000000000000,
+    0, 0x8000000000000000, 0x6000000000000000, 0xe000000000000000,
+    0x2000000000000000, 0xa000000000000000, 0x4000000000000000, 0xc000000000000000,
+    0xe000000000000000, 0x6000000000000000, 0x8000000000000000, 0,
+    0x8000000000000000, 0, 0xe000000000000000, 0x6000000000000000,
+    0x4000000000000000, 0xc000000000000000, 0x2000000000000000, 0xa000000000000000,
+    0x6000000000000000, 0xe000000000000000, 0, 0x8000000000000000,
+    0xa000000000000000, 0x2000000000000000, 0xc000000000000000, 0x4000000000000000,
+    0x2000000000000000, 0xa000000000000000, 0x4000000000000000, 0xc000000000000000,
+    0xe000000000000000, 0x6000000000000000, 0x8000000000000000, 0,
+    0xc000000000000000, 0x4000000000000000, 0xa000000000000000, 0x2000000000000000,
+    0, 0x8000000000000000, 0x6000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0x2000000000000000, 0xc000000000000000, 0x4000000000000000,
+    0x6000000000000000, 0xe000000000000000, 0, 0x8000000000000000,
+    0x4000000000000000, 0xc000000000000000, 0x2000000000000000, 0xa000000000000000,
+    0x8000000000000000, 0, 0xe000000000000000, 0x6000000000000000,
+    0, 0x8000000000000000, 0x6000000000000000, 0xe000000000000000,
+    0xc000000000000000, 0x4000000000000000, 0xa000000000000000, 0x2000000000000000,
+    0xe000000000000000, 0x6000000000000000, 0x8000000000000000, 0,
+    0x2000000000000000, 0xa000000000000000, 0x4000000000000000, 0xc000000000000000,
+    0xc000000000000000, 0x4000000000000000, 0xa000000000000000, 0x2000000000000000,
+    0, 0x8000000000000000, 0x6000000000000000, 0xe000000000000000,
+    0x2000000000000000, 0xa000000000000000, 0x4000000000000000, 0xc000000000000000,
+    0xe000000000000000, 0x6000000000000000, 0x8000000000000000, 0,
+    0x6000000000000000, 0xe000000000000000, 0, 0x8000000000000000,
+    0xa000000000000000, 0x2000000000000000, 0xc000000000000000, 0x4000000000000000,
+    0x8000000000000000, 0, 0xe000000000000000, 0x6000000000000000,
+    0x4000000000000000, 0xc000000000000000, 0x2000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0x6000000000000000, 0x8000000000000000, 0,
+    0x2000000000000000, 0xa000000000000000, 0x4000000000000000, 0xc000000000000000,
+    0, 0x8000000000000000, 0x6000000000000000, 0xe000000000000000,
+    0xc000000000000000, 0x4000000000000000, 0xa000000000000000, 0x2000000000000000,
+    0x4000000000000000, 0xc000000000000000, 0x2000000000000000, 0xa000000000000000,
+    0x8000000000000000, 0, 0xe000000000000000, 0x6000000000000000,
+    0xa000000000000000, 0x2000000000000000, 0xc000000000000000, 0x4000000000000000,
+    0x6000000000000000, 0xe000000000000000, 0, 0x8000000000000000,
+  },
+  {
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0xa000000000000000, 0xc000000000000000, 0x6000000000000000, 0,
+    0x4000000000000000, 0x2000000000000000, 0x8000000000000000, 0xe000000000000000,
+    0, 0x6000000000000000, 0xc000000000000000, 0xa000000000000000,
+    0xe000000000000000, 0x8000000000000000, 0x2000000000000000, 0x4000000000000000,
+    0x8000000000000000, 0xe000000000000000, 0x4000000000000000, 0x2000000000000000,
+    0x6000000000000000, 0, 0xa000000000000000, 0xc000000000000000,
+    0x2000000000000000, 0x4000000000000000, 0xe000000000000000, 0x8000000000000000,
+    0xc000000000000000, 0xa000000000000000, 0, 0x6000000000000000,
+  },
+};
+static const CrcFold crc_cat_f0 = {
+    3, 0, 0x6000000000000000,
+    { 0x2000000000000000, 0xa000000000000000 }, { 0xc000000000000000, 0x6000000000000000 }, { 0xe000000000000000, 0xc000000000000000 },
+    0xc000000000000000, 0x72e5cb972e5cb972
+};
+
+/* CRC-5/USB */
+static const uint64_t crc_cat_t1[8][256] = {
+  {
+    0, 0xe, 0x1c, 0x12,
+    0x11, 0x1f, 0xd, 0x3,
+    0xb, 0x5, 0x17, 0x19,
+    0x1a, 0x14, 0x6, 0x8,
+    0x16, 0x18, 0xa, 0x4,
+    0x7, 0x9, 0x1b, 0x15,
+    0x1d, 0x13, 0x1, 0xf,
+    0xc, 0x2, 0x10, 0x1e,
+    0x5, 0xb, 0x19, 0x17,
+    0x14, 0x1a, 0x8, 0x6,
+    0xe, 0, 0x12, 0x1c,
+    0x1f, 0x11, 0x3, 0xd,
+    0x13, 0x1d, 0xf, 0x1,
+    0x2, 0xc, 0x1e, 0x10,
+    0x18, 0x16, 0x4, 0xa,
+    0x9, 0x7, 0x15, 0x1b,
+    0xa, 0x4, 0x16, 0x18,
+    0x1b, 0x15, 0x7, 0x9,
+    0x1, 0xf, 0x1d, 0x13,
+    0x10, 0x1e, 0xc, 0x2,
+    0x1c, 0x12, 0, 0xe,
+    0xd, 0x3, 0x11, 0x1f,
+    0x17, 0x19, 0xb, 0x5,
+    0x6, 0x8, 0x1a, 0x14,
+    0xf, 0x1, 0x13, 0x1d,
+    0x1e, 0x10, 0x2, 0xc,
+    0x4, 0xa, 0x18, 0x16,
+    0x15, 0x1b, 0x9, 0x7,
+    0x19, 0x17, 0x5, 0xb,
+    0x8, 0x6, 0x14, 0x1a,
+    0x12, 0x1c, 0xe, 0,
+    0x3, 0xd, 0x1f, 0x11,
+    0x14, 0x1a, 0x8, 0x6,
+    0x5, 0xb, 0x19, 0x17,
+    0x1f, 0x11, 0x3, 0xd,
+    0xe, 0, 0x12, 0x1c,
+    0x2, 0xc, 0x1e, 0x10,
+    0x13, 0x1d, 0xf, 0x1,
+    0x9, 0x7, 0x15, 0x1b,
+    0x18, 0x16, 0x4, 0xa,
+    0x11, 0x1f, 0xd, 0x3,
+    0, 0xe, 0x1c, 0x12,
+    0x1a, 0x14, 0x6, 0x8,
+    0xb, 0x5, 0x17, 0x19,
+    0x7, 0x9, 0x1b, 0x15,
+    0x16, 0x18, 0xa, 0x4,
+    0xc, 0x2, 0x10, 0x1e,
+    0x1d, 0x13, 0x1, 0xf,
+    0x1e, 0x10, 0x2, 0xc,
+    0xf, 0x1, 0x13, 0x1d,
+    0x15, 0x1b, 0x9, 0x7,
+    0x4, 0xa, 0x18, 0x16,
+    0x8, 0x6, 0x14, 0x1a,
+    0x19, 0x17, 0x5, 0xb,
+    0x3, 0xd, 0x1f, 0x11,
+    0x12, 0x1c, 0xe, 0,
+    0x1b, 0x15, 0x7, 0x9,
+    0xa, 0x4, 0x16, 0x18,
+    0x10, 0x1e, 0xc, 0x2,
+    0x1, 0xf, 0x1d, 0x13,
+    0xd, 0x3, 0x11, 0x1f,
+    0x1c, 0x12, 0, 0xe,
+    0x6, 0x8, 0x1a, 0x14,
+    0x17, 0x19, 0xb, 0x5,
+  },
+  {
+    0, 0x6, 0xc, 0xa,
+    0x18, 0x1e, 0x14, 0x12,
+    0x19, 0x1f, 0x15, 0x13,
+    0x1, 0x7, 0xd, 0xb,
+    0x1b, 0x1d, 0x17, 0x11,
+    0x3, 0x5, 0xf, 0x9,
+    0x2, 0x4, 0xe, 0x8,
+    0x1a, 0x1c, 0x16, 0x10,
+    0x1f, 0x19, 0x13, 0x15,
+    0x7, 0x1, 0xb, 0xd,
+    0x6, 0, 0xa, 0xc,
+    0x1e, 0x18, 0x12, 0x14,
+    0x4, 0x2, 0x8, 0xe,
+    0x1c, 0x1a, 0x10, 0x16,
+    0x1d, 0x1b, 0x11, 0x17,
+    0x5, 0x3, 0x9, 0xf,
+    0x17, 0x11, 0x1b, 0x1d,
+    0xf, 0x9, 0x3, 0x5,
+    0xe, 0x8, 0x2, 0x4,
+    0x16, 0x10, 0x1a, 0x1c,
+    0xc, 0xa, 0, 0x6,
+    0x14, 0x12, 0x18, 0x1e,
+    0x15, 0x13, 0x19, 0x1f,
+    0xd, 0xb, 0x1, 0x7,
+    0x8, 0xe, 0x4, 0x2,
+    0x10, 0x16, 0x1c, 0x1a,
+    0x11, 0x17, 0x1d, 0x1b,
+    0x9, 0xf, 0x5, 0x3,
+    0x13, 0x15, 0x1f, 0x19,
+    0xb, 0xd, 0x7, 0x1,
+    0xa, 0xc, 0x6, 0,
+    0x12, 0x14, 0x1e, 0x18,
+    0x7, 0x1, 0xb, 0xd,
+    0x1f, 0x19, 0x13, 0x15,
+    0x1e, 0x18, 0x12, 0x14,
+    0x6, 0, 0xa, 0xc,
+    0x1c, 0x1a, 0x10, 0x16,
+    0x4, 0x2, 0x8, 0xe,
+    0x5, 0x3, 0x9, 0xf,
+    0x1d, 0x1b, 0x11, 0x17,
+    0x18, 0x1e, 0x14, 0x12,
+    0, 0x6, 0xc, 0xa,
+    0x1, 0x7, 0xd, 0xb,
+    0x19, 0x1f, 0x15, 0x13,
+    0x3, 0x5, 0xf, 0x9,
+    0x1b, 0x1d, 0x17, 0x11,
+    0x1a, 0x1c, 0x16, 0x10,
+    0x2, 0x4, 0xe, 0x8,
+    0x10, 0x16, 0x1c, 0x1a,
+    0x8, 0xe, 0x4, 0x2,
+    0x9, 0xf, 0x5, 0x3,
+    0x11, 0x17, 0x1d, 0x1b,
+    0xb, 0xd, 0x7, 0x1,
+    0x13, 0x15, 0x1f, 0x19,
+    0x12, 0x14, 0x1e, 0x18,
+    0xa, 0xc, 0x6, 0,
+    0xf, 0x9, 0x3, 0x5,
+    0x17, 0x11, 0x1b, 0x1d,
+    0x16, 0x10, 0x1a, 0x1c,
+    0xe, 0x8, 0x2, 0x4,
+    0x14, 0x12, 0x18, 0x1e,
+    0xc, 0xa, 0, 0x6,
+    0xd, 0xb, 0x1, 0x7,
+    0x15, 0x13, 0x19, 0x1f,
+  },
+  {
+    0, 0xd, 0x1a, 0x17,
+    0x1d, 0x10, 0x7, 0xa,
+    0x13, 0x1e, 0x9, 0x4,
+    0xe, 0x3, 0x14, 0x19,
+    0xf, 0x2, 0x15, 0x18,
+    0x12, 0x1f, 0x8, 0x5,
+    0x1c, 0x11, 0x6, 0xb,
+    0x1, 0xc, 0x1b, 0x16,
+    0x1e, 0x13, 0x4, 0x9,
+    0x3, 0xe, 0x19, 0x14,
+    0xd, 0, 0x17, 0x1a,
+    0x10, 0x1d, 0xa, 0x7,
+    0x11, 0x1c, 0xb, 0x6,
+    0xc, 0x1, 0x16, 0x1b,
+    0x2, 0xf, 0x18, 0x15,
+    0x1f, 0x12, 0x5, 0x8,
+    0x15, 0x18, 0xf, 0x2,
+    0x8, 0x5, 0x12, 0x1f,
+    0x6, 0xb, 0x1c, 0x11,
+    0x1b, 0x16, 0x1, 0xc,
+    0x1a, 0x17, 0, 0xd,
+    0x7, 0xa, 0x1d, 0x10,
+    0x9, 0x4, 0x13, 0x1e,
+    0x14, 0x19, 0xe, 0x3,
+    0xb, 0x6, 0x11, 0x1c,
+    0x16, 0x1b, 0xc, 0x1,
+    0x18, 0x15, 0x2, 0xf,
+    0x5, 0x8, 0x1f, 0x12,
+    0x4, 0x9, 0x1e, 0x13,
+    0x19, 0x14, 0x3, 0xe,
+    0x17, 0x1a, 0xd, 0,
+    0xa, 0x7, 0x10, 0x1d,
+    0x3, 0xe, 0x19, 0x14,
+    0x1e, 0x13, 0x4, 0x9,
+    0x10, 0x1d, 0xa, 0x7,
+    0xd, 0, 0x17, 0x1a,
+    0xc, 0x1, 0x16, 0x1b,
+    0x11, 0x1c, 0xb, 0x6,
+    0x1f, 0x12, 0x5, 0x8,
+    0x2, 0xf, 0x18, 0x15,
+    0x1d, 0x10, 0x7, 0xa,
+    0, 0xd, 0x1a, 0x17,
+    0xe, 0x3, 0x14, 0x19,
+    0x13, 0x1e, 0x9, 0x4,
+    0x12, 0x1f, 0x8, 0x5,
+    0xf, 0x2, 0x15, 0x18,
+    0x1, 0xc, 0x1b, 0x16,
+    0x1c, 0x11, 0x6, 0xb,
+    0x16, 0x1b, 0xc, 0x1,
+    0xb, 0x6, 0x11, 0x1c,
+    0x5, 0x8, 0x1f, 0x12,
+    0x18, 0x15, 0x2, 0xf,
+    0x19, 0x14, 0x3, 0xe,
+    0x4, 0x9, 0x1e, 0x13,
+    0xa, 0x7, 0x10, 0x1d,
+    0x17, 0x1a, 0xd, 0,
+    0x8, 0x5, 0x12, 0x1f,
+    0x15, 0x18, 0xf, 0x2,
+    0x1b, 0x16, 0x1, 0xc,
+    0x6, 0xb, 0x1c, 0x11,
+    0x7, 0xa, 0x1d, 0x10,
+    0x1a, 0x17, 0, 0xd,
+    0x14, 0x19, 0xe, 0x3,
+    0x9, 0x4, 0x13, 0x1e,
+  },
+  {
+    0, 0x14, 0x1, 0x15,
+    0x2, 0x16, 0x3, 0x17,
+    0x4, 0x10, 0x5, 0x11,
+    0x6, 0x12, 0x7, 0x13,
+    0x8, 0x1c, 0x9, 0x1d,
+    0xa, 0x1e, 0xb, 0x1f,
+    0xc, 0x18, 0xd, 0x19,
+    0xe, 0x1a, 0xf, 0x1b,
+    0x10, 0x4, 0x11, 0x5,
+    0x12, 0x6, 0x13, 0x7,
+    0x14, 0, 0x15, 0x1,
+    0x16, 0x2, 0x17, 0x3,
+    0x18, 0xc, 0x19, 0xd,
+    0x1a, 0xe, 0x1b, 0xf,
+    0x1c, 0x8, 0x1d, 0x9,
+    0x1e, 0xa, 0x1f, 0xb,
+    0x9, 0x1d, 0x8, 0x1c,
+    0xb, 0x1f, 0xa, 0x1e,
+    0xd, 0x19, 0xc, 0x18,
+    0xf, 0x1b, 0xe, 0x1a,
+    0x1, 0x15, 0, 0x14,
+    0x3, 0x17, 0x2, 0x16,
+    0x5, 0x11, 0x4, 0x10,
+    0x7, 0x13, 0x6, 0x12,
+    0x19, 0xd, 0x18, 0xc,
+    0x1b, 0xf, 0x1a, 0xe,
+    0x1d, 0x9, 0x1c, 0x8,
+    0x1f, 0xb, 0x1e, 0xa,
+    0x11, 0x5, 0x10, 0x4,
+    0x13, 0x7, 0x12, 0x6,
+    0x15, 0x1, 0x14, 0,
+    0x17, 0x3, 0x16, 0x2,
+    0x12, 0x6, 0x13, 0x7,
+    0x10, 0x4, 0x11, 0x5,
+    0x16, 0x2, 0x17, 0x3,
+    0x14, 0, 0x15, 0x1,
+    0x1a, 0xe, 0x1b, 0xf,
+    0x18, 0xc, 0x19, 0xd,
+    0x1e, 0xa, 0x1f, 0xb,
+    0x1c, 0x8, 0x1d, 0x9,
+    0x2, 0x16, 0x3, 0x17,
+    0, 0x14, 0x1, 0x15,
+    0x6, 0x12, 0x7, 0x13,
+    0x4, 0x10, 0x5, 0x11,
+    0xa, 0x1e, 0xb, 0x1f,
+    0x8, 0x1c, 0x9, 0x1d,
+    0xe, 0x1a, 0xf, 0x1b,
+    0xc, 0x18, 0xd, 0x19,
+    0x1b, 0xf, 0x1a, 0xe,
+    0x19, 0xd, 0x18, 0xc,
+    0x1f, 0xb, 0x1e, 0xa,
+    0x1d, 0x9, 0x1c, 0x8,
+    0x13, 0x7, 0x12, 0x6,
+    0x11, 0x5, 0x10, 0x4,
+    0x17, 0x3, 0x16, 0x2,
+    0x15, 0x1, 0x14, 0,
+    0xb, 0x1f, 0xa, 0x1e,
+    0x9, 0x1d, 0x8, 0x1c,
+    0xf, 0x1b, 0xe, 0x1a,
+    0xd, 0x19, 0xc, 0x18,
+    0x3, 0x17, 0x2, 0x16,
+    0x1, 0x15, 0, 0x14,
+    0x7, 0x13, 0x6, 0x12,
+    0x5, 0x11, 0x4, 0x10,
+  },
+  {
+    0, 0x7, 0xe, 0x9,
+    0x1c, 0x1b, 0x12, 0x15,
+    0x11, 0x16, 0x1f, 0x18,
+    0xd, 0xa, 0x3, 0x4,
+    0xb, 0xc, 0x5, 0x2,
+    0x17, 0x10, 0x19, 0x1e,
+    0x1a, 0x1d, 0x14, 0x13,
+    0x6, 0x1, 0x8, 0xf,
+    0x16, 0x11, 0x18, 0x1f,
+    0xa, 0xd, 0x4, 0x3,
+    0x7, 0, 0x9, 0xe,
+    0x1b, 0x1c, 0x15, 0x12,
+    0x1d, 0x1a, 0x13, 0x14,
+    0x1, 0x6, 0xf, 0x8,
+    0xc, 0xb, 0x2, 0x5,
+    0x10, 0x17, 0x1e, 0x19,
+    0x5, 0x2, 0xb, 0xc,
+    0x19, 0x1e, 0x17, 0x10,
+    0x14, 0x13, 0x1a, 0x1d,
+    0x8, 0xf, 0x6, 0x1,
+    0xe, 0x9, 0, 0x7,
+    0x12, 0x15, 0x1c, 0x1b,
+    0x1f, 0x18, 0x11, 0x16,
+    0x3, 0x4, 0xd, 0xa,
+    0x13, 0x14, 0x1d, 0x1a,
+    0xf, 0x8, 0x1, 0x6,
+    0x2, 0x5, 0xc, 0xb,
+    0x1e, 0x19, 0x10, 0x17,
+    0x18, 0x1f, 0x16, 0x11,
+    0x4, 0x3, 0xa, 0xd,
+    0x9, 0xe, 0x7, 0,
+    0x15, 0x12, 0x1b, 0x1c,
+    0xa, 0xd, 0x4, 0x3,
+    0x16, 0x11, 0x18, 0x1f,
+    0x1b, 0x1c, 0x15, 0x12,
+    0x7, 0, 0x9, 0xe,
+    0x1, 0x6, 0xf, 0x8,
+    0x1d, 0x1a, 0x13, 0x14,
+    0x10, 0x17, 0x1e, 0x19,
+    0xc, 0xb, 0x2, 0x5,
+    0x1c, 0x1b, 0x12, 0x15,
+    0, 0x7, 0xe, 0x9,
+    0xd, 0xa, 0x3, 0x4,
+    0x11, 0x16, 0x1f, 0x18,
+    0x17, 0x10, 0x19, 0x1e,
+    0xb, 0xc, 0x5, 0x2,
+    0x6, 0x1, 0x8, 0xf,
+    0x1a, 0x1d, 0x14, 0x13,
+    0xf, 0x8, 0x1, 0x6,
+    0x13, 0x14, 0x1d, 0x1a,
+    0x1e, 0x19, 0x10, 0x17,
+    0x2, 0x5, 0xc, 0xb,
+    0x4, 0x3, 0xa, 0xd,
+    0x18, 0x1f, 0x16, 0x11,
+    0x15, 0x12, 0x1b, 0x1c,
+    0x9, 0xe, 0x7, 0,
+    0x19, 0x1e, 0x17, 0x10,
+    0x5, 0x2, 0xb, 0xc,
+    0x8, 0xf, 0x6, 0x1,
+    0x14, 0x13, 0x1a, 0x1d,
+    0x12, 0x15, 0x1c, 0x1b,
+    0xe, 0x9, 0, 0x7,
+    0x3, 0x4, 0xd, 0xa,
+    0x1f, 0x18, 0x11, 0x16,
+  },
+  {
+    0, 0x3, 0x6, 0x5,
+    0xc, 0xf, 0xa, 0x9,
+    0x18, 0x1b, 0x1e, 0x1d,
+    0x14, 0x17, 0x12, 0x11,
+    0x19, 0x1a, 0x1f, 0x1c,
+    0x15, 0x16, 0x13, 0x10,
+    0x1, 0x2, 0x7, 0x4,
+    0xd, 0xe, 0xb, 0x8,
+    0x1b, 0x18, 0x1d, 0x1e,
+    0x17, 0x14, 0x11, 0x12,
+    0x3, 0, 0x5, 0x6,
+    0xf, 0xc, 0x9, 0xa,
+    0x2, 0x1, 0x4, 0x7,
+    0xe, 0xd, 0x8, 0xb,
+    0x1a, 0x19, 0x1c, 0x1f,
+    0x16, 0x15, 0x10, 0x13,
+    0x1f, 0x1c, 0x19, 0x1a,
+    0x13, 0x10, 0x15, 0x16,
+    0x7, 0x4, 0x1, 0x2,
+    0xb, 0x8, 0xd, 0xe,
+    0x6, 0x5, 0, 0x3,
+    0xa, 0x9, 0xc, 0xf,
+    0x1e, 0x1d, 0x18, 0x1b,
+    0x12, 0x11, 0x14, 0x17,
+    0x4, 0x7, 0x2, 0x1,
+    0x8, 0xb, 0xe, 0xd,
+    0x1c, 0x1f, 0x1a, 0x19,
+    0x10, 0x13, 0x16, 0x15,
+    0x1d, 0x1e, 0x1b, 0x18,
+    0x11, 0x12, 0x17, 0x14,
+    0x5, 0x6, 0x3, 0,
+    0x9, 0xa, 0xf, 0xc,
+    0x17, 0x14, 0x11, 0x12,
+    0x1b, 0x18, 0x1d, 0x1e,
+    0xf, 0xc, 0x9, 0xa,
+    0x3, 0, 0x5, 0x6,
+    0xe, 0xd, 0x8, 0xb,
+    0x2, 0x1, 0x4, 0x7,
+    0x16, 0x15, 0x10, 0x13,
+    0x1a, 0x19, 0x1c, 0x1f,
+    0xc, 0xf, 0xa, 0x9,
+    0, 0x3, 0x6, 0x5,
+    0x14, 0x17, 0x12, 0x11,
+    0x18, 0x1b, 0x1e, 0x1d,
+    0x15, 0x16, 0x13, 0x10,
+    0x19, 0x1a, 0x1f, 0x1c,
+    0xd, 0xe, 0xb, 0x8,
+    0x1, 0x2, 0x7, 0x4,
+    0x8, 0xb, 0xe, 0xd,
+    0x4, 0x7, 0x2, 0x1,
+    0x10, 0x13, 0x16, 0x15,
+    0x1c, 0x1f, 0x1a, 0x19,
+    0x11, 0x12, 0x17, 0x14,
+    0x1d, 0x1e, 0x1b, 0x18,
+    0x9, 0xa, 0xf, 0xc,
+    0x5, 0x6, 0x3, 0,
+    0x13, 0x10, 0x15, 0x16,
+    0x1f, 0x1c, 0x19, 0x1a,
+    0xb, 0x8, 0xd, 0xe,
+    0x7, 0x4, 0x1, 0x2,
+    0xa, 0x9, 0xc, 0xf,
+    0x6, 0x5, 0, 0x3,
+    0x12, 0x11, 0x14, 0x17,
+    0x1e, 0x1d, 0x18, 0x1b,
+  },
+  {
+    0, 0x12, 0xd, 0x1f,
+    0x1a, 0x8, 0x17, 0x5,
+    0x1d, 0xf, 0x10, 0x2,
+    0x7, 0x15, 0xa, 0x18,
+    0x13, 0x1, 0x1e, 0xc,
+    0x9, 0x1b, 0x4, 0x16,
+    0xe, 0x1c, 0x3, 0x11,
+    0x14, 0x6, 0x19, 0xb,
+    0xf, 0x1d, 0x2, 0x10,
+    0x15, 0x7, 0x18, 0xa,
+    0x12, 0, 0x1f, 0xd,
+    0x8, 0x1a, 0x5, 0x17,
+    0x1c, 0xe, 0x11, 0x3,
+    0x6, 0x14, 0xb, 0x19,
+    0x1, 0x13, 0xc, 0x1e,
+    0x1b, 0x9, 0x16, 0x4,
+    0x1e, 0xc, 0x13, 0x1,
+    0x4, 0x16, 0x9, 0x1b,
+    0x3, 0x11, 0xe, 0x1c,
+    0x19, 0xb, 0x14, 0x6,
+    0xd, 0x1f, 0, 0x12,
+    0x17, 0x5, 0x1a, 0x8,
+    0x10, 0x2, 0x1d, 0xf,
+    0xa, 0x18, 0x7, 0x15,
+    0x11, 0x3, 0x1c, 0xe,
+    0xb, 0x19, 0x6, 0x14,
+    0xc, 0x1e, 0x1, 0x13,
+    0x16, 0x4, 0x1b, 0x9,
+    0x2, 0x10, 0xf, 0x1d,
+    0x18, 0xa, 0x15, 0x7,
+    0x1f, 0xd, 0x12, 0,
+    0x5, 0x17, 0x8, 0x1a,
+    0x15, 0x7, 0x18, 0xa,
+    0xf, 0x1d, 0x2, 0x10,
+    0x8, 0x1a, 0x5, 0x17,
+    0x12, 0, 0x1f, 0xd,
+    0x6, 0x14, 0xb, 0x19,
+    0x1c, 0xe, 0x11, 0x3,
+    0x1b, 0x9, 0x16, 0x4,
+    0x1, 0x13, 0xc, 0x1e,
+    0x1a, 0x8, 0x17, 0x5,
+    0, 0x12, 0xd, 0x1f,
+    0x7, 0x15, 0xa, 0x18,
+    0x1d, 0xf, 0x10, 0x2,
+    0x9, 0x1b, 0x4, 0x16,
+    0x13, 0x1, 0x1e, 0xc,
+    0x14, 0x6, 0x19, 0xb,
+    0xe, 0x1c, 0x3, 0x11,
+    0xb, 0x19, 0x6, 0x14,
+    0x11, 0x3, 0x1c, 0xe,
+    0x16, 0x4, 0x1b, 0x9,
+    0xc, 0x1e, 0x1, 0x13,
+    0x18, 0xa, 0x15, 0x7,
+    0x2, 0x10, 0xf, 0x1d,
+    0x5, 0x17, 0x8, 0x1a,
+    0x1f, 0xd, 0x12, 0,
+    0x4, 0x16, 0x9, 0x1b,
+    0x1e, 0xc, 0x13, 0x1,
+    0x19, 0xb, 0x14, 0x6,
+    0x3, 0x11, 0xe, 0x1c,
+    0x17, 0x5, 0x1a, 0x8,
+    0xd, 0x1f, 0, 0x12,
+    0xa, 0x18, 0x7, 0x15,
+    0x10, 0x2, 0x1d, 0xf,
+  },
+  {
+    0, 0xa, 0x14, 0x1e,
+    0x1, 0xb, 0x15, 0x1f,
+    0x2, 0x8, 0x16, 0x1c,
+    0x3, 0x9, 0x17, 0x1d,
+    0x4, 0xe, 0x10, 0x1a,
+    0x5, 0xf, 0x11, 0x1b,
+    0x6, 0xc, 0x12, 0x18,
+    0x7, 0xd, 0x13, 0x19,
+    0x8, 0x2, 0x1c, 0x16,
+    0x9, 0x3, 0x1d, 0x17,
+    0xa, 0, 0x1e, 0x14,
+    0xb, 0x1, 0x1f, 0x15,
+    0xc, 0x6, 0x18, 0x12,
+    0xd, 0x7, 0x19, 0x13,
+    0xe, 0x4, 0x1a, 0x10,
+    0xf, 0x5, 0x1b, 0x11,
+    0x10, 0x1a, 0x4, 0xe,
+    0x11, 0x1b, 0x5, 0xf,
+    0x12, 0x18, 0x6, 0xc,
+    0x13, 0x19, 0x7, 0xd,
+    0x14, 0x1e, 0, 0xa,
+    0x15, 0x1f, 0x1, 0xb,
+    0x16, 0x1c, 0x2, 0x8,
+    0x17, 0x1d, 0x3, 0x9,
+    0x18, 0x12, 0xc, 0x6,
+    0x19, 0x13, 0xd, 0x7,
+    0x1a, 0x10, 0xe, 0x4,
+    0x1b, 0x11, 0xf, 0x5,
+    0x1c, 0x16, 0x8, 0x2,
+    0x1d, 0x17, 0x9, 0x3,
+    0x1e, 0x14, 0xa, 0,
+    0x1f, 0x15, 0xb, 0x1,
+    0x9, 0x3, 0x1d, 0x17,
+    0x8, 0x2, 0x1c, 0x16,
+    0xb, 0x1, 0x1f, 0x15,
+    0xa, 0, 0x1e, 0x14,
+    0xd, 0x7, 0x19, 0x13,
+    0xc, 0x6, 0x18, 0x12,
+    0xf, 0x5, 0x1b, 0x11,
+    0xe, 0x4, 0x1a, 0x10,
+    0x1, 0xb, 0x15, 0x1f,
+    0, 0xa, 0x14, 0x1e,
+    0x3, 0x9, 0x17, 0x1d,
+    0x2, 0x8, 0x16, 0x1c,
+    0x5, 0xf, 0x11, 0x1b,
+    0x4, 0xe, 0x10, 0x1a,
+    0x7, 0xd, 0x13, 0x19,
+    0x6, 0xc, 0x12, 0x18,
+    0x19, 0x13, 0xd, 0x7,
+    0x18, 0x12, 0xc, 0x6,
+    0x1b, 0x11, 0xf, 0x5,
+    0x1a, 0x10, 0xe, 0x4,
+    0x1d, 0x17, 0x9, 0x3,
+    0x1c, 0x16, 0x8, 0x2,
+    0x1f, 0x15, 0xb, 0x1,
+    0x1e, 0x14, 0xa, 0,
+    0x11, 0x1b, 0x5, 0xf,
+    0x10, 0x1a, 0x4, 0xe,
+    0x13, 0x19, 0x7, 0xd,
+    0x12, 0x18, 0x6, 0xc,
+    0x15, 0x1f, 0x1, 0xb,
+    0x14, 0x1e, 0, 0xa,
+    0x17, 0x1d, 0x3, 0x9,
+    0x16, 0x1c, 0x2, 0x8,
+  },
+};
+static const CrcFold crc_cat_f1 = {
+    5, 1, 0x14,
+    { 0x1, 0xa }, { 0x18, 0x6 }, { 0xa, 0x16 },
+    0xa, 0x215d8f9a42bb1f34
+};
+
+/* CRC-8/SMBUS */
+static const uint64_t crc_cat_t2[8][256] = {
+  {
+    0, 0x700000000000000, 0xe00000000000000, 0x900000000000000,
+    0x1c00000000000000, 0x1b00000000000000, 0x1200000000000000, 0x1500000000000000,
+    0x3800000000000000, 0x3f00000000000000, 0x3600000000000000, 0x3100000000000000,
+    0x2400000000000000, 0x2300000000000000, 0x2a00000000000000, 0x2d00000000000000,
+    0x7000000000000000, 0x7700000000000000, 0x7e00000000000000, 0x7900000000000000,
+    0x6c00000000000000, 0x6b00000000000000, 0x6200000000000000, 0x6500000000000000,
+    0x4800000000000000, 0x4f00000000000000, 0x4600000000000000, 0x4100000000000000,
+    0x5400000000000000, 0x5300000000000000, 0x5a00000000000000, 0x5d00000000000000,
+    0xe000000000000000, 0xe700000000000000, 0xee00000000000000, 0xe900000000000000,
+    0xfc00000000000000, 0xfb00000000000000, 0xf200000000000000, 0xf500000000000000,
+    0xd800000000000000, 0xdf00000000000000, 0xd600000000000000, 0xd100000000000000,
+    0xc400000000000000, 0xc300000000000000, 0xca00000000000000, 0xcd00000000000000,
+    0x9000000000000000, 0x9700000000000000, 0x9e00000000000000, 0x9900000000000000,
+    0x8c00000000000000, 0x8b00000000000000, 0x8200000000000000, 0x8500000000000000,
+    0xa800000000000000, 0xaf00000000000000, 0xa600000000000000, 0xa100000000000000,
+    0xb400000000000000, 0xb300000000000000, 0xba00000000000000, 0xbd00000000000000,
+    0xc700000000000000, 0xc000000000000000, 0xc900000000000000, 0xce00000000000000,
+    0xdb00000000000000, 0xdc00000000000000, 0xd500000000000000, 0xd200000000000000,
+    0xff00000000000000, 0xf800000000000000, 0xf100000000000000, 0xf600000000000000,
+    0xe300000000000000, 0xe400000000000000, 0xed00000000000000, 0xea00000000000000,
+    0xb700000000000000, 0xb000000000000000, 0xb900000000000000, 0xbe00000000000000,
+    0xab00000000000000, 0xac00000000000000, 0xa500000000000000, 0xa200000000000000,
+    0x8f00000000000000, 0x8800000000000000, 0x8100000000000000, 0x8600000000000000,
+    0x9300000000000000, 0x9400000000000000, 0x9d00000000000000, 0x9a00000000000000,
+    0x2700000000000000, 0x2000000000000000, 0x2900000000000000, 0x2e00000000000000,
+    0x3b00000000000000, 0x3c00000000000000, 0x3500000000000000, 0x3200000000000000,
+    0x1f00000000000000, 0x1800000000000000, 0x1100000000000000, 0x1600000000000000,
+    0x300000000000000, 0x400000000000000, 0xd00000000000000, 0xa00000000000000,
+    0x5700000000000000, 0x5000000000000000, 0x5900000000000000, 0x5e00000000000000,
+    0x4b00000000000000, 0x4c00000000000000, 0x4500000000000000, 0x4200000000000000,
+    0x6f00000000000000, 0x6800000000000000, 0x6100000000000000, 0x6600000000000000,
+    0x7300000000000000, 0x7400000000000000, 0x7d00000000000000, 0x7a00000000000000,
+    0x8900000000000000, 0x8e00000000000000, 0x8700000000000000, 0x8000000000000000,
+    0x9500000000000000, 0x9200000000000000, 0x9b00000000000000, 0x9c00000000000000,
+    0xb100000000000000, 0xb600000000000000, 0xbf00000000000000, 0xb800000000000000,
+    0xad00000000000000, 0xaa00000000000000, 0xa300000000000000, 0xa400000000000000,
+    0xf900000000000000, 0xfe00000000000000, 0xf700000000000000, 0xf000000000000000,
+    0xe500000000000000, 0xe200000000000000, 0xeb00000000000000, 0xec00000000000000,
+    0xc100000000000000, 0xc600000000000000, 0xcf00000000000000, 0xc800000000000000,
+    0xdd00000000000000, 0xda00000000000000, 0xd300000000000000, 0xd400000000000000,
+    0x6900000000000000, 0x6e00000000000000, 0x6700000000000000, 0x6000000000000000,
+    0x7500000000000000, 0x7200000000000000, 0x7b00000000000000, 0x7c00000000000000,
+    0x5100000000000000, 0x5600000000000000, 0x5f00000000000000, 0x5800000000000000,
+    0x4d00000000000000, 0x4a00000000000000, 0x4300000000000000, 0x4400000000000000,
+    0x1900000000000000, 0x1e00000000000000, 0x1700000000000000, 0x1000000000000000,
+    0x500000000000000, 0x200000000000000, 0xb00000000000000, 0xc00000000000000,
+    0x2100000000000000, 0x2600000000000000, 0x2f00000000000000, 0x2800000000000000,
+    0x3d00000000000000, 0x3a00000000000000, 0x3300000000000000, 0x3400000000000000,
+    0x4e00000000000000, 0x4900000000000000, 0x4000000000000000, 0x4700000000000000,
+    0x5200000000000000, 0x5500000000000000, 0x5c00000000000000, 0x5b00000000000000,
+    0x7600000000000000, 0x7100000000000000, 0x7800000000000000, 0x7f00000000000000,
+    0x6a00000000000000, 0x6d00000000000000, 0x6400000000000000, 0x6300000000000000,
+    0x3e00000000000000, 0x3900000000000000, 0x3000000000000000, 0x3700000000000000,
+    0x2200000000000000, 0x2500000000000000, 0x2c00000000000000, 0x2b00000000000000,
+    0x600000000000000, 0x100000000000000, 0x800000000000000, 0xf00000000000000,
+    0x1a00000000000000, 0x1d00000000000000, 0x1400000000000000, 0x1300000000000000,
+    0xae00000000000000, 0xa900000000000000, 0xa000000000000000, 0xa700000000000000,
+    0xb200000000000000, 0xb500000000000000, 0xbc00000000000000, 0xbb00000000000000,
+    0x9600000000000000, 0x9100000000000000, 0x9800000000000000, 0x9f00000000000000,
+    0x8a00000000000000, 0x8d00000000000000, 0x8400000000000000, 0x8300000000000000,
+    0xde00000000000000, 0xd900000000000000, 0xd000000000000000, 0xd700000000000000,
+    0xc200000000000000, 0xc500000000000000, 0xcc00000000000000, 0xcb00000000000000,
+    0xe600000000000000, 0xe100000000000000, 0xe800000000000000, 0xef00000000000000,
+    0xfa00000000000000, 0xfd00000000000000, 0xf400000000000000, 0xf300000000000000,
+  },
+  {
+    0, 0x1500000000000000, 0x2a00000000000000, 0x3f00000000000000,
+    0x5400000000000000, 0x4100000000000000, 0x7e00000000000000, 0x6b00000000000000,
+    0xa800000000000000, 0xbd00000000000000, 0x8200000000000000, 0x9700000000000000,
+    0xfc00000000000000, 0xe900000000000000, 0xd600000000000000, 0xc300000000000000,
+    0x5700000000000000, 0x4200000000000000, 0x7d00000000000000, 0x6800000000000000,
+    0x300000000000000, 0x1600000000000000, 0x2900000000000000, 0x3c00000000000000,
+    0xff00000000000000, 0xea00000000000000, 0xd500000000000000, 0xc000000000000000,
+    0xab00000000000000, 0xbe00000000000000, 0x8100000000000000, 0x9400000000000000,
+    0xae00000000000000, 0xbb00000000000000, 0x8400000000000000, 0x9100000000000000,
+    0xfa00000000000000, 0xef00000000000000, 0xd000000000000000, 0xc500000000000000,
+    0x600000000000000, 0x1300000000000000, 0x2c00000000000000, 0x3900000000000000,
+    0x5200000000000000, 0x4700000000000000, 0x7800000000000000, 0x6d00000000000000,
+    0xf900000000000000, 0xec00000000000000, 0xd300000000000000, 0xc600000000000000,
+    0xad00000000000000, 0xb800000000000000, 0x8700000000000000, 0x9200000000000000,
+    0x5100000000000000, 0x4400000000000000, 0x7b00000000000000, 0x6e00000000000000,
+    0x500000000000000, 0x1000000000000000, 0x2f00000000000000, 0x3a00000000000000,
+    0x5b00000000000000, 0x4e00000000000000, 0x7100000000000000, 0x6400000000000000,
+    0xf00000000000000, 0x1a00000000000000, 0x2500000000000000, 0x3000000000000000,
+    0xf300000000000000, 0xe600000000000000, 0xd900000000000000, 0xcc00000000000000,
+    0xa700000000000000, 0xb200000000000000, 0x8d00000000000000, 0x9800000000000000,
+    0xc00000000000000, 0x1900000000000000, 0x2600000000000000, 0x3300000000000000,
+    0x5800000000000000, 0x4d00000000000000, 0x7200000000000000, 0x6700000000000000,
+    0xa400000000000000, 0xb100000000000000, 0x8e00000000000000, 0x9b00000000000000,
+    0xf000000000000000, 0xe500000000000000, 0xda00000000000000, 0xcf00000000000000,
+    0xf500000000000000, 0xe000000000000000, 0xdf00000000000000, 0xca00000000000000,
+    0xa100000000000000, 0xb400000000000000, 0x8b00000000000000, 0x9e00000000000000,
+    0x5d00000000000000, 0x4800000000000000, 0x7700000000000000, 0x6200000000000000,
+    0x900000000000000, 0x1c00000000000000, 0x2300000000000000, 0x3600000000000000,
+    0xa200000000000000, 0xb700000000000000, 0x8800000000000000, 0x9d00000000000000,
+    0xf600000000000000, 0xe300000000000000, 0xdc00000000000000, 0xc900000000000000,
+    0xa00000000000000, 0x1f00000000000000, 0x2000000000000000, 0x3500000000000000,
+    0x5e00000000000000, 0x4b00000000000000, 0x7400000000000000, 0x6100000000000000,
+    0xb600000000000000, 0xa300000000000000, 0x9c00000000000000, 0x8900000000000000,
+    0xe200000000000000, 0xf700000000000000, 0xc800000000000000, 0xdd00000000000000,
+    0x1e00000000000000, 0xb00000000000000, 0x3400000000000000, 0x2100000000000000,
+    0x4a00000000000000, 0x5f00000000000000, 0x6000000000000000, 0x7500000000000000,
+    0xe100000000000000, 0xf400000000000000, 0xcb00000000000000, 0xde00000000000000,
+    0xb500000000000000, 0xa000000000000000, 0x9f00000000000000, 0x8a00000000000000,
+    0x4900000000000000, 0x5c00000000000000, 0x6300000000000000, 0x7600000000000000,
+    0x1d00000000000000, 0x800000000000000, 0x3700000000000000, 0x2200000000000000,
+    0x1800000000000000, 0xd00000000000000, 0x3200000000000000, 0x2700000000000000,
+    0x4c00000000000000, 0x5900000000000000, 0x6600000000000000, 0x7300000000000000,
+    0xb000000000000000, 0xa500000000000000, 0x9a00000000000000, 0x8f00000000000000,
+    0xe400000000000000, 0xf100000000000000, 0xce00000000000000, 0xdb00000000000000,
+    0x4f00000000000000, 0x5a00000000000000, 0x6500000000000000, 0x7000000000000000,
+    0x1b00000000000000, 0xe00000000000000, 0x3100000000000000, 0x2400000000000000,
+    0xe700000000000000, 0xf200000000000000, 0xcd00000000000000, 0xd800000000000000,
+    0xb300000000000000, 0xa600000000000000, 0x9900000000000000, 0x8c00000000000000,
+    0xed00000000000000, 0xf800000000000000, 0xc700000000000000, 0xd200000000000000,
+    0xb900000000000000, 0xac00000000000000, 0x9300000000000000, 0x8600000000000000,
+    0x4500000000000000, 0x5000000000000000, 0x6f00000000000000, 0x7a00000000000000,
+    0x1100000000000000, 0x400000000000000, 0x3b00000000000000, 0x2e00000000000000,
+    0xba00000000000000, 0xaf00000000000000, 0x9000000000000000, 0x8500000000000000,
+    0xee00000000000000, 0xfb00000000000000, 0xc400000000000000, 0xd100000000000000,
+    0x1200000000000000, 0x700000000000000, 0x3800000000000000, 0x2d00000000000000,
+    0x4600000000000000, 0x5300000000000000, 0x6c00000000000000, 0x7900000000000000,
+    0x4300000000000000, 0x5600000000000000, 0x6900000000000000, 0x7c00000000000000,
+    0x1700000000000000, 0x200000000000000, 0x3d00000000000000, 0x2800000000000000,
+    0xeb00000000000000, 0xfe00000000000000, 0xc100000000000000, 0xd400000000000000,
+    0xbf00000000000000, 0xaa00000000000000, 0x9500000000000000, 0x8000000000000000,
+    0x1400000000000000, 0x100000000000000, 0x3e00000000000000, 0x2b00000000000000,
+    0x4000000000000000, 0x5500000000000000, 0x6a00000000000000, 0x7f00000000000000,
+    0xbc00000000000000, 0xa900000000000000, 0x9600000000000000, 0x8300000000000000,
+    0xe800000000000000, 0xfd00000000000000, 0xc200000000000000, 0xd700000000000000,
+  },
+  {
+    0, 0x6b00000000000000, 0xd600000000000000, 0xbd00000000000000,
+    0xab00000000000000, 0xc000000000000000, 0x7d00000000000000, 0x1600000000000000,
+    0x5100000000000000, 0x3a00000000000000, 0x8700000000000000, 0xec00000000000000,
+    0xfa00000000000000, 0x9100000000000000, 0x2c00000000000000, 0x4700000000000000,
+    0xa200000000000000, 0xc900000000000000, 0x7400000000000000, 0x1f00000000000000,
+    0x900000000000000, 0x6200000000000000, 0xdf00000000000000, 0xb400000000000000,
+    0xf300000000000000, 0x9800000000000000, 0x2500000000000000, 0x4e00000000000000,
+    0x5800000000000000, 0x3300000000000000, 0x8e00000000000000, 0xe500000000000000,
+    0x4300000000000000, 0x2800000000000000, 0x9500000000000000, 0xfe00000000000000,
+    0xe800000000000000, 0x8300000000000000, 0x3e00000000000000, 0x5500000000000000,
+    0x1200000000000000, 0x7900000000000000, 0xc400000000000000, 0xaf00000000000000,
+    0xb900000000000000, 0xd200000000000000, 0x6f00000000000000, 0x400000000000000,
+    0xe100000000000000, 0x8a00000000000000, 0x3700000000000000, 0x5c00000000000000,
+    0x4a00000000000000, 0x2100000000000000, 0x9c00000000000000, 0xf700000000000000,
+    0xb000000000000000, 0xdb00000000000000, 0x6600000000000000, 0xd00000000000000,
+    0x1b00000000000000, 0x7000000000000000, 0xcd00000000000000, 0xa600000000000000,
+    0x8600000000000000, 0xed00000000000000, 0x5000000000000000, 0x3b00000000000000,
+    0x2d00000000000000, 0x4600000000000000, 0xfb00000000000000, 0x9000000000000000,
+    0xd700000000000000, 0xbc00000000000000, 0x100000000000000, 0x6a00000000000000,
+    0x7c00000000000000, 0x1700000000000000, 0xaa00000000000000, 0xc100000000000000,
+    0x2400000000000000, 0x4f00000000000000, 0xf200000000000000, 0x9900000000000000,
+    0x8f00000000000000, 0xe400000000000000, 0x5900000000000000, 0x3200000000000000,
+    0x7500000000000000, 0x1e00000000000000, 0xa300000000000000, 0xc800000000000000,
+    0xde00000000000000, 0xb500000000000000, 0x800000000000000, 0x6300000000000000,
+    0xc500000000000000, 0xae00000000000000, 0x1300000000000000, 0x7800000000000000,
+    0x6e00000000000000, 0x500000000000000, 0xb800000000000000, 0xd300000000000000,
+    0x9400000000000000, 0xff00000000000000, 0x4200000000000000, 0x2900000000000000,
+    0x3f00000000000000, 0x5400000000000000, 0xe900000000000000, 0x8200000000000000,
+    0x6700000000000000, 0xc00000000000000, 0xb100000000000000, 0xda00000000000000,
+    0xcc00000000000000, 0xa700000000000000, 0x1a00000000000000, 0x7100000000000000,
+    0x3600000000000000, 0x5d00000000000000, 0xe000000000000000, 0x8b00000000000000,
+    0x9d00000000000000, 0xf600000000000000, 0x4b00000000000000, 0x2000000000000000,
+    0xb00000000000000, 0x6000000000000000, 0xdd00000000000000, 0xb600000000000000,
+    0xa000000000000000, 0xcb00000000000000, 0x7600000000000000, 0x1d00000000000000,
+    0x5a00000000000000, 0x3100000000000000, 0x8c00000000000000, 0xe700000000000000,
+    0xf100000000000000, 0x9a00000000000000, 0x2700000000000000, 0x4c00000000000000,
+    0xa900000000000000, 0xc200000000000000, 0x7f00000000000000, 0x1400000000000000,
+    0x200000000000000, 0x6900000000000000, 0xd400000000000000, 0xbf00000000000000,
+    0xf800000000000000, 0x9300000000000000, 0x2e00000000000000, 0x4500000000000000,
+    0x5300000000000000, 0x3800000000000000, 0x8500000000000000, 0xee00000000000000,
+    0x4800000000000000, 0x2300000000000000, 0x9e00000000000000, 0xf500000000000000,
+    0xe300000000000000, 0x8800000000000000, 0x3500000000000000, 0x5e00000000000000,
+    0x1900000000000000, 0x7200000000000000, 0xcf00000000000000, 0xa400000000000000,
+    0xb200000000000000, 0xd900000000000000, 0x6400000000000000, 0xf00000000000000,
+    0xea00000000000000, 0x8100000000000000, 0x3c00000000000000, 0x5700000000000000,
+    0x4100000000000000, 0x2a00000000000000, 0x9700000000000000, 0xfc00000000000000,
+    0xbb00000000000000, 0xd000000000000000, 0x6d00000000000000, 0x600000000000000,
+    0x1000000000000000, 0x7b00000000000000, 0xc600000000000000, 0xad00000000000000,
+    0x8d00000000000000, 0xe600000000000000, 0x5b00000000000000, 0x3000000000000000,
+    0x2600000000000000, 0x4d00000000000000, 0xf000000000000000, 0x9b00000000000000,
+    0xdc00000000000000, 0xb700000000000000, 0xa00000000000000, 0x6100000000000000,
+    0x7700000000000000, 0x1c00000000000000, 0xa100000000000000, 0xca00000000000000,
+    0x2f00000000000000, 0x4400000000000000, 0xf900000000000000, 0x9200000000000000,
+    0x8400000000000000, 0xef00000000000000, 0x5200000000000000, 0x3900000000000000,
+    0x7e00000000000000, 0x1500000000000000, 0xa800000000000000, 0xc300000000000000,
+    0xd500000000000000, 0xbe00000000000000, 0x300000000000000, 0x6800000000000000,
+    0xce00000000000000, 0xa500000000000000, 0x1800000000000000, 0x7300000000000000,
+    0x6500000000000000, 0xe00000000000000, 0xb300000000000000, 0xd800000000000000,
+    0x9f00000000000000, 0xf400000000000000, 0x4900000000000000, 0x2200000000000000,
+    0x3400000000000000, 0x5f00000000000000, 0xe200000000000000, 0x8900000000000000,
+    0x6c00000000000000, 0x700000000000000, 0xba00000000000000, 0xd100000000000000,
+    0xc700000000000000, 0xac00000000000000, 0x1100000000000000, 0x7a00000000000000,
+    0x3d00000000000000, 0x5600000000000000, 0xeb00000000000000, 0x8000000000000000,
+    0x9600000000000000, 0xfd00000000000000, 0x4000000000000000, 0x2b00000000000000,
+  },
+  {
+    0, 0x1600000000000000, 0x2c00000000000000, 0x3a00000000000000,
+    0x5800000000000000, 0x4e00000000000000, 0x7400000000000000, 0x6200000000000000,
+    0xb000000000000000, 0xa600000000000000, 0x9c00000000000000, 0x8a00000000000000,
+    0xe800000000000000, 0xfe00000000000000, 0xc400000000000000, 0xd200000000000000,
+    0x6700000000000000, 0x7100000000000000, 0x4b00000000000000, 0x5d00000000000000,
+    0x3f00000000000000, 0x2900000000000000, 0x1300000000000000, 0x500000000000000,
+    0xd700000000000000, 0xc100000000000000, 0xfb00000000000000, 0xed00000000000000,
+    0x8f00000000000000, 0x9900000000000000, 0xa300000000000000, 0xb500000000000000,
+    0xce00000000000000, 0xd800000000000000, 0xe200000000000000, 0xf400000000000000,
+    0x9600000000000000, 0x8000000000000000, 0xba00000000000000, 0xac00000000000000,
+    0x7e00000000000000, 0x6800000000000000, 0x5200000000000000, 0x4400000000000000,
+    0x2600000000000000, 0x3000000000000000, 0xa00000000000000, 0x1c00000000000000,
+    0xa900000000000000, 0xbf00000000000000, 0x8500000000000000, 0x9300000000000000,
+    0xf100000000000000, 0xe700000000000000, 0xdd00000000000000, 0xcb00000000000000,
+    0x1900000000000000, 0xf00000000000000, 0x3500000000000000, 0x2300000000000000,
+    0x4100000000000000, 0x5700000000000000, 0x6d00000000000000, 0x7b00000000000000,
+    0x9b00000000000000, 0x8d00000000000000, 0xb700000000000000, 0xa100000000000000,
+    0xc300000000000000, 0xd500000000000000, 0xef00000000000000, 0xf900000000000000,
+    0x2b00000000000000, 0x3d00000000000000, 0x700000000000000, 0x1100000000000000,
+    0x7300000000000000, 0x6500000000000000, 0x5f00000000000000, 0x4900000000000000,
+    0xfc00000000000000, 0xea00000000000000, 0xd000000000000000, 0xc600000000000000,
+    0xa400000000000000, 0xb200000000000000, 0x8800000000000000, 0x9e00000000000000,
+    0x4c00000000000000, 0x5a00000000000000, 0x6000000000000000, 0x7600000000000000,
+    0x1400000000000000, 0x200000000000000, 0x3800000000000000, 0x2e00000000000000,
+    0x5500000000000000, 0x4300000000000000, 0x7900000000000000, 0x6f00000000000000,
+    0xd00000000000000, 0x1b00000000000000, 0x2100000000000000, 0x3700000000000000,
+    0xe500000000000000, 0xf300000000000000, 0xc900000000000000, 0xdf00000000000000,
+    0xbd00000000000000, 0xab00000000000000, 0x9100000000000000, 0x8700000000000000,
+    0x3200000000000000, 0x2400000000000000, 0x1e00000000000000, 0x800000000000000,
+    0x6a00000000000000, 0x7c00000000000000, 0x4600000000000000, 0x5000000000000000,
+    0x8200000000000000, 0x9400000000000000, 0xae00000000000000, 0xb800000000000000,
+    0xda00000000000000, 0xcc00000000000000, 0xf600000000000000, 0xe000000000000000,
+    0x3100000000000000, 0x2700000000000000, 0x1d00000000000000, 0xb00000000000000,
+    0x6900000000000000, 0x7f00000000000000, 0x4500000000000000, 0x5300000000000000,
+    0x8100000000000000, 0x9700000000000000, 0xad00000000000000, 0xbb00000000000000,
+    0xd900000000000000, 0xcf00000000000000, 0xf500000000000000, 0xe300000000000000,
+    0x5600000000000000, 0x4000000000000000, 0x7a00000000000000, 0x6c00000000000000,
+    0xe00000000000000, 0x1800000000000000, 0x2200000000000000, 0x3400000000000000,
+    0xe600000000000000, 0xf000000000000000, 0xca00000000000000, 0xdc00000000000000,
+    0xbe00000000000000, 0xa800000000000000, 0x9200000000000000, 0x8400000000000000,
+    0xff00000000000000, 0xe900000000000000, 0xd300000000000000, 0xc500000000000000,
+    0xa700000000000000, 0xb100000000000000, 0x8b00000000000000, 0x9d00000000000000,
+    0x4f00000000000000, 0x5900000000000000, 0x6300000000000000, 0x7500000000000000,
+    0x1700000000000000, 0x100000000000000, 0x3b00000000000000, 0x2d00000000000000,
+    0x9800000000000000, 0x8e00000000000000, 0xb400000000000000, 0xa200000000000000,
+    0xc000000000000000, 0xd600000000000000, 0xec00000000000000, 0xfa00000000000000,
+    0x2800000000000000, 0x3e00000000000000, 0x400000000000000, 0x1200000000000000,
+    0x7000000000000000, 0x6600000000000000, 0x5c00000000000000, 0x4a00000000000000,
+    0xaa00000000000000, 0xbc00000000000000, 0x8600000000000000, 0x9000000000000000,
+    0xf200000000000000, 0xe400000000000000, 0xde00000000000000, 0xc800000000000000,
+    0x1a00000000000000, 0xc00000000000000, 0x3600000000000000, 0x2000000000000000,
+    0x4200000000000000, 0x5400000000000000, 0x6e00000000000000, 0x7800000000000000,
+    0xcd00000000000000, 0xdb00000000000000, 0xe100000000000000, 0xf700000000000000,
+    0x9500000000000000, 0x8300000000000000, 0xb900000000000000, 0xaf00000000000000,
+    0x7d00000000000000, 0x6b00000000000000, 0x5100000000000000, 0x4700000000000000,
+    0x2500000000000000, 0x3300000000000000, 0x900000000000000, 0x1f00000000000000,
+    0x6400000000000000, 0x7200000000000000, 0x4800000000000000, 0x5e00000000000000,
+    0x3c00000000000000, 0x2a00000000000000, 0x1000000000000000, 0x600000000000000,
+    0xd400000000000000, 0xc200000000000000, 0xf800000000000000, 0xee00000000000000,
+    0x8c00000000000000, 0x9a00000000000000, 0xa000000000000000, 0xb600000000000000,
+    0x300000000000000, 0x1500000000000000, 0x2f00000000000000, 0x3900000000000000,
+    0x5b00000000000000, 0x4d00000000000000, 0x7700000000000000, 0x6100000000000000,
+    0xb300000000000000, 0xa500000000000000, 0x9f00000000000000, 0x8900000000000000,
+    0xeb00000000000000, 0xfd00000000000000, 0xc700000000000000, 0xd100000000000000,
+  },
+  {
+    0, 0x6200000000000000, 0xc400000000000000, 0xa600000000000000,
+    0x8f00000000000000, 0xed00000000000000, 0x4b00000000000000, 0x2900000000000000,
+    0x1900000000000000, 0x7b00000000000000, 0xdd00000000000000, 0xbf00000000000000,
+    0x9600000000000000, 0xf400000000000000, 0x5200000000000000, 0x3000000000000000,
+    0x3200000000000000, 0x5000000000000000, 0xf600000000000000, 0x9400000000000000,
+    0xbd00000000000000, 0xdf00000000000000, 0x7900000000000000, 0x1b00000000000000,
+    0x2b00000000000000, 0x4900000000000000, 0xef00000000000000, 0x8d00000000000000,
+    0xa400000000000000, 0xc600000000000000, 0x6000000000000000, 0x200000000000000,
+    0x6400000000000000, 0x600000000000000, 0xa000000000000000, 0xc200000000000000,
+    0xeb00000000000000, 0x8900000000000000, 0x2f00000000000000, 0x4d00000000000000,
+    0x7d00000000000000, 0x1f00000000000000, 0xb900000000000000, 0xdb00000000000000,
+    0xf200000000000000, 0x9000000000000000, 0x3600000000000000, 0x5400000000000000,
+    0x5600000000000000, 0x3400000000000000, 0x9200000000000000, 0xf000000000000000,
+    0xd900000000000000, 0xbb00000000000000, 0x1d00000000000000, 0x7f00000000000000,
+    0x4f00000000000000, 0x2d00000000000000, 0x8b00000000000000, 0xe900000000000000,
+    0xc000000000000000, 0xa200000000000000, 0x400000000000000, 0x6600000000000000,
+    0xc800000000000000, 0xaa00000000000000, 0xc00000000000000, 0x6e00000000000000,
+    0x4700000000000000, 0x2500000000000000, 0x8300000000000000, 0xe100000000000000,
+    0xd100000000000000, 0xb300000000000000, 0x1500000000000000, 0x7700000000000000,
+    0x5e00000000000000, 0x3c00000000000000, 0x9a00000000000000, 0xf800000000000000,
+    0xfa00000000000000, 0x9800000000000000, 0x3e00000000000000, 0x5c00000000000000,
+    0x7500000000000000, 0x1700000000000000, 0xb100000000000000, 0xd300000000000000,
+    0xe300000000000000, 0x8100000000000000, 0x2700000000000000, 0x4500000000000000,
+    0x6c00000000000000, 0xe00000000000000, 0xa800000000000000, 0xca00000000000000,
+    0xac00000000000000, 0xce00000000000000, 0x6800000000000000, 0xa00000000000000,
+    0x2300000000000000, 0x4100000000000000, 0xe700000000000000, 0x8500000000000000,
+    0xb500000000000000, 0xd700000000000000, 0x7100000000000000, 0x1300000000000000,
+    0x3a00000000000000, 0x5800000000000000, 0xfe00000000000000, 0x9c00000000000000,
+    0x9e00000000000000, 0xfc00000000000000, 0x5a00000000000000, 0x3800000000000000,
+    0x1100000000000000, 0x7300000000000000, 0xd500000000000000, 0xb700000000000000,
+    0x8700000000000000, 0xe500000000000000, 0x4300000000000000, 0x2100000000000000,
+    0x800000000000000, 0x6a00000000000000, 0xcc00000000000000, 0xae00000000000000,
+    0x9700000000000000, 0xf500000000000000, 0x5300000000000000, 0x3100000000000000,
+    0x1800000000000000, 0x7a00000000000000, 0xdc00000000000000, 0xbe00000000000000,
+    0x8e00000000000000, 0xec00000000000000, 0x4a00000000000000, 0x2800000000000000,
+    0x100000000000000, 0x6300000000000000, 0xc500000000000000, 0xa700000000000000,
+    0xa500000000000000, 0xc700000000000000, 0x6100000000000000, 0x300000000000000,
+    0x2a00000000000000, 0x4800000000000000, 0xee00000000000000, 0x8c00000000000000,
+    0xbc00000000000000, 0xde00000000000000, 0x7800000000000000, 0x1a00000000000000,
+    0x3300000000000000, 0x5100000000000000, 0xf700000000000000, 0x9500000000000000,
+    0xf300000000000000, 0x9100000000000000, 0x3700000000000000, 0x5500000000000000,
+    0x7c00000000000000, 0x1e00000000000000, 0xb800000000000000, 0xda00000000000000,
+    0xea00000000000000, 0x8800000000000000, 0x2e00000000000000, 0x4c00000000000000,
+    0x6500000000000000, 0x700000000000000, 0xa100000000000000, 0xc300000000000000,
+    0xc100000000000000, 0xa300000000000000, 0x500000000000000, 0x6700000000000000,
+    0x4e00000000000000, 0x2c00000000000000, 0x8a00000000000000, 0xe800000000000000,
+    0xd800000000000000, 0xba00000000000000, 0x1c00000000000000, 0x7e00000000000000,
+    0x5700000000000000, 0x3500000000000000, 0x9300000000000000, 0xf100000000000000,
+    0x5f00000000000000, 0x3d00000000000000, 0x9b00000000000000, 0xf900000000000000,
+    0xd000000000000000, 0xb200000000000000, 0x1400000000000000, 0x7600000000000000,
+    0x4600000000000000, 0x2400000000000000, 0x8200000000000000, 0xe000000000000000,
+    0xc900000000000000, 0xab00000000000000, 0xd00000000000000, 0x6f00000000000000,
+    0x6d00000000000000, 0xf00000000000000, 0xa900000000000000, 0xcb00000000000000,
+    0xe200000000000000, 0x8000000000000000, 0x2600000000000000, 0x4400000000000000,
+    0x7400000000000000, 0x1600000000000000, 0xb000000000000000, 0xd200000000000000,
+    0xfb00000000000000, 0x9900000000000000, 0x3f00000000000000, 0x5d00000000000000,
+    0x3b00000000000000, 0x5900000000000000, 0xff00000000000000, 0x9d00000000000000,
+    0xb400000000000000, 0xd600000000000000, 0x7000000000000000, 0x1200000000000000,
+    0x2200000000000000, 0x4000000000000000, 0xe600000000000000, 0x8400000000000000,
+    0xad00000000000000, 0xcf00000000000000, 0x6900000000000000, 0xb00000000000000,
+    0x900000000000000, 0x6b00000000000000, 0xcd00000000000000, 0xaf00000000000000,
+    0x8600000000000000, 0xe400000000000000, 0x4200000000000000, 0x2000000000000000,
+    0x1000000000000000, 0x7200000000000000, 0xd400000000000000, 0xb600000000000000,
+    0x9f00000000000000, 0xfd00000000000000, 0x5b00000000000000, 0x3900000000000000,
+  },
+  {
+    0, 0x2900000000000000, 0x5200000000000000, 0x7b00000000000000,
+    0xa400000000000000, 0x8d00000000000000, 0xf600000000000000, 0xdf00000000000000,
+    0x4f00000000000000, 0x6600000000000000, 0x1d00000000000000, 0x3400000000000000,
+    0xeb00000000000000, 0xc200000000000000, 0xb900000000000000, 0x9000000000000000,
+    0x9e00000000000000, 0xb700000000000000, 0xcc00000000000000, 0xe500000000000000,
+    0x3a00000000000000, 0x1300000000000000, 0x6800000000000000, 0x4100000000000000,
+    0xd100000000000000, 0xf800000000000000, 0x8300000000000000, 0xaa00000000000000,
+    0x7500000000000000, 0x5c00000000000000, 0x2700000000000000, 0xe00000000000000,
+    0x3b00000000000000, 0x1200000000000000, 0x6900000000000000, 0x4000000000000000,
+    0x9f00000000000000, 0xb600000000000000, 0xcd00000000000000, 0xe400000000000000,
+    0x7400000000000000, 0x5d00000000000000, 0x2600000000000000, 0xf00000000000000,
+    0xd000000000000000, 0xf900000000000000, 0x8200000000000000, 0xab00000000000000,
+    0xa500000000000000, 0x8c00000000000000, 0xf700000000000000, 0xde00000000000000,
+    0x100000000000000, 0x2800000000000000, 0x5300000000000000, 0x7a00000000000000,
+    0xea00000000000000, 0xc300000000000000, 0xb800000000000000, 0x9100000000000000,
+    0x4e00000000000000, 0x6700000000000000, 0x1c00000000000000, 0x3500000000000000,
+    0x7600000000000000, 0x5f00000000000000, 0x2400000000000000, 0xd00000000000000,
+    0xd200000000000000, 0xfb00000000000000, 0x8000000000000000, 0xa900000000000000,
+    0x3900000000000000, 0x1000000000000000, 0x6b00000000000000, 0x4200000000000000,
+    0x9d00000000000000, 0xb400000000000000, 0xcf00000000000000, 0xe600000000000000,
+    0xe800000000000000, 0xc100000000000000, 0xba00000000000000, 0x9300000000000000,
+    0x4c00000000000000, 0x6500000000000000, 0x1e00000000000000, 0x3700000000000000,
+    0xa700000000000000, 0x8e00000000000000, 0xf500000000000000, 0xdc00000000000000,
+    0x300000000000000, 0x2a00000000000000, 0x5100000000000000, 0x7800000000000000,
+    0x4d00000000000000, 0x6400000000000000, 0x1f00000000000000, 0x3600000000000000,
+    0xe900000000000000, 0xc000000000000000, 0xbb00000000000000, 0x9200000000000000,
+    0x200000000000000, 0x2b00000000000000, 0x5000000000000000, 0x7900000000000000,
+    0xa600000000000000, 0x8f00000000000000, 0xf400000000000000, 0xdd00000000000000,
+    0xd300000000000000, 0xfa00000000000000, 0x8100000000000000, 0xa800000000000000,
+    0x7700000000000000, 0x5e00000000000000, 0x2500000000000000, 0xc00000000000000,
+    0x9c00000000000000, 0xb500000000000000, 0xce00000000000000, 0xe700000000000000,
+    0x3800000000000000, 0x1100000000000000, 0x6a00000000000000, 0x4300000000000000,
+    0xec00000000000000, 0xc500000000000000, 0xbe00000000000000, 0x9700000000000000,
+    0x4800000000000000, 0x6100000000000000, 0x1a00000000000000, 0x3300000000000000,
+    0xa300000000000000, 0x8a00000000000000, 0xf100000000000000, 0xd800000000000000,
+    0x700000000000000, 0x2e00000000000000, 0x5500000000000000, 0x7c00000000000000,
+    0x7200000000000000, 0x5b00000000000000, 0x2000000000000000, 0x900000000000000,
+    0xd600000000000000, 0xff00000000000000, 0x8400000000000000, 0xad00000000000000,
+    0x3d00000000000000, 0x1400000000000000, 0x6f00000000000000, 0x4600000000000000,
+    0x9900000000000000, 0xb000000000000000, 0xcb00000000000000, 0xe200000000000000,
+    0xd700000000000000, 0xfe00000000000000, 0x8500000000000000, 0xac00000000000000,
+    0x7300000000000000, 0x5a00000000000000, 0x2100000000000000, 0x800000000000000,
+    0x9800000000000000, 0xb100000000000000, 0xca00000000000000, 0xe300000000000000,
+    0x3c00000000000000, 0x1500000000000000, 0x6e00000000000000, 0x4700000000000000,
+    0x4900000000000000, 0x6000000000000000, 0x1b00000000000000, 0x3200000000000000,
+    0xed00000000000000, 0xc400000000000000, 0xbf00000000000000, 0x9600000000000000,
+    0x600000000000000, 0x2f00000000000000, 0x5400000000000000, 0x7d00000000000000,
+    0xa200000000000000, 0x8b00000000000000, 0xf000000000000000, 0xd900000000000000,
+    0x9a00000000000000, 0xb300000000000000, 0xc800000000000000, 0xe100000000000000,
+    0x3e00000000000000, 0x1700000000000000, 0x6c00000000000000, 0x4500000000000000,
+    0xd500000000000000, 0xfc00000000000000, 0x8700000000000000, 0xae00000000000000,
+    0x7100000000000000, 0x5800000000000000, 0x2300000000000000, 0xa00000000000000,
+    0x400000000000000, 0x2d00000000000000, 0x5600000000000000, 0x7f00000000000000,
+    0xa000000000000000, 0x8900000000000000, 0xf200000000000000, 0xdb00000000000000,
+    0x4b00000000000000, 0x6200000000000000, 0x1900000000000000, 0x3000000000000000,
+    0xef00000000000000, 0xc600000000000000, 0xbd00000000000000, 0x9400000000000000,
+    0xa100000000000000, 0x8800000000000000, 0xf300000000000000, 0xda00000000000000,
+    0x500000000000000, 0x2c00000000000000, 0x5700000000000000, 0x7e00000000000000,
+    0xee00000000000000, 0xc700000000000000, 0xbc00000000000000, 0x9500000000000000,
+    0x4a00000000000000, 0x6300000000000000, 0x1800000000000000, 0x3100000000000000,
+    0x3f00000000000000, 0x1600000000000000, 0x6d00000000000000, 0x4400000000000000,
+    0x9b00000000000000, 0xb200000000000000, 0xc900000000000000, 0xe000000000000000,
+    0x7000000000000000, 0x5900000000000000, 0x2200000000000000, 0xb00000000000000,
+    0xd400000000000000, 0xfd00000000000000, 0x8600000000000000, 0xaf00000000000000,
+  },
+  {
+    0, 0xdf00000000000000, 0xb900000000000000, 0x6600000000000000,
+    0x7500000000000000, 0xaa00000000000000, 0xcc00000000000000, 0x1300000000000000,
+    0xea00000000000000, 0x3500000000000000, 0x5300000000000000, 0x8c00000000000000,
+    0x9f00000000000000, 0x4000000000000000, 0x2600000000000000, 0xf900000000000000,
+    0xd300000000000000, 0xc00000000000000, 0x6a00000000000000, 0xb500000000000000,
+    0xa600000000000000, 0x7900000000000000, 0x1f00000000000000, 0xc000000000000000,
+    0x3900000000000000, 0xe600000000000000, 0x8000000000000000, 0x5f00000000000000,
+    0x4c00000000000000, 0x9300000000000000, 0xf500000000000000, 0x2a00000000000000,
+    0xa100000000000000, 0x7e00000000000000, 0x1800000000000000, 0xc700000000000000,
+    0xd400000000000000, 0xb00000000000000, 0x6d00000000000000, 0xb200000000000000,
+    0x4b00000000000000, 0x9400000000000000, 0xf200000000000000, 0x2d00000000000000,
+    0x3e00000000000000, 0xe100000000000000, 0x8700000000000000, 0x5800000000000000,
+    0x7200000000000000, 0xad00000000000000, 0xcb00000000000000, 0x1400000000000000,
+    0x700000000000000, 0xd800000000000000, 0xbe00000000000000, 0x6100000000000000,
+    0x9800000000000000, 0x4700000000000000, 0x2100000000000000, 0xfe00000000000000,
+    0xed00000000000000, 0x3200000000000000, 0x5400000000000000, 0x8b00000000000000,
+    0x4500000000000000, 0x9a00000000000000, 0xfc00000000000000, 0x2300000000000000,
+    0x3000000000000000, 0xef00000000000000, 0x8900000000000000, 0x5600000000000000,
+    0xaf00000000000000, 0x7000000000000000, 0x1600000000000000, 0xc900000000000000,
+    0xda00000000000000, 0x500000000000000, 0x6300000000000000, 0xbc00000000000000,
+    0x9600000000000000, 0x4900000000000000, 0x2f00000000000000, 0xf000000000000000,
+    0xe300000000000000, 0x3c00000000000000, 0x5a00000000000000, 0x8500000000000000,
+    0x7c00000000000000, 0xa300000000000000, 0xc500000000000000, 0x1a00000000000000,
+    0x900000000000000, 0xd600000000000000, 0xb000000000000000, 0x6f00000000000000,
+    0xe400000000000000, 0x3b00000000000000, 0x5d00000000000000, 0x8200000000000000,
+    0x9100000000000000, 0x4e00000000000000, 0x2800000000000000, 0xf700000000000000,
+    0xe00000000000000, 0xd100000000000000, 0xb700000000000000, 0x6800000000000000,
+    0x7b00000000000000, 0xa400000000000000, 0xc200000000000000, 0x1d00000000000000,
+    0x3700000000000000, 0xe800000000000000, 0x8e00000000000000, 0x5100000000000000,
+    0x4200000000000000, 0x9d00000000000000, 0xfb00000000000000, 0x2400000000000000,
+    0xdd00000000000000, 0x200000000000000, 0x6400000000000000, 0xbb00000000000000,
+    0xa800000000000000, 0x7700000000000000, 0x1100000000000000, 0xce00000000000000,
+    0x8a00000000000000, 0x5500000000000000, 0x3300000000000000, 0xec00000000000000,
+    0xff00000000000000, 0x2000000000000000, 0x4600000000000000, 0x9900000000000000,
+    0x6000000000000000, 0xbf00000000000000, 0xd900000000000000, 0x600000000000000,
+    0x1500000000000000, 0xca00000000000000, 0xac00000000000000, 0x7300000000000000,
+    0x5900000000000000, 0x8600000000000000, 0xe000000000000000, 0x3f00000000000000,
+    0x2c00000000000000, 0xf300000000000000, 0x9500000000000000, 0x4a00000000000000,
+    0xb300000000000000, 0x6c00000000000000, 0xa00000000000000, 0xd500000000000000,
+    0xc600000000000000, 0x1900000000000000, 0x7f00000000000000, 0xa000000000000000,
+    0x2b00000000000000, 0xf400000000000000, 0x9200000000000000, 0x4d00000000000000,
+    0x5e00000000000000, 0x8100000000000000, 0xe700000000000000, 0x3800000000000000,
+    0xc100000000000000, 0x1e00000000000000, 0x7800000000000000, 0xa700000000000000,
+    0xb400000000000000, 0x6b00000000000000, 0xd00000000000000, 0xd200000000000000,
+    0xf800000000000000, 0x2700000000000000, 0x4100000000000000, 0x9e00000000000000,
+    0x8d00000000000000, 0x5200000000000000, 0x3400000000000000, 0xeb00000000000000,
+    0x1200000000000000, 0xcd00000000000000, 0xab00000000000000, 0x7400000000000000,
+    0x6700000000000000, 0xb800000000000000, 0xde00000000000000, 0x100000000000000,
+    0xcf00000000000000, 0x1000000000000000, 0x7600000000000000, 0xa900000000000000,
+    0xba00000000000000, 0x6500000000000000, 0x300000000000000, 0xdc00000000000000,
+    0x2500000000000000, 0xfa00000000000000, 0x9c00000000000000, 0x4300000000000000,
+    0x5000000000000000, 0x8f00000000000000, 0xe900000000000000, 0x3600000000000000,
+    0x1c00000000000000, 0xc300000000000000, 0xa500000000000000, 0x7a00000000000000,
+    0x6900000000000000, 0xb600000000000000, 0xd000000000000000, 0xf00000000000000,
+    0xf600000000000000, 0x2900000000000000, 0x4f00000000000000, 0x9000000000000000,
+    0x8300000000000000, 0x5c00000000000000, 0x3a00000000000000, 0xe500000000000000,
+    0x6e00000000000000, 0xb100000000000000, 0xd700000000000000, 0x800000000000000,
+    0x1b00000000000000, 0xc400000000000000, 0xa200000000000000, 0x7d00000000000000,
+    0x8400000000000000, 0x5b00000000000000, 0x3d00000000000000, 0xe200000000000000,
+    0xf100000000000000, 0x2e00000000000000, 0x4800000000000000, 0x9700000000000000,
+    0xbd00000000000000, 0x6200000000000000, 0x400000000000000, 0xdb00000000000000,
+    0xc800000000000000, 0x1700000000000000, 0x7100000000000000, 0xae00000000000000,
+    0x5700000000000000, 0x8800000000000000, 0xee00000000000000, 0x3100000000000000,
+    0x2200000000000000, 0xfd00000000000000, 0x9b00000000000000, 0x4400000000000000,
+  },
+  {
+    0, 0x1300000000000000, 0x2600000000000000, 0x3500000000000000,
+    0x4c00000000000000, 0x5f00000000000000, 0x6a00000000000000, 0x7900000000000000,
+    0x9800000000000000, 0x8b00000000000000, 0xbe00000000000000, 0xad00000000000000,
+    0xd400000000000000, 0xc700000000000000, 0xf200000000000000, 0xe100000000000000,
+    0x3700000000000000, 0x2400000000000000, 0x1100000000000000, 0x200000000000000,
+    0x7b00000000000000, 0x6800000000000000, 0x5d00000000000000, 0x4e00000000000000,
+    0xaf00000000000000, 0xbc00000000000000, 0x8900000000000000, 0x9a00000000000000,
+    0xe300000000000000, 0xf000000000000000, 0xc500000000000000, 0xd600000000000000,
+    0x6e00000000000000, 0x7d00000000000000, 0x4800000000000000, 0x5b00000000000000,
+    0x2200000000000000, 0x3100000000000000, 0x400000000000000, 0x1700000000000000,
+    0xf600000000000000, 0xe500000000000000, 0xd000000000000000, 0xc300000000000000,
+    0xba00000000000000, 0xa900000000000000, 0x9c00000000000000, 0x8f00000000000000,
+    0x5900000000000000, 0x4a00000000000000, 0x7f00000000000000, 0x6c00000000000000,
+    0x1500000000000000, 0x600000000000000, 0x3300000000000000, 0x2000000000000000,
+    0xc100000000000000, 0xd200000000000000, 0xe700000000000000, 0xf400000000000000,
+    0x8d00000000000000, 0x9e00000000000000, 0xab00000000000000, 0xb800000000000000,
+    0xdc00000000000000, 0xcf00000000000000, 0xfa00000000000000, 0xe900000000000000,
+    0x9000000000000000, 0x8300000000000000, 0xb600000000000000, 0xa500000000000000,
+    0x4400000000000000, 0x5700000000000000, 0x6200000000000000, 0x7100000000000000,
+    0x800000000000000, 0x1b00000000000000, 0x2e00000000000000, 0x3d00000000000000,
+    0xeb00000000000000, 0xf800000000000000, 0xcd00000000000000, 0xde00000000000000,
+    0xa700000000000000, 0xb400000000000000, 0x8100000000000000, 0x9200000000000000,
+    0x7300000000000000, 0x6000000000000000, 0x5500000000000000, 0x4600000000000000,
+    0x3f00000000000000, 0x2c00000000000000, 0x1900000000000000, 0xa00000000000000,
+    0xb200000000000000, 0xa100000000000000, 0x9400000000000000, 0x8700000000000000,
+    0xfe00000000000000, 0xed00000000000000, 0xd800000000000000, 0xcb00000000000000,
+    0x2a00000000000000, 0x3900000000000000, 0xc00000000000000, 0x1f00000000000000,
+    0x6600000000000000, 0x7500000000000000, 0x4000000000000000, 0x5300000000000000,
+    0x8500000000000000, 0x9600000000000000, 0xa300000000000000, 0xb000000000000000,
+    0xc900000000000000, 0xda00000000000000, 0xef00000000000000, 0xfc00000000000000,
+    0x1d00000000000000, 0xe00000000000000, 0x3b00000000000000, 0x2800000000000000,
+    0x5100000000000000, 0x4200000000000000, 0x7700000000000000, 0x6400000000000000,
+    0xbf00000000000000, 0xac00000000000000, 0x9900000000000000, 0x8a00000000000000,
+    0xf300000000000000, 0xe000000000000000, 0xd500000000000000, 0xc600000000000000,
+    0x2700000000000000, 0x3400000000000000, 0x100000000000000, 0x1200000000000000,
+    0x6b00000000000000, 0x7800000000000000, 0x4d00000000000000, 0x5e00000000000000,
+    0x8800000000000000, 0x9b00000000000000, 0xae00000000000000, 0xbd00000000000000,
+    0xc400000000000000, 0xd700000000000000, 0xe200000000000000, 0xf100000000000000,
+    0x1000000000000000, 0x300000000000000, 0x3600000000000000, 0x2500000000000000,
+    0x5c00000000000000, 0x4f00000000000000, 0x7a00000000000000, 0x6900000000000000,
+    0xd100000000000000, 0xc200000000000000, 0xf700000000000000, 0xe400000000000000,
+    0x9d00000000000000, 0x8e00000000000000, 0xbb00000000000000, 0xa800000000000000,
+    0x4900000000000000, 0x5a00000000000000, 0x6f00000000000000, 0x7c00000000000000,
+    0x500000000000000, 0x1600000000000000, 0x2300000000000000, 0x3000000000000000,
+    0xe600000000000000, 0xf500000000000000, 0xc000000000000000, 0xd300000000000000,
+    0xaa00000000000000, 0xb900000000000000, 0x8c00000000000000, 0x9f00000000000000,
+    0x7e00000000000000, 0x6d00000000000000, 0x5800000000000000, 0x4b00000000000000,
+    0x3200000000000000, 0x2100000000000000, 0x1400000000000000, 0x700000000000000,
+    0x6300000000000000, 0x7000000000000000, 0x4500000000000000, 0x5600000000000000,
+    0x2f00000000000000, 0x3c00000000000000, 0x900000000000000, 0x1a00000000000000,
+    0xfb00000000000000, 0xe800000000000000, 0xdd00000000000000, 0xce00000000000000,
+    0xb700000000000000, 0xa400000000000000, 0x9100000000000000, 0x8200000000000000,
+    0x5400000000000000, 0x4700000000000000, 0x7200000000000000, 0x6100000000000000,
+    0x1800000000000000, 0xb00000000000000, 0x3e00000000000000, 0x2d00000000000000,
+    0xcc00000000000000, 0xdf00000000000000, 0xea00000000000000, 0xf900000000000000,
+    0x8000000000000000, 0x9300000000000000, 0xa600000000000000, 0xb500000000000000,
+    0xd00000000000000, 0x1e00000000000000, 0x2b00000000000000, 0x3800000000000000,
+    0x4100000000000000, 0x5200000000000000, 0x6700000000000000, 0x7400000000000000,
+    0x9500000000000000, 0x8600000000000000, 0xb300000000000000, 0xa000000000000000,
+    0xd900000000000000, 0xca00000000000000, 0xff00000000000000, 0xec00000000000000,
+    0x3a00000000000000, 0x2900000000000000, 0x1c00000000000000, 0xf00000000000000,
+    0x7600000000000000, 0x6500000000000000, 0x5000000000000000, 0x4300000000000000,
+    0xa200000000000000, 0xb100000000000000, 0x8400000000000000, 0x9700000000000000,
+    0xee00000000000000, 0xfd00000000000000, 0xc800000000000000, 0xdb00000000000000,
+  },
+};
+static const CrcFold crc_cat_f2 = {
+    8, 0, 0x700000000000000,
+    { 0x6b00000000000000, 0x8c00000000000000 }, { 0x7000000000000000, 0xc100000000000000 }, { 0xe00000000000000, 0x7900000000000000 },
+    0x7900000000000000, 0x7156a166329dd13
+};
+
+/* CRC-8/MAXIM-DOW */
+static const uint64_t crc_cat_t3[8][256] = {
+  {
+    0, 0x5e, 0xbc, 0xe2,
+    0x61, 0x3f, 0xdd, 0x83,
+    0xc2, 0x9c, 0x7e, 0x20,
+    0xa3, 0xfd, 0x1f, 0x41,
+    0x9d, 0xc3, 0x21, 0x7f,
+    0xfc, 0xa2, 0x40, 0x1e,
+    0x5f, 0x1, 0xe3, 0xbd,
+    0x3e, 0x60, 0x82, 0xdc,
+    0x23, 0x7d, 0x9f, 0xc1,
+    0x42, 0x1c, 0xfe, 0xa0,
+    0xe1, 0xbf, 0x5d, 0x3,
+    0x80, 0xde, 0x3c, 0x62,
+    0xbe, 0xe0, 0x2, 0x5c,
+    0xdf, 0x81, 0x63, 0x3d,
+    0x7c, 0x22, 0xc0, 0x9e,
+    0x1d, 0x43, 0xa1, 0xff,
+    0x46, 0x18, 0xfa, 0xa4,
+    0x27, 0x79, 0x9b, 0xc5,
+    0x84, 0xda, 0x38, 0x66,
+    0xe5, 0xbb, 0x59, 0x7,
+    0xdb, 0x85, 0x67, 0x39,
+    0xba, 0xe4, 0x6, 0x58,
+    0x19, 0x47, 0xa5, 0xfb,
+    0x78, 0x26, 0xc4, 0x9a,
+    0x65, 0x3b, 0xd9, 0x87,
+    0x4, 0x5a, 0xb8, 0xe6,
+    0xa7, 0xf9, 0x1b, 0x45,
+    0xc6, 0x98, 0x7a, 0x24,
+    0xf8, 0xa6, 0x44, 0x1a,
+    0x99, 0xc7, 0x25, 0x7b,
+    0x3a, 0x64, 0x86, 0xd8,
+    0x5b, 0x5, 0xe7, 0xb9,
+    0x8c, 0xd2, 0x30, 0x6e,
+    0xed, 0xb3, 0x51, 0xf,
+    0x4e, 0x10, 0xf2, 0xac,
+    0x2f, 0x71, 0x93, 0xcd,
+    0x11, 0x4f, 0xad, 0xf3,
+    0x70, 0x2e, 0xcc, 0x92,
+    0xd3, 0x8d, 0x6f, 0x31,
+    0xb2, 0xec, 0xe, 0x50,
+    0xaf, 0xf1, 0x13, 0x4d,
+    0xce, 0x90, 0x72, 0x2c,
+    0x6d, 0x33, 0xd1, 0x8f,
+    0xc, 0x52, 0xb0, 0xee,
+    0x32, 0x6c, 0x8e, 0xd0,
+    0x53, 0xd, 0xef, 0xb1,
+    0xf0, 0xae, 0x4c, 0x12,
+    0x91, 0xcf, 0x2d, 0x73,
+    0xca, 0x94, 0x76, 0x28,
+    0xab, 0xf5, 0x17, 0x49,
+    0x8, 0x56, 0xb4, 0xea,
+    0x69, 0x37, 0xd5, 0x8b,
+    0x57, 0x9, 0xeb, 0xb5,
+    0x36, 0x68, 0x8a, 0xd4,
+    0x95, 0xcb, 0x29, 0x77,
+    0xf4, 0xaa, 0x48, 0x16,
+    0xe9, 0xb7, 0x55, 0xb,
+    0x88, 0xd6, 0x34, 0x6a,
+    0x2b, 0x75, 0x97, 0xc9,
+    0x4a, 0x14, 0xf6, 0xa8,
+    0x74, 0x2a, 0xc8, 0x96,
+    0x15, 0x4b, 0xa9, 0xf7,
+    0xb6, 0xe8, 0xa, 0x54,
+    0xd7, 0x89, 0x6b, 0x35,
+  },
+  {
+    0, 0xc4, 0x91, 0x55,
+    0x3b, 0xff, 0xaa, 0x6e,
+    0x76, 0xb2, 0xe7, 0x23,
+    0x4d, 0x89, 0xdc, 0x18,
+    0xec, 0x28, 0x7d, 0xb9,
+    0xd7, 0x13, 0x46, 0x82,
+    0x9a, 0x5e, 0xb, 0xcf,
+    0xa1, 0x65, 0x30, 0xf4,
+    0xc1, 0x5, 0x50, 0x94,
+    0xfa, 0x3e, 0x6b, 0xaf,
+    0xb7, 0x73, 0x26, 0xe2,
+    0x8c, 0x48, 0x1d, 0xd9,
+    0x2d, 0xe9, 0xbc, 0x78,
+    0x16, 0xd2, 0x87, 0x43,
+    0x5b, 0x9f, 0xca, 0xe,
+    0x60, 0xa4, 0xf1, 0x35,
+    0x9b, 0x5f, 0xa, 0xce,
+    0xa0, 0x64, 0x31, 0xf5,
+    0xed, 0x29, 0x7c, 0xb8,
+    0xd6, 0x12, 0x47, 0x83,
+    0x77, 0xb3, 0xe6, 0x22,
+    0x4c, 0x88, 0xdd, 0x19,
+    0x1, 0xc5, 0x90, 0x54,
+    0x3a, 0xfe, 0xab, 0x6f,
+    0x5a, 0x9e, 0xcb, 0xf,
+    0x61, 0xa5, 0xf0, 0x34,
+    0x2c, 0xe8, 0xbd, 0x79,
+    0x17, 0xd3, 0x86, 0x42,
+    0xb6, 0x72, 0x27, 0xe3,
+    0x8d, 0x49, 0x1c, 0xd8,
+    0xc0, 0x4, 0x51, 0x95,
+    0xfb, 0x3f, 0x6a, 0xae,
+    0x2f, 0xeb, 0xbe, 0x7a,
+    0x14, 0xd0, 0x85, 0x41,
+    0x59, 0x9d, 0xc8, 0xc,
+    0x62, 0xa6, 0xf3, 0x37,
+    0xc3, 0x7, 0x52, 0x96,
+    0xf8, 0x3c, 0x69, 0xad,
+    0xb5, 0x71, 0x24, 0xe0,
+    0x8e, 0x4a, 0x1f, 0xdb,
+    0xee, 0x2a, 0x7f, 0xbb,
+    0xd5, 0x11, 0x44, 0x80,
+    0x98, 0x5c, 0x9, 0xcd,
+    0xa3, 0x67, 0x32, 0xf6,
+    0x2, 0xc6, 0x93, 0x57,
+    0x39, 0xfd, 0xa8, 0x6c,
+    0x74, 0xb0, 0xe5, 0x21,
+    0x4f, 0x8b, 0xde, 0x1a,
+    0xb4, 0x70, 0x25, 0xe1,
+    0x8f, 0x4b, 0x1e, 0xda,
+    0xc2, 0x6, 0x53, 0x97,
+    0xf9, 0x3d, 0x68, 0xac,
+    0x58, 0x9c, 0xc9, 0xd,
+    0x63, 0xa7, 0xf2, 0x36,
+    0x2e, 0xea, 0xbf, 0x7b,
+    0x15, 0xd1, 0x84, 0x40,
+    0x75, 0xb1, 0xe4, 0x20,
+    0x4e, 0x8a, 0xdf, 0x1b,
+    0x3, 0xc7, 0x92, 0x56,
+    0x38, 0xfc, 0xa9, 0x6d,
+    0x99, 0x5d, 0x8, 0xcc,
+    0xa2, 0x66, 0x33, 0xf7,
+    0xef, 0x2b, 0x7e, 0xba,
+    0xd4, 0x10, 0x45, 0x81,
+  },
+  {
+    0, 0xab, 0x4f, 0xe4,
+    0x9e, 0x35, 0xd1, 0x7a,
+    0x25, 0x8e, 0x6a, 0xc1,
+    0xbb, 0x10, 0xf4, 0x5f,
+    0x4a, 0xe1, 0x5, 0xae,
+    0xd4, 0x7f, 0x9b, 0x30,
+    0x6f, 0xc4, 0x20, 0x8b,
+    0xf1, 0x5a, 0xbe, 0x15,
+    0x94, 0x3f, 0xdb, 0x70,
+    0xa, 0xa1, 0x45, 0xee,
+    0xb1, 0x1a, 0xfe, 0x55,
+    0x2f, 0x84, 0x60, 0xcb,
+    0xde, 0x75, 0x91, 0x3a,
+    0x40, 0xeb, 0xf, 0xa4,
+    0xfb, 0x50, 0xb4, 0x1f,
+    0x65, 0xce, 0x2a, 0x81,
+    0x31, 0x9a, 0x7e, 0xd5,
+    0xaf, 0x4, 0xe0, 0x4b,
+    0x14, 0xbf, 0x5b, 0xf0,
+    0x8a, 0x21, 0xc5, 0x6e,
+    0x7b, 0xd0, 0x34, 0x9f,
+    0xe5, 0x4e, 0xaa, 0x1,
+    0x5e, 0xf5, 0x11, 0xba,
+    0xc0, 0x6b, 0x8f, 0x24,
+    0xa5, 0xe, 0xea, 0x41,
+    0x3b, 0x90, 0x74, 0xdf,
+    0x80, 0x2b, 0xcf, 0x64,
+    0x1e, 0xb5, 0x51, 0xfa,
+    0xef, 0x44, 0xa0, 0xb,
+    0x71, 0xda, 0x3e, 0x95,
+    0xca, 0x61, 0x85, 0x2e,
+    0x54, 0xff, 0x1b, 0xb0,
+    0x62, 0xc9, 0x2d, 0x86,
+    0xfc, 0x57, 0xb3, 0x18,
+    0x47, 0xec, 0x8, 0xa3,
+    0xd9, 0x72, 0x96, 0x3d,
+    0x28, 0x83, 0x67, 0xcc,
+    0xb6, 0x1d, 0xf9, 0x52,
+    0xd, 0xa6, 0x42, 0xe9,
+    0x93, 0x38, 0xdc, 0x77,
+    0xf6, 0x5d, 0xb9, 0x12,
+    0x68, 0xc3, 0x27, 0x8c,
+    0xd3, 0x78, 0x9c, 0x37,
+    0x4d, 0xe6, 0x2, 0xa9,
+    0xbc, 0x17, 0xf3, 0x58,
+    0x22, 0x89, 0x6d, 0xc6,
+    0x99, 0x32, 0xd6, 0x7d,
+    0x7, 0xac, 0x48, 0xe3,
+    0x53, 0xf8, 0x1c, 0xb7,
+    0xcd, 0x66, 0x82, 0x29,
+    0x76, 0xdd, 0x39, 0x92,
+    0xe8, 0x43, 0xa7, 0xc,
+    0x19, 0xb2, 0x56, 0xfd,
+    0x87, 0x2c, 0xc8, 0x63,
+    0x3c, 0x97, 0x73, 0xd8,
+    0xa2, 0x9, 0xed, 0x46,
+    0xc7, 0x6c, 0x88, 0x23,
+    0x59, 0xf2, 0x16, 0xbd,
+    0xe2, 0x49, 0xad, 0x6,
+    0x7c, 0xd7, 0x33, 0x98,
+    0x8d, 0x26, 0xc2, 0x69,
+    0x13, 0xb8, 0x5c, 0xf7,
+    0xa8, 0x3, 0xe7, 0x4c,
+    0x36, 0x9d, 0x79, 0xd2,
+  },
+  {
+    0, 0x8f, 0x7, 0x88,
+    0xe, 0x81, 0x9, 0x86,
+    0x1c, 0x93, 0x1b, 0x94,
+    0x12, 0x9d, 0x15, 0x9a,
+    0x38, 0xb7, 0x3f, 0xb0,
+    0x36, 0xb9, 0x31, 0xbe,
+    0x24, 0xab, 0x23, 0xac,
+    0x2a, 0xa5, 0x2d, 0xa2,
+    0x70, 0xff, 0x77, 0xf8,
+    0x7e, 0xf1, 0x79, 0xf6,
+    0x6c, 0xe3, 0x6b, 0xe4,
+    0x62, 0xed, 0x65, 0xea,
+    0x48, 0xc7, 0x4f, 0xc0,
+    0x46, 0xc9, 0x41, 0xce,
+    0x54, 0xdb, 0x53, 0xdc,
+    0x5a, 0xd5, 0x5d, 0xd2,
+    0xe0, 0x6f, 0xe7, 0x68,
+    0xee, 0x61, 0xe9, 0x66,
+    0xfc, 0x73, 0xfb, 0x74,
+    0xf2, 0x7d, 0xf5, 0x7a,
+    0xd8, 0x57, 0xdf, 0x50,
+    0xd6, 0x59, 0xd1, 0x5e,
+    0xc4, 0x4b, 0xc3, 0x4c,
+    0xca, 0x45, 0xcd, 0x42,
+    0x90, 0x1f, 0x97, 0x18,
+    0x9e, 0x11, 0x99, 0x16,
+    0x8c, 0x3, 0x8b, 0x4,
+    0x82, 0xd, 0x85, 0xa,
+    0xa8, 0x27, 0xaf, 0x20,
+    0xa6, 0x29, 0xa1, 0x2e,
+    0xb4, 0x3b, 0xb3, 0x3c,
+    0xba, 0x35, 0xbd, 0x32,
+    0xd9, 0x56, 0xde, 0x51,
+    0xd7, 0x58, 0xd0, 0x5f,
+    0xc5, 0x4a, 0xc2, 0x4d,
+    0xcb, 0x44, 0xcc, 0x43,
+    0xe1, 0x6e, 0xe6, 0x69,
+    0xef, 0x60, 0xe8, 0x67,
+    0xfd, 0x72, 0xfa, 0x75,
+    0xf3, 0x7c, 0xf4, 0x7b,
+    0xa9, 0x26, 0xae, 0x21,
+    0xa7, 0x28, 0xa0, 0x2f,
+    0xb5, 0x3a, 0xb2, 0x3d,
+    0xbb, 0x34, 0xbc, 0x33,
+    0x91, 0x1e, 0x96, 0x19,
+    0x9f, 0x10, 0x98, 0x17,
+    0x8d, 0x2, 0x8a, 0x5,
+    0x83, 0xc, 0x84, 0xb,
+    0x39, 0xb6, 0x3e, 0xb1,
+    0x37, 0xb8, 0x30, 0xbf,
+    0x25, 0xaa, 0x22, 0xad,
+    0x2b, 0xa4, 0x2c, 0xa3,
+    0x1, 0x8e, 0x6, 0x89,
+    0xf, 0x80, 0x8, 0x87,
+    0x1d, 0x92, 0x1a, 0x95,
+    0x13, 0x9c, 0x14, 0x9b,
+    0x49, 0xc6, 0x4e, 0xc1,
+    0x47, 0xc8, 0x40, 0xcf,
+    0x55, 0xda, 0x52, 0xdd,
+    0x5b, 0xd4, 0x5c, 0xd3,
+    0x71, 0xfe, 0x76, 0xf9,
+    0x7f, 0xf0, 0x78, 0xf7,
+    0x6d, 0xe2, 0x6a, 0xe5,
+    0x63, 0xec, 0x64, 0xeb,
+  },
+  {
+    0, 0xcd, 0x83, 0x4e,
+    0x1f, 0xd2, 0x9c, 0x51,
+    0x3e, 0xf3, 0xbd, 0x70,
+    0x21, 0xec, 0xa2, 0x6f,
+    0x7c, 0xb1, 0xff, 0x32,
+    0x63, 0xae, 0xe0, 0x2d,
+    0x42, 0x8f, 0xc1, 0xc,
+    0x5d, 0x90, 0xde, 0x13,
+    0xf8, 0x35, 0x7b, 0xb6,
+    0xe7, 0x2a, 0x64, 0xa9,
+    0xc6, 0xb, 0x45, 0x88,
+    0xd9, 0x14, 0x5a, 0x97,
+    0x84, 0x49, 0x7, 0xca,
+    0x9b, 0x56, 0x18, 0xd5,
+    0xba, 0x77, 0x39, 0xf4,
+    0xa5, 0x68, 0x26, 0xeb,
+    0xe9, 0x24, 0x6a, 0xa7,
+    0xf6, 0x3b, 0x75, 0xb8,
+    0xd7, 0x1a, 0x54, 0x99,
+    0xc8, 0x5, 0x4b, 0x86,
+    0x95, 0x58, 0x16, 0xdb,
+    0x8a, 0x47, 0x9, 0xc4,
+    0xab, 0x66, 0x28, 0xe5,
+    0xb4, 0x79, 0x37, 0xfa,
+    0x11, 0xdc, 0x92, 0x5f,
+    0xe, 0xc3, 0x8d, 0x40,
+    0x2f, 0xe2, 0xac, 0x61,
+    0x30, 0xfd, 0xb3, 0x7e,
+    0x6d, 0xa0, 0xee, 0x23,
+    0x72, 0xbf, 0xf1, 0x3c,
+    0x53, 0x9e, 0xd0, 0x1d,
+    0x4c, 0x81, 0xcf, 0x2,
+    0xcb, 0x6, 0x48, 0x85,
+    0xd4, 0x19, 0x57, 0x9a,
+    0xf5, 0x38, 0x76, 0xbb,
+    0xea, 0x27, 0x69, 0xa4,
+    0xb7, 0x7a, 0x34, 0xf9,
+    0xa8, 0x65, 0x2b, 0xe6,
+    0x89, 0x44, 0xa, 0xc7,
+    0x96, 0x5b, 0x15, 0xd8,
+    0x33, 0xfe, 0xb0, 0x7d,
+    0x2c, 0xe1, 0xaf, 0x62,
+    0xd, 0xc0, 0x8e, 0x43,
+    0x12, 0xdf, 0x91, 0x5c,
+    0x4f, 0x82, 0xcc, 0x1,
+    0x50, 0x9d, 0xd3, 0x1e,
+    0x71, 0xbc, 0xf2, 0x3f,
+    0x6e, 0xa3, 0xed, 0x20,
+    0x22, 0xef, 0xa1, 0x6c,
+    0x3d, 0xf0, 0xbe, 0x73,
+    0x1c, 0xd1, 0x9f, 0x52,
+    0x3, 0xce, 0x80, 0x4d,
+    0x5e, 0x93, 0xdd, 0x10,
+    0x41, 0x8c, 0xc2, 0xf,
+    0x60, 0xad, 0xe3, 0x2e,
+    0x7f, 0xb2, 0xfc, 0x31,
+    0xda, 0x17, 0x59, 0x94,
+    0xc5, 0x8, 0x46, 0x8b,
+    0xe4, 0x29, 0x67, 0xaa,
+    0xfb, 0x36, 0x78, 0xb5,
+    0xa6, 0x6b, 0x25, 0xe8,
+    0xb9, 0x74, 0x3a, 0xf7,
+    0x98, 0x55, 0x1b, 0xd6,
+    0x87, 0x4a, 0x4, 0xc9,
+  },
+  {
+    0, 0x37, 0x6e, 0x59,
+    0xdc, 0xeb, 0xb2, 0x85,
+    0xa1, 0x96, 0xcf, 0xf8,
+    0x7d, 0x4a, 0x13, 0x24,
+    0x5b, 0x6c, 0x35, 0x2,
+    0x87, 0xb0, 0xe9, 0xde,
+    0xfa, 0xcd, 0x94, 0xa3,
+    0x26, 0x11, 0x48, 0x7f,
+    0xb6, 0x81, 0xd8, 0xef,
+    0x6a, 0x5d, 0x4, 0x33,
+    0x17, 0x20, 0x79, 0x4e,
+    0xcb, 0xfc, 0xa5, 0x92,
+    0xed, 0xda, 0x83, 0xb4,
+    0x31, 0x6, 0x5f, 0x68,
+    0x4c, 0x7b, 0x22, 0x15,
+    0x90, 0xa7, 0xfe, 0xc9,
+    0x75, 0x42, 0x1b, 0x2c,
+    0xa9, 0x9e, 0xc7, 0xf0,
+    0xd4, 0xe3, 0xba, 0x8d,
+    0x8, 0x3f, 0x66, 0x51,
+    0x2e, 0x19, 0x40, 0x77,
+    0xf2, 0xc5, 0x9c, 0xab,
+    0x8f, 0xb8, 0xe1, 0xd6,
+    0x53, 0x64, 0x3d, 0xa,
+    0xc3, 0xf4, 0xad, 0x9a,
+    0x1f, 0x28, 0x71, 0x46,
+    0x62, 0x55, 0xc, 0x3b,
+    0xbe, 0x89, 0xd0, 0xe7,
+    0x98, 0xaf, 0xf6, 0xc1,
+    0x44, 0x73, 0x2a, 0x1d,
+    0x39, 0xe, 0x57, 0x60,
+    0xe5, 0xd2, 0x8b, 0xbc,
+    0xea, 0xdd, 0x84, 0xb3,
+    0x36, 0x1, 0x58, 0x6f,
+    0x4b, 0x7c, 0x25, 0x12,
+    0x97, 0xa0, 0xf9, 0xce,
+    0xb1, 0x86, 0xdf, 0xe8,
+    0x6d, 0x5a, 0x3, 0x34,
+    0x10, 0x27, 0x7e, 0x49,
+    0xcc, 0xfb, 0xa2, 0x95,
+    0x5c, 0x6b, 0x32, 0x5,
+    0x80, 0xb7, 0xee, 0xd9,
+    0xfd, 0xca, 0x93, 0xa4,
+    0x21, 0x16, 0x4f, 0x78,
+    0x7, 0x30, 0x69, 0x5e,
+    0xdb, 0xec, 0xb5, 0x82,
+    0xa6, 0x91, 0xc8, 0xff,
+    0x7a, 0x4d, 0x14, 0x23,
+    0x9f, 0xa8, 0xf1, 0xc6,
+    0x43, 0x74, 0x2d, 0x1a,
+    0x3e, 0x9, 0x50, 0x67,
+    0xe2, 0xd5, 0x8c, 0xbb,
+    0xc4, 0xf3, 0xaa, 0x9d,
+    0x18, 0x2f, 0x76, 0x41,
+    0x65, 0x52, 0xb, 0x3c,
+    0xb9, 0x8e, 0xd7, 0xe0,
+    0x29, 0x1e, 0x47, 0x70,
+    0xf5, 0xc2, 0x9b, 0xac,
+    0x88, 0xbf, 0xe6, 0xd1,
+    0x54, 0x63, 0x3a, 0xd,
+    0x72, 0x45, 0x1c, 0x2b,
+    0xae, 0x99, 0xc0, 0xf7,
+    0xd3, 0xe4, 0xbd, 0x8a,
+    0xf, 0x38, 0x61, 0x56,
+  },
+  {
+    0, 0x3d, 0x7a, 0x47,
+    0xf4, 0xc9, 0x8e, 0xb3,
+    0xf1, 0xcc, 0x8b, 0xb6,
+    0x5, 0x38, 0x7f, 0x42,
+    0xfb, 0xc6, 0x81, 0xbc,
+    0xf, 0x32, 0x75, 0x48,
+    0xa, 0x37, 0x70, 0x4d,
+    0xfe, 0xc3, 0x84, 0xb9,
+    0xef, 0xd2, 0x95, 0xa8,
+    0x1b, 0x26, 0x61, 0x5c,
+    0x1e, 0x23, 0x64, 0x59,
+    0xea, 0xd7, 0x90, 0xad,
+    0x14, 0x29, 0x6e, 0x53,
+    0xe0, 0xdd, 0x9a, 0xa7,
+    0xe5, 0xd8, 0x9f, 0xa2,
+    0x11, 0x2c, 0x6b, 0x56,
+    0xc7, 0xfa, 0xbd, 0x80,
+    0x33, 0xe, 0x49, 0x74,
+    0x36, 0xb, 0x4c, 0x71,
+    0xc2, 0xff, 0xb8, 0x85,
+    0x3c, 0x1, 0x46, 0x7b,
+    0xc8, 0xf5, 0xb2, 0x8f,
+    0xcd, 0xf0, 0xb7, 0x8a,
+    0x39, 0x4, 0x43, 0x7e,
+    0x28, 0x15, 0x52, 0x6f,
+    0xdc, 0xe1, 0xa6, 0x9b,
+    0xd9, 0xe4, 0xa3, 0x9e,
+    0x2d, 0x10, 0x57, 0x6a,
+    0xd3, 0xee, 0xa9, 0x94,
+    0x27, 0x1a, 0x5d, 0x60,
+    0x22, 0x1f, 0x58, 0x65,
+    0xd6, 0xeb, 0xac, 0x91,
+    0x97, 0xaa, 0xed, 0xd0,
+    0x63, 0x5e, 0x19, 0x24,
+    0x66, 0x5b, 0x1c, 0x21,
+    0x92, 0xaf, 0xe8, 0xd5,
+    0x6c, 0x51, 0x16, 0x2b,
+    0x98, 0xa5, 0xe2, 0xdf,
+    0x9d, 0xa0, 0xe7, 0xda,
+    0x69, 0x54, 0x13, 0x2e,
+    0x78, 0x45, 0x2, 0x3f,
+    0x8c, 0xb1, 0xf6, 0xcb,
+    0x89, 0xb4, 0xf3, 0xce,
+    0x7d, 0x40, 0x7, 0x3a,
+    0x83, 0xbe, 0xf9, 0xc4,
+    0x77, 0x4a, 0xd, 0x30,
+    0x72, 0x4f, 0x8, 0x35,
+    0x86, 0xbb, 0xfc, 0xc1,
+    0x50, 0x6d, 0x2a, 0x17,
+    0xa4, 0x99, 0xde, 0xe3,
+    0xa1, 0x9c, 0xdb, 0xe6,
+    0x55, 0x68, 0x2f, 0x12,
+    0xab, 0x96, 0xd1, 0xec,
+    0x5f, 0x62, 0x25, 0x18,
+    0x5a, 0x67, 0x20, 0x1d,
+    0xae, 0x93, 0xd4, 0xe9,
+    0xbf, 0x82, 0xc5, 0xf8,
+    0x4b, 0x76, 0x31, 0xc,
+    0x4e, 0x73, 0x34, 0x9,
+    0xba, 0x87, 0xc0, 0xfd,
+    0x44, 0x79, 0x3e, 0x3,
+    0xb0, 0x8d, 0xca, 0xf7,
+    0xb5, 0x88, 0xcf, 0xf2,
+    0x41, 0x7c, 0x3b, 0x6,
+  },
+  {
+    0, 0x43, 0x86, 0xc5,
+    0x15, 0x56, 0x93, 0xd0,
+    0x2a, 0x69, 0xac, 0xef,
+    0x3f, 0x7c, 0xb9, 0xfa,
+    0x54, 0x17, 0xd2, 0x91,
+    0x41, 0x2, 0xc7, 0x84,
+    0x7e, 0x3d, 0xf8, 0xbb,
+    0x6b, 0x28, 0xed, 0xae,
+    0xa8, 0xeb, 0x2e, 0x6d,
+    0xbd, 0xfe, 0x3b, 0x78,
+    0x82, 0xc1, 0x4, 0x47,
+    0x97, 0xd4, 0x11, 0x52,
+    0xfc, 0xbf, 0x7a, 0x39,
+    0xe9, 0xaa, 0x6f, 0x2c,
+    0xd6, 0x95, 0x50, 0x13,
+    0xc3, 0x80, 0x45, 0x6,
+    0x49, 0xa, 0xcf, 0x8c,
+    0x5c, 0x1f, 0xda, 0x99,
+    0x63, 0x20, 0xe5, 0xa6,
+    0x76, 0x35, 0xf0, 0xb3,
+    0x1d, 0x5e, 0x9b, 0xd8,
+    0x8, 0x4b, 0x8e, 0xcd,
+    0x37, 0x74, 0xb1, 0xf2,
+    0x22, 0x61, 0xa4, 0xe7,
+    0xe1, 0xa2, 0x67, 0x24,
+    0xf4, 0xb7, 0x72, 0x31,
+    0xcb, 0x88, 0x4d, 0xe,
+    0xde, 0x9d, 0x58, 0x1b,
+    0xb5, 0xf6, 0x33, 0x70,
+    0xa0, 0xe3, 0x26, 0x65,
+    0x9f, 0xdc, 0x19, 0x5a,
+    0x8a, 0xc9, 0xc, 0x4f,
+    0x92, 0xd1, 0x14, 0x57,
+    0x87, 0xc4, 0x1, 0x42,
+    0xb8, 0xfb, 0x3e, 0x7d,
+    0xad, 0xee, 0x2b, 0x68,
+    0xc6, 0x85, 0x40, 0x3,
+    0xd3, 0x90, 0x55, 0x16,
+    0xec, 0xaf, 0x6a, 0x29,
+    0xf9, 0xba, 0x7f, 0x3c,
+    0x3a, 0x79, 0xbc, 0xff,
+    0x2f, 0x6c, 0xa9, 0xea,
+    0x10, 0x53, 0x96, 0xd5,
+    0x5, 0x46, 0x83, 0xc0,
+    0x6e, 0x2d, 0xe8, 0xab,
+    0x7b, 0x38, 0xfd, 0xbe,
+    0x44, 0x7, 0xc2, 0x81,
+    0x51, 0x12, 0xd7, 0x94,
+    0xdb, 0x98, 0x5d, 0x1e,
+    0xce, 0x8d, 0x48, 0xb,
+    0xf1, 0xb2, 0x77, 0x34,
+    0xe4, 0xa7, 0x62, 0x21,
+    0x8f, 0xcc, 0x9, 0x4a,
+    0x9a, 0xd9, 0x1c, 0x5f,
+    0xa5, 0xe6, 0x23, 0x60,
+    0xb0, 0xf3, 0x36, 0x75,
+    0x73, 0x30, 0xf5, 0xb6,
+    0x66, 0x25, 0xe0, 0xa3,
+    0x59, 0x1a, 0xdf, 0x9c,
+    0x4c, 0xf, 0xca, 0x89,
+    0x27, 0x64, 0xa1, 0xe2,
+    0x32, 0x71, 0xb4, 0xf7,
+    0xd, 0x4e, 0x8b, 0xc8,
+    0x18, 0x5b, 0x9e, 0xdd,
+  },
+};
+static const CrcFold crc_cat_f3 = {
+    8, 1, 0x8c,
+    { 0x85, 0xc4 }, { 0x6d, 0x9d }, { 0x43, 0x8c },
+    0x43, 0xa29f9ae3c1d2672c
+};
+
+/* CRC-12/UMTS */
+static const uint64_t crc_cat_t4[8][256] = {
+  {
+    0, 0x80f0000000000000, 0x8110000000000000, 0x1e0000000000000,
+    0x82d0000000000000, 0x220000000000000, 0x3c0000000000000, 0x8330000000000000,
+    0x8550000000000000, 0x5a0000000000000, 0x440000000000000, 0x84b0000000000000,
+    0x780000000000000, 0x8770000000000000, 0x8690000000000000, 0x660000000000000,
+    0x8a50000000000000, 0xaa0000000000000, 0xb40000000000000, 0x8bb0000000000000,
+    0x880000000000000, 0x8870000000000000, 0x8990000000000000, 0x960000000000000,
+    0xf00000000000000, 0x8ff0000000000000, 0x8e10000000000000, 0xee0000000000000,
+    0x8dd0000000000000, 0xd20000000000000, 0xcc0000000000000, 0x8c30000000000000,
+    0x9450000000000000, 0x14a0000000000000, 0x1540000000000000, 0x95b0000000000000,
+    0x1680000000000000, 0x9670000000000000, 0x9790000000000000, 0x1760000000000000,
+    0x1100000000000000, 0x91f0000000000000, 0x9010000000000000, 0x10e0000000000000,
+    0x93d0000000000000, 0x1320000000000000, 0x12c0000000000000, 0x9230000000000000,
+    0x1e00000000000000, 0x9ef0000000000000, 0x9f10000000000000, 0x1fe0000000000000,
+    0x9cd0000000000000, 0x1c20000000000000, 0x1dc0000000000000, 0x9d30000000000000,
+    0x9b50000000000000, 0x1ba0000000000000, 0x1a40000000000000, 0x9ab0000000000000,
+    0x1980000000000000, 0x9970000000000000, 0x9890000000000000, 0x1860000000000000,
+    0xa850000000000000, 0x28a0000000000000, 0x2940000000000000, 0xa9b0000000000000,
+    0x2a80000000000000, 0xaa70000000000000, 0xab90000000000000, 0x2b60000000000000,
+    0x2d00000000000000, 0xadf0000000000000, 0xac10000000000000, 0x2ce0000000000000,
+    0xafd0000000000000, 0x2f20000000000000, 0x2ec0000000000000, 0xae30000000000000,
+    0x2200000000000000, 0xa2f0000000000000, 0xa310000000000000, 0x23e0000000000000,
+    0xa0d0000000000000, 0x2020000000000000, 0x21c0000000000000, 0xa130000000000000,
+    0xa750000000000000, 0x27a0000000000000, 0x2640000000000000, 0xa6b0000000000000,
+    0x2580000000000000, 0xa570000000000000, 0xa490000000000000, 0x2460000000000000,
+    0x3c00000000000000, 0xbcf0000000000000, 0xbd10000000000000, 0x3de0000000000000,
+    0xbed0000000000000, 0x3e20000000000000, 0x3fc0000000000000, 0xbf30000000000000,
+    0xb950000000000000, 0x39a0000000000000, 0x3840000000000000, 0xb8b0000000000000,
+    0x3b80000000000000, 0xbb70000000000000, 0xba90000000000000, 0x3a60000000000000,
+    0xb650000000000000, 0x36a0000000000000, 0x3740000000000000, 0xb7b0000000000000,
+    0x3480000000000000, 0xb470000000000000, 0xb590000000000000, 0x3560000000000000,
+    0x3300000000000000, 0xb3f0000000000000, 0xb210000000000000, 0x32e0000000000000,
+    0xb1d0000000000000, 0x3120000000000000, 0x30c0000000000000, 0xb030000000000000,
+    0xd050000000000000, 0x50a0000000000000, 0x5140000000000000, 0xd1b0000000000000,
+    0x5280000000000000, 0xd270000000000000, 0xd390000000000000, 0x5360000000000000,
+    0x5500000000000000, 0xd5f0000000000000, 0xd410000000000000, 0x54e0000000000000,
+    0xd7d0000000000000, 0x5720000000000000, 0x56c0000000000000, 0xd630000000000000,
+    0x5a00000000000000, 0xdaf0000000000000, 0xdb10000000000000, 0x5be0000000000000,
+    0xd8d0000000000000, 0x5820000000000000, 0x59c0000000000000, 0xd930000000000000,
+    0xdf50000000000000, 0x5fa0000000000000, 0x5e40000000000000, 0xdeb0000000000000,
+    0x5d80000000000000, 0xdd70000000000000, 0xdc90000000000000, 0x5c60000000000000,
+    0x4400000000000000, 0xc4f0000000000000, 0xc510000000000000, 0x45e0000000000000,
+    0xc6d0000000000000, 0x4620000000000000, 0x47c0000000000000, 0xc730000000000000,
+    0xc150000000000000, 0x41a0000000000000, 0x4040000000000000, 0xc0b0000000000000,
+    0x4380000000000000, 0xc370000000000000, 0xc290000000000000, 0x4260000000000000,
+    0xce50000000000000, 0x4ea0000000000000, 0x4f40000000000000, 0xcfb0000000000000,
+    0x4c80000000000000, 0xcc70000000000000, 0xcd90000000000000, 0x4d60000000000000,
+    0x4b00000000000000, 0xcbf0000000000000, 0xca10000000000000, 0x4ae0000000000000,
+    0xc9d0000000000000, 0x4920000000000000, 0x48c0000000000000, 0xc830000000000000,
+    0x7800000000000000, 0xf8f0000000000000, 0xf910000000000000, 0x79e0000000000000,
+    0xfad0000000000000, 0x7a20000000000000, 0x7bc0000000000000, 0xfb30000000000000,
+    0xfd50000000000000, 0x7da0000000000000, 0x7c40000000000000, 0xfcb0000000000000,
+    0x7f80000000000000, 0xff70000000000000, 0xfe90000000000000, 0x7e60000000000000,
+    0xf250000000000000, 0x72a0000000000000, 0x7340000000000000, 0xf3b0000000000000,
+    0x7080000000000000, 0xf070000000000000, 0xf190000000000000, 0x7160000000000000,
+    0x7700000000000000, 0xf7f0000000000000, 0xf610000000000000, 0x76e0000000000000,
+    0xf5d0000000000000, 0x7520000000000000, 0x74c0000000000000, 0xf430000000000000,
+    0xec50000000000000, 0x6ca0000000000000, 0x6d40000000000000, 0xedb0000000000000,
+    0x6e80000000000000, 0xee70000000000000, 0xef90000000000000, 0x6f60000000000000,
+    0x6900000000000000, 0xe9f0000000000000, 0xe810000000000000, 0x68e0000000000000,
+    0xebd0000000000000, 0x6b20000000000000, 0x6ac0000000000000, 0xea30000000000000,
+    0x6600000000000000, 0xe6f0000000000000, 0xe710000000000000, 0x67e0000000000000,
+    0xe4d0000000000000, 0x6420000000000000, 0x65c0000000000000, 0xe530000000000000,
+    0xe350000000000000, 0x63a0000000000000, 0x6240000000000000, 0xe2b0000000000000,
+    0x6180000000000000, 0xe170000000000000, 0xe090000000000000, 0x6060000000000000,
+  },
+  {
+    0, 0x2050000000000000, 0x40a0000000000000, 0x60f0000000000000,
+    0x8140000000000000, 0xa110000000000000, 0xc1e0000000000000, 0xe1b0000000000000,
+    0x8270000000000000, 0xa220000000000000, 0xc2d0000000000000, 0xe280000000000000,
+    0x330000000000000, 0x2360000000000000, 0x4390000000000000, 0x63c0000000000000,
+    0x8410000000000000, 0xa440000000000000, 0xc4b0000000000000, 0xe4e0000000000000,
+    0x550000000000000, 0x2500000000000000, 0x45f0000000000000, 0x65a0000000000000,
+    0x660000000000000, 0x2630000000000000, 0x46c0000000000000, 0x6690000000000000,
+    0x8720000000000000, 0xa770000000000000, 0xc780000000000000, 0xe7d0000000000000,
+    0x88d0000000000000, 0xa880000000000000, 0xc870000000000000, 0xe820000000000000,
+    0x990000000000000, 0x29c0000000000000, 0x4930000000000000, 0x6960000000000000,
+    0xaa0000000000000, 0x2af0000000000000, 0x4a00000000000000, 0x6a50000000000000,
+    0x8be0000000000000, 0xabb0000000000000, 0xcb40000000000000, 0xeb10000000000000,
+    0xcc0000000000000, 0x2c90000000000000, 0x4c60000000000000, 0x6c30000000000000,
+    0x8d80000000000000, 0xadd0000000000000, 0xcd20000000000000, 0xed70000000000000,
+    0x8eb0000000000000, 0xaee0000000000000, 0xce10000000000000, 0xee40000000000000,
+    0xff0000000000000, 0x2fa0000000000000, 0x4f50000000000000, 0x6f00000000000000,
+    0x9150000000000000, 0xb100000000000000, 0xd1f0000000000000, 0xf1a0000000000000,
+    0x1010000000000000, 0x3040000000000000, 0x50b0000000000000, 0x70e0000000000000,
+    0x1320000000000000, 0x3370000000000000, 0x5380000000000000, 0x73d0000000000000,
+    0x9260000000000000, 0xb230000000000000, 0xd2c0000000000000, 0xf290000000000000,
+    0x1540000000000000, 0x3510000000000000, 0x55e0000000000000, 0x75b0000000000000,
+    0x9400000000000000, 0xb450000000000000, 0xd4a0000000000000, 0xf4f0000000000000,
+    0x9730000000000000, 0xb760000000000000, 0xd790000000000000, 0xf7c0000000000000,
+    0x1670000000000000, 0x3620000000000000, 0x56d0000000000000, 0x7680000000000000,
+    0x1980000000000000, 0x39d0000000000000, 0x5920000000000000, 0x7970000000000000,
+    0x98c0000000000000, 0xb890000000000000, 0xd860000000000000, 0xf830000000000000,
+    0x9bf0000000000000, 0xbba0000000000000, 0xdb50000000000000, 0xfb00000000000000,
+    0x1ab0000000000000, 0x3ae0000000000000, 0x5a10000000000000, 0x7a40000000000000,
+    0x9d90000000000000, 0xbdc0000000000000, 0xdd30000000000000, 0xfd60000000000000,
+    0x1cd0000000000000, 0x3c80000000000000, 0x5c70000000000000, 0x7c20000000000000,
+    0x1fe0000000000000, 0x3fb0000000000000, 0x5f40000000000000, 0x7f10000000000000,
+    0x9ea0000000000000, 0xbef0000000000000, 0xde00000000000000, 0xfe50000000000000,
+    0xa250000000000000, 0x8200000000000000, 0xe2f0000000000000, 0xc2a0000000000000,
+    0x2310000000000000, 0x340000000000000, 0x63b0000000000000, 0x43e0000000000000,
+    0x2020000000000000, 0x70000000000000, 0x6080000000000000, 0x40d0000000000000,
+    0xa160000000000000, 0x8130000000000000, 0xe1c0000000000000, 0xc190000000000000,
+    0x2640000000000000, 0x610000000000000, 0x66e0000000000000, 0x46b0000000000000,
+    0xa700000000000000, 0x8750000000000000, 0xe7a0000000000000, 0xc7f0000000000000,
+    0xa430000000000000, 0x8460000000000000, 0xe490000000000000, 0xc4c0000000000000,
+    0x2570000000000000, 0x520000000000000, 0x65d0000000000000, 0x4580000000000000,
+    0x2a80000000000000, 0xad0000000000000, 0x6a20000000000000, 0x4a70000000000000,
+    0xabc0000000000000, 0x8b90000000000000, 0xeb60000000000000, 0xcb30000000000000,
+    0xa8f0000000000000, 0x88a0000000000000, 0xe850000000000000, 0xc800000000000000,
+    0x29b0000000000000, 0x9e0000000000000, 0x6910000000000000, 0x4940000000000000,
+    0xae90000000000000, 0x8ec0000000000000, 0xee30000000000000, 0xce60000000000000,
+    0x2fd0000000000000, 0xf80000000000000, 0x6f70000000000000, 0x4f20000000000000,
+    0x2ce0000000000000, 0xcb0000000000000, 0x6c40000000000000, 0x4c10000000000000,
+    0xada0000000000000, 0x8df0000000000000, 0xed00000000000000, 0xcd50000000000000,
+    0x3300000000000000, 0x1350000000000000, 0x73a0000000000000, 0x53f0000000000000,
+    0xb240000000000000, 0x9210000000000000, 0xf2e0000000000000, 0xd2b0000000000000,
+    0xb170000000000000, 0x9120000000000000, 0xf1d0000000000000, 0xd180000000000000,
+    0x3030000000000000, 0x1060000000000000, 0x7090000000000000, 0x50c0000000000000,
+    0xb710000000000000, 0x9740000000000000, 0xf7b0000000000000, 0xd7e0000000000000,
+    0x3650000000000000, 0x1600000000000000, 0x76f0000000000000, 0x56a0000000000000,
+    0x3560000000000000, 0x1530000000000000, 0x75c0000000000000, 0x5590000000000000,
+    0xb420000000000000, 0x9470000000000000, 0xf480000000000000, 0xd4d0000000000000,
+    0xbbd0000000000000, 0x9b80000000000000, 0xfb70000000000000, 0xdb20000000000000,
+    0x3a90000000000000, 0x1ac0000000000000, 0x7a30000000000000, 0x5a60000000000000,
+    0x39a0000000000000, 0x19f0000000000000, 0x7900000000000000, 0x5950000000000000,
+    0xb8e0000000000000, 0x98b0000000000000, 0xf840000000000000, 0xd810000000000000,
+    0x3fc0000000000000, 0x1f90000000000000, 0x7f60000000000000, 0x5f30000000000000,
+    0xbe80000000000000, 0x9ed0000000000000, 0xfe20000000000000, 0xde70000000000000,
+    0xbdb0000000000000, 0x9de0000000000000, 0xfd10000000000000, 0xdd40000000000000,
+    0x3cf0000000000000, 0x1ca0000000000000, 0x7c50000000000000, 0x5c00000000000000,
+  },
+  {
+    0, 0xc450000000000000, 0x850000000000000, 0xcc00000000000000,
+    0x10a0000000000000, 0xd4f0000000000000, 0x18f0000000000000, 0xdca0000000000000,
+    0x2140000000000000, 0xe510000000000000, 0x2910000000000000, 0xed40000000000000,
+    0x31e0000000000000, 0xf5b0000000000000, 0x39b0000000000000, 0xfde0000000000000,
+    0x4280000000000000, 0x86d0000000000000, 0x4ad0000000000000, 0x8e80000000000000,
+    0x5220000000000000, 0x9670000000000000, 0x5a70000000000000, 0x9e20000000000000,
+    0x63c0000000000000, 0xa790000000000000, 0x6b90000000000000, 0xafc0000000000000,
+    0x7360000000000000, 0xb730000000000000, 0x7b30000000000000, 0xbf60000000000000,
+    0x8500000000000000, 0x4150000000000000, 0x8d50000000000000, 0x4900000000000000,
+    0x95a0000000000000, 0x51f0000000000000, 0x9df0000000000000, 0x59a0000000000000,
+    0xa440000000000000, 0x6010000000000000, 0xac10000000000000, 0x6840000000000000,
+    0xb4e0000000000000, 0x70b0000000000000, 0xbcb0000000000000, 0x78e0000000000000,
+    0xc780000000000000, 0x3d0000000000000, 0xcfd0000000000000, 0xb80000000000000,
+    0xd720000000000000, 0x1370000000000000, 0xdf70000000000000, 0x1b20000000000000,
+    0xe6c0000000000000, 0x2290000000000000, 0xee90000000000000, 0x2ac0000000000000,
+    0xf660000000000000, 0x3230000000000000, 0xfe30000000000000, 0x3a60000000000000,
+    0x8af0000000000000, 0x4ea0000000000000, 0x82a0000000000000, 0x46f0000000000000,
+    0x9a50000000000000, 0x5e00000000000000, 0x9200000000000000, 0x5650000000000000,
+    0xabb0000000000000, 0x6fe0000000000000, 0xa3e0000000000000, 0x67b0000000000000,
+    0xbb10000000000000, 0x7f40000000000000, 0xb340000000000000, 0x7710000000000000,
+    0xc870000000000000, 0xc20000000000000, 0xc020000000000000, 0x470000000000000,
+    0xd8d0000000000000, 0x1c80000000000000, 0xd080000000000000, 0x14d0000000000000,
+    0xe930000000000000, 0x2d60000000000000, 0xe160000000000000, 0x2530000000000000,
+    0xf990000000000000, 0x3dc0000000000000, 0xf1c0000000000000, 0x3590000000000000,
+    0xff0000000000000, 0xcba0000000000000, 0x7a0000000000000, 0xc3f0000000000000,
+    0x1f50000000000000, 0xdb00000000000000, 0x1700000000000000, 0xd350000000000000,
+    0x2eb0000000000000, 0xeae0000000000000, 0x26e0000000000000, 0xe2b0000000000000,
+    0x3e10000000000000, 0xfa40000000000000, 0x3640000000000000, 0xf210000000000000,
+    0x4d70000000000000, 0x8920000000000000, 0x4520000000000000, 0x8170000000000000,
+    0x5dd0000000000000, 0x9980000000000000, 0x5580000000000000, 0x91d0000000000000,
+    0x6c30000000000000, 0xa860000000000000, 0x6460000000000000, 0xa030000000000000,
+    0x7c90000000000000, 0xb8c0000000000000, 0x74c0000000000000, 0xb090000000000000,
+    0x9510000000000000, 0x5140000000000000, 0x9d40000000000000, 0x5910000000000000,
+    0x85b0000000000000, 0x41e0000000000000, 0x8de0000000000000, 0x49b0000000000000,
+    0xb450000000000000, 0x7000000000000000, 0xbc00000000000000, 0x7850000000000000,
+    0xa4f0000000000000, 0x60a0000000000000, 0xaca0000000000000, 0x68f0000000000000,
+    0xd790000000000000, 0x13c0000000000000, 0xdfc0000000000000, 0x1b90000000000000,
+    0xc730000000000000, 0x360000000000000, 0xcf60000000000000, 0xb30000000000000,
+    0xf6d0000000000000, 0x3280000000000000, 0xfe80000000000000, 0x3ad0000000000000,
+    0xe670000000000000, 0x2220000000000000, 0xee20000000000000, 0x2a70000000000000,
+    0x1010000000000000, 0xd440000000000000, 0x1840000000000000, 0xdc10000000000000,
+    0xb0000000000000, 0xc4e0000000000000, 0x8e0000000000000, 0xccb0000000000000,
+    0x3150000000000000, 0xf500000000000000, 0x3900000000000000, 0xfd50000000000000,
+    0x21f0000000000000, 0xe5a0000000000000, 0x29a0000000000000, 0xedf0000000000000,
+    0x5290000000000000, 0x96c0000000000000, 0x5ac0000000000000, 0x9e90000000000000,
+    0x4230000000000000, 0x8660000000000000, 0x4a60000000000000, 0x8e30000000000000,
+    0x73d0000000000000, 0xb780000000000000, 0x7b80000000000000, 0xbfd0000000000000,
+    0x6370000000000000, 0xa720000000000000, 0x6b20000000000000, 0xaf70000000000000,
+    0x1fe0000000000000, 0xdbb0000000000000, 0x17b0000000000000, 0xd3e0000000000000,
+    0xf40000000000000, 0xcb10000000000000, 0x710000000000000, 0xc340000000000000,
+    0x3ea0000000000000, 0xfaf0000000000000, 0x36f0000000000000, 0xf2a0000000000000,
+    0x2e00000000000000, 0xea50000000000000, 0x2650000000000000, 0xe200000000000000,
+    0x5d60000000000000, 0x9930000000000000, 0x5530000000000000, 0x9160000000000000,
+    0x4dc0000000000000, 0x8990000000000000, 0x4590000000000000, 0x81c0000000000000,
+    0x7c20000000000000, 0xb870000000000000, 0x7470000000000000, 0xb020000000000000,
+    0x6c80000000000000, 0xa8d0000000000000, 0x64d0000000000000, 0xa080000000000000,
+    0x9ae0000000000000, 0x5eb0000000000000, 0x92b0000000000000, 0x56e0000000000000,
+    0x8a40000000000000, 0x4e10000000000000, 0x8210000000000000, 0x4640000000000000,
+    0xbba0000000000000, 0x7ff0000000000000, 0xb3f0000000000000, 0x77a0000000000000,
+    0xab00000000000000, 0x6f50000000000000, 0xa350000000000000, 0x6700000000000000,
+    0xd860000000000000, 0x1c30000000000000, 0xd030000000000000, 0x1460000000000000,
+    0xc8c0000000000000, 0xc90000000000000, 0xc090000000000000, 0x4c0000000000000,
+    0xf920000000000000, 0x3d70000000000000, 0xf170000000000000, 0x3520000000000000,
+    0xe980000000000000, 0x2dd0000000000000, 0xe1d0000000000000, 0x2580000000000000,
+  },
+  {
+    0, 0xaad0000000000000, 0xd550000000000000, 0x7f80000000000000,
+    0x2a50000000000000, 0x8080000000000000, 0xff00000000000000, 0x55d0000000000000,
+    0x54a0000000000000, 0xfe70000000000000, 0x81f0000000000000, 0x2b20000000000000,
+    0x7ef0000000000000, 0xd420000000000000, 0xaba0000000000000, 0x170000000000000,
+    0xa940000000000000, 0x390000000000000, 0x7c10000000000000, 0xd6c0000000000000,
+    0x8310000000000000, 0x29c0000000000000, 0x5640000000000000, 0xfc90000000000000,
+    0xfde0000000000000, 0x5730000000000000, 0x28b0000000000000, 0x8260000000000000,
+    0xd7b0000000000000, 0x7d60000000000000, 0x2e0000000000000, 0xa830000000000000,
+    0xd270000000000000, 0x78a0000000000000, 0x720000000000000, 0xadf0000000000000,
+    0xf820000000000000, 0x52f0000000000000, 0x2d70000000000000, 0x87a0000000000000,
+    0x86d0000000000000, 0x2c00000000000000, 0x5380000000000000, 0xf950000000000000,
+    0xac80000000000000, 0x650000000000000, 0x79d0000000000000, 0xd300000000000000,
+    0x7b30000000000000, 0xd1e0000000000000, 0xae60000000000000, 0x4b0000000000000,
+    0x5160000000000000, 0xfbb0000000000000, 0x8430000000000000, 0x2ee0000000000000,
+    0x2f90000000000000, 0x8540000000000000, 0xfac0000000000000, 0x5010000000000000,
+    0x5c0000000000000, 0xaf10000000000000, 0xd090000000000000, 0x7a40000000000000,
+    0x2410000000000000, 0x8ec0000000000000, 0xf140000000000000, 0x5b90000000000000,
+    0xe40000000000000, 0xa490000000000000, 0xdb10000000000000, 0x71c0000000000000,
+    0x70b0000000000000, 0xda60000000000000, 0xa5e0000000000000, 0xf30000000000000,
+    0x5ae0000000000000, 0xf030000000000000, 0x8fb0000000000000, 0x2560000000000000,
+    0x8d50000000000000, 0x2780000000000000, 0x5800000000000000, 0xf2d0000000000000,
+    0xa700000000000000, 0xdd0000000000000, 0x7250000000000000, 0xd880000000000000,
+    0xd9f0000000000000, 0x7320000000000000, 0xca0000000000000, 0xa670000000000000,
+    0xf3a0000000000000, 0x5970000000000000, 0x26f0000000000000, 0x8c20000000000000,
+    0xf660000000000000, 0x5cb0000000000000, 0x2330000000000000, 0x89e0000000000000,
+    0xdc30000000000000, 0x76e0000000000000, 0x960000000000000, 0xa3b0000000000000,
+    0xa2c0000000000000, 0x810000000000000, 0x7790000000000000, 0xdd40000000000000,
+    0x8890000000000000, 0x2240000000000000, 0x5dc0000000000000, 0xf710000000000000,
+    0x5f20000000000000, 0xf5f0000000000000, 0x8a70000000000000, 0x20a0000000000000,
+    0x7570000000000000, 0xdfa0000000000000, 0xa020000000000000, 0xaf0000000000000,
+    0xb80000000000000, 0xa150000000000000, 0xded0000000000000, 0x7400000000000000,
+    0x21d0000000000000, 0x8b00000000000000, 0xf480000000000000, 0x5e50000000000000,
+    0x4820000000000000, 0xe2f0000000000000, 0x9d70000000000000, 0x37a0000000000000,
+    0x6270000000000000, 0xc8a0000000000000, 0xb720000000000000, 0x1df0000000000000,
+    0x1c80000000000000, 0xb650000000000000, 0xc9d0000000000000, 0x6300000000000000,
+    0x36d0000000000000, 0x9c00000000000000, 0xe380000000000000, 0x4950000000000000,
+    0xe160000000000000, 0x4bb0000000000000, 0x3430000000000000, 0x9ee0000000000000,
+    0xcb30000000000000, 0x61e0000000000000, 0x1e60000000000000, 0xb4b0000000000000,
+    0xb5c0000000000000, 0x1f10000000000000, 0x6090000000000000, 0xca40000000000000,
+    0x9f90000000000000, 0x3540000000000000, 0x4ac0000000000000, 0xe010000000000000,
+    0x9a50000000000000, 0x3080000000000000, 0x4f00000000000000, 0xe5d0000000000000,
+    0xb000000000000000, 0x1ad0000000000000, 0x6550000000000000, 0xcf80000000000000,
+    0xcef0000000000000, 0x6420000000000000, 0x1ba0000000000000, 0xb170000000000000,
+    0xe4a0000000000000, 0x4e70000000000000, 0x31f0000000000000, 0x9b20000000000000,
+    0x3310000000000000, 0x99c0000000000000, 0xe640000000000000, 0x4c90000000000000,
+    0x1940000000000000, 0xb390000000000000, 0xcc10000000000000, 0x66c0000000000000,
+    0x67b0000000000000, 0xcd60000000000000, 0xb2e0000000000000, 0x1830000000000000,
+    0x4de0000000000000, 0xe730000000000000, 0x98b0000000000000, 0x3260000000000000,
+    0x6c30000000000000, 0xc6e0000000000000, 0xb960000000000000, 0x13b0000000000000,
+    0x4660000000000000, 0xecb0000000000000, 0x9330000000000000, 0x39e0000000000000,
+    0x3890000000000000, 0x9240000000000000, 0xedc0000000000000, 0x4710000000000000,
+    0x12c0000000000000, 0xb810000000000000, 0xc790000000000000, 0x6d40000000000000,
+    0xc570000000000000, 0x6fa0000000000000, 0x1020000000000000, 0xbaf0000000000000,
+    0xef20000000000000, 0x45f0000000000000, 0x3a70000000000000, 0x90a0000000000000,
+    0x91d0000000000000, 0x3b00000000000000, 0x4480000000000000, 0xee50000000000000,
+    0xbb80000000000000, 0x1150000000000000, 0x6ed0000000000000, 0xc400000000000000,
+    0xbe40000000000000, 0x1490000000000000, 0x6b10000000000000, 0xc1c0000000000000,
+    0x9410000000000000, 0x3ec0000000000000, 0x4140000000000000, 0xeb90000000000000,
+    0xeae0000000000000, 0x4030000000000000, 0x3fb0000000000000, 0x9560000000000000,
+    0xc0b0000000000000, 0x6a60000000000000, 0x15e0000000000000, 0xbf30000000000000,
+    0x1700000000000000, 0xbdd0000000000000, 0xc250000000000000, 0x6880000000000000,
+    0x3d50000000000000, 0x9780000000000000, 0xe800000000000000, 0x42d0000000000000,
+    0x43a0000000000000, 0xe970000000000000, 0x96f0000000000000, 0x3c20000000000000,
+    0x69f0000000000000, 0xc320000000000000, 0xbca0000000000000, 0x1670000000000000,
+  },
+  {
+    0, 0x9040000000000000, 0xa070000000000000, 0x3030000000000000,
+    0xc010000000000000, 0x5050000000000000, 0x6060000000000000, 0xf020000000000000,
+    0xd0000000000000, 0x9090000000000000, 0xa0a0000000000000, 0x30e0000000000000,
+    0xc0c0000000000000, 0x5080000000000000, 0x60b0000000000000, 0xf0f0000000000000,
+    0x1a0000000000000, 0x91e0000000000000, 0xa1d0000000000000, 0x3190000000000000,
+    0xc1b0000000000000, 0x51f0000000000000, 0x61c0000000000000, 0xf180000000000000,
+    0x170000000000000, 0x9130000000000000, 0xa100000000000000, 0x3140000000000000,
+    0xc160000000000000, 0x5120000000000000, 0x6110000000000000, 0xf150000000000000,
+    0x340000000000000, 0x9300000000000000, 0xa330000000000000, 0x3370000000000000,
+    0xc350000000000000, 0x5310000000000000, 0x6320000000000000, 0xf360000000000000,
+    0x390000000000000, 0x93d0000000000000, 0xa3e0000000000000, 0x33a0000000000000,
+    0xc380000000000000, 0x53c0000000000000, 0x63f0000000000000, 0xf3b0000000000000,
+    0x2e0000000000000, 0x92a0000000000000, 0xa290000000000000, 0x32d0000000000000,
+    0xc2f0000000000000, 0x52b0000000000000, 0x6280000000000000, 0xf2c0000000000000,
+    0x230000000000000, 0x9270000000000000, 0xa240000000000000, 0x3200000000000000,
+    0xc220000000000000, 0x5260000000000000, 0x6250000000000000, 0xf210000000000000,
+    0x680000000000000, 0x96c0000000000000, 0xa6f0000000000000, 0x36b0000000000000,
+    0xc690000000000000, 0x56d0000000000000, 0x66e0000000000000, 0xf6a0000000000000,
+    0x650000000000000, 0x9610000000000000, 0xa620000000000000, 0x3660000000000000,
+    0xc640000000000000, 0x5600000000000000, 0x6630000000000000, 0xf670000000000000,
+    0x720000000000000, 0x9760000000000000, 0xa750000000000000, 0x3710000000000000,
+    0xc730000000000000, 0x5770000000000000, 0x6740000000000000, 0xf700000000000000,
+    0x7f0000000000000, 0x97b0000000000000, 0xa780000000000000, 0x37c0000000000000,
+    0xc7e0000000000000, 0x57a0000000000000, 0x6790000000000000, 0xf7d0000000000000,
+    0x5c0000000000000, 0x9580000000000000, 0xa5b0000000000000, 0x35f0000000000000,
+    0xc5d0000000000000, 0x5590000000000000, 0x65a0000000000000, 0xf5e0000000000000,
+    0x510000000000000, 0x9550000000000000, 0xa560000000000000, 0x3520000000000000,
+    0xc500000000000000, 0x5540000000000000, 0x6570000000000000, 0xf530000000000000,
+    0x460000000000000, 0x9420000000000000, 0xa410000000000000, 0x3450000000000000,
+    0xc470000000000000, 0x5430000000000000, 0x6400000000000000, 0xf440000000000000,
+    0x4b0000000000000, 0x94f0000000000000, 0xa4c0000000000000, 0x3480000000000000,
+    0xc4a0000000000000, 0x54e0000000000000, 0x64d0000000000000, 0xf490000000000000,
+    0xd00000000000000, 0x9d40000000000000, 0xad70000000000000, 0x3d30000000000000,
+    0xcd10000000000000, 0x5d50000000000000, 0x6d60000000000000, 0xfd20000000000000,
+    0xdd0000000000000, 0x9d90000000000000, 0xada0000000000000, 0x3de0000000000000,
+    0xcdc0000000000000, 0x5d80000000000000, 0x6db0000000000000, 0xfdf0000000000000,
+    0xca0000000000000, 0x9ce0000000000000, 0xacd0000000000000, 0x3c90000000000000,
+    0xccb0000000000000, 0x5cf0000000000000, 0x6cc0000000000000, 0xfc80000000000000,
+    0xc70000000000000, 0x9c30000000000000, 0xac00000000000000, 0x3c40000000000000,
+    0xcc60000000000000, 0x5c20000000000000, 0x6c10000000000000, 0xfc50000000000000,
+    0xe40000000000000, 0x9e00000000000000, 0xae30000000000000, 0x3e70000000000000,
+    0xce50000000000000, 0x5e10000000000000, 0x6e20000000000000, 0xfe60000000000000,
+    0xe90000000000000, 0x9ed0000000000000, 0xaee0000000000000, 0x3ea0000000000000,
+    0xce80000000000000, 0x5ec0000000000000, 0x6ef0000000000000, 0xfeb0000000000000,
+    0xfe0000000000000, 0x9fa0000000000000, 0xaf90000000000000, 0x3fd0000000000000,
+    0xcff0000000000000, 0x5fb0000000000000, 0x6f80000000000000, 0xffc0000000000000,
+    0xf30000000000000, 0x9f70000000000000, 0xaf40000000000000, 0x3f00000000000000,
+    0xcf20000000000000, 0x5f60000000000000, 0x6f50000000000000, 0xff10000000000000,
+    0xb80000000000000, 0x9bc0000000000000, 0xabf0000000000000, 0x3bb0000000000000,
+    0xcb90000000000000, 0x5bd0000000000000, 0x6be0000000000000, 0xfba0000000000000,
+    0xb50000000000000, 0x9b10000000000000, 0xab20000000000000, 0x3b60000000000000,
+    0xcb40000000000000, 0x5b00000000000000, 0x6b30000000000000, 0xfb70000000000000,
+    0xa20000000000000, 0x9a60000000000000, 0xaa50000000000000, 0x3a10000000000000,
+    0xca30000000000000, 0x5a70000000000000, 0x6a40000000000000, 0xfa00000000000000,
+    0xaf0000000000000, 0x9ab0000000000000, 0xaa80000000000000, 0x3ac0000000000000,
+    0xcae0000000000000, 0x5aa0000000000000, 0x6a90000000000000, 0xfad0000000000000,
+    0x8c0000000000000, 0x9880000000000000, 0xa8b0000000000000, 0x38f0000000000000,
+    0xc8d0000000000000, 0x5890000000000000, 0x68a0000000000000, 0xf8e0000000000000,
+    0x810000000000000, 0x9850000000000000, 0xa860000000000000, 0x3820000000000000,
+    0xc800000000000000, 0x5840000000000000, 0x6870000000000000, 0xf830000000000000,
+    0x960000000000000, 0x9920000000000000, 0xa910000000000000, 0x3950000000000000,
+    0xc970000000000000, 0x5930000000000000, 0x6900000000000000, 0xf940000000000000,
+    0x9b0000000000000, 0x99f0000000000000, 0xa9c0000000000000, 0x3980000000000000,
+    0xc9a0000000000000, 0x59e0000000000000, 0x69d0000000000000, 0xf990000000000000,
+  },
+  {
+    0, 0x1a00000000000000, 0x3400000000000000, 0x2e00000000000000,
+    0x6800000000000000, 0x7200000000000000, 0x5c00000000000000, 0x4600000000000000,
+    0xd000000000000000, 0xca00000000000000, 0xe400000000000000, 0xfe00000000000000,
+    0xb800000000000000, 0xa200000000000000, 0x8c00000000000000, 0x9600000000000000,
+    0x20f0000000000000, 0x3af0000000000000, 0x14f0000000000000, 0xef0000000000000,
+    0x48f0000000000000, 0x52f0000000000000, 0x7cf0000000000000, 0x66f0000000000000,
+    0xf0f0000000000000, 0xeaf0000000000000, 0xc4f0000000000000, 0xdef0000000000000,
+    0x98f0000000000000, 0x82f0000000000000, 0xacf0000000000000, 0xb6f0000000000000,
+    0x41e0000000000000, 0x5be0000000000000, 0x75e0000000000000, 0x6fe0000000000000,
+    0x29e0000000000000, 0x33e0000000000000, 0x1de0000000000000, 0x7e0000000000000,
+    0x91e0000000000000, 0x8be0000000000000, 0xa5e0000000000000, 0xbfe0000000000000,
+    0xf9e0000000000000, 0xe3e0000000000000, 0xcde0000000000000, 0xd7e0000000000000,
+    0x6110000000000000, 0x7b10000000000000, 0x5510000000000000, 0x4f10000000000000,
+    0x910000000000000, 0x1310000000000000, 0x3d10000000000000, 0x2710000000000000,
+    0xb110000000000000, 0xab10000000000000, 0x8510000000000000, 0x9f10000000000000,
+    0xd910000000000000, 0xc310000000000000, 0xed10000000000000, 0xf710000000000000,
+    0x83c0000000000000, 0x99c0000000000000, 0xb7c0000000000000, 0xadc0000000000000,
+    0xebc0000000000000, 0xf1c0000000000000, 0xdfc0000000000000, 0xc5c0000000000000,
+    0x53c0000000000000, 0x49c0000000000000, 0x67c0000000000000, 0x7dc0000000000000,
+    0x3bc0000000000000, 0x21c0000000000000, 0xfc0000000000000, 0x15c0000000000000,
+    0xa330000000000000, 0xb930000000000000, 0x9730000000000000, 0x8d30000000000000,
+    0xcb30000000000000, 0xd130000000000000, 0xff30000000000000, 0xe530000000000000,
+    0x7330000000000000, 0x6930000000000000, 0x4730000000000000, 0x5d30000000000000,
+    0x1b30000000000000, 0x130000000000000, 0x2f30000000000000, 0x3530000000000000,
+    0xc220000000000000, 0xd820000000000000, 0xf620000000000000, 0xec20000000000000,
+    0xaa20000000000000, 0xb020000000000000, 0x9e20000000000000, 0x8420000000000000,
+    0x1220000000000000, 0x820000000000000, 0x2620000000000000, 0x3c20000000000000,
+    0x7a20000000000000, 0x6020000000000000, 0x4e20000000000000, 0x5420000000000000,
+    0xe2d0000000000000, 0xf8d0000000000000, 0xd6d0000000000000, 0xccd0000000000000,
+    0x8ad0000000000000, 0x90d0000000000000, 0xbed0000000000000, 0xa4d0000000000000,
+    0x32d0000000000000, 0x28d0000000000000, 0x6d0000000000000, 0x1cd0000000000000,
+    0x5ad0000000000000, 0x40d0000000000000, 0x6ed0000000000000, 0x74d0000000000000,
+    0x8770000000000000, 0x9d70000000000000, 0xb370000000000000, 0xa970000000000000,
+    0xef70000000000000, 0xf570000000000000, 0xdb70000000000000, 0xc170000000000000,
+    0x5770000000000000, 0x4d70000000000000, 0x6370000000000000, 0x7970000000000000,
+    0x3f70000000000000, 0x2570000000000000, 0xb70000000000000, 0x1170000000000000,
+    0xa780000000000000, 0xbd80000000000000, 0x9380000000000000, 0x8980000000000000,
+    0xcf80000000000000, 0xd580000000000000, 0xfb80000000000000, 0xe180000000000000,
+    0x7780000000000000, 0x6d80000000000000, 0x4380000000000000, 0x5980000000000000,
+    0x1f80000000000000, 0x580000000000000, 0x2b80000000000000, 0x3180000000000000,
+    0xc690000000000000, 0xdc90000000000000, 0xf290000000000000, 0xe890000000000000,
+    0xae90000000000000, 0xb490000000000000, 0x9a90000000000000, 0x8090000000000000,
+    0x1690000000000000, 0xc90000000000000, 0x2290000000000000, 0x3890000000000000,
+    0x7e90000000000000, 0x6490000000000000, 0x4a90000000000000, 0x5090000000000000,
+    0xe660000000000000, 0xfc60000000000000, 0xd260000000000000, 0xc860000000000000,
+    0x8e60000000000000, 0x9460000000000000, 0xba60000000000000, 0xa060000000000000,
+    0x3660000000000000, 0x2c60000000000000, 0x260000000000000, 0x1860000000000000,
+    0x5e60000000000000, 0x4460000000000000, 0x6a60000000000000, 0x7060000000000000,
+    0x4b0000000000000, 0x1eb0000000000000, 0x30b0000000000000, 0x2ab0000000000000,
+    0x6cb0000000000000, 0x76b0000000000000, 0x58b0000000000000, 0x42b0000000000000,
+    0xd4b0000000000000, 0xceb0000000000000, 0xe0b0000000000000, 0xfab0000000000000,
+    0xbcb0000000000000, 0xa6b0000000000000, 0x88b0000000000000, 0x92b0000000000000,
+    0x2440000000000000, 0x3e40000000000000, 0x1040000000000000, 0xa40000000000000,
+    0x4c40000000000000, 0x5640000000000000, 0x7840000000000000, 0x6240000000000000,
+    0xf440000000000000, 0xee40000000000000, 0xc040000000000000, 0xda40000000000000,
+    0x9c40000000000000, 0x8640000000000000, 0xa840000000000000, 0xb240000000000000,
+    0x4550000000000000, 0x5f50000000000000, 0x7150000000000000, 0x6b50000000000000,
+    0x2d50000000000000, 0x3750000000000000, 0x1950000000000000, 0x350000000000000,
+    0x9550000000000000, 0x8f50000000000000, 0xa150000000000000, 0xbb50000000000000,
+    0xfd50000000000000, 0xe750000000000000, 0xc950000000000000, 0xd350000000000000,
+    0x65a0000000000000, 0x7fa0000000000000, 0x51a0000000000000, 0x4ba0000000000000,
+    0xda0000000000000, 0x17a0000000000000, 0x39a0000000000000, 0x23a0000000000000,
+    0xb5a0000000000000, 0xafa0000000000000, 0x81a0000000000000, 0x9ba0000000000000,
+    0xdda0000000000000, 0xc7a0000000000000, 0xe9a0000000000000, 0xf3a0000000000000,
+  },
+  {
+    0, 0x8e10000000000000, 0x9cd0000000000000, 0x12c0000000000000,
+    0xb950000000000000, 0x3740000000000000, 0x2580000000000000, 0xab90000000000000,
+    0xf250000000000000, 0x7c40000000000000, 0x6e80000000000000, 0xe090000000000000,
+    0x4b00000000000000, 0xc510000000000000, 0xd7d0000000000000, 0x59c0000000000000,
+    0x6450000000000000, 0xea40000000000000, 0xf880000000000000, 0x7690000000000000,
+    0xdd00000000000000, 0x5310000000000000, 0x41d0000000000000, 0xcfc0000000000000,
+    0x9600000000000000, 0x1810000000000000, 0xad0000000000000, 0x84c0000000000000,
+    0x2f50000000000000, 0xa140000000000000, 0xb380000000000000, 0x3d90000000000000,
+    0xc8a0000000000000, 0x46b0000000000000, 0x5470000000000000, 0xda60000000000000,
+    0x71f0000000000000, 0xffe0000000000000, 0xed20000000000000, 0x6330000000000000,
+    0x3af0000000000000, 0xb4e0000000000000, 0xa620000000000000, 0x2830000000000000,
+    0x83a0000000000000, 0xdb0000000000000, 0x1f70000000000000, 0x9160000000000000,
+    0xacf0000000000000, 0x22e0000000000000, 0x3020000000000000, 0xbe30000000000000,
+    0x15a0000000000000, 0x9bb0000000000000, 0x8970000000000000, 0x760000000000000,
+    0x5ea0000000000000, 0xd0b0000000000000, 0xc270000000000000, 0x4c60000000000000,
+    0xe7f0000000000000, 0x69e0000000000000, 0x7b20000000000000, 0xf530000000000000,
+    0x11b0000000000000, 0x9fa0000000000000, 0x8d60000000000000, 0x370000000000000,
+    0xa8e0000000000000, 0x26f0000000000000, 0x3430000000000000, 0xba20000000000000,
+    0xe3e0000000000000, 0x6df0000000000000, 0x7f30000000000000, 0xf120000000000000,
+    0x5ab0000000000000, 0xd4a0000000000000, 0xc660000000000000, 0x4870000000000000,
+    0x75e0000000000000, 0xfbf0000000000000, 0xe930000000000000, 0x6720000000000000,
+    0xccb0000000000000, 0x42a0000000000000, 0x5060000000000000, 0xde70000000000000,
+    0x87b0000000000000, 0x9a0000000000000, 0x1b60000000000000, 0x9570000000000000,
+    0x3ee0000000000000, 0xb0f0000000000000, 0xa230000000000000, 0x2c20000000000000,
+    0xd910000000000000, 0x5700000000000000, 0x45c0000000000000, 0xcbd0000000000000,
+    0x6040000000000000, 0xee50000000000000, 0xfc90000000000000, 0x7280000000000000,
+    0x2b40000000000000, 0xa550000000000000, 0xb790000000000000, 0x3980000000000000,
+    0x9210000000000000, 0x1c00000000000000, 0xec0000000000000, 0x80d0000000000000,
+    0xbd40000000000000, 0x3350000000000000, 0x2190000000000000, 0xaf80000000000000,
+    0x410000000000000, 0x8a00000000000000, 0x98c0000000000000, 0x16d0000000000000,
+    0x4f10000000000000, 0xc100000000000000, 0xd3c0000000000000, 0x5dd0000000000000,
+    0xf640000000000000, 0x7850000000000000, 0x6a90000000000000, 0xe480000000000000,
+    0x2360000000000000, 0xad70000000000000, 0xbfb0000000000000, 0x31a0000000000000,
+    0x9a30000000000000, 0x1420000000000000, 0x6e0000000000000, 0x88f0000000000000,
+    0xd130000000000000, 0x5f20000000000000, 0x4de0000000000000, 0xc3f0000000000000,
+    0x6860000000000000, 0xe670000000000000, 0xf4b0000000000000, 0x7aa0000000000000,
+    0x4730000000000000, 0xc920000000000000, 0xdbe0000000000000, 0x55f0000000000000,
+    0xfe60000000000000, 0x7070000000000000, 0x62b0000000000000, 0xeca0000000000000,
+    0xb560000000000000, 0x3b70000000000000, 0x29b0000000000000, 0xa7a0000000000000,
+    0xc30000000000000, 0x8220000000000000, 0x90e0000000000000, 0x1ef0000000000000,
+    0xebc0000000000000, 0x65d0000000000000, 0x7710000000000000, 0xf900000000000000,
+    0x5290000000000000, 0xdc80000000000000, 0xce40000000000000, 0x4050000000000000,
+    0x1990000000000000, 0x9780000000000000, 0x8540000000000000, 0xb50000000000000,
+    0xa0c0000000000000, 0x2ed0000000000000, 0x3c10000000000000, 0xb200000000000000,
+    0x8f90000000000000, 0x180000000000000, 0x1340000000000000, 0x9d50000000000000,
+    0x36c0000000000000, 0xb8d0000000000000, 0xaa10000000000000, 0x2400000000000000,
+    0x7dc0000000000000, 0xf3d0000000000000, 0xe110000000000000, 0x6f00000000000000,
+    0xc490000000000000, 0x4a80000000000000, 0x5840000000000000, 0xd650000000000000,
+    0x32d0000000000000, 0xbcc0000000000000, 0xae00000000000000, 0x2010000000000000,
+    0x8b80000000000000, 0x590000000000000, 0x1750000000000000, 0x9940000000000000,
+    0xc080000000000000, 0x4e90000000000000, 0x5c50000000000000, 0xd240000000000000,
+    0x79d0000000000000, 0xf7c0000000000000, 0xe500000000000000, 0x6b10000000000000,
+    0x5680000000000000, 0xd890000000000000, 0xca50000000000000, 0x4440000000000000,
+    0xefd0000000000000, 0x61c0000000000000, 0x7300000000000000, 0xfd10000000000000,
+    0xa4d0000000000000, 0x2ac0000000000000, 0x3800000000000000, 0xb610000000000000,
+    0x1d80000000000000, 0x9390000000000000, 0x8150000000000000, 0xf40000000000000,
+    0xfa70000000000000, 0x7460000000000000, 0x66a0000000000000, 0xe8b0000000000000,
+    0x4320000000000000, 0xcd30000000000000, 0xdff0000000000000, 0x51e0000000000000,
+    0x820000000000000, 0x8630000000000000, 0x94f0000000000000, 0x1ae0000000000000,
+    0xb170000000000000, 0x3f60000000000000, 0x2da0000000000000, 0xa3b0000000000000,
+    0x9e20000000000000, 0x1030000000000000, 0x2f0000000000000, 0x8ce0000000000000,
+    0x2770000000000000, 0xa960000000000000, 0xbba0000000000000, 0x35b0000000000000,
+    0x6c70000000000000, 0xe260000000000000, 0xf0a0000000000000, 0x7eb0000000000000,
+    0xd520000000000000, 0x5b30000000000000, 0x49f0000000000000, 0xc7e0000000000000,
+  },
+  {
+    0, 0x46c0000000000000, 0x8d80000000000000, 0xcb40000000000000,
+    0x9bf0000000000000, 0xdd30000000000000, 0x1670000000000000, 0x50b0000000000000,
+    0xb710000000000000, 0xf1d0000000000000, 0x3a90000000000000, 0x7c50000000000000,
+    0x2ce0000000000000, 0x6a20000000000000, 0xa160000000000000, 0xe7a0000000000000,
+    0xeed0000000000000, 0xa810000000000000, 0x6350000000000000, 0x2590000000000000,
+    0x7520000000000000, 0x33e0000000000000, 0xf8a0000000000000, 0xbe60000000000000,
+    0x59c0000000000000, 0x1f00000000000000, 0xd440000000000000, 0x9280000000000000,
+    0xc230000000000000, 0x84f0000000000000, 0x4fb0000000000000, 0x970000000000000,
+    0x5d50000000000000, 0x1b90000000000000, 0xd0d0000000000000, 0x9610000000000000,
+    0xc6a0000000000000, 0x8060000000000000, 0x4b20000000000000, 0xde0000000000000,
+    0xea40000000000000, 0xac80000000000000, 0x67c0000000000000, 0x2100000000000000,
+    0x71b0000000000000, 0x3770000000000000, 0xfc30000000000000, 0xbaf0000000000000,
+    0xb380000000000000, 0xf540000000000000, 0x3e00000000000000, 0x78c0000000000000,
+    0x2870000000000000, 0x6eb0000000000000, 0xa5f0000000000000, 0xe330000000000000,
+    0x490000000000000, 0x4250000000000000, 0x8910000000000000, 0xcfd0000000000000,
+    0x9f60000000000000, 0xd9a0000000000000, 0x12e0000000000000, 0x5420000000000000,
+    0xbaa0000000000000, 0xfc60000000000000, 0x3720000000000000, 0x71e0000000000000,
+    0x2150000000000000, 0x6790000000000000, 0xacd0000000000000, 0xea10000000000000,
+    0xdb0000000000000, 0x4b70000000000000, 0x8030000000000000, 0xc6f0000000000000,
+    0x9640000000000000, 0xd080000000000000, 0x1bc0000000000000, 0x5d00000000000000,
+    0x5470000000000000, 0x12b0000000000000, 0xd9f0000000000000, 0x9f30000000000000,
+    0xcf80000000000000, 0x8940000000000000, 0x4200000000000000, 0x4c0000000000000,
+    0xe360000000000000, 0xa5a0000000000000, 0x6ee0000000000000, 0x2820000000000000,
+    0x7890000000000000, 0x3e50000000000000, 0xf510000000000000, 0xb3d0000000000000,
+    0xe7f0000000000000, 0xa130000000000000, 0x6a70000000000000, 0x2cb0000000000000,
+    0x7c00000000000000, 0x3ac0000000000000, 0xf180000000000000, 0xb740000000000000,
+    0x50e0000000000000, 0x1620000000000000, 0xdd60000000000000, 0x9ba0000000000000,
+    0xcb10000000000000, 0x8dd0000000000000, 0x4690000000000000, 0x50000000000000,
+    0x920000000000000, 0x4fe0000000000000, 0x84a0000000000000, 0xc260000000000000,
+    0x92d0000000000000, 0xd410000000000000, 0x1f50000000000000, 0x5990000000000000,
+    0xbe30000000000000, 0xf8f0000000000000, 0x33b0000000000000, 0x7570000000000000,
+    0x25c0000000000000, 0x6300000000000000, 0xa840000000000000, 0xee80000000000000,
+    0xf5b0000000000000, 0xb370000000000000, 0x7830000000000000, 0x3ef0000000000000,
+    0x6e40000000000000, 0x2880000000000000, 0xe3c0000000000000, 0xa500000000000000,
+    0x42a0000000000000, 0x460000000000000, 0xcf20000000000000, 0x89e0000000000000,
+    0xd950000000000000, 0x9f90000000000000, 0x54d0000000000000, 0x1210000000000000,
+    0x1b60000000000000, 0x5da0000000000000, 0x96e0000000000000, 0xd020000000000000,
+    0x8090000000000000, 0xc650000000000000, 0xd10000000000000, 0x4bd0000000000000,
+    0xac70000000000000, 0xeab0000000000000, 0x21f0000000000000, 0x6730000000000000,
+    0x3780000000000000, 0x7140000000000000, 0xba00000000000000, 0xfcc0000000000000,
+    0xa8e0000000000000, 0xee20000000000000, 0x2560000000000000, 0x63a0000000000000,
+    0x3310000000000000, 0x75d0000000000000, 0xbe90000000000000, 0xf850000000000000,
+    0x1ff0000000000000, 0x5930000000000000, 0x9270000000000000, 0xd4b0000000000000,
+    0x8400000000000000, 0xc2c0000000000000, 0x980000000000000, 0x4f40000000000000,
+    0x4630000000000000, 0xf0000000000000, 0xcbb0000000000000, 0x8d70000000000000,
+    0xddc0000000000000, 0x9b00000000000000, 0x5040000000000000, 0x1680000000000000,
+    0xf120000000000000, 0xb7e0000000000000, 0x7ca0000000000000, 0x3a60000000000000,
+    0x6ad0000000000000, 0x2c10000000000000, 0xe750000000000000, 0xa190000000000000,
+    0x4f10000000000000, 0x9d0000000000000, 0xc290000000000000, 0x8450000000000000,
+    0xd4e0000000000000, 0x9220000000000000, 0x5960000000000000, 0x1fa0000000000000,
+    0xf800000000000000, 0xbec0000000000000, 0x7580000000000000, 0x3340000000000000,
+    0x63f0000000000000, 0x2530000000000000, 0xee70000000000000, 0xa8b0000000000000,
+    0xa1c0000000000000, 0xe700000000000000, 0x2c40000000000000, 0x6a80000000000000,
+    0x3a30000000000000, 0x7cf0000000000000, 0xb7b0000000000000, 0xf170000000000000,
+    0x16d0000000000000, 0x5010000000000000, 0x9b50000000000000, 0xdd90000000000000,
+    0x8d20000000000000, 0xcbe0000000000000, 0xa0000000000000, 0x4660000000000000,
+    0x1240000000000000, 0x5480000000000000, 0x9fc0000000000000, 0xd900000000000000,
+    0x89b0000000000000, 0xcf70000000000000, 0x430000000000000, 0x42f0000000000000,
+    0xa550000000000000, 0xe390000000000000, 0x28d0000000000000, 0x6e10000000000000,
+    0x3ea0000000000000, 0x7860000000000000, 0xb320000000000000, 0xf5e0000000000000,
+    0xfc90000000000000, 0xba50000000000000, 0x7110000000000000, 0x37d0000000000000,
+    0x6760000000000000, 0x21a0000000000000, 0xeae0000000000000, 0xac20000000000000,
+    0x4b80000000000000, 0xd40000000000000, 0xc600000000000000, 0x80c0000000000000,
+    0xd070000000000000, 0x96b0000000000000, 0x5df0000000000000, 0x1b30000000000000,
+  },
+};
+static const CrcFold crc_cat_f4 = {
+    12, 0, 0x80f0000000000000,
+    { 0x8110000000000000, 0xbca0000000000000 }, { 0x4300000000000000, 0xe690000000000000 }, { 0xdc90000000000000, 0x6b90000000000000 },
+    0x6b90000000000000, 0xff3f87cce013f47b
+};
+
+/* CRC-16/ARC */
+static const uint64_t crc_cat_t5[8][256] = {
+  {
+    0, 0xc0c1, 0xc181, 0x140,
+    0xc301, 0x3c0, 0x280, 0xc241,
+    0xc601, 0x6c0, 0x780, 0xc741,
+    0x500, 0xc5c1, 0xc481, 0x440,
+    0xcc01, 0xcc0, 0xd80, 0xcd41,
+    0xf00, 0xcfc1, 0xce81, 0xe40,
+    0xa00, 0xcac1, 0xcb81, 0xb40,
+    0xc901, 0x9c0, 0x880, 0xc841,
+    0xd801, 0x18c0, 0x1980, 0xd941,
+    0x1b00, 0xdbc1, 0xda81, 0x1a40,
+    0x1e00, 0xdec1, 0xdf81, 0x1f40,
+    0xdd01, 0x1dc0, 0x1c80, 0xdc41,
+    0x1400, 0xd4c1, 0xd581, 0x1540,
+    0xd701, 0x17c0, 0x1680, 0xd641,
+    0xd201, 0x12c0, 0x1380, 0xd341,
+    0x1100, 0xd1c1, 0xd081, 0x1040,
+    0xf001, 0x30c0, 0x3180, 0xf141,
+    0x3300, 0xf3c1, 0xf281, 0x3240,
+    0x3600, 0xf6c1, 0xf781, 0x3740,
+    0xf501, 0x35c0, 0x3480, 0xf441,
+    0x3c00, 0xfcc1, 0xfd81, 0x3d40,
+    0xff01, 0x3fc0, 0x3e80, 0xfe41,
+    0xfa01, 0x3ac0, 0x3b80, 0xfb41,
+    0x3900, 0xf9c1, 0xf881, 0x3840,
+    0x2800, 0xe8c1, 0xe981, 0x2940,
+    0xeb01, 0x2bc0, 0x2a80, 0xea41,
+    0xee01, 0x2ec0, 0x2f80, 0xef41,
+    0x2d00, 0xedc1, 0xec81, 0x2c40,
+    0xe401, 0x24c0, 0x2580, 0xe541,
+    0x2700, 0xe7c1, 0xe681, 0x2640,
+    0x2200, 0xe2c1, 0xe381, 0x2340,
+    0xe101, 0x21c0, 0x2080, 0xe041,
+    0xa001, 0x60c0, 0x6180, 0xa141,
+    0x6300, 0xa3c1, 0xa281, 0x6240,
+    0x6600, 0xa6c1, 0xa781, 0x6740,
+    0xa501, 0x65c0, 0x6480, 0xa441,
+    0x6c00, 0xacc1, 0xad81, 0x6d40,
+    0xaf01, 0x6fc0, 0x6e80, 0xae41,
+    0xaa01, 0x6ac0, 0x6b80, 0xab41,
+    0x6900, 0xa9c1, 0xa881, 0x6840,
+    0x7800, 0xb8c1, 0xb981, 0x7940,
+    0xbb01, 0x7bc0, 0x7a80, 0xba41,
+    0xbe01, 0x7ec0, 0x7f80, 0xbf41,
+    0x7d00, 0xbdc1, 0xbc81, 0x7c40,
+    0xb401, 0x74c0, 0x7580, 0xb541,
+    0x7700, 0xb7c1, 0xb681, 0x7640,
+    0x7200, 0xb2c1, 0xb381, 0x7340,
+    0xb101, 0x71c0, 0x7080, 0xb041,
+    0x5000, 0x90c1, 0x9181, 0x5140,
+    0x9301, 0x53c0, 0x5280, 0x9241,
+    0x9601, 0x56c0, 0x5780, 0x9741,
+    0x5500, 0x95c1, 0x9481, 0x5440,
+    0x9c01, 0x5cc0, 0x5d80, 0x9d41,
+    0x5f00, 0x9fc1, 0x9e81, 0x5e40,
+    0x5a00, 0x9ac1, 0x9b81, 0x5b40,
+    0x9901, 0x59c0, 0x5880, 0x9841,
+    0x8801, 0x48c0, 0x4980, 0x8941,
+    0x4b00, 0x8bc1, 0x8a81, 0x4a40,
+    0x4e00, 0x8ec1, 0x8f81, 0x4f40,
+    0x8d01, 0x4dc0, 0x4c80, 0x8c41,
+    0x4400, 0x84c1, 0x8581, 0x4540,
+    0x8701, 0x47c0, 0x4680, 0x8641,
+    0x8201, 0x42c0, 0x4380, 0x8341,
+    0x4100, 0x81c1, 0x8081, 0x4040,
+  },
+  {
+    0, 0x9001, 0x6001, 0xf000,
+    0xc002, 0x5003, 0xa003, 0x3002,
+    0xc007, 0x5006, 0xa006, 0x3007,
+    0x5, 0x9004, 0x6004, 0xf005,
+    0xc00d, 0x500c, 0xa00c, 0x300d,
+    0xf, 0x900e, 0x600e, 0xf00f,
+    0xa, 0x900b, 0x600b, 0xf00a,
+    0xc008, 0x5009, 0xa009, 0x3008,
+    0xc019, 0x5018, 0xa018, 0x3019,
+    0x1b, 0x901a, 0x601a, 0xf01b,
+    0x1e, 0x901f, 0x601f, 0xf01e,
+    0xc01c, 0x501d, 0xa01d, 0x301c,
+    0x14, 0x9015, 0x6015, 0xf014,
+    0xc016, 0x5017, 0xa017, 0x3016,
+    0xc013, 0x5012, 0xa012, 0x3013,
+    0x11, 0x9010, 0x6010, 0xf011,
+    0xc031, 0x5030, 0xa030, 0x3031,
+    0x33, 0x9032, 0x6032, 0xf033,
+    0x36, 0x9037, 0x6037, 0xf036,
+    0xc034, 0x5035, 0xa035, 0x3034,
+    0x3c, 0x903d, 0x603d, 0xf03c,
+    0xc03e, 0x503f, 0xa03f, 0x303e,
+    0xc03b, 0x503a, 0xa03a, 0x303b,
+    0x39, 0x9038, 0x6038, 0xf039,
+    0x28, 0x9029, 0x6029, 0xf028,
+    0xc02a, 0x502b, 0xa02b, 0x302a,
+    0xc02f, 0x502e, 0xa02e, 0x302f,
+    0x2d, 0x902c, 0x602c, 0xf02d,
+    0xc025, 0x5024, 0xa024, 0x3025,
+    0x27, 0x9026, 0x6026, 0xf027,
+    0x22, 0x9023, 0x6023, 0xf022,
+    0xc020, 0x5021, 0xa021, 0x3020,
+    0xc061, 0x5060, 0xa060, 0x3061,
+    0x63, 0x9062, 0x6062, 0xf063,
+    0x66, 0x9067, 0x6067, 0xf066,
+    0xc064, 0x5065, 0xa065, 0x3064,
+    0x6c, 0x906d, 0x606d, 0xf06c,
+    0xc06e, 0x506f, 0xa06f, 0x306e,
+    0xc06b, 0x506a, 0xa06a, 0x306b,
+    0x69, 0x9068, 0x6068, 0xf069,
+    0x78, 0x9079, 0x6079, 0xf078,
+    0xc07a, 0x507b, 0xa07b, 0x307a,
+    0xc07f, 0x507e, 0xa07e, 0x307f,
+    0x7d, 0x907c, 0x607c, 0xf07d,
+    0xc075, 0x5074, 0xa074, 0x3075,
+    0x77, 0x9076, 0x6076, 0xf077,
+    0x72, 0x9073, 0x6073, 0xf072,
+    0xc070, 0x5071, 0xa071, 0x3070,
+    0x50, 0x9051, 0x6051, 0xf050,
+    0xc052, 0x5053, 0xa053, 0x3052,
+    0xc057, 0x5056, 0xa056, 0x3057,
+    0x55, 0x9054, 0x6054, 0xf055,
+    0xc05d, 0x505c, 0xa05c, 0x305d,
+    0x5f, 0x905e, 0x605e, 0xf05f,
+    0x5a, 0x905b, 0x605b, 0xf05a,
+    0xc058, 0x5059, 0xa059, 0x3058,
+    0xc049, 0x5048, 0xa048, 0x3049,
+    0x4b, 0x904a, 0x604a, 0xf04b,
+    0x4e, 0x904f, 0x604f, 0xf04e,
+    0xc04c, 0x504d, 0xa04d, 0x304c,
+    0x44, 0x9045, 0x6045, 0xf044,
+    0xc046, 0x5047, 0xa047, 0x3046,
+    0xc043, 0x5042, 0xa042, 0x3043,
+    0x41, 0x9040, 0x6040, 0xf041,
+  },
+  {
+    0, 0xc051, 0xc0a1, 0xf0,
+    0xc141, 0x110, 0x1e0, 0xc1b1,
+    0xc281, 0x2d0, 0x220, 0xc271,
+    0x3c0, 0xc391, 0xc361, 0x330,
+    0xc501, 0x550, 0x5a0, 0xc5f1,
+    0x440, 0xc411, 0xc4e1, 0x4b0,
+    0x780, 0xc7d1, 0xc721, 0x770,
+    0xc6c1, 0x690, 0x660, 0xc631,
+    0xca01, 0xa50, 0xaa0, 0xcaf1,
+    0xb40, 0xcb11, 0xcbe1, 0xbb0,
+    0x880, 0xc8d1, 0xc821, 0x870,
+    0xc9c1, 0x990, 0x960, 0xc931,
+    0xf00, 0xcf51, 0xcfa1, 0xff0,
+    0xce41, 0xe10, 0xee0, 0xceb1,
+    0xcd81, 0xdd0, 0xd20, 0xcd71,
+    0xcc0, 0xcc91, 0xcc61, 0xc30,
+    0xd401, 0x1450, 0x14a0, 0xd4f1,
+    0x1540, 0xd511, 0xd5e1, 0x15b0,
+    0x1680, 0xd6d1, 0xd621, 0x1670,
+    0xd7c1, 0x1790, 0x1760, 0xd731,
+    0x1100, 0xd151, 0xd1a1, 0x11f0,
+    0xd041, 0x1010, 0x10e0, 0xd0b1,
+    0xd381, 0x13d0, 0x1320, 0xd371,
+    0x12c0, 0xd291, 0xd261, 0x1230,
+    0x1e00, 0xde51, 0xdea1, 0x1ef0,
+    0xdf41, 0x1f10, 0x1fe0, 0xdfb1,
+    0xdc81, 0x1cd0, 0x1c20, 0xdc71,
+    0x1dc0, 0xdd91, 0xdd61, 0x1d30,
+    0xdb01, 0x1b50, 0x1ba0, 0xdbf1,
+    0x1a40, 0xda11, 0xdae1, 0x1ab0,
+    0x1980, 0xd9d1, 0xd921, 0x1970,
+    0xd8c1, 0x1890, 0x1860, 0xd831,
+    0xe801, 0x2850, 0x28a0, 0xe8f1,
+    0x2940, 0xe911, 0xe9e1, 0x29b0,
+    0x2a80, 0xead1, 0xea21, 0x2a70,
+    0xebc1, 0x2b90, 0x2b60, 0xeb31,
+    0x2d00, 0xed51, 0xeda1, 0x2df0,
+    0xec41, 0x2c10, 0x2ce0, 0xecb1,
+    0xef81, 0x2fd0, 0x2f20, 0xef71,
+    0x2ec0, 0xee91, 0xee61, 0x2e30,
+    0x2200, 0xe251, 0xe2a1, 0x22f0,
+    0xe341, 0x2310, 0x23e0, 0xe3b1,
+    0xe081, 0x20d0, 0x2020, 0xe071,
+    0x21c0, 0xe191, 0xe161, 0x2130,
+    0xe701, 0x2750, 0x27a0, 0xe7f1,
+    0x2640, 0xe611, 0xe6e1, 0x26b0,
+    0x2580, 0xe5d1, 0xe521, 0x2570,
+    0xe4c1, 0x2490, 0x2460, 0xe431,
+    0x3c00, 0xfc51, 0xfca1, 0x3cf0,
+    0xfd41, 0x3d10, 0x3de0, 0xfdb1,
+    0xfe81, 0x3ed0, 0x3e20, 0xfe71,
+    0x3fc0, 0xff91, 0xff61, 0x3f30,
+    0xf901, 0x3950, 0x39a0, 0xf9f1,
+    0x3840, 0xf811, 0xf8e1, 0x38b0,
+    0x3b80, 0xfbd1, 0xfb21, 0x3b70,
+    0xfac1, 0x3a90, 0x3a60, 0xfa31,
+    0xf601, 0x3650, 0x36a0, 0xf6f1,
+    0x3740, 0xf711, 0xf7e1, 0x37b0,
+    0x3480, 0xf4d1, 0xf421, 0x3470,
+    0xf5c1, 0x3590, 0x3560, 0xf531,
+    0x3300, 0xf351, 0xf3a1, 0x33f0,
+    0xf241, 0x3210, 0x32e0, 0xf2b1,
+    0xf181, 0x31d0, 0x3120, 0xf171,
+    0x30c0, 0xf091, 0xf061, 0x3030,
+  },
+  {
+    0, 0xfc01, 0xb801, 0x4400,
+    0x3001, 0xcc00, 0x8800, 0x7401,
+    0x6002, 0x9c03, 0xd803, 0x2402,
+    0x5003, 0xac02, 0xe802, 0x1403,
+    0xc004, 0x3c05, 0x7805, 0x8404,
+    0xf005, 0xc04, 0x4804, 0xb405,
+    0xa006, 0x5c07, 0x1807, 0xe406,
+    0x9007, 0x6c06, 0x2806, 0xd407,
+    0xc00b, 0x3c0a, 0x780a, 0x840b,
+    0xf00a, 0xc0b, 0x480b, 0xb40a,
+    0xa009, 0x5c08, 0x1808, 0xe409,
+    0x9008, 0x6c09, 0x2809, 0xd408,
+    0xf, 0xfc0e, 0xb80e, 0x440f,
+    0x300e, 0xcc0f, 0x880f, 0x740e,
+    0x600d, 0x9c0c, 0xd80c, 0x240d,
+    0x500c, 0xac0d, 0xe80d, 0x140c,
+    0xc015, 0x3c14, 0x7814, 0x8415,
+    0xf014, 0xc15, 0x4815, 0xb414,
+    0xa017, 0x5c16, 0x1816, 0xe417,
+    0x9016, 0x6c17, 0x2817, 0xd416,
+    0x11, 0xfc10, 0xb810, 0x4411,
+    0x3010, 0xcc11, 0x8811, 0x7410,
+    0x6013, 0x9c12, 0xd812, 0x2413,
+    0x5012, 0xac13, 0xe813, 0x1412,
+    0x1e, 0xfc1f, 0xb81f, 0x441e,
+    0x301f, 0xcc1e, 0x881e, 0x741f,
+    0x601c, 0x9c1d, 0xd81d, 0x241c,
+    0x501d, 0xac1c, 0xe81c, 0x141d,
+    0xc01a, 0x3c1b, 0x781b, 0x841a,
+    0xf01b, 0xc1a, 0x481a, 0xb41b,
+    0xa018, 0x5c19, 0x1819, 0xe418,
+    0x9019, 0x6c18, 0x2818, 0xd419,
+    0xc029, 0x3c28, 0x7828, 0x8429,
+    0xf028, 0xc29, 0x4829, 0xb428,
+    0xa02b, 0x5c2a, 0x182a, 0xe42b,
+    0x902a, 0x6c2b, 0x282b, 0xd42a,
+    0x2d, 0xfc2c, 0xb82c, 0x442d,
+    0x302c, 0xcc2d, 0x882d, 0x742c,
+    0x602f, 0x9c2e, 0xd82e, 0x242f,
+    0x502e, 0xac2f, 0xe82f, 0x142e,
+    0x22, 0xfc23, 0xb823, 0x4422,
+    0x3023, 0xcc22, 0x8822, 0x7423,
+    0x6020, 0x9c21, 0xd821, 0x2420,
+    0x5021, 0xac20, 0xe820, 0x1421,
+    0xc026, 0x3c27, 0x7827, 0x8426,
+    0xf027, 0xc26, 0x4826, 0xb427,
+    0xa024, 0x5c25, 0x1825, 0xe424,
+    0x9025, 0x6c24, 0x2824, 0xd425,
+    0x3c, 0xfc3d, 0xb83d, 0x443c,
+    0x303d, 0xcc3c, 0x883c, 0x743d,
+    0x603e, 0x9c3f, 0xd83f, 0x243e,
+    0x503f, 0xac3e, 0xe83e, 0x143f,
+    0xc038, 0x3c39, 0x7839, 0x8438,
+    0xf039, 0xc38, 0x4838, 0xb439,
+    0xa03a, 0x5c3b, 0x183b, 0xe43a,
+    0x903b, 0x6c3a, 0x283a, 0xd43b,
+    0xc037, 0x3c36, 0x7836, 0x8437,
+    0xf036, 0xc37, 0x4837, 0xb436,
+    0xa035, 0x5c34, 0x1834, 0xe435,
+    0x9034, 0x6c35, 0x2835, 0xd434,
+    0x33, 0xfc32, 0xb832, 0x4433,
+    0x3032, 0xcc33, 0x8833, 0x7432,
+    0x6031, 0x9c30, 0xd830, 0x2431,
+    0x5030, 0xac31, 0xe831, 0x1430,
+  },
+  {
+    0, 0xc03d, 0xc079, 0x44,
+    0xc0f1, 0xcc, 0x88, 0xc0b5,
+    0xc1e1, 0x1dc, 0x198, 0xc1a5,
+    0x110, 0xc12d, 0xc169, 0x154,
+    0xc3c1, 0x3fc, 0x3b8, 0xc385,
+    0x330, 0xc30d, 0xc349, 0x374,
+    0x220, 0xc21d, 0xc259, 0x264,
+    0xc2d1, 0x2ec, 0x2a8, 0xc295,
+    0xc781, 0x7bc, 0x7f8, 0xc7c5,
+    0x770, 0xc74d, 0xc709, 0x734,
+    0x660, 0xc65d, 0xc619, 0x624,
+    0xc691, 0x6ac, 0x6e8, 0xc6d5,
+    0x440, 0xc47d, 0xc439, 0x404,
+    0xc4b1, 0x48c, 0x4c8, 0xc4f5,
+    0xc5a1, 0x59c, 0x5d8, 0xc5e5,
+    0x550, 0xc56d, 0xc529, 0x514,
+    0xcf01, 0xf3c, 0xf78, 0xcf45,
+    0xff0, 0xcfcd, 0xcf89, 0xfb4,
+    0xee0, 0xcedd, 0xce99, 0xea4,
+    0xce11, 0xe2c, 0xe68, 0xce55,
+    0xcc0, 0xccfd, 0xccb9, 0xc84,
+    0xcc31, 0xc0c, 0xc48, 0xcc75,
+    0xcd21, 0xd1c, 0xd58, 0xcd65,
+    0xdd0, 0xcded, 0xcda9, 0xd94,
+    0x880, 0xc8bd, 0xc8f9, 0x8c4,
+    0xc871, 0x84c, 0x808, 0xc835,
+    0xc961, 0x95c, 0x918, 0xc925,
+    0x990, 0xc9ad, 0xc9e9, 0x9d4,
+    0xcb41, 0xb7c, 0xb38, 0xcb05,
+    0xbb0, 0xcb8d, 0xcbc9, 0xbf4,
+    0xaa0, 0xca9d, 0xcad9, 0xae4,
+    0xca51, 0xa6c, 0xa28, 0xca15,
+    0xde01, 0x1e3c, 0x1e78, 0xde45,
+    0x1ef0, 0xdecd, 0xde89, 0x1eb4,
+    0x1fe0, 0xdfdd, 0xdf99, 0x1fa4,
+    0xdf11, 0x1f2c, 0x1f68, 0xdf55,
+    0x1dc0, 0xddfd, 0xddb9, 0x1d84,
+    0xdd31, 0x1d0c, 0x1d48, 0xdd75,
+    0xdc21, 0x1c1c, 0x1c58, 0xdc65,
+    0x1cd0, 0xdced, 0xdca9, 0x1c94,
+    0x1980, 0xd9bd, 0xd9f9, 0x19c4,
+    0xd971, 0x194c, 0x1908, 0xd935,
+    0xd861, 0x185c, 0x1818, 0xd825,
+    0x1890, 0xd8ad, 0xd8e9, 0x18d4,
+    0xda41, 0x1a7c, 0x1a38, 0xda05,
+    0x1ab0, 0xda8d, 0xdac9, 0x1af4,
+    0x1ba0, 0xdb9d, 0xdbd9, 0x1be4,
+    0xdb51, 0x1b6c, 0x1b28, 0xdb15,
+    0x1100, 0xd13d, 0xd179, 0x1144,
+    0xd1f1, 0x11cc, 0x1188, 0xd1b5,
+    0xd0e1, 0x10dc, 0x1098, 0xd0a5,
+    0x1010, 0xd02d, 0xd069, 0x1054,
+    0xd2c1, 0x12fc, 0x12b8, 0xd285,
+    0x1230, 0xd20d, 0xd249, 0x1274,
+    0x1320, 0xd31d, 0xd359, 0x1364,
+    0xd3d1, 0x13ec, 0x13a8, 0xd395,
+    0xd681, 0x16bc, 0x16f8, 0xd6c5,
+    0x1670, 0xd64d, 0xd609, 0x1634,
+    0x1760, 0xd75d, 0xd719, 0x1724,
+    0xd791, 0x17ac, 0x17e8, 0xd7d5,
+    0x1540, 0xd57d, 0xd539, 0x1504,
+    0xd5b1, 0x158c, 0x15c8, 0xd5f5,
+    0xd4a1, 0x149c, 0x14d8, 0xd4e5,
+    0x1450, 0xd46d, 0xd429, 0x1414,
+  },
+  {
+    0, 0xd101, 0xe201, 0x3300,
+    0x8401, 0x5500, 0x6600, 0xb701,
+    0x4801, 0x9900, 0xaa00, 0x7b01,
+    0xcc00, 0x1d01, 0x2e01, 0xff00,
+    0x9002, 0x4103, 0x7203, 0xa302,
+    0x1403, 0xc502, 0xf602, 0x2703,
+    0xd803, 0x902, 0x3a02, 0xeb03,
+    0x5c02, 0x8d03, 0xbe03, 0x6f02,
+    0x6007, 0xb106, 0x8206, 0x5307,
+    0xe406, 0x3507, 0x607, 0xd706,
+    0x2806, 0xf907, 0xca07, 0x1b06,
+    0xac07, 0x7d06, 0x4e06, 0x9f07,
+    0xf005, 0x2104, 0x1204, 0xc305,
+    0x7404, 0xa505, 0x9605, 0x4704,
+    0xb804, 0x6905, 0x5a05, 0x8b04,
+    0x3c05, 0xed04, 0xde04, 0xf05,
+    0xc00e, 0x110f, 0x220f, 0xf30e,
+    0x440f, 0x950e, 0xa60e, 0x770f,
+    0x880f, 0x590e, 0x6a0e, 0xbb0f,
+    0xc0e, 0xdd0f, 0xee0f, 0x3f0e,
+    0x500c, 0x810d, 0xb20d, 0x630c,
+    0xd40d, 0x50c, 0x360c, 0xe70d,
+    0x180d, 0xc90c, 0xfa0c, 0x2b0d,
+    0x9c0c, 0x4d0d, 0x7e0d, 0xaf0c,
+    0xa009, 0x7108, 0x4208, 0x9309,
+    0x2408, 0xf509, 0xc609, 0x1708,
+    0xe808, 0x3909, 0xa09, 0xdb08,
+    0x6c09, 0xbd08, 0x8e08, 0x5f09,
+    0x300b, 0xe10a, 0xd20a, 0x30b,
+    0xb40a, 0x650b, 0x560b, 0x870a,
+    0x780a, 0xa90b, 0x9a0b, 0x4b0a,
+    0xfc0b, 0x2d0a, 0x1e0a, 0xcf0b,
+    0xc01f, 0x111e, 0x221e, 0xf31f,
+    0x441e, 0x951f, 0xa61f, 0x771e,
+    0x881e, 0x591f, 0x6a1f, 0xbb1e,
+    0xc1f, 0xdd1e, 0xee1e, 0x3f1f,
+    0x501d, 0x811c, 0xb21c, 0x631d,
+    0xd41c, 0x51d, 0x361d, 0xe71c,
+    0x181c, 0xc91d, 0xfa1d, 0x2b1c,
+    0x9c1d, 0x4d1c, 0x7e1c, 0xaf1d,
+    0xa018, 0x7119, 0x4219, 0x9318,
+    0x2419, 0xf518, 0xc618, 0x1719,
+    0xe819, 0x3918, 0xa18, 0xdb19,
+    0x6c18, 0xbd19, 0x8e19, 0x5f18,
+    0x301a, 0xe11b, 0xd21b, 0x31a,
+    0xb41b, 0x651a, 0x561a, 0x871b,
+    0x781b, 0xa91a, 0x9a1a, 0x4b1b,
+    0xfc1a, 0x2d1b, 0x1e1b, 0xcf1a,
+    0x11, 0xd110, 0xe210, 0x3311,
+    0x8410, 0x5511, 0x6611, 0xb710,
+    0x4810, 0x9911, 0xaa11, 0x7b10,
+    0xcc11, 0x1d10, 0x2e10, 0xff11,
+    0x9013, 0x4112, 0x7212, 0xa313,
+    0x1412, 0xc513, 0xf613, 0x2712,
+    0xd812, 0x913, 0x3a13, 0xeb12,
+    0x5c13, 0x8d12, 0xbe12, 0x6f13,
+    0x6016, 0xb117, 0x8217, 0x5316,
+    0xe417, 0x3516, 0x616, 0xd717,
+    0x2817, 0xf916, 0xca16, 0x1b17,
+    0xac16, 0x7d17, 0x4e17, 0x9f16,
+    0xf014, 0x2115, 0x1215, 0xc314,
+    0x7415, 0xa514, 0x9614, 0x4715,
+    0xb815, 0x6914, 0x5a14, 0x8b15,
+    0x3c14, 0xed15, 0xde15, 0xf14,
+  },
+  {
+    0, 0xc010, 0xc023, 0x33,
+    0xc045, 0x55, 0x66, 0xc076,
+    0xc089, 0x99, 0xaa, 0xc0ba,
+    0xcc, 0xc0dc, 0xc0ef, 0xff,
+    0xc111, 0x101, 0x132, 0xc122,
+    0x154, 0xc144, 0xc177, 0x167,
+    0x198, 0xc188, 0xc1bb, 0x1ab,
+    0xc1dd, 0x1cd, 0x1fe, 0xc1ee,
+    0xc221, 0x231, 0x202, 0xc212,
+    0x264, 0xc274, 0xc247, 0x257,
+    0x2a8, 0xc2b8, 0xc28b, 0x29b,
+    0xc2ed, 0x2fd, 0x2ce, 0xc2de,
+    0x330, 0xc320, 0xc313, 0x303,
+    0xc375, 0x365, 0x356, 0xc346,
+    0xc3b9, 0x3a9, 0x39a, 0xc38a,
+    0x3fc, 0xc3ec, 0xc3df, 0x3cf,
+    0xc441, 0x451, 0x462, 0xc472,
+    0x404, 0xc414, 0xc427, 0x437,
+    0x4c8, 0xc4d8, 0xc4eb, 0x4fb,
+    0xc48d, 0x49d, 0x4ae, 0xc4be,
+    0x550, 0xc540, 0xc573, 0x563,
+    0xc515, 0x505, 0x536, 0xc526,
+    0xc5d9, 0x5c9, 0x5fa, 0xc5ea,
+    0x59c, 0xc58c, 0xc5bf, 0x5af,
+    0x660, 0xc670, 0xc643, 0x653,
+    0xc625, 0x635, 0x606, 0xc616,
+    0xc6e9, 0x6f9, 0x6ca, 0xc6da,
+    0x6ac, 0xc6bc, 0xc68f, 0x69f,
+    0xc771, 0x761, 0x752, 0xc742,
+    0x734, 0xc724, 0xc717, 0x707,
+    0x7f8, 0xc7e8, 0xc7db, 0x7cb,
+    0xc7bd, 0x7ad, 0x79e, 0xc78e,
+    0xc881, 0x891, 0x8a2, 0xc8b2,
+    0x8c4, 0xc8d4, 0xc8e7, 0x8f7,
+    0x808, 0xc818, 0xc82b, 0x83b,
+    0xc84d, 0x85d, 0x86e, 0xc87e,
+    0x990, 0xc980, 0xc9b3, 0x9a3,
+    0xc9d5, 0x9c5, 0x9f6, 0xc9e6,
+    0xc919, 0x909, 0x93a, 0xc92a,
+    0x95c, 0xc94c, 0xc97f, 0x96f,
+    0xaa0, 0xcab0, 0xca83, 0xa93,
+    0xcae5, 0xaf5, 0xac6, 0xcad6,
+    0xca29, 0xa39, 0xa0a, 0xca1a,
+    0xa6c, 0xca7c, 0xca4f, 0xa5f,
+    0xcbb1, 0xba1, 0xb92, 0xcb82,
+    0xbf4, 0xcbe4, 0xcbd7, 0xbc7,
+    0xb38, 0xcb28, 0xcb1b, 0xb0b,
+    0xcb7d, 0xb6d, 0xb5e, 0xcb4e,
+    0xcc0, 0xccd0, 0xcce3, 0xcf3,
+    0xcc85, 0xc95, 0xca6, 0xccb6,
+    0xcc49, 0xc59, 0xc6a, 0xcc7a,
+    0xc0c, 0xcc1c, 0xcc2f, 0xc3f,
+    0xcdd1, 0xdc1, 0xdf2, 0xcde2,
+    0xd94, 0xcd84, 0xcdb7, 0xda7,
+    0xd58, 0xcd48, 0xcd7b, 0xd6b,
+    0xcd1d, 0xd0d, 0xd3e, 0xcd2e,
+    0xcee1, 0xef1, 0xec2, 0xced2,
+    0xea4, 0xceb4, 0xce87, 0xe97,
+    0xe68, 0xce78, 0xce4b, 0xe5b,
+    0xce2d, 0xe3d, 0xe0e, 0xce1e,
+    0xff0, 0xcfe0, 0xcfd3, 0xfc3,
+    0xcfb5, 0xfa5, 0xf96, 0xcf86,
+    0xcf79, 0xf69, 0xf5a, 0xcf4a,
+    0xf3c, 0xcf2c, 0xcf1f, 0xf0f,
+  },
+  {
+    0, 0xccc1, 0xd981, 0x1540,
+    0xf301, 0x3fc0, 0x2a80, 0xe641,
+    0xa601, 0x6ac0, 0x7f80, 0xb341,
+    0x5500, 0x99c1, 0x8c81, 0x4040,
+    0xc01, 0xc0c0, 0xd580, 0x1941,
+    0xff00, 0x33c1, 0x2681, 0xea40,
+    0xaa00, 0x66c1, 0x7381, 0xbf40,
+    0x5901, 0x95c0, 0x8080, 0x4c41,
+    0x1802, 0xd4c3, 0xc183, 0xd42,
+    0xeb03, 0x27c2, 0x3282, 0xfe43,
+    0xbe03, 0x72c2, 0x6782, 0xab43,
+    0x4d02, 0x81c3, 0x9483, 0x5842,
+    0x1403, 0xd8c2, 0xcd82, 0x143,
+    0xe702, 0x2bc3, 0x3e83, 0xf242,
+    0xb202, 0x7ec3, 0x6b83, 0xa742,
+    0x4103, 0x8dc2, 0x9882, 0x5443,
+    0x3004, 0xfcc5, 0xe985, 0x2544,
+    0xc305, 0xfc4, 0x1a84, 0xd645,
+    0x9605, 0x5ac4, 0x4f84, 0x8345,
+    0x6504, 0xa9c5, 0xbc85, 0x7044,
+    0x3c05, 0xf0c4, 0xe584, 0x2945,
+    0xcf04, 0x3c5, 0x1685, 0xda44,
+    0x9a04, 0x56c5, 0x4385, 0x8f44,
+    0x6905, 0xa5c4, 0xb084, 0x7c45,
+    0x2806, 0xe4c7, 0xf187, 0x3d46,
+    0xdb07, 0x17c6, 0x286, 0xce47,
+    0x8e07, 0x42c6, 0x5786, 0x9b47,
+    0x7d06, 0xb1c7, 0xa487, 0x6846,
+    0x2407, 0xe8c6, 0xfd86, 0x3147,
+    0xd706, 0x1bc7, 0xe87, 0xc246,
+    0x8206, 0x4ec7, 0x5b87, 0x9746,
+    0x7107, 0xbdc6, 0xa886, 0x6447,
+    0x6008, 0xacc9, 0xb989, 0x7548,
+    0x9309, 0x5fc8, 0x4a88, 0x8649,
+    0xc609, 0xac8, 0x1f88, 0xd349,
+    0x3508, 0xf9c9, 0xec89, 0x2048,
+    0x6c09, 0xa0c8, 0xb588, 0x7949,
+    0x9f08, 0x53c9, 0x4689, 0x8a48,
+    0xca08, 0x6c9, 0x1389, 0xdf48,
+    0x3909, 0xf5c8, 0xe088, 0x2c49,
+    0x780a, 0xb4cb, 0xa18b, 0x6d4a,
+    0x8b0b, 0x47ca, 0x528a, 0x9e4b,
+    0xde0b, 0x12ca, 0x78a, 0xcb4b,
+    0x2d0a, 0xe1cb, 0xf48b, 0x384a,
+    0x740b, 0xb8ca, 0xad8a, 0x614b,
+    0x870a, 0x4bcb, 0x5e8b, 0x924a,
+    0xd20a, 0x1ecb, 0xb8b, 0xc74a,
+    0x210b, 0xedca, 0xf88a, 0x344b,
+    0x500c, 0x9ccd, 0x898d, 0x454c,
+    0xa30d, 0x6fcc, 0x7a8c, 0xb64d,
+    0xf60d, 0x3acc, 0x2f8c, 0xe34d,
+    0x50c, 0xc9cd, 0xdc8d, 0x104c,
+    0x5c0d, 0x90cc, 0x858c, 0x494d,
+    0xaf0c, 0x63cd, 0x768d, 0xba4c,
+    0xfa0c, 0x36cd, 0x238d, 0xef4c,
+    0x90d, 0xc5cc, 0xd08c, 0x1c4d,
+    0x480e, 0x84cf, 0x918f, 0x5d4e,
+    0xbb0f, 0x77ce, 0x628e, 0xae4f,
+    0xee0f, 0x22ce, 0x378e, 0xfb4f,
+    0x1d0e, 0xd1cf, 0xc48f, 0x84e,
+    0x440f, 0x88ce, 0x9d8e, 0x514f,
+    0xb70e, 0x7bcf, 0x6e8f, 0xa24e,
+    0xe20e, 0x2ecf, 0x3b8f, 0xf74e,
+    0x110f, 0xddce, 0xc88e, 0x44f,
+  },
+};
+static const CrcFold crc_cat_f5 = {
+    16, 1, 0xa001,
+    { 0x999d, 0xfcc1 }, { 0xbffa, 0xf0c1 }, { 0xccc1, 0x90c1 },
+    0xccc1, 0xf87ff5ffe7ffdfff
+};
+
+/* CRC-16/IBM-3740 */
+static const uint64_t crc_cat_t6[8][256] = {
+  {
+    0, 0x1021000000000000, 0x2042000000000000, 0x3063000000000000,
+    0x4084000000000000, 0x50a5000000000000, 0x60c6000000000000, 0x70e7000000000000,
+    0x8108000000000000, 0x9129000000000000, 0xa14a000000000000, 0xb16b000000000000,
+    0xc18c000000000000, 0xd1ad000000000000, 0xe1ce000000000000, 0xf1ef000000000000,
+    0x1231000000000000, 0x210000000000000, 0x3273000000000000, 0x2252000000000000,
+    0x52b5000000000000, 0x4294000000000000, 0x72f7000000000000, 0x62d6000000000000,
+    0x9339000000000000, 0x8318000000000000, 0xb37b000000000000, 0xa35a000000000000,
+    0xd3bd000000000000, 0xc39c000000000000, 0xf3ff000000000000, 0xe3de000000000000,
+    0x2462000000000000, 0x3443000000000000, 0x420000000000000, 0x1401000000000000,
+    0x64e6000000000000, 0x74c7000000000000, 0x44a4000000000000, 0x5485000000000000,
+    0xa56a000000000000, 0xb54b000000000000, 0x8528000000000000, 0x9509000000000000,
+    0xe5ee000000000000, 0xf5cf000000000000, 0xc5ac000000000000, 0xd58d000000000000,
+    0x3653000000000000, 0x2672000000000000, 0x1611000000000000, 0x630000000000000,
+    0x76d7000000000000, 0x66f6000000000000, 0x5695000000000000, 0x46b4000000000000,
+    0xb75b000000000000, 0xa77a000000000000, 0x9719000000000000, 0x8738000000000000,
+    0xf7df000000000000, 0xe7fe000000000000, 0xd79d000000000000, 0xc7bc000000000000,
+    0x48c4000000000000, 0x58e5000000000000, 0x6886000000000000, 0x78a7000000000000,
+    0x840000000000000, 0x1861000000000000, 0x2802000000000000, 0x3823000000000000,
+    0xc9cc000000000000, 0xd9ed000000000000, 0xe98e000000000000, 0xf9af000000000000,
+    0x8948000000000000, 0x9969000000000000, 0xa90a000000000000, 0xb92b000000000000,
+    0x5af5000000000000, 0x4ad4000000000000, 0x7ab7000000000000, 0x6a96000000000000,
+    0x1a71000000000000, 0xa50000000000000, 0x3a33000000000000, 0x2a12000000000000,
+    0xdbfd000000000000, 0xcbdc000000000000, 0xfbbf000000000000, 0xeb9e000000000000,
+    0x9b79000000000000, 0x8b58000000000000, 0xbb3b000000000000, 0xab1a000000000000,
+    0x6ca6000000000000, 0x7c87000000000000, 0x4ce4000000000000, 0x5cc5000000000000,
+    0x2c22000000000000, 0x3c03000000000000, 0xc60000000000000, 0x1c41000000000000,
+    0xedae000000000000, 0xfd8f000000000000, 0xcdec000000000000, 0xddcd000000000000,
+    0xad2a000000000000, 0xbd0b000000000000, 0x8d68000000000000, 0x9d49000000000000,
+    0x7e97000000000000, 0x6eb6000000000000, 0x5ed5000000000000, 0x4ef4000000000000,
+    0x3e13000000000000, 0x2e32000000000000, 0x1e51000000000000, 0xe70000000000000,
+    0xff9f000000000000, 0xefbe000000000000, 0xdfdd000000000000, 0xcffc000000000000,
+    0xbf1b000000000000, 0xaf3a000000000000, 0x9f59000000000000, 0x8f78000000000000,
+    0x9188000000000000, 0x81a9000000000000, 0xb1ca000000000000, 0xa1eb000000000000,
+    0xd10c000000000000, 0xc12d000000000000, 0xf14e000000000000, 0xe16f000000000000,
+    0x1080000000000000, 0xa1000000000000, 0x30c2000000000000, 0x20e3000000000000,
+    0x5004000000000000, 0x4025000000000000, 0x7046000000000000, 0x6067000000000000,
+    0x83b9000000000000, 0x9398000000000000, 0xa3fb000000000000, 0xb3da000000000000,
+    0xc33d000000000000, 0xd31c000000000000, 0xe37f000000000000, 0xf35e000000000000,
+    0x2b1000000000000, 0x1290000000000000, 0x22f3000000000000, 0x32d2000000000000,
+    0x4235000000000000, 0x5214000000000000, 0x6277000000000000, 0x7256000000000000,
+    0xb5ea000000000000, 0xa5cb000000000000, 0x95a8000000000000, 0x8589000000000000,
+    0xf56e000000000000, 0xe54f000000000000, 0xd52c000000000000, 0xc50d000000000000,
+    0x34e2000000000000, 0x24c3000000000000, 0x14a0000000000000, 0x481000000000000,
+    0x7466000000000000, 0x6447000000000000, 0x5424000000000000, 0x4405000000000000,
+    0xa7db000000000000, 0xb7fa000000000000, 0x8799000000000000, 0x97b8000000000000,
+    0xe75f000000000000, 0xf77e000000000000, 0xc71d000000000000, 0xd73c000000000000,
+    0x26d3000000000000, 0x36f2000000000000, 0x691000000000000, 0x16b0000000000000,
+    0x6657000000000000, 0x7676000000000000, 0x4615000000000000, 0x5634000000000000,
+    0xd94c000000000000, 0xc96d000000000000, 0xf90e000000000000, 0xe92f000000000000,
+    0x99c8000000000000, 0x89e9000000000000, 0xb98a000000000000, 0xa9ab000000000000,
+    0x5844000000000000, 0x4865000000000000, 0x7806000000000000, 0x6827000000000000,
+    0x18c0000000000000, 0x8e1000000000000, 0x3882000000000000, 0x28a3000000000000,
+    0xcb7d000000000000, 0xdb5c000000000000, 0xeb3f000000000000, 0xfb1e000000000000,
+    0x8bf9000000000000, 0x9bd8000000000000, 0xabbb000000000000, 0xbb9a000000000000,
+    0x4a75000000000000, 0x5a54000000000000, 0x6a37000000000000, 0x7a16000000000000,
+    0xaf1000000000000, 0x1ad0000000000000, 0x2ab3000000000000, 0x3a92000000000000,
+    0xfd2e000000000000, 0xed0f000000000000, 0xdd6c000000000000, 0xcd4d000000000000,
+    0xbdaa000000000000, 0xad8b000000000000, 0x9de8000000000000, 0x8dc9000000000000,
+    0x7c26000000000000, 0x6c07000000000000, 0x5c64000000000000, 0x4c45000000000000,
+    0x3ca2000000000000, 0x2c83000000000000, 0x1ce0000000000000, 0xcc1000000000000,
+    0xef1f000000000000, 0xff3e000000000000, 0xcf5d000000000000, 0xdf7c000000000000,
+    0xaf9b000000000000, 0xbfba000000000000, 0x8fd9000000000000, 0x9ff8000000000000,
+    0x6e17000000000000, 0x7e36000000000000, 0x4e55000000000000, 0x5e74000000000000,
+    0x2e93000000000000, 0x3eb2000000000000, 0xed1000000000000, 0x1ef0000000000000,
+  },
+  {
+    0, 0x3331000000000000, 0x6662000000000000, 0x5553000000000000,
+    0xccc4000000000000, 0xfff5000000000000, 0xaaa6000000000000, 0x9997000000000000,
+    0x89a9000000000000, 0xba98000000000000, 0xefcb000000000000, 0xdcfa000000000000,
+    0x456d000000000000, 0x765c000000000000, 0x230f000000000000, 0x103e000000000000,
+    0x373000000000000, 0x3042000000000000, 0x6511000000000000, 0x5620000000000000,
+    0xcfb7000000000000, 0xfc86000000000000, 0xa9d5000000000000, 0x9ae4000000000000,
+    0x8ada000000000000, 0xb9eb000000000000, 0xecb8000000000000, 0xdf89000000000000,
+    0x461e000000000000, 0x752f000000000000, 0x207c000000000000, 0x134d000000000000,
+    0x6e6000000000000, 0x35d7000000000000, 0x6084000000000000, 0x53b5000000000000,
+    0xca22000000000000, 0xf913000000000000, 0xac40000000000000, 0x9f71000000000000,
+    0x8f4f000000000000, 0xbc7e000000000000, 0xe92d000000000000, 0xda1c000000000000,
+    0x438b000000000000, 0x70ba000000000000, 0x25e9000000000000, 0x16d8000000000000,
+    0x595000000000000, 0x36a4000000000000, 0x63f7000000000000, 0x50c6000000000000,
+    0xc951000000000000, 0xfa60000000000000, 0xaf33000000000000, 0x9c02000000000000,
+    0x8c3c000000000000, 0xbf0d000000000000, 0xea5e000000000000, 0xd96f000000000000,
+    0x40f8000000000000, 0x73c9000000000000, 0x269a000000000000, 0x15ab000000000000,
+    0xdcc000000000000, 0x3efd000000000000, 0x6bae000000000000, 0x589f000000000000,
+    0xc108000000000000, 0xf239000000000000, 0xa76a000000000000, 0x945b000000000000,
+    0x8465000000000000, 0xb754000000000000, 0xe207000000000000, 0xd136000000000000,
+    0x48a1000000000000, 0x7b90000000000000, 0x2ec3000000000000, 0x1df2000000000000,
+    0xebf000000000000, 0x3d8e000000000000, 0x68dd000000000000, 0x5bec000000000000,
+    0xc27b000000000000, 0xf14a000000000000, 0xa419000000000000, 0x9728000000000000,
+    0x8716000000000000, 0xb427000000000000, 0xe174000000000000, 0xd245000000000000,
+    0x4bd2000000000000, 0x78e3000000000000, 0x2db0000000000000, 0x1e81000000000000,
+    0xb2a000000000000, 0x381b000000000000, 0x6d48000000000000, 0x5e79000000000000,
+    0xc7ee000000000000, 0xf4df000000000000, 0xa18c000000000000, 0x92bd000000000000,
+    0x8283000000000000, 0xb1b2000000000000, 0xe4e1000000000000, 0xd7d0000000000000,
+    0x4e47000000000000, 0x7d76000000000000, 0x2825000000000000, 0x1b14000000000000,
+    0x859000000000000, 0x3b68000000000000, 0x6e3b000000000000, 0x5d0a000000000000,
+    0xc49d000000000000, 0xf7ac000000000000, 0xa2ff000000000000, 0x91ce000000000000,
+    0x81f0000000000000, 0xb2c1000000000000, 0xe792000000000000, 0xd4a3000000000000,
+    0x4d34000000000000, 0x7e05000000000000, 0x2b56000000000000, 0x1867000000000000,
+    0x1b98000000000000, 0x28a9000000000000, 0x7dfa000000000000, 0x4ecb000000000000,
+    0xd75c000000000000, 0xe46d000000000000, 0xb13e000000000000, 0x820f000000000000,
+    0x9231000000000000, 0xa100000000000000, 0xf453000000000000, 0xc762000000000000,
+    0x5ef5000000000000, 0x6dc4000000000000, 0x3897000000000000, 0xba6000000000000,
+    0x18eb000000000000, 0x2bda000000000000, 0x7e89000000000000, 0x4db8000000000000,
+    0xd42f000000000000, 0xe71e000000000000, 0xb24d000000000000, 0x817c000000000000,
+    0x9142000000000000, 0xa273000000000000, 0xf720000000000000, 0xc411000000000000,
+    0x5d86000000000000, 0x6eb7000000000000, 0x3be4000000000000, 0x8d5000000000000,
+    0x1d7e000000000000, 0x2e4f000000000000, 0x7b1c000000000000, 0x482d000000000000,
+    0xd1ba000000000000, 0xe28b000000000000, 0xb7d8000000000000, 0x84e9000000000000,
+    0x94d7000000000000, 0xa7e6000000000000, 0xf2b5000000000000, 0xc184000000000000,
+    0x5813000000000000, 0x6b22000000000000, 0x3e71000000000000, 0xd40000000000000,
+    0x1e0d000000000000, 0x2d3c000000000000, 0x786f000000000000, 0x4b5e000000000000,
+    0xd2c9000000000000, 0xe1f8000000000000, 0xb4ab000000000000, 0x879a000000000000,
+    0x97a4000000000000, 0xa495000000000000, 0xf1c6000000000000, 0xc2f7000000000000,
+    0x5b60000000000000, 0x6851000000000000, 0x3d02000000000000, 0xe33000000000000,
+    0x1654000000000000, 0x2565000000000000, 0x7036000000000000, 0x4307000000000000,
+    0xda90000000000000, 0xe9a1000000000000, 0xbcf2000000000000, 0x8fc3000000000000,
+    0x9ffd000000000000, 0xaccc000000000000, 0xf99f000000000000, 0xcaae000000000000,
+    0x5339000000000000, 0x6008000000000000, 0x355b000000000000, 0x66a000000000000,
+    0x1527000000000000, 0x2616000000000000, 0x7345000000000000, 0x4074000000000000,
+    0xd9e3000000000000, 0xead2000000000000, 0xbf81000000000000, 0x8cb0000000000000,
+    0x9c8e000000000000, 0xafbf000000000000, 0xfaec000000000000, 0xc9dd000000000000,
+    0x504a000000000000, 0x637b000000000000, 0x3628000000000000, 0x519000000000000,
+    0x10b2000000000000, 0x2383000000000000, 0x76d0000000000000, 0x45e1000000000000,
+    0xdc76000000000000, 0xef47000000000000, 0xba14000000000000, 0x8925000000000000,
+    0x991b000000000000, 0xaa2a000000000000, 0xff79000000000000, 0xcc48000000000000,
+    0x55df000000000000, 0x66ee000000000000, 0x33bd000000000000, 0x8c000000000000,
+    0x13c1000000000000, 0x20f0000000000000, 0x75a3000000000000, 0x4692000000000000,
+    0xdf05000000000000, 0xec34000000000000, 0xb967000000000000, 0x8a56000000000000,
+    0x9a68000000000000, 0xa959000000000000, 0xfc0a000000000000, 0xcf3b000000000000,
+    0x56ac000000000000, 0x659d000000000000, 0x30ce000000000000, 0x3ff000000000000,
+  },
+  {
+    0, 0x3730000000000000, 0x6e60000000000000, 0x5950000000000000,
+    0xdcc0000000000000, 0xebf0000000000000, 0xb2a0000000000000, 0x8590000000000000,
+    0xa9a1000000000000, 0x9e91000000000000, 0xc7c1000000000000, 0xf0f1000000000000,
+    0x7561000000000000, 0x4251000000000000, 0x1b01000000000000, 0x2c31000000000000,
+    0x4363000000000000, 0x7453000000000000, 0x2d03000000000000, 0x1a33000000000000,
+    0x9fa3000000000000, 0xa893000000000000, 0xf1c3000000000000, 0xc6f3000000000000,
+    0xeac2000000000000, 0xddf2000000000000, 0x84a2000000000000, 0xb392000000000000,
+    0x3602000000000000, 0x132000000000000, 0x5862000000000000, 0x6f52000000000000,
+    0x86c6000000000000, 0xb1f6000000000000, 0xe8a6000000000000, 0xdf96000000000000,
+    0x5a06000000000000, 0x6d36000000000000, 0x3466000000000000, 0x356000000000000,
+    0x2f67000000000000, 0x1857000000000000, 0x4107000000000000, 0x7637000000000000,
+    0xf3a7000000000000, 0xc497000000000000, 0x9dc7000000000000, 0xaaf7000000000000,
+    0xc5a5000000000000, 0xf295000000000000, 0xabc5000000000000, 0x9cf5000000000000,
+    0x1965000000000000, 0x2e55000000000000, 0x7705000000000000, 0x4035000000000000,
+    0x6c04000000000000, 0x5b34000000000000, 0x264000000000000, 0x3554000000000000,
+    0xb0c4000000000000, 0x87f4000000000000, 0xdea4000000000000, 0xe994000000000000,
+    0x1dad000000000000, 0x2a9d000000000000, 0x73cd000000000000, 0x44fd000000000000,
+    0xc16d000000000000, 0xf65d000000000000, 0xaf0d000000000000, 0x983d000000000000,
+    0xb40c000000000000, 0x833c000000000000, 0xda6c000000000000, 0xed5c000000000000,
+    0x68cc000000000000, 0x5ffc000000000000, 0x6ac000000000000, 0x319c000000000000,
+    0x5ece000000000000, 0x69fe000000000000, 0x30ae000000000000, 0x79e000000000000,
+    0x820e000000000000, 0xb53e000000000000, 0xec6e000000000000, 0xdb5e000000000000,
+    0xf76f000000000000, 0xc05f000000000000, 0x990f000000000000, 0xae3f000000000000,
+    0x2baf000000000000, 0x1c9f000000000000, 0x45cf000000000000, 0x72ff000000000000,
+    0x9b6b000000000000, 0xac5b000000000000, 0xf50b000000000000, 0xc23b000000000000,
+    0x47ab000000000000, 0x709b000000000000, 0x29cb000000000000, 0x1efb000000000000,
+    0x32ca000000000000, 0x5fa000000000000, 0x5caa000000000000, 0x6b9a000000000000,
+    0xee0a000000000000, 0xd93a000000000000, 0x806a000000000000, 0xb75a000000000000,
+    0xd808000000000000, 0xef38000000000000, 0xb668000000000000, 0x8158000000000000,
+    0x4c8000000000000, 0x33f8000000000000, 0x6aa8000000000000, 0x5d98000000000000,
+    0x71a9000000000000, 0x4699000000000000, 0x1fc9000000000000, 0x28f9000000000000,
+    0xad69000000000000, 0x9a59000000000000, 0xc309000000000000, 0xf439000000000000,
+    0x3b5a000000000000, 0xc6a000000000000, 0x553a000000000000, 0x620a000000000000,
+    0xe79a000000000000, 0xd0aa000000000000, 0x89fa000000000000, 0xbeca000000000000,
+    0x92fb000000000000, 0xa5cb000000000000, 0xfc9b000000000000, 0xcbab000000000000,
+    0x4e3b000000000000, 0x790b000000000000, 0x205b000000000000, 0x176b000000000000,
+    0x7839000000000000, 0x4f09000000000000, 0x1659000000000000, 0x2169000000000000,
+    0xa4f9000000000000, 0x93c9000000000000, 0xca99000000000000, 0xfda9000000000000,
+    0xd198000000000000, 0xe6a8000000000000, 0xbff8000000000000, 0x88c8000000000000,
+    0xd58000000000000, 0x3a68000000000000, 0x6338000000000000, 0x5408000000000000,
+    0xbd9c000000000000, 0x8aac000000000000, 0xd3fc000000000000, 0xe4cc000000000000,
+    0x615c000000000000, 0x566c000000000000, 0xf3c000000000000, 0x380c000000000000,
+    0x143d000000000000, 0x230d000000000000, 0x7a5d000000000000, 0x4d6d000000000000,
+    0xc8fd000000000000, 0xffcd000000000000, 0xa69d000000000000, 0x91ad000000000000,
+    0xfeff000000000000, 0xc9cf000000000000, 0x909f000000000000, 0xa7af000000000000,
+    0x223f000000000000, 0x150f000000000000, 0x4c5f000000000000, 0x7b6f000000000000,
+    0x575e000000000000, 0x606e000000000000, 0x393e000000000000, 0xe0e000000000000,
+    0x8b9e000000000000, 0xbcae000000000000, 0xe5fe000000000000, 0xd2ce000000000000,
+    0x26f7000000000000, 0x11c7000000000000, 0x4897000000000000, 0x7fa7000000000000,
+    0xfa37000000000000, 0xcd07000000000000, 0x9457000000000000, 0xa367000000000000,
+    0x8f56000000000000, 0xb866000000000000, 0xe136000000000000, 0xd606000000000000,
+    0x5396000000000000, 0x64a6000000000000, 0x3df6000000000000, 0xac6000000000000,
+    0x6594000000000000, 0x52a4000000000000, 0xbf4000000000000, 0x3cc4000000000000,
+    0xb954000000000000, 0x8e64000000000000, 0xd734000000000000, 0xe004000000000000,
+    0xcc35000000000000, 0xfb05000000000000, 0xa255000000000000, 0x9565000000000000,
+    0x10f5000000000000, 0x27c5000000000000, 0x7e95000000000000, 0x49a5000000000000,
+    0xa031000000000000, 0x9701000000000000, 0xce51000000000000, 0xf961000000000000,
+    0x7cf1000000000000, 0x4bc1000000000000, 0x1291000000000000, 0x25a1000000000000,
+    0x990000000000000, 0x3ea0000000000000, 0x67f0000000000000, 0x50c0000000000000,
+    0xd550000000000000, 0xe260000000000000, 0xbb30000000000000, 0x8c00000000000000,
+    0xe352000000000000, 0xd462000000000000, 0x8d32000000000000, 0xba02000000000000,
+    0x3f92000000000000, 0x8a2000000000000, 0x51f2000000000000, 0x66c2000000000000,
+    0x4af3000000000000, 0x7dc3000000000000, 0x2493000000000000, 0x13a3000000000000,
+    0x9633000000000000, 0xa103000000000000, 0xf853000000000000, 0xcf63000000000000,
+  },
+  {
+    0, 0x76b4000000000000, 0xed68000000000000, 0x9bdc000000000000,
+    0xcaf1000000000000, 0xbc45000000000000, 0x2799000000000000, 0x512d000000000000,
+    0x85c3000000000000, 0xf377000000000000, 0x68ab000000000000, 0x1e1f000000000000,
+    0x4f32000000000000, 0x3986000000000000, 0xa25a000000000000, 0xd4ee000000000000,
+    0x1ba7000000000000, 0x6d13000000000000, 0xf6cf000000000000, 0x807b000000000000,
+    0xd156000000000000, 0xa7e2000000000000, 0x3c3e000000000000, 0x4a8a000000000000,
+    0x9e64000000000000, 0xe8d0000000000000, 0x730c000000000000, 0x5b8000000000000,
+    0x5495000000000000, 0x2221000000000000, 0xb9fd000000000000, 0xcf49000000000000,
+    0x374e000000000000, 0x41fa000000000000, 0xda26000000000000, 0xac92000000000000,
+    0xfdbf000000000000, 0x8b0b000000000000, 0x10d7000000000000, 0x6663000000000000,
+    0xb28d000000000000, 0xc439000000000000, 0x5fe5000000000000, 0x2951000000000000,
+    0x787c000000000000, 0xec8000000000000, 0x9514000000000000, 0xe3a0000000000000,
+    0x2ce9000000000000, 0x5a5d000000000000, 0xc181000000000000, 0xb735000000000000,
+    0xe618000000000000, 0x90ac000000000000, 0xb70000000000000, 0x7dc4000000000000,
+    0xa92a000000000000, 0xdf9e000000000000, 0x4442000000000000, 0x32f6000000000000,
+    0x63db000000000000, 0x156f000000000000, 0x8eb3000000000000, 0xf807000000000000,
+    0x6e9c000000000000, 0x1828000000000000, 0x83f4000000000000, 0xf540000000000000,
+    0xa46d000000000000, 0xd2d9000000000000, 0x4905000000000000, 0x3fb1000000000000,
+    0xeb5f000000000000, 0x9deb000000000000, 0x637000000000000, 0x7083000000000000,
+    0x21ae000000000000, 0x571a000000000000, 0xccc6000000000000, 0xba72000000000000,
+    0x753b000000000000, 0x38f000000000000, 0x9853000000000000, 0xeee7000000000000,
+    0xbfca000000000000, 0xc97e000000000000, 0x52a2000000000000, 0x2416000000000000,
+    0xf0f8000000000000, 0x864c000000000000, 0x1d90000000000000, 0x6b24000000000000,
+    0x3a09000000000000, 0x4cbd000000000000, 0xd761000000000000, 0xa1d5000000000000,
+    0x59d2000000000000, 0x2f66000000000000, 0xb4ba000000000000, 0xc20e000000000000,
+    0x9323000000000000, 0xe597000000000000, 0x7e4b000000000000, 0x8ff000000000000,
+    0xdc11000000000000, 0xaaa5000000000000, 0x3179000000000000, 0x47cd000000000000,
+    0x16e0000000000000, 0x6054000000000000, 0xfb88000000000000, 0x8d3c000000000000,
+    0x4275000000000000, 0x34c1000000000000, 0xaf1d000000000000, 0xd9a9000000000000,
+    0x8884000000000000, 0xfe30000000000000, 0x65ec000000000000, 0x1358000000000000,
+    0xc7b6000000000000, 0xb102000000000000, 0x2ade000000000000, 0x5c6a000000000000,
+    0xd47000000000000, 0x7bf3000000000000, 0xe02f000000000000, 0x969b000000000000,
+    0xdd38000000000000, 0xab8c000000000000, 0x3050000000000000, 0x46e4000000000000,
+    0x17c9000000000000, 0x617d000000000000, 0xfaa1000000000000, 0x8c15000000000000,
+    0x58fb000000000000, 0x2e4f000000000000, 0xb593000000000000, 0xc327000000000000,
+    0x920a000000000000, 0xe4be000000000000, 0x7f62000000000000, 0x9d6000000000000,
+    0xc69f000000000000, 0xb02b000000000000, 0x2bf7000000000000, 0x5d43000000000000,
+    0xc6e000000000000, 0x7ada000000000000, 0xe106000000000000, 0x97b2000000000000,
+    0x435c000000000000, 0x35e8000000000000, 0xae34000000000000, 0xd880000000000000,
+    0x89ad000000000000, 0xff19000000000000, 0x64c5000000000000, 0x1271000000000000,
+    0xea76000000000000, 0x9cc2000000000000, 0x71e000000000000, 0x71aa000000000000,
+    0x2087000000000000, 0x5633000000000000, 0xcdef000000000000, 0xbb5b000000000000,
+    0x6fb5000000000000, 0x1901000000000000, 0x82dd000000000000, 0xf469000000000000,
+    0xa544000000000000, 0xd3f0000000000000, 0x482c000000000000, 0x3e98000000000000,
+    0xf1d1000000000000, 0x8765000000000000, 0x1cb9000000000000, 0x6a0d000000000000,
+    0x3b20000000000000, 0x4d94000000000000, 0xd648000000000000, 0xa0fc000000000000,
+    0x7412000000000000, 0x2a6000000000000, 0x997a000000000000, 0xefce000000000000,
+    0xbee3000000000000, 0xc857000000000000, 0x538b000000000000, 0x253f000000000000,
+    0xb3a4000000000000, 0xc510000000000000, 0x5ecc000000000000, 0x2878000000000000,
+    0x7955000000000000, 0xfe1000000000000, 0x943d000000000000, 0xe289000000000000,
+    0x3667000000000000, 0x40d3000000000000, 0xdb0f000000000000, 0xadbb000000000000,
+    0xfc96000000000000, 0x8a22000000000000, 0x11fe000000000000, 0x674a000000000000,
+    0xa803000000000000, 0xdeb7000000000000, 0x456b000000000000, 0x33df000000000000,
+    0x62f2000000000000, 0x1446000000000000, 0x8f9a000000000000, 0xf92e000000000000,
+    0x2dc0000000000000, 0x5b74000000000000, 0xc0a8000000000000, 0xb61c000000000000,
+    0xe731000000000000, 0x9185000000000000, 0xa59000000000000, 0x7ced000000000000,
+    0x84ea000000000000, 0xf25e000000000000, 0x6982000000000000, 0x1f36000000000000,
+    0x4e1b000000000000, 0x38af000000000000, 0xa373000000000000, 0xd5c7000000000000,
+    0x129000000000000, 0x779d000000000000, 0xec41000000000000, 0x9af5000000000000,
+    0xcbd8000000000000, 0xbd6c000000000000, 0x26b0000000000000, 0x5004000000000000,
+    0x9f4d000000000000, 0xe9f9000000000000, 0x7225000000000000, 0x491000000000000,
+    0x55bc000000000000, 0x2308000000000000, 0xb8d4000000000000, 0xce60000000000000,
+    0x1a8e000000000000, 0x6c3a000000000000, 0xf7e6000000000000, 0x8152000000000000,
+    0xd07f000000000000, 0xa6cb000000000000, 0x3d17000000000000, 0x4ba3000000000000,
+  },
+  {
+    0, 0xaa51000000000000, 0x4483000000000000, 0xeed2000000000000,
+    0x8906000000000000, 0x2357000000000000, 0xcd85000000000000, 0x67d4000000000000,
+    0x22d000000000000, 0xa87c000000000000, 0x46ae000000000000, 0xecff000000000000,
+    0x8b2b000000000000, 0x217a000000000000, 0xcfa8000000000000, 0x65f9000000000000,
+    0x45a000000000000, 0xae0b000000000000, 0x40d9000000000000, 0xea88000000000000,
+    0x8d5c000000000000, 0x270d000000000000, 0xc9df000000000000, 0x638e000000000000,
+    0x677000000000000, 0xac26000000000000, 0x42f4000000000000, 0xe8a5000000000000,
+    0x8f71000000000000, 0x2520000000000000, 0xcbf2000000000000, 0x61a3000000000000,
+    0x8b4000000000000, 0xa2e5000000000000, 0x4c37000000000000, 0xe666000000000000,
+    0x81b2000000000000, 0x2be3000000000000, 0xc531000000000000, 0x6f60000000000000,
+    0xa99000000000000, 0xa0c8000000000000, 0x4e1a000000000000, 0xe44b000000000000,
+    0x839f000000000000, 0x29ce000000000000, 0xc71c000000000000, 0x6d4d000000000000,
+    0xcee000000000000, 0xa6bf000000000000, 0x486d000000000000, 0xe23c000000000000,
+    0x85e8000000000000, 0x2fb9000000000000, 0xc16b000000000000, 0x6b3a000000000000,
+    0xec3000000000000, 0xa492000000000000, 0x4a40000000000000, 0xe011000000000000,
+    0x87c5000000000000, 0x2d94000000000000, 0xc346000000000000, 0x6917000000000000,
+    0x1168000000000000, 0xbb39000000000000, 0x55eb000000000000, 0xffba000000000000,
+    0x986e000000000000, 0x323f000000000000, 0xdced000000000000, 0x76bc000000000000,
+    0x1345000000000000, 0xb914000000000000, 0x57c6000000000000, 0xfd97000000000000,
+    0x9a43000000000000, 0x3012000000000000, 0xdec0000000000000, 0x7491000000000000,
+    0x1532000000000000, 0xbf63000000000000, 0x51b1000000000000, 0xfbe0000000000000,
+    0x9c34000000000000, 0x3665000000000000, 0xd8b7000000000000, 0x72e6000000000000,
+    0x171f000000000000, 0xbd4e000000000000, 0x539c000000000000, 0xf9cd000000000000,
+    0x9e19000000000000, 0x3448000000000000, 0xda9a000000000000, 0x70cb000000000000,
+    0x19dc000000000000, 0xb38d000000000000, 0x5d5f000000000000, 0xf70e000000000000,
+    0x90da000000000000, 0x3a8b000000000000, 0xd459000000000000, 0x7e08000000000000,
+    0x1bf1000000000000, 0xb1a0000000000000, 0x5f72000000000000, 0xf523000000000000,
+    0x92f7000000000000, 0x38a6000000000000, 0xd674000000000000, 0x7c25000000000000,
+    0x1d86000000000000, 0xb7d7000000000000, 0x5905000000000000, 0xf354000000000000,
+    0x9480000000000000, 0x3ed1000000000000, 0xd003000000000000, 0x7a52000000000000,
+    0x1fab000000000000, 0xb5fa000000000000, 0x5b28000000000000, 0xf179000000000000,
+    0x96ad000000000000, 0x3cfc000000000000, 0xd22e000000000000, 0x787f000000000000,
+    0x22d0000000000000, 0x8881000000000000, 0x6653000000000000, 0xcc02000000000000,
+    0xabd6000000000000, 0x187000000000000, 0xef55000000000000, 0x4504000000000000,
+    0x20fd000000000000, 0x8aac000000000000, 0x647e000000000000, 0xce2f000000000000,
+    0xa9fb000000000000, 0x3aa000000000000, 0xed78000000000000, 0x4729000000000000,
+    0x268a000000000000, 0x8cdb000000000000, 0x6209000000000000, 0xc858000000000000,
+    0xaf8c000000000000, 0x5dd000000000000, 0xeb0f000000000000, 0x415e000000000000,
+    0x24a7000000000000, 0x8ef6000000000000, 0x6024000000000000, 0xca75000000000000,
+    0xada1000000000000, 0x7f0000000000000, 0xe922000000000000, 0x4373000000000000,
+    0x2a64000000000000, 0x8035000000000000, 0x6ee7000000000000, 0xc4b6000000000000,
+    0xa362000000000000, 0x933000000000000, 0xe7e1000000000000, 0x4db0000000000000,
+    0x2849000000000000, 0x8218000000000000, 0x6cca000000000000, 0xc69b000000000000,
+    0xa14f000000000000, 0xb1e000000000000, 0xe5cc000000000000, 0x4f9d000000000000,
+    0x2e3e000000000000, 0x846f000000000000, 0x6abd000000000000, 0xc0ec000000000000,
+    0xa738000000000000, 0xd69000000000000, 0xe3bb000000000000, 0x49ea000000000000,
+    0x2c13000000000000, 0x8642000000000000, 0x6890000000000000, 0xc2c1000000000000,
+    0xa515000000000000, 0xf44000000000000, 0xe196000000000000, 0x4bc7000000000000,
+    0x33b8000000000000, 0x99e9000000000000, 0x773b000000000000, 0xdd6a000000000000,
+    0xbabe000000000000, 0x10ef000000000000, 0xfe3d000000000000, 0x546c000000000000,
+    0x3195000000000000, 0x9bc4000000000000, 0x7516000000000000, 0xdf47000000000000,
+    0xb893000000000000, 0x12c2000000000000, 0xfc10000000000000, 0x5641000000000000,
+    0x37e2000000000000, 0x9db3000000000000, 0x7361000000000000, 0xd930000000000000,
+    0xbee4000000000000, 0x14b5000000000000, 0xfa67000000000000, 0x5036000000000000,
+    0x35cf000000000000, 0x9f9e000000000000, 0x714c000000000000, 0xdb1d000000000000,
+    0xbcc9000000000000, 0x1698000000000000, 0xf84a000000000000, 0x521b000000000000,
+    0x3b0c000000000000, 0x915d000000000000, 0x7f8f000000000000, 0xd5de000000000000,
+    0xb20a000000000000, 0x185b000000000000, 0xf689000000000000, 0x5cd8000000000000,
+    0x3921000000000000, 0x9370000000000000, 0x7da2000000000000, 0xd7f3000000000000,
+    0xb027000000000000, 0x1a76000000000000, 0xf4a4000000000000, 0x5ef5000000000000,
+    0x3f56000000000000, 0x9507000000000000, 0x7bd5000000000000, 0xd184000000000000,
+    0xb650000000000000, 0x1c01000000000000, 0xf2d3000000000000, 0x5882000000000000,
+    0x3d7b000000000000, 0x972a000000000000, 0x79f8000000000000, 0xd3a9000000000000,
+    0xb47d000000000000, 0x1e2c000000000000, 0xf0fe000000000000, 0x5aaf000000000000,
+  },
+  {
+    0, 0x45a0000000000000, 0x8b40000000000000, 0xcee0000000000000,
+    0x6a1000000000000, 0x4301000000000000, 0x8de1000000000000, 0xc841000000000000,
+    0xd42000000000000, 0x48e2000000000000, 0x8602000000000000, 0xc3a2000000000000,
+    0xbe3000000000000, 0x4e43000000000000, 0x80a3000000000000, 0xc503000000000000,
+    0x1a84000000000000, 0x5f24000000000000, 0x91c4000000000000, 0xd464000000000000,
+    0x1c25000000000000, 0x5985000000000000, 0x9765000000000000, 0xd2c5000000000000,
+    0x17c6000000000000, 0x5266000000000000, 0x9c86000000000000, 0xd926000000000000,
+    0x1167000000000000, 0x54c7000000000000, 0x9a27000000000000, 0xdf87000000000000,
+    0x3508000000000000, 0x70a8000000000000, 0xbe48000000000000, 0xfbe8000000000000,
+    0x33a9000000000000, 0x7609000000000000, 0xb8e9000000000000, 0xfd49000000000000,
+    0x384a000000000000, 0x7dea000000000000, 0xb30a000000000000, 0xf6aa000000000000,
+    0x3eeb000000000000, 0x7b4b000000000000, 0xb5ab000000000000, 0xf00b000000000000,
+    0x2f8c000000000000, 0x6a2c000000000000, 0xa4cc000000000000, 0xe16c000000000000,
+    0x292d000000000000, 0x6c8d000000000000, 0xa26d000000000000, 0xe7cd000000000000,
+    0x22ce000000000000, 0x676e000000000000, 0xa98e000000000000, 0xec2e000000000000,
+    0x246f000000000000, 0x61cf000000000000, 0xaf2f000000000000, 0xea8f000000000000,
+    0x6a10000000000000, 0x2fb0000000000000, 0xe150000000000000, 0xa4f0000000000000,
+    0x6cb1000000000000, 0x2911000000000000, 0xe7f1000000000000, 0xa251000000000000,
+    0x6752000000000000, 0x22f2000000000000, 0xec12000000000000, 0xa9b2000000000000,
+    0x61f3000000000000, 0x2453000000000000, 0xeab3000000000000, 0xaf13000000000000,
+    0x7094000000000000, 0x3534000000000000, 0xfbd4000000000000, 0xbe74000000000000,
+    0x7635000000000000, 0x3395000000000000, 0xfd75000000000000, 0xb8d5000000000000,
+    0x7dd6000000000000, 0x3876000000000000, 0xf696000000000000, 0xb336000000000000,
+    0x7b77000000000000, 0x3ed7000000000000, 0xf037000000000000, 0xb597000000000000,
+    0x5f18000000000000, 0x1ab8000000000000, 0xd458000000000000, 0x91f8000000000000,
+    0x59b9000000000000, 0x1c19000000000000, 0xd2f9000000000000, 0x9759000000000000,
+    0x525a000000000000, 0x17fa000000000000, 0xd91a000000000000, 0x9cba000000000000,
+    0x54fb000000000000, 0x115b000000000000, 0xdfbb000000000000, 0x9a1b000000000000,
+    0x459c000000000000, 0x3c000000000000, 0xcedc000000000000, 0x8b7c000000000000,
+    0x433d000000000000, 0x69d000000000000, 0xc87d000000000000, 0x8ddd000000000000,
+    0x48de000000000000, 0xd7e000000000000, 0xc39e000000000000, 0x863e000000000000,
+    0x4e7f000000000000, 0xbdf000000000000, 0xc53f000000000000, 0x809f000000000000,
+    0xd420000000000000, 0x9180000000000000, 0x5f60000000000000, 0x1ac0000000000000,
+    0xd281000000000000, 0x9721000000000000, 0x59c1000000000000, 0x1c61000000000000,
+    0xd962000000000000, 0x9cc2000000000000, 0x5222000000000000, 0x1782000000000000,
+    0xdfc3000000000000, 0x9a63000000000000, 0x5483000000000000, 0x1123000000000000,
+    0xcea4000000000000, 0x8b04000000000000, 0x45e4000000000000, 0x44000000000000,
+    0xc805000000000000, 0x8da5000000000000, 0x4345000000000000, 0x6e5000000000000,
+    0xc3e6000000000000, 0x8646000000000000, 0x48a6000000000000, 0xd06000000000000,
+    0xc547000000000000, 0x80e7000000000000, 0x4e07000000000000, 0xba7000000000000,
+    0xe128000000000000, 0xa488000000000000, 0x6a68000000000000, 0x2fc8000000000000,
+    0xe789000000000000, 0xa229000000000000, 0x6cc9000000000000, 0x2969000000000000,
+    0xec6a000000000000, 0xa9ca000000000000, 0x672a000000000000, 0x228a000000000000,
+    0xeacb000000000000, 0xaf6b000000000000, 0x618b000000000000, 0x242b000000000000,
+    0xfbac000000000000, 0xbe0c000000000000, 0x70ec000000000000, 0x354c000000000000,
+    0xfd0d000000000000, 0xb8ad000000000000, 0x764d000000000000, 0x33ed000000000000,
+    0xf6ee000000000000, 0xb34e000000000000, 0x7dae000000000000, 0x380e000000000000,
+    0xf04f000000000000, 0xb5ef000000000000, 0x7b0f000000000000, 0x3eaf000000000000,
+    0xbe30000000000000, 0xfb90000000000000, 0x3570000000000000, 0x70d0000000000000,
+    0xb891000000000000, 0xfd31000000000000, 0x33d1000000000000, 0x7671000000000000,
+    0xb372000000000000, 0xf6d2000000000000, 0x3832000000000000, 0x7d92000000000000,
+    0xb5d3000000000000, 0xf073000000000000, 0x3e93000000000000, 0x7b33000000000000,
+    0xa4b4000000000000, 0xe114000000000000, 0x2ff4000000000000, 0x6a54000000000000,
+    0xa215000000000000, 0xe7b5000000000000, 0x2955000000000000, 0x6cf5000000000000,
+    0xa9f6000000000000, 0xec56000000000000, 0x22b6000000000000, 0x6716000000000000,
+    0xaf57000000000000, 0xeaf7000000000000, 0x2417000000000000, 0x61b7000000000000,
+    0x8b38000000000000, 0xce98000000000000, 0x78000000000000, 0x45d8000000000000,
+    0x8d99000000000000, 0xc839000000000000, 0x6d9000000000000, 0x4379000000000000,
+    0x867a000000000000, 0xc3da000000000000, 0xd3a000000000000, 0x489a000000000000,
+    0x80db000000000000, 0xc57b000000000000, 0xb9b000000000000, 0x4e3b000000000000,
+    0x91bc000000000000, 0xd41c000000000000, 0x1afc000000000000, 0x5f5c000000000000,
+    0x971d000000000000, 0xd2bd000000000000, 0x1c5d000000000000, 0x59fd000000000000,
+    0x9cfe000000000000, 0xd95e000000000000, 0x17be000000000000, 0x521e000000000000,
+    0x9a5f000000000000, 0xdfff000000000000, 0x111f000000000000, 0x54bf000000000000,
+  },
+  {
+    0, 0xb861000000000000, 0x60e3000000000000, 0xd882000000000000,
+    0xc1c6000000000000, 0x79a7000000000000, 0xa125000000000000, 0x1944000000000000,
+    0x93ad000000000000, 0x2bcc000000000000, 0xf34e000000000000, 0x4b2f000000000000,
+    0x526b000000000000, 0xea0a000000000000, 0x3288000000000000, 0x8ae9000000000000,
+    0x377b000000000000, 0x8f1a000000000000, 0x5798000000000000, 0xeff9000000000000,
+    0xf6bd000000000000, 0x4edc000000000000, 0x965e000000000000, 0x2e3f000000000000,
+    0xa4d6000000000000, 0x1cb7000000000000, 0xc435000000000000, 0x7c54000000000000,
+    0x6510000000000000, 0xdd71000000000000, 0x5f3000000000000, 0xbd92000000000000,
+    0x6ef6000000000000, 0xd697000000000000, 0xe15000000000000, 0xb674000000000000,
+    0xaf30000000000000, 0x1751000000000000, 0xcfd3000000000000, 0x77b2000000000000,
+    0xfd5b000000000000, 0x453a000000000000, 0x9db8000000000000, 0x25d9000000000000,
+    0x3c9d000000000000, 0x84fc000000000000, 0x5c7e000000000000, 0xe41f000000000000,
+    0x598d000000000000, 0xe1ec000000000000, 0x396e000000000000, 0x810f000000000000,
+    0x984b000000000000, 0x202a000000000000, 0xf8a8000000000000, 0x40c9000000000000,
+    0xca20000000000000, 0x7241000000000000, 0xaac3000000000000, 0x12a2000000000000,
+    0xbe6000000000000, 0xb387000000000000, 0x6b05000000000000, 0xd364000000000000,
+    0xddec000000000000, 0x658d000000000000, 0xbd0f000000000000, 0x56e000000000000,
+    0x1c2a000000000000, 0xa44b000000000000, 0x7cc9000000000000, 0xc4a8000000000000,
+    0x4e41000000000000, 0xf620000000000000, 0x2ea2000000000000, 0x96c3000000000000,
+    0x8f87000000000000, 0x37e6000000000000, 0xef64000000000000, 0x5705000000000000,
+    0xea97000000000000, 0x52f6000000000000, 0x8a74000000000000, 0x3215000000000000,
+    0x2b51000000000000, 0x9330000000000000, 0x4bb2000000000000, 0xf3d3000000000000,
+    0x793a000000000000, 0xc15b000000000000, 0x19d9000000000000, 0xa1b8000000000000,
+    0xb8fc000000000000, 0x9d000000000000, 0xd81f000000000000, 0x607e000000000000,
+    0xb31a000000000000, 0xb7b000000000000, 0xd3f9000000000000, 0x6b98000000000000,
+    0x72dc000000000000, 0xcabd000000000000, 0x123f000000000000, 0xaa5e000000000000,
+    0x20b7000000000000, 0x98d6000000000000, 0x4054000000000000, 0xf835000000000000,
+    0xe171000000000000, 0x5910000000000000, 0x8192000000000000, 0x39f3000000000000,
+    0x8461000000000000, 0x3c00000000000000, 0xe482000000000000, 0x5ce3000000000000,
+    0x45a7000000000000, 0xfdc6000000000000, 0x2544000000000000, 0x9d25000000000000,
+    0x17cc000000000000, 0xafad000000000000, 0x772f000000000000, 0xcf4e000000000000,
+    0xd60a000000000000, 0x6e6b000000000000, 0xb6e9000000000000, 0xe88000000000000,
+    0xabf9000000000000, 0x1398000000000000, 0xcb1a000000000000, 0x737b000000000000,
+    0x6a3f000000000000, 0xd25e000000000000, 0xadc000000000000, 0xb2bd000000000000,
+    0x3854000000000000, 0x8035000000000000, 0x58b7000000000000, 0xe0d6000000000000,
+    0xf992000000000000, 0x41f3000000000000, 0x9971000000000000, 0x2110000000000000,
+    0x9c82000000000000, 0x24e3000000000000, 0xfc61000000000000, 0x4400000000000000,
+    0x5d44000000000000, 0xe525000000000000, 0x3da7000000000000, 0x85c6000000000000,
+    0xf2f000000000000, 0xb74e000000000000, 0x6fcc000000000000, 0xd7ad000000000000,
+    0xcee9000000000000, 0x7688000000000000, 0xae0a000000000000, 0x166b000000000000,
+    0xc50f000000000000, 0x7d6e000000000000, 0xa5ec000000000000, 0x1d8d000000000000,
+    0x4c9000000000000, 0xbca8000000000000, 0x642a000000000000, 0xdc4b000000000000,
+    0x56a2000000000000, 0xeec3000000000000, 0x3641000000000000, 0x8e20000000000000,
+    0x9764000000000000, 0x2f05000000000000, 0xf787000000000000, 0x4fe6000000000000,
+    0xf274000000000000, 0x4a15000000000000, 0x9297000000000000, 0x2af6000000000000,
+    0x33b2000000000000, 0x8bd3000000000000, 0x5351000000000000, 0xeb30000000000000,
+    0x61d9000000000000, 0xd9b8000000000000, 0x13a000000000000, 0xb95b000000000000,
+    0xa01f000000000000, 0x187e000000000000, 0xc0fc000000000000, 0x789d000000000000,
+    0x7615000000000000, 0xce74000000000000, 0x16f6000000000000, 0xae97000000000000,
+    0xb7d3000000000000, 0xfb2000000000000, 0xd730000000000000, 0x6f51000000000000,
+    0xe5b8000000000000, 0x5dd9000000000000, 0x855b000000000000, 0x3d3a000000000000,
+    0x247e000000000000, 0x9c1f000000000000, 0x449d000000000000, 0xfcfc000000000000,
+    0x416e000000000000, 0xf90f000000000000, 0x218d000000000000, 0x99ec000000000000,
+    0x80a8000000000000, 0x38c9000000000000, 0xe04b000000000000, 0x582a000000000000,
+    0xd2c3000000000000, 0x6aa2000000000000, 0xb220000000000000, 0xa41000000000000,
+    0x1305000000000000, 0xab64000000000000, 0x73e6000000000000, 0xcb87000000000000,
+    0x18e3000000000000, 0xa082000000000000, 0x7800000000000000, 0xc061000000000000,
+    0xd925000000000000, 0x6144000000000000, 0xb9c6000000000000, 0x1a7000000000000,
+    0x8b4e000000000000, 0x332f000000000000, 0xebad000000000000, 0x53cc000000000000,
+    0x4a88000000000000, 0xf2e9000000000000, 0x2a6b000000000000, 0x920a000000000000,
+    0x2f98000000000000, 0x97f9000000000000, 0x4f7b000000000000, 0xf71a000000000000,
+    0xee5e000000000000, 0x563f000000000000, 0x8ebd000000000000, 0x36dc000000000000,
+    0xbc35000000000000, 0x454000000000000, 0xdcd6000000000000, 0x64b7000000000000,
+    0x7df3000000000000, 0xc592000000000000, 0x1d10000000000000, 0xa571000000000000,
+  },
+  {
+    0, 0x47d3000000000000, 0x8fa6000000000000, 0xc875000000000000,
+    0xf6d000000000000, 0x48be000000000000, 0x80cb000000000000, 0xc718000000000000,
+    0x1eda000000000000, 0x5909000000000000, 0x917c000000000000, 0xd6af000000000000,
+    0x11b7000000000000, 0x5664000000000000, 0x9e11000000000000, 0xd9c2000000000000,
+    0x3db4000000000000, 0x7a67000000000000, 0xb212000000000000, 0xf5c1000000000000,
+    0x32d9000000000000, 0x750a000000000000, 0xbd7f000000000000, 0xfaac000000000000,
+    0x236e000000000000, 0x64bd000000000000, 0xacc8000000000000, 0xeb1b000000000000,
+    0x2c03000000000000, 0x6bd0000000000000, 0xa3a5000000000000, 0xe476000000000000,
+    0x7b68000000000000, 0x3cbb000000000000, 0xf4ce000000000000, 0xb31d000000000000,
+    0x7405000000000000, 0x33d6000000000000, 0xfba3000000000000, 0xbc70000000000000,
+    0x65b2000000000000, 0x2261000000000000, 0xea14000000000000, 0xadc7000000000000,
+    0x6adf000000000000, 0x2d0c000000000000, 0xe579000000000000, 0xa2aa000000000000,
+    0x46dc000000000000, 0x10f000000000000, 0xc97a000000000000, 0x8ea9000000000000,
+    0x49b1000000000000, 0xe62000000000000, 0xc617000000000000, 0x81c4000000000000,
+    0x5806000000000000, 0x1fd5000000000000, 0xd7a0000000000000, 0x9073000000000000,
+    0x576b000000000000, 0x10b8000000000000, 0xd8cd000000000000, 0x9f1e000000000000,
+    0xf6d0000000000000, 0xb103000000000000, 0x7976000000000000, 0x3ea5000000000000,
+    0xf9bd000000000000, 0xbe6e000000000000, 0x761b000000000000, 0x31c8000000000000,
+    0xe80a000000000000, 0xafd9000000000000, 0x67ac000000000000, 0x207f000000000000,
+    0xe767000000000000, 0xa0b4000000000000, 0x68c1000000000000, 0x2f12000000000000,
+    0xcb64000000000000, 0x8cb7000000000000, 0x44c2000000000000, 0x311000000000000,
+    0xc409000000000000, 0x83da000000000000, 0x4baf000000000000, 0xc7c000000000000,
+    0xd5be000000000000, 0x926d000000000000, 0x5a18000000000000, 0x1dcb000000000000,
+    0xdad3000000000000, 0x9d00000000000000, 0x5575000000000000, 0x12a6000000000000,
+    0x8db8000000000000, 0xca6b000000000000, 0x21e000000000000, 0x45cd000000000000,
+    0x82d5000000000000, 0xc506000000000000, 0xd73000000000000, 0x4aa0000000000000,
+    0x9362000000000000, 0xd4b1000000000000, 0x1cc4000000000000, 0x5b17000000000000,
+    0x9c0f000000000000, 0xdbdc000000000000, 0x13a9000000000000, 0x547a000000000000,
+    0xb00c000000000000, 0xf7df000000000000, 0x3faa000000000000, 0x7879000000000000,
+    0xbf61000000000000, 0xf8b2000000000000, 0x30c7000000000000, 0x7714000000000000,
+    0xaed6000000000000, 0xe905000000000000, 0x2170000000000000, 0x66a3000000000000,
+    0xa1bb000000000000, 0xe668000000000000, 0x2e1d000000000000, 0x69ce000000000000,
+    0xfd81000000000000, 0xba52000000000000, 0x7227000000000000, 0x35f4000000000000,
+    0xf2ec000000000000, 0xb53f000000000000, 0x7d4a000000000000, 0x3a99000000000000,
+    0xe35b000000000000, 0xa488000000000000, 0x6cfd000000000000, 0x2b2e000000000000,
+    0xec36000000000000, 0xabe5000000000000, 0x6390000000000000, 0x2443000000000000,
+    0xc035000000000000, 0x87e6000000000000, 0x4f93000000000000, 0x840000000000000,
+    0xcf58000000000000, 0x888b000000000000, 0x40fe000000000000, 0x72d000000000000,
+    0xdeef000000000000, 0x993c000000000000, 0x5149000000000000, 0x169a000000000000,
+    0xd182000000000000, 0x9651000000000000, 0x5e24000000000000, 0x19f7000000000000,
+    0x86e9000000000000, 0xc13a000000000000, 0x94f000000000000, 0x4e9c000000000000,
+    0x8984000000000000, 0xce57000000000000, 0x622000000000000, 0x41f1000000000000,
+    0x9833000000000000, 0xdfe0000000000000, 0x1795000000000000, 0x5046000000000000,
+    0x975e000000000000, 0xd08d000000000000, 0x18f8000000000000, 0x5f2b000000000000,
+    0xbb5d000000000000, 0xfc8e000000000000, 0x34fb000000000000, 0x7328000000000000,
+    0xb430000000000000, 0xf3e3000000000000, 0x3b96000000000000, 0x7c45000000000000,
+    0xa587000000000000, 0xe254000000000000, 0x2a21000000000000, 0x6df2000000000000,
+    0xaaea000000000000, 0xed39000000000000, 0x254c000000000000, 0x629f000000000000,
+    0xb51000000000000, 0x4c82000000000000, 0x84f7000000000000, 0xc324000000000000,
+    0x43c000000000000, 0x43ef000000000000, 0x8b9a000000000000, 0xcc49000000000000,
+    0x158b000000000000, 0x5258000000000000, 0x9a2d000000000000, 0xddfe000000000000,
+    0x1ae6000000000000, 0x5d35000000000000, 0x9540000000000000, 0xd293000000000000,
+    0x36e5000000000000, 0x7136000000000000, 0xb943000000000000, 0xfe90000000000000,
+    0x3988000000000000, 0x7e5b000000000000, 0xb62e000000000000, 0xf1fd000000000000,
+    0x283f000000000000, 0x6fec000000000000, 0xa799000000000000, 0xe04a000000000000,
+    0x2752000000000000, 0x6081000000000000, 0xa8f4000000000000, 0xef27000000000000,
+    0x7039000000000000, 0x37ea000000000000, 0xff9f000000000000, 0xb84c000000000000,
+    0x7f54000000000000, 0x3887000000000000, 0xf0f2000000000000, 0xb721000000000000,
+    0x6ee3000000000000, 0x2930000000000000, 0xe145000000000000, 0xa696000000000000,
+    0x618e000000000000, 0x265d000000000000, 0xee28000000000000, 0xa9fb000000000000,
+    0x4d8d000000000000, 0xa5e000000000000, 0xc22b000000000000, 0x85f8000000000000,
+    0x42e0000000000000, 0x533000000000000, 0xcd46000000000000, 0x8a95000000000000,
+    0x5357000000000000, 0x1484000000000000, 0xdcf1000000000000, 0x9b22000000000000,
+    0x5c3a000000000000, 0x1be9000000000000, 0xd39c000000000000, 0x944f000000000000,
+  },
+};
+static const CrcFold crc_cat_f6 = {
+    16, 0, 0x1021000000000000,
+    { 0x3f68000000000000, 0x2093000000000000 }, { 0x78b3000000000000, 0x9fe5000000000000 }, { 0x10e2000000000000, 0xeb23000000000000 },
+    0xeb23000000000000, 0x11303471a041b343
+};
+
+/* CRC-16/MODBUS: mesmas tabelas de CRC-16/ARC */
+
+/* CRC-16/XMODEM: mesmas tabelas de CRC-16/IBM-3740 */
+
+/* CRC-16/X-25 */
+static const uint64_t crc_cat_t9[8][256] = {
+  {
+    0, 0x1189, 0x2312, 0x329b,
+    0x4624, 0x57ad, 0x6536, 0x74bf,
+    0x8c48, 0x9dc1, 0xaf5a, 0xbed3,
+    0xca6c, 0xdbe5, 0xe97e, 0xf8f7,
+    0x1081, 0x108, 0x3393, 0x221a,
+    0x56a5, 0x472c, 0x75b7, 0x643e,
+    0x9cc9, 0x8d40, 0xbfdb, 0xae52,
+    0xdaed, 0xcb64, 0xf9ff, 0xe876,
+    0x2102, 0x308b, 0x210, 0x1399,
+    0x6726, 0x76af, 0x4434, 0x55bd,
+    0xad4a, 0xbcc3, 0x8e58, 0x9fd1,
+    0xeb6e, 0xfae7, 0xc87c, 0xd9f5,
+    0x3183, 0x200a, 0x1291, 0x318,
+    0x77a7, 0x662e, 0x54b5, 0x453c,
+    0xbdcb, 0xac42, 0x9ed9, 0x8f50,
+    0xfbef, 0xea66, 0xd8fd, 0xc974,
+    0x4204, 0x538d, 0x6116, 0x709f,
+    0x420, 0x15a9, 0x2732, 0x36bb,
+    0xce4c, 0xdfc5, 0xed5e, 0xfcd7,
+    0x8868, 0x99e1, 0xab7a, 0xbaf3,
+    0x5285, 0x430c, 0x7197, 0x601e,
+    0x14a1, 0x528, 0x37b3, 0x263a,
+    0xdecd, 0xcf44, 0xfddf, 0xec56,
+    0x98e9, 0x8960, 0xbbfb, 0xaa72,
+    0x6306, 0x728f, 0x4014, 0x519d,
+    0x2522, 0x34ab, 0x630, 0x17b9,
+    0xef4e, 0xfec7, 0xcc5c, 0xddd5,
+    0xa96a, 0xb8e3, 0x8a78, 0x9bf1,
+    0x7387, 0x620e, 0x5095, 0x411c,
+    0x35a3, 0x242a, 0x16b1, 0x738,
+    0xffcf, 0xee46, 0xdcdd, 0xcd54,
+    0xb9eb, 0xa862, 0x9af9, 0x8b70,
+    0x8408, 0x9581, 0xa71a, 0xb693,
+    0xc22c, 0xd3a5, 0xe13e, 0xf0b7,
+    0x840, 0x19c9, 0x2b52, 0x3adb,
+    0x4e64, 0x5fed, 0x6d76, 0x7cff,
+    0x9489, 0x8500, 0xb79b, 0xa612,
+    0xd2ad, 0xc324, 0xf1bf, 0xe036,
+    0x18c1, 0x948, 0x3bd3, 0x2a5a,
+    0x5ee5, 0x4f6c, 0x7df7, 0x6c7e,
+    0xa50a, 0xb483, 0x8618, 0x9791,
+    0xe32e, 0xf2a7, 0xc03c, 0xd1b5,
+    0x2942, 0x38cb, 0xa50, 0x1bd9,
+    0x6f66, 0x7eef, 0x4c74, 0x5dfd,
+    0xb58b, 0xa402, 0x9699, 0x8710,
+    0xf3af, 0xe226, 0xd0bd, 0xc134,
+    0x39c3, 0x284a, 0x1ad1, 0xb58,
+    0x7fe7, 0x6e6e, 0x5cf5, 0x4d7c,
+    0xc60c, 0xd785, 0xe51e, 0xf497,
+    0x8028, 0x91a1, 0xa33a, 0xb2b3,
+    0x4a44, 0x5bcd, 0x6956, 0x78df,
+    0xc60, 0x1de9, 0x2f72, 0x3efb,
+    0xd68d, 0xc704, 0xf59f, 0xe416,
+    0x90a9, 0x8120, 0xb3bb, 0xa232,
+    0x5ac5, 0x4b4c, 0x79d7, 0x685e,
+    0x1ce1, 0xd68, 0x3ff3, 0x2e7a,
+    0xe70e, 0xf687, 0xc41c, 0xd595,
+    0xa12a, 0xb0a3, 0x8238, 0x93b1,
+    0x6b46, 0x7acf, 0x4854, 0x59dd,
+    0x2d62, 0x3ceb, 0xe70, 0x1ff9,
+    0xf78f, 0xe606, 0xd49d, 0xc514,
+    0xb1ab, 0xa022, 0x92b9, 0x8330,
+    0x7bc7, 0x6a4e, 0x58d5, 0x495c,
+    0x3de3, 0x2c6a, 0x1ef1, 0xf78,
+  },
+  {
+    0, 0x19d8, 0x33b0, 0x2a68,
+    0x6760, 0x7eb8, 0x54d0, 0x4d08,
+    0xcec0, 0xd718, 0xfd70, 0xe4a8,
+    0xa9a0, 0xb078, 0x9a10, 0x83c8,
+    0x9591, 0x8c49, 0xa621, 0xbff9,
+    0xf2f1, 0xeb29, 0xc141, 0xd899,
+    0x5b51, 0x4289, 0x68e1, 0x7139,
+    0x3c31, 0x25e9, 0xf81, 0x1659,
+    0x2333, 0x3aeb, 0x1083, 0x95b,
+    0x4453, 0x5d8b, 0x77e3, 0x6e3b,
+    0xedf3, 0xf42b, 0xde43, 0xc79b,
+    0x8a93, 0x934b, 0xb923, 0xa0fb,
+    0xb6a2, 0xaf7a, 0x8512, 0x9cca,
+    0xd1c2, 0xc81a, 0xe272, 0xfbaa,
+    0x7862, 0x61ba, 0x4bd2, 0x520a,
+    0x1f02, 0x6da, 0x2cb2, 0x356a,
+    0x4666, 0x5fbe, 0x75d6, 0x6c0e,
+    0x2106, 0x38de, 0x12b6, 0xb6e,
+    0x88a6, 0x917e, 0xbb16, 0xa2ce,
+    0xefc6, 0xf61e, 0xdc76, 0xc5ae,
+    0xd3f7, 0xca2f, 0xe047, 0xf99f,
+    0xb497, 0xad4f, 0x8727, 0x9eff,
+    0x1d37, 0x4ef, 0x2e87, 0x375f,
+    0x7a57, 0x638f, 0x49e7, 0x503f,
+    0x6555, 0x7c8d, 0x56e5, 0x4f3d,
+    0x235, 0x1bed, 0x3185, 0x285d,
+    0xab95, 0xb24d, 0x9825, 0x81fd,
+    0xccf5, 0xd52d, 0xff45, 0xe69d,
+    0xf0c4, 0xe91c, 0xc374, 0xdaac,
+    0x97a4, 0x8e7c, 0xa414, 0xbdcc,
+    0x3e04, 0x27dc, 0xdb4, 0x146c,
+    0x5964, 0x40bc, 0x6ad4, 0x730c,
+    0x8ccc, 0x9514, 0xbf7c, 0xa6a4,
+    0xebac, 0xf274, 0xd81c, 0xc1c4,
+    0x420c, 0x5bd4, 0x71bc, 0x6864,
+    0x256c, 0x3cb4, 0x16dc, 0xf04,
+    0x195d, 0x85, 0x2aed, 0x3335,
+    0x7e3d, 0x67e5, 0x4d8d, 0x5455,
+    0xd79d, 0xce45, 0xe42d, 0xfdf5,
+    0xb0fd, 0xa925, 0x834d, 0x9a95,
+    0xafff, 0xb627, 0x9c4f, 0x8597,
+    0xc89f, 0xd147, 0xfb2f, 0xe2f7,
+    0x613f, 0x78e7, 0x528f, 0x4b57,
+    0x65f, 0x1f87, 0x35ef, 0x2c37,
+    0x3a6e, 0x23b6, 0x9de, 0x1006,
+    0x5d0e, 0x44d6, 0x6ebe, 0x7766,
+    0xf4ae, 0xed76, 0xc71e, 0xdec6,
+    0x93ce, 0x8a16, 0xa07e, 0xb9a6,
+    0xcaaa, 0xd372, 0xf91a, 0xe0c2,
+    0xadca, 0xb412, 0x9e7a, 0x87a2,
+    0x46a, 0x1db2, 0x37da, 0x2e02,
+    0x630a, 0x7ad2, 0x50ba, 0x4962,
+    0x5f3b, 0x46e3, 0x6c8b, 0x7553,
+    0x385b, 0x2183, 0xbeb, 0x1233,
+    0x91fb, 0x8823, 0xa24b, 0xbb93,
+    0xf69b, 0xef43, 0xc52b, 0xdcf3,
+    0xe999, 0xf041, 0xda29, 0xc3f1,
+    0x8ef9, 0x9721, 0xbd49, 0xa491,
+    0x2759, 0x3e81, 0x14e9, 0xd31,
+    0x4039, 0x59e1, 0x7389, 0x6a51,
+    0x7c08, 0x65d0, 0x4fb8, 0x5660,
+    0x1b68, 0x2b0, 0x28d8, 0x3100,
+    0xb2c8, 0xab10, 0x8178, 0x98a0,
+    0xd5a8, 0xcc70, 0xe618, 0xffc0,
+  },
+  {
+    0, 0x5adc, 0xb5b8, 0xef64,
+    0x6361, 0x39bd, 0xd6d9, 0x8c05,
+    0xc6c2, 0x9c1e, 0x737a, 0x29a6,
+    0xa5a3, 0xff7f, 0x101b, 0x4ac7,
+    0x8595, 0xdf49, 0x302d, 0x6af1,
+    0xe6f4, 0xbc28, 0x534c, 0x990,
+    0x4357, 0x198b, 0xf6ef, 0xac33,
+    0x2036, 0x7aea, 0x958e, 0xcf52,
+    0x33b, 0x59e7, 0xb683, 0xec5f,
+    0x605a, 0x3a86, 0xd5e2, 0x8f3e,
+    0xc5f9, 0x9f25, 0x7041, 0x2a9d,
+    0xa698, 0xfc44, 0x1320, 0x49fc,
+    0x86ae, 0xdc72, 0x3316, 0x69ca,
+    0xe5cf, 0xbf13, 0x5077, 0xaab,
+    0x406c, 0x1ab0, 0xf5d4, 0xaf08,
+    0x230d, 0x79d1, 0x96b5, 0xcc69,
+    0x676, 0x5caa, 0xb3ce, 0xe912,
+    0x6517, 0x3fcb, 0xd0af, 0x8a73,
+    0xc0b4, 0x9a68, 0x750c, 0x2fd0,
+    0xa3d5, 0xf909, 0x166d, 0x4cb1,
+    0x83e3, 0xd93f, 0x365b, 0x6c87,
+    0xe082, 0xba5e, 0x553a, 0xfe6,
+    0x4521, 0x1ffd, 0xf099, 0xaa45,
+    0x2640, 0x7c9c, 0x93f8, 0xc924,
+    0x54d, 0x5f91, 0xb0f5, 0xea29,
+    0x662c, 0x3cf0, 0xd394, 0x8948,
+    0xc38f, 0x9953, 0x7637, 0x2ceb,
+    0xa0ee, 0xfa32, 0x1556, 0x4f8a,
+    0x80d8, 0xda04, 0x3560, 0x6fbc,
+    0xe3b9, 0xb965, 0x5601, 0xcdd,
+    0x461a, 0x1cc6, 0xf3a2, 0xa97e,
+    0x257b, 0x7fa7, 0x90c3, 0xca1f,
+    0xcec, 0x5630, 0xb954, 0xe388,
+    0x6f8d, 0x3551, 0xda35, 0x80e9,
+    0xca2e, 0x90f2, 0x7f96, 0x254a,
+    0xa94f, 0xf393, 0x1cf7, 0x462b,
+    0x8979, 0xd3a5, 0x3cc1, 0x661d,
+    0xea18, 0xb0c4, 0x5fa0, 0x57c,
+    0x4fbb, 0x1567, 0xfa03, 0xa0df,
+    0x2cda, 0x7606, 0x9962, 0xc3be,
+    0xfd7, 0x550b, 0xba6f, 0xe0b3,
+    0x6cb6, 0x366a, 0xd90e, 0x83d2,
+    0xc915, 0x93c9, 0x7cad, 0x2671,
+    0xaa74, 0xf0a8, 0x1fcc, 0x4510,
+    0x8a42, 0xd09e, 0x3ffa, 0x6526,
+    0xe923, 0xb3ff, 0x5c9b, 0x647,
+    0x4c80, 0x165c, 0xf938, 0xa3e4,
+    0x2fe1, 0x753d, 0x9a59, 0xc085,
+    0xa9a, 0x5046, 0xbf22, 0xe5fe,
+    0x69fb, 0x3327, 0xdc43, 0x869f,
+    0xcc58, 0x9684, 0x79e0, 0x233c,
+    0xaf39, 0xf5e5, 0x1a81, 0x405d,
+    0x8f0f, 0xd5d3, 0x3ab7, 0x606b,
+    0xec6e, 0xb6b2, 0x59d6, 0x30a,
+    0x49cd, 0x1311, 0xfc75, 0xa6a9,
+    0x2aac, 0x7070, 0x9f14, 0xc5c8,
+    0x9a1, 0x537d, 0xbc19, 0xe6c5,
+    0x6ac0, 0x301c, 0xdf78, 0x85a4,
+    0xcf63, 0x95bf, 0x7adb, 0x2007,
+    0xac02, 0xf6de, 0x19ba, 0x4366,
+    0x8c34, 0xd6e8, 0x398c, 0x6350,
+    0xef55, 0xb589, 0x5aed, 0x31,
+    0x4af6, 0x102a, 0xff4e, 0xa592,
+    0x2997, 0x734b, 0x9c2f, 0xc6f3,
+  },
+  {
+    0, 0x1cbb, 0x3976, 0x25cd,
+    0x72ec, 0x6e57, 0x4b9a, 0x5721,
+    0xe5d8, 0xf963, 0xdcae, 0xc015,
+    0x9734, 0x8b8f, 0xae42, 0xb2f9,
+    0xc3a1, 0xdf1a, 0xfad7, 0xe66c,
+    0xb14d, 0xadf6, 0x883b, 0x9480,
+    0x2679, 0x3ac2, 0x1f0f, 0x3b4,
+    0x5495, 0x482e, 0x6de3, 0x7158,
+    0x8f53, 0x93e8, 0xb625, 0xaa9e,
+    0xfdbf, 0xe104, 0xc4c9, 0xd872,
+    0x6a8b, 0x7630, 0x53fd, 0x4f46,
+    0x1867, 0x4dc, 0x2111, 0x3daa,
+    0x4cf2, 0x5049, 0x7584, 0x693f,
+    0x3e1e, 0x22a5, 0x768, 0x1bd3,
+    0xa92a, 0xb591, 0x905c, 0x8ce7,
+    0xdbc6, 0xc77d, 0xe2b0, 0xfe0b,
+    0x16b7, 0xa0c, 0x2fc1, 0x337a,
+    0x645b, 0x78e0, 0x5d2d, 0x4196,
+    0xf36f, 0xefd4, 0xca19, 0xd6a2,
+    0x8183, 0x9d38, 0xb8f5, 0xa44e,
+    0xd516, 0xc9ad, 0xec60, 0xf0db,
+    0xa7fa, 0xbb41, 0x9e8c, 0x8237,
+    0x30ce, 0x2c75, 0x9b8, 0x1503,
+    0x4222, 0x5e99, 0x7b54, 0x67ef,
+    0x99e4, 0x855f, 0xa092, 0xbc29,
+    0xeb08, 0xf7b3, 0xd27e, 0xcec5,
+    0x7c3c, 0x6087, 0x454a, 0x59f1,
+    0xed0, 0x126b, 0x37a6, 0x2b1d,
+    0x5a45, 0x46fe, 0x6333, 0x7f88,
+    0x28a9, 0x3412, 0x11df, 0xd64,
+    0xbf9d, 0xa326, 0x86eb, 0x9a50,
+    0xcd71, 0xd1ca, 0xf407, 0xe8bc,
+    0x2d6e, 0x31d5, 0x1418, 0x8a3,
+    0x5f82, 0x4339, 0x66f4, 0x7a4f,
+    0xc8b6, 0xd40d, 0xf1c0, 0xed7b,
+    0xba5a, 0xa6e1, 0x832c, 0x9f97,
+    0xeecf, 0xf274, 0xd7b9, 0xcb02,
+    0x9c23, 0x8098, 0xa555, 0xb9ee,
+    0xb17, 0x17ac, 0x3261, 0x2eda,
+    0x79fb, 0x6540, 0x408d, 0x5c36,
+    0xa23d, 0xbe86, 0x9b4b, 0x87f0,
+    0xd0d1, 0xcc6a, 0xe9a7, 0xf51c,
+    0x47e5, 0x5b5e, 0x7e93, 0x6228,
+    0x3509, 0x29b2, 0xc7f, 0x10c4,
+    0x619c, 0x7d27, 0x58ea, 0x4451,
+    0x1370, 0xfcb, 0x2a06, 0x36bd,
+    0x8444, 0x98ff, 0xbd32, 0xa189,
+    0xf6a8, 0xea13, 0xcfde, 0xd365,
+    0x3bd9, 0x2762, 0x2af, 0x1e14,
+    0x4935, 0x558e, 0x7043, 0x6cf8,
+    0xde01, 0xc2ba, 0xe777, 0xfbcc,
+    0xaced, 0xb056, 0x959b, 0x8920,
+    0xf878, 0xe4c3, 0xc10e, 0xddb5,
+    0x8a94, 0x962f, 0xb3e2, 0xaf59,
+    0x1da0, 0x11b, 0x24d6, 0x386d,
+    0x6f4c, 0x73f7, 0x563a, 0x4a81,
+    0xb48a, 0xa831, 0x8dfc, 0x9147,
+    0xc666, 0xdadd, 0xff10, 0xe3ab,
+    0x5152, 0x4de9, 0x6824, 0x749f,
+    0x23be, 0x3f05, 0x1ac8, 0x673,
+    0x772b, 0x6b90, 0x4e5d, 0x52e6,
+    0x5c7, 0x197c, 0x3cb1, 0x200a,
+    0x92f3, 0x8e48, 0xab85, 0xb73e,
+    0xe01f, 0xfca4, 0xd969, 0xc5d2,
+  },
+  {
+    0, 0xb44, 0x1688, 0x1dcc,
+    0x2d10, 0x2654, 0x3b98, 0x30dc,
+    0x5a20, 0x5164, 0x4ca8, 0x47ec,
+    0x7730, 0x7c74, 0x61b8, 0x6afc,
+    0xb440, 0xbf04, 0xa2c8, 0xa98c,
+    0x9950, 0x9214, 0x8fd8, 0x849c,
+    0xee60, 0xe524, 0xf8e8, 0xf3ac,
+    0xc370, 0xc834, 0xd5f8, 0xdebc,
+    0x6091, 0x6bd5, 0x7619, 0x7d5d,
+    0x4d81, 0x46c5, 0x5b09, 0x504d,
+    0x3ab1, 0x31f5, 0x2c39, 0x277d,
+    0x17a1, 0x1ce5, 0x129, 0xa6d,
+    0xd4d1, 0xdf95, 0xc259, 0xc91d,
+    0xf9c1, 0xf285, 0xef49, 0xe40d,
+    0x8ef1, 0x85b5, 0x9879, 0x933d,
+    0xa3e1, 0xa8a5, 0xb569, 0xbe2d,
+    0xc122, 0xca66, 0xd7aa, 0xdcee,
+    0xec32, 0xe776, 0xfaba, 0xf1fe,
+    0x9b02, 0x9046, 0x8d8a, 0x86ce,
+    0xb612, 0xbd56, 0xa09a, 0xabde,
+    0x7562, 0x7e26, 0x63ea, 0x68ae,
+    0x5872, 0x5336, 0x4efa, 0x45be,
+    0x2f42, 0x2406, 0x39ca, 0x328e,
+    0x252, 0x916, 0x14da, 0x1f9e,
+    0xa1b3, 0xaaf7, 0xb73b, 0xbc7f,
+    0x8ca3, 0x87e7, 0x9a2b, 0x916f,
+    0xfb93, 0xf0d7, 0xed1b, 0xe65f,
+    0xd683, 0xddc7, 0xc00b, 0xcb4f,
+    0x15f3, 0x1eb7, 0x37b, 0x83f,
+    0x38e3, 0x33a7, 0x2e6b, 0x252f,
+    0x4fd3, 0x4497, 0x595b, 0x521f,
+    0x62c3, 0x6987, 0x744b, 0x7f0f,
+    0x8a55, 0x8111, 0x9cdd, 0x9799,
+    0xa745, 0xac01, 0xb1cd, 0xba89,
+    0xd075, 0xdb31, 0xc6fd, 0xcdb9,
+    0xfd65, 0xf621, 0xebed, 0xe0a9,
+    0x3e15, 0x3551, 0x289d, 0x23d9,
+    0x1305, 0x1841, 0x58d, 0xec9,
+    0x6435, 0x6f71, 0x72bd, 0x79f9,
+    0x4925, 0x4261, 0x5fad, 0x54e9,
+    0xeac4, 0xe180, 0xfc4c, 0xf708,
+    0xc7d4, 0xcc90, 0xd15c, 0xda18,
+    0xb0e4, 0xbba0, 0xa66c, 0xad28,
+    0x9df4, 0x96b0, 0x8b7c, 0x8038,
+    0x5e84, 0x55c0, 0x480c, 0x4348,
+    0x7394, 0x78d0, 0x651c, 0x6e58,
+    0x4a4, 0xfe0, 0x122c, 0x1968,
+    0x29b4, 0x22f0, 0x3f3c, 0x3478,
+    0x4b77, 0x4033, 0x5dff, 0x56bb,
+    0x6667, 0x6d23, 0x70ef, 0x7bab,
+    0x1157, 0x1a13, 0x7df, 0xc9b,
+    0x3c47, 0x3703, 0x2acf, 0x218b,
+    0xff37, 0xf473, 0xe9bf, 0xe2fb,
+    0xd227, 0xd963, 0xc4af, 0xcfeb,
+    0xa517, 0xae53, 0xb39f, 0xb8db,
+    0x8807, 0x8343, 0x9e8f, 0x95cb,
+    0x2be6, 0x20a2, 0x3d6e, 0x362a,
+    0x6f6, 0xdb2, 0x107e, 0x1b3a,
+    0x71c6, 0x7a82, 0x674e, 0x6c0a,
+    0x5cd6, 0x5792, 0x4a5e, 0x411a,
+    0x9fa6, 0x94e2, 0x892e, 0x826a,
+    0xb2b6, 0xb9f2, 0xa43e, 0xaf7a,
+    0xc586, 0xcec2, 0xd30e, 0xd84a,
+    0xe896, 0xe3d2, 0xfe1e, 0xf55a,
+  },
+  {
+    0, 0x42b, 0x856, 0xc7d,
+    0x10ac, 0x1487, 0x18fa, 0x1cd1,
+    0x2158, 0x2573, 0x290e, 0x2d25,
+    0x31f4, 0x35df, 0x39a2, 0x3d89,
+    0x42b0, 0x469b, 0x4ae6, 0x4ecd,
+    0x521c, 0x5637, 0x5a4a, 0x5e61,
+    0x63e8, 0x67c3, 0x6bbe, 0x6f95,
+    0x7344, 0x776f, 0x7b12, 0x7f39,
+    0x8560, 0x814b, 0x8d36, 0x891d,
+    0x95cc, 0x91e7, 0x9d9a, 0x99b1,
+    0xa438, 0xa013, 0xac6e, 0xa845,
+    0xb494, 0xb0bf, 0xbcc2, 0xb8e9,
+    0xc7d0, 0xc3fb, 0xcf86, 0xcbad,
+    0xd77c, 0xd357, 0xdf2a, 0xdb01,
+    0xe688, 0xe2a3, 0xeede, 0xeaf5,
+    0xf624, 0xf20f, 0xfe72, 0xfa59,
+    0x2d1, 0x6fa, 0xa87, 0xeac,
+    0x127d, 0x1656, 0x1a2b, 0x1e00,
+    0x2389, 0x27a2, 0x2bdf, 0x2ff4,
+    0x3325, 0x370e, 0x3b73, 0x3f58,
+    0x4061, 0x444a, 0x4837, 0x4c1c,
+    0x50cd, 0x54e6, 0x589b, 0x5cb0,
+    0x6139, 0x6512, 0x696f, 0x6d44,
+    0x7195, 0x75be, 0x79c3, 0x7de8,
+    0x87b1, 0x839a, 0x8fe7, 0x8bcc,
+    0x971d, 0x9336, 0x9f4b, 0x9b60,
+    0xa6e9, 0xa2c2, 0xaebf, 0xaa94,
+    0xb645, 0xb26e, 0xbe13, 0xba38,
+    0xc501, 0xc12a, 0xcd57, 0xc97c,
+    0xd5ad, 0xd186, 0xddfb, 0xd9d0,
+    0xe459, 0xe072, 0xec0f, 0xe824,
+    0xf4f5, 0xf0de, 0xfca3, 0xf888,
+    0x5a2, 0x189, 0xdf4, 0x9df,
+    0x150e, 0x1125, 0x1d58, 0x1973,
+    0x24fa, 0x20d1, 0x2cac, 0x2887,
+    0x3456, 0x307d, 0x3c00, 0x382b,
+    0x4712, 0x4339, 0x4f44, 0x4b6f,
+    0x57be, 0x5395, 0x5fe8, 0x5bc3,
+    0x664a, 0x6261, 0x6e1c, 0x6a37,
+    0x76e6, 0x72cd, 0x7eb0, 0x7a9b,
+    0x80c2, 0x84e9, 0x8894, 0x8cbf,
+    0x906e, 0x9445, 0x9838, 0x9c13,
+    0xa19a, 0xa5b1, 0xa9cc, 0xade7,
+    0xb136, 0xb51d, 0xb960, 0xbd4b,
+    0xc272, 0xc659, 0xca24, 0xce0f,
+    0xd2de, 0xd6f5, 0xda88, 0xdea3,
+    0xe32a, 0xe701, 0xeb7c, 0xef57,
+    0xf386, 0xf7ad, 0xfbd0, 0xfffb,
+    0x773, 0x358, 0xf25, 0xb0e,
+    0x17df, 0x13f4, 0x1f89, 0x1ba2,
+    0x262b, 0x2200, 0x2e7d, 0x2a56,
+    0x3687, 0x32ac, 0x3ed1, 0x3afa,
+    0x45c3, 0x41e8, 0x4d95, 0x49be,
+    0x556f, 0x5144, 0x5d39, 0x5912,
+    0x649b, 0x60b0, 0x6ccd, 0x68e6,
+    0x7437, 0x701c, 0x7c61, 0x784a,
+    0x8213, 0x8638, 0x8a45, 0x8e6e,
+    0x92bf, 0x9694, 0x9ae9, 0x9ec2,
+    0xa34b, 0xa760, 0xab1d, 0xaf36,
+    0xb3e7, 0xb7cc, 0xbbb1, 0xbf9a,
+    0xc0a3, 0xc488, 0xc8f5, 0xccde,
+    0xd00f, 0xd424, 0xd859, 0xdc72,
+    0xe1fb, 0xe5d0, 0xe9ad, 0xed86,
+    0xf157, 0xf57c, 0xf901, 0xfd2a,
+  },
+  {
+    0, 0x9fd5, 0x37bb, 0xa86e,
+    0x6f76, 0xf0a3, 0x58cd, 0xc718,
+    0xdeec, 0x4139, 0xe957, 0x7682,
+    0xb19a, 0x2e4f, 0x8621, 0x19f4,
+    0xb5c9, 0x2a1c, 0x8272, 0x1da7,
+    0xdabf, 0x456a, 0xed04, 0x72d1,
+    0x6b25, 0xf4f0, 0x5c9e, 0xc34b,
+    0x453, 0x9b86, 0x33e8, 0xac3d,
+    0x6383, 0xfc56, 0x5438, 0xcbed,
+    0xcf5, 0x9320, 0x3b4e, 0xa49b,
+    0xbd6f, 0x22ba, 0x8ad4, 0x1501,
+    0xd219, 0x4dcc, 0xe5a2, 0x7a77,
+    0xd64a, 0x499f, 0xe1f1, 0x7e24,
+    0xb93c, 0x26e9, 0x8e87, 0x1152,
+    0x8a6, 0x9773, 0x3f1d, 0xa0c8,
+    0x67d0, 0xf805, 0x506b, 0xcfbe,
+    0xc706, 0x58d3, 0xf0bd, 0x6f68,
+    0xa870, 0x37a5, 0x9fcb, 0x1e,
+    0x19ea, 0x863f, 0x2e51, 0xb184,
+    0x769c, 0xe949, 0x4127, 0xdef2,
+    0x72cf, 0xed1a, 0x4574, 0xdaa1,
+    0x1db9, 0x826c, 0x2a02, 0xb5d7,
+    0xac23, 0x33f6, 0x9b98, 0x44d,
+    0xc355, 0x5c80, 0xf4ee, 0x6b3b,
+    0xa485, 0x3b50, 0x933e, 0xceb,
+    0xcbf3, 0x5426, 0xfc48, 0x639d,
+    0x7a69, 0xe5bc, 0x4dd2, 0xd207,
+    0x151f, 0x8aca, 0x22a4, 0xbd71,
+    0x114c, 0x8e99, 0x26f7, 0xb922,
+    0x7e3a, 0xe1ef, 0x4981, 0xd654,
+    0xcfa0, 0x5075, 0xf81b, 0x67ce,
+    0xa0d6, 0x3f03, 0x976d, 0x8b8,
+    0x861d, 0x19c8, 0xb1a6, 0x2e73,
+    0xe96b, 0x76be, 0xded0, 0x4105,
+    0x58f1, 0xc724, 0x6f4a, 0xf09f,
+    0x3787, 0xa852, 0x3c, 0x9fe9,
+    0x33d4, 0xac01, 0x46f, 0x9bba,
+    0x5ca2, 0xc377, 0x6b19, 0xf4cc,
+    0xed38, 0x72ed, 0xda83, 0x4556,
+    0x824e, 0x1d9b, 0xb5f5, 0x2a20,
+    0xe59e, 0x7a4b, 0xd225, 0x4df0,
+    0x8ae8, 0x153d, 0xbd53, 0x2286,
+    0x3b72, 0xa4a7, 0xcc9, 0x931c,
+    0x5404, 0xcbd1, 0x63bf, 0xfc6a,
+    0x5057, 0xcf82, 0x67ec, 0xf839,
+    0x3f21, 0xa0f4, 0x89a, 0x974f,
+    0x8ebb, 0x116e, 0xb900, 0x26d5,
+    0xe1cd, 0x7e18, 0xd676, 0x49a3,
+    0x411b, 0xdece, 0x76a0, 0xe975,
+    0x2e6d, 0xb1b8, 0x19d6, 0x8603,
+    0x9ff7, 0x22, 0xa84c, 0x3799,
+    0xf081, 0x6f54, 0xc73a, 0x58ef,
+    0xf4d2, 0x6b07, 0xc369, 0x5cbc,
+    0x9ba4, 0x471, 0xac1f, 0x33ca,
+    0x2a3e, 0xb5eb, 0x1d85, 0x8250,
+    0x4548, 0xda9d, 0x72f3, 0xed26,
+    0x2298, 0xbd4d, 0x1523, 0x8af6,
+    0x4dee, 0xd23b, 0x7a55, 0xe580,
+    0xfc74, 0x63a1, 0xcbcf, 0x541a,
+    0x9302, 0xcd7, 0xa4b9, 0x3b6c,
+    0x9751, 0x884, 0xa0ea, 0x3f3f,
+    0xf827, 0x67f2, 0xcf9c, 0x5049,
+    0x49bd, 0xd668, 0x7e06, 0xe1d3,
+    0x26cb, 0xb91e, 0x1170, 0x8ea5,
+  },
+  {
+    0, 0x81bf, 0xb6f, 0x8ad0,
+    0x16de, 0x9761, 0x1db1, 0x9c0e,
+    0x2dbc, 0xac03, 0x26d3, 0xa76c,
+    0x3b62, 0xbadd, 0x300d, 0xb1b2,
+    0x5b78, 0xdac7, 0x5017, 0xd1a8,
+    0x4da6, 0xcc19, 0x46c9, 0xc776,
+    0x76c4, 0xf77b, 0x7dab, 0xfc14,
+    0x601a, 0xe1a5, 0x6b75, 0xeaca,
+    0xb6f0, 0x374f, 0xbd9f, 0x3c20,
+    0xa02e, 0x2191, 0xab41, 0x2afe,
+    0x9b4c, 0x1af3, 0x9023, 0x119c,
+    0x8d92, 0xc2d, 0x86fd, 0x742,
+    0xed88, 0x6c37, 0xe6e7, 0x6758,
+    0xfb56, 0x7ae9, 0xf039, 0x7186,
+    0xc034, 0x418b, 0xcb5b, 0x4ae4,
+    0xd6ea, 0x5755, 0xdd85, 0x5c3a,
+    0x65f1, 0xe44e, 0x6e9e, 0xef21,
+    0x732f, 0xf290, 0x7840, 0xf9ff,
+    0x484d, 0xc9f2, 0x4322, 0xc29d,
+    0x5e93, 0xdf2c, 0x55fc, 0xd443,
+    0x3e89, 0xbf36, 0x35e6, 0xb459,
+    0x2857, 0xa9e8, 0x2338, 0xa287,
+    0x1335, 0x928a, 0x185a, 0x99e5,
+    0x5eb, 0x8454, 0xe84, 0x8f3b,
+    0xd301, 0x52be, 0xd86e, 0x59d1,
+    0xc5df, 0x4460, 0xceb0, 0x4f0f,
+    0xfebd, 0x7f02, 0xf5d2, 0x746d,
+    0xe863, 0x69dc, 0xe30c, 0x62b3,
+    0x8879, 0x9c6, 0x8316, 0x2a9,
+    0x9ea7, 0x1f18, 0x95c8, 0x1477,
+    0xa5c5, 0x247a, 0xaeaa, 0x2f15,
+    0xb31b, 0x32a4, 0xb874, 0x39cb,
+    0xcbe2, 0x4a5d, 0xc08d, 0x4132,
+    0xdd3c, 0x5c83, 0xd653, 0x57ec,
+    0xe65e, 0x67e1, 0xed31, 0x6c8e,
+    0xf080, 0x713f, 0xfbef, 0x7a50,
+    0x909a, 0x1125, 0x9bf5, 0x1a4a,
+    0x8644, 0x7fb, 0x8d2b, 0xc94,
+    0xbd26, 0x3c99, 0xb649, 0x37f6,
+    0xabf8, 0x2a47, 0xa097, 0x2128,
+    0x7d12, 0xfcad, 0x767d, 0xf7c2,
+    0x6bcc, 0xea73, 0x60a3, 0xe11c,
+    0x50ae, 0xd111, 0x5bc1, 0xda7e,
+    0x4670, 0xc7cf, 0x4d1f, 0xcca0,
+    0x266a, 0xa7d5, 0x2d05, 0xacba,
+    0x30b4, 0xb10b, 0x3bdb, 0xba64,
+    0xbd6, 0x8a69, 0xb9, 0x8106,
+    0x1d08, 0x9cb7, 0x1667, 0x97d8,
+    0xae13, 0x2fac, 0xa57c, 0x24c3,
+    0xb8cd, 0x3972, 0xb3a2, 0x321d,
+    0x83af, 0x210, 0x88c0, 0x97f,
+    0x9571, 0x14ce, 0x9e1e, 0x1fa1,
+    0xf56b, 0x74d4, 0xfe04, 0x7fbb,
+    0xe3b5, 0x620a, 0xe8da, 0x6965,
+    0xd8d7, 0x5968, 0xd3b8, 0x5207,
+    0xce09, 0x4fb6, 0xc566, 0x44d9,
+    0x18e3, 0x995c, 0x138c, 0x9233,
+    0xe3d, 0x8f82, 0x552, 0x84ed,
+    0x355f, 0xb4e0, 0x3e30, 0xbf8f,
+    0x2381, 0xa23e, 0x28ee, 0xa951,
+    0x439b, 0xc224, 0x48f4, 0xc94b,
+    0x5545, 0xd4fa, 0x5e2a, 0xdf95,
+    0x6e27, 0xef98, 0x6548, 0xe4f7,
+    0x78f9, 0xf946, 0x7396, 0xf229,
+  },
+};
+static const CrcFold crc_cat_f9 = {
+    16, 1, 0x8408,
+    { 0x9a19, 0x2df8 }, { 0x47e3, 0x922d }, { 0x81bf, 0x8e10 },
+    0x81bf, 0xc2cd82058e2c0c88
+};
+
+/* CRC-24/OPENPGP */
+static const uint64_t crc_cat_t10[8][256] = {
+  {
+    0, 0x864cfb0000000000, 0x8ad50d0000000000, 0xc99f60000000000,
+    0x93e6e10000000000, 0x15aa1a0000000000, 0x1933ec0000000000, 0x9f7f170000000000,
+    0xa181390000000000, 0x27cdc20000000000, 0x2b54340000000000, 0xad18cf0000000000,
+    0x3267d80000000000, 0xb42b230000000000, 0xb8b2d50000000000, 0x3efe2e0000000000,
+    0xc54e890000000000, 0x4302720000000000, 0x4f9b840000000000, 0xc9d77f0000000000,
+    0x56a8680000000000, 0xd0e4930000000000, 0xdc7d650000000000, 0x5a319e0000000000,
+    0x64cfb00000000000, 0xe2834b0000000000, 0xee1abd0000000000, 0x6856460000000000,
+    0xf729510000000000, 0x7165aa0000000000, 0x7dfc5c0000000000, 0xfbb0a70000000000,
+    0xcd1e90000000000, 0x8a9d120000000000, 0x8604e40000000000, 0x481f0000000000,
+    0x9f37080000000000, 0x197bf30000000000, 0x15e2050000000000, 0x93aefe0000000000,
+    0xad50d00000000000, 0x2b1c2b0000000000, 0x2785dd0000000000, 0xa1c9260000000000,
+    0x3eb6310000000000, 0xb8faca0000000000, 0xb4633c0000000000, 0x322fc70000000000,
+    0xc99f600000000000, 0x4fd39b0000000000, 0x434a6d0000000000, 0xc506960000000000,
+    0x5a79810000000000, 0xdc357a0000000000, 0xd0ac8c0000000000, 0x56e0770000000000,
+    0x681e590000000000, 0xee52a20000000000, 0xe2cb540000000000, 0x6487af0000000000,
+    0xfbf8b80000000000, 0x7db4430000000000, 0x712db50000000000, 0xf7614e0000000000,
+    0x19a3d20000000000, 0x9fef290000000000, 0x9376df0000000000, 0x153a240000000000,
+    0x8a45330000000000, 0xc09c80000000000, 0x903e0000000000, 0x86dcc50000000000,
+    0xb822eb0000000000, 0x3e6e100000000000, 0x32f7e60000000000, 0xb4bb1d0000000000,
+    0x2bc40a0000000000, 0xad88f10000000000, 0xa111070000000000, 0x275dfc0000000000,
+    0xdced5b0000000000, 0x5aa1a00000000000, 0x5638560000000000, 0xd074ad0000000000,
+    0x4f0bba0000000000, 0xc947410000000000, 0xc5deb70000000000, 0x43924c0000000000,
+    0x7d6c620000000000, 0xfb20990000000000, 0xf7b96f0000000000, 0x71f5940000000000,
+    0xee8a830000000000, 0x68c6780000000000, 0x645f8e0000000000, 0xe213750000000000,
+    0x15723b0000000000, 0x933ec00000000000, 0x9fa7360000000000, 0x19ebcd0000000000,
+    0x8694da0000000000, 0xd8210000000000, 0xc41d70000000000, 0x8a0d2c0000000000,
+    0xb4f3020000000000, 0x32bff90000000000, 0x3e260f0000000000, 0xb86af40000000000,
+    0x2715e30000000000, 0xa159180000000000, 0xadc0ee0000000000, 0x2b8c150000000000,
+    0xd03cb20000000000, 0x5670490000000000, 0x5ae9bf0000000000, 0xdca5440000000000,
+    0x43da530000000000, 0xc596a80000000000, 0xc90f5e0000000000, 0x4f43a50000000000,
+    0x71bd8b0000000000, 0xf7f1700000000000, 0xfb68860000000000, 0x7d247d0000000000,
+    0xe25b6a0000000000, 0x6417910000000000, 0x688e670000000000, 0xeec29c0000000000,
+    0x3347a40000000000, 0xb50b5f0000000000, 0xb992a90000000000, 0x3fde520000000000,
+    0xa0a1450000000000, 0x26edbe0000000000, 0x2a74480000000000, 0xac38b30000000000,
+    0x92c69d0000000000, 0x148a660000000000, 0x1813900000000000, 0x9e5f6b0000000000,
+    0x1207c0000000000, 0x876c870000000000, 0x8bf5710000000000, 0xdb98a0000000000,
+    0xf6092d0000000000, 0x7045d60000000000, 0x7cdc200000000000, 0xfa90db0000000000,
+    0x65efcc0000000000, 0xe3a3370000000000, 0xef3ac10000000000, 0x69763a0000000000,
+    0x5788140000000000, 0xd1c4ef0000000000, 0xdd5d190000000000, 0x5b11e20000000000,
+    0xc46ef50000000000, 0x42220e0000000000, 0x4ebbf80000000000, 0xc8f7030000000000,
+    0x3f964d0000000000, 0xb9dab60000000000, 0xb543400000000000, 0x330fbb0000000000,
+    0xac70ac0000000000, 0x2a3c570000000000, 0x26a5a10000000000, 0xa0e95a0000000000,
+    0x9e17740000000000, 0x185b8f0000000000, 0x14c2790000000000, 0x928e820000000000,
+    0xdf1950000000000, 0x8bbd6e0000000000, 0x8724980000000000, 0x168630000000000,
+    0xfad8c40000000000, 0x7c943f0000000000, 0x700dc90000000000, 0xf641320000000000,
+    0x693e250000000000, 0xef72de0000000000, 0xe3eb280000000000, 0x65a7d30000000000,
+    0x5b59fd0000000000, 0xdd15060000000000, 0xd18cf00000000000, 0x57c00b0000000000,
+    0xc8bf1c0000000000, 0x4ef3e70000000000, 0x426a110000000000, 0xc426ea0000000000,
+    0x2ae4760000000000, 0xaca88d0000000000, 0xa0317b0000000000, 0x267d800000000000,
+    0xb902970000000000, 0x3f4e6c0000000000, 0x33d79a0000000000, 0xb59b610000000000,
+    0x8b654f0000000000, 0xd29b40000000000, 0x1b0420000000000, 0x87fcb90000000000,
+    0x1883ae0000000000, 0x9ecf550000000000, 0x9256a30000000000, 0x141a580000000000,
+    0xefaaff0000000000, 0x69e6040000000000, 0x657ff20000000000, 0xe333090000000000,
+    0x7c4c1e0000000000, 0xfa00e50000000000, 0xf699130000000000, 0x70d5e80000000000,
+    0x4e2bc60000000000, 0xc8673d0000000000, 0xc4fecb0000000000, 0x42b2300000000000,
+    0xddcd270000000000, 0x5b81dc0000000000, 0x57182a0000000000, 0xd154d10000000000,
+    0x26359f0000000000, 0xa079640000000000, 0xace0920000000000, 0x2aac690000000000,
+    0xb5d37e0000000000, 0x339f850000000000, 0x3f06730000000000, 0xb94a880000000000,
+    0x87b4a60000000000, 0x1f85d0000000000, 0xd61ab0000000000, 0x8b2d500000000000,
+    0x1452470000000000, 0x921ebc0000000000, 0x9e874a0000000000, 0x18cbb10000000000,
+    0xe37b160000000000, 0x6537ed0000000000, 0x69ae1b0000000000, 0xefe2e00000000000,
+    0x709df70000000000, 0xf6d10c0000000000, 0xfa48fa0000000000, 0x7c04010000000000,
+    0x42fa2f0000000000, 0xc4b6d40000000000, 0xc82f220000000000, 0x4e63d90000000000,
+    0xd11cce0000000000, 0x5750350000000000, 0x5bc9c30000000000, 0xdd85380000000000,
+  },
+  {
+    0, 0x668f480000000000, 0xcd1e900000000000, 0xab91d80000000000,
+    0x1c71db0000000000, 0x7afe930000000000, 0xd16f4b0000000000, 0xb7e0030000000000,
+    0x38e3b60000000000, 0x5e6cfe0000000000, 0xf5fd260000000000, 0x93726e0000000000,
+    0x24926d0000000000, 0x421d250000000000, 0xe98cfd0000000000, 0x8f03b50000000000,
+    0x71c76c0000000000, 0x1748240000000000, 0xbcd9fc0000000000, 0xda56b40000000000,
+    0x6db6b70000000000, 0xb39ff0000000000, 0xa0a8270000000000, 0xc6276f0000000000,
+    0x4924da0000000000, 0x2fab920000000000, 0x843a4a0000000000, 0xe2b5020000000000,
+    0x5555010000000000, 0x33da490000000000, 0x984b910000000000, 0xfec4d90000000000,
+    0xe38ed80000000000, 0x8501900000000000, 0x2e90480000000000, 0x481f000000000000,
+    0xffff030000000000, 0x99704b0000000000, 0x32e1930000000000, 0x546edb0000000000,
+    0xdb6d6e0000000000, 0xbde2260000000000, 0x1673fe0000000000, 0x70fcb60000000000,
+    0xc71cb50000000000, 0xa193fd0000000000, 0xa02250000000000, 0x6c8d6d0000000000,
+    0x9249b40000000000, 0xf4c6fc0000000000, 0x5f57240000000000, 0x39d86c0000000000,
+    0x8e386f0000000000, 0xe8b7270000000000, 0x4326ff0000000000, 0x25a9b70000000000,
+    0xaaaa020000000000, 0xcc254a0000000000, 0x67b4920000000000, 0x13bda0000000000,
+    0xb6dbd90000000000, 0xd054910000000000, 0x7bc5490000000000, 0x1d4a010000000000,
+    0x41514b0000000000, 0x27de030000000000, 0x8c4fdb0000000000, 0xeac0930000000000,
+    0x5d20900000000000, 0x3bafd80000000000, 0x903e000000000000, 0xf6b1480000000000,
+    0x79b2fd0000000000, 0x1f3db50000000000, 0xb4ac6d0000000000, 0xd223250000000000,
+    0x65c3260000000000, 0x34c6e0000000000, 0xa8ddb60000000000, 0xce52fe0000000000,
+    0x3096270000000000, 0x56196f0000000000, 0xfd88b70000000000, 0x9b07ff0000000000,
+    0x2ce7fc0000000000, 0x4a68b40000000000, 0xe1f96c0000000000, 0x8776240000000000,
+    0x875910000000000, 0x6efad90000000000, 0xc56b010000000000, 0xa3e4490000000000,
+    0x14044a0000000000, 0x728b020000000000, 0xd91ada0000000000, 0xbf95920000000000,
+    0xa2df930000000000, 0xc450db0000000000, 0x6fc1030000000000, 0x94e4b0000000000,
+    0xbeae480000000000, 0xd821000000000000, 0x73b0d80000000000, 0x153f900000000000,
+    0x9a3c250000000000, 0xfcb36d0000000000, 0x5722b50000000000, 0x31adfd0000000000,
+    0x864dfe0000000000, 0xe0c2b60000000000, 0x4b536e0000000000, 0x2ddc260000000000,
+    0xd318ff0000000000, 0xb597b70000000000, 0x1e066f0000000000, 0x7889270000000000,
+    0xcf69240000000000, 0xa9e66c0000000000, 0x277b40000000000, 0x64f8fc0000000000,
+    0xebfb490000000000, 0x8d74010000000000, 0x26e5d90000000000, 0x406a910000000000,
+    0xf78a920000000000, 0x9105da0000000000, 0x3a94020000000000, 0x5c1b4a0000000000,
+    0x82a2960000000000, 0xe42dde0000000000, 0x4fbc060000000000, 0x29334e0000000000,
+    0x9ed34d0000000000, 0xf85c050000000000, 0x53cddd0000000000, 0x3542950000000000,
+    0xba41200000000000, 0xdcce680000000000, 0x775fb00000000000, 0x11d0f80000000000,
+    0xa630fb0000000000, 0xc0bfb30000000000, 0x6b2e6b0000000000, 0xda1230000000000,
+    0xf365fa0000000000, 0x95eab20000000000, 0x3e7b6a0000000000, 0x58f4220000000000,
+    0xef14210000000000, 0x899b690000000000, 0x220ab10000000000, 0x4485f90000000000,
+    0xcb864c0000000000, 0xad09040000000000, 0x698dc0000000000, 0x6017940000000000,
+    0xd7f7970000000000, 0xb178df0000000000, 0x1ae9070000000000, 0x7c664f0000000000,
+    0x612c4e0000000000, 0x7a3060000000000, 0xac32de0000000000, 0xcabd960000000000,
+    0x7d5d950000000000, 0x1bd2dd0000000000, 0xb043050000000000, 0xd6cc4d0000000000,
+    0x59cff80000000000, 0x3f40b00000000000, 0x94d1680000000000, 0xf25e200000000000,
+    0x45be230000000000, 0x23316b0000000000, 0x88a0b30000000000, 0xee2ffb0000000000,
+    0x10eb220000000000, 0x76646a0000000000, 0xddf5b20000000000, 0xbb7afa0000000000,
+    0xc9af90000000000, 0x6a15b10000000000, 0xc184690000000000, 0xa70b210000000000,
+    0x2808940000000000, 0x4e87dc0000000000, 0xe516040000000000, 0x83994c0000000000,
+    0x34794f0000000000, 0x52f6070000000000, 0xf967df0000000000, 0x9fe8970000000000,
+    0xc3f3dd0000000000, 0xa57c950000000000, 0xeed4d0000000000, 0x6862050000000000,
+    0xdf82060000000000, 0xb90d4e0000000000, 0x129c960000000000, 0x7413de0000000000,
+    0xfb106b0000000000, 0x9d9f230000000000, 0x360efb0000000000, 0x5081b30000000000,
+    0xe761b00000000000, 0x81eef80000000000, 0x2a7f200000000000, 0x4cf0680000000000,
+    0xb234b10000000000, 0xd4bbf90000000000, 0x7f2a210000000000, 0x19a5690000000000,
+    0xae456a0000000000, 0xc8ca220000000000, 0x635bfa0000000000, 0x5d4b20000000000,
+    0x8ad7070000000000, 0xec584f0000000000, 0x47c9970000000000, 0x2146df0000000000,
+    0x96a6dc0000000000, 0xf029940000000000, 0x5bb84c0000000000, 0x3d37040000000000,
+    0x207d050000000000, 0x46f24d0000000000, 0xed63950000000000, 0x8becdd0000000000,
+    0x3c0cde0000000000, 0x5a83960000000000, 0xf1124e0000000000, 0x979d060000000000,
+    0x189eb30000000000, 0x7e11fb0000000000, 0xd580230000000000, 0xb30f6b0000000000,
+    0x4ef680000000000, 0x6260200000000000, 0xc9f1f80000000000, 0xaf7eb00000000000,
+    0x51ba690000000000, 0x3735210000000000, 0x9ca4f90000000000, 0xfa2bb10000000000,
+    0x4dcbb20000000000, 0x2b44fa0000000000, 0x80d5220000000000, 0xe65a6a0000000000,
+    0x6959df0000000000, 0xfd6970000000000, 0xa4474f0000000000, 0xc2c8070000000000,
+    0x7528040000000000, 0x13a74c0000000000, 0xb836940000000000, 0xdeb9dc0000000000,
+  },
+  {
+    0, 0x8309d70000000000, 0x805f550000000000, 0x356820000000000,
+    0x86f2510000000000, 0x5fb860000000000, 0x6ad040000000000, 0x85a4d30000000000,
+    0x8ba8590000000000, 0x8a18e0000000000, 0xbf70c0000000000, 0x88fedb0000000000,
+    0xd5a080000000000, 0x8e53df0000000000, 0x8d055d0000000000, 0xe0c8a0000000000,
+    0x911c490000000000, 0x12159e0000000000, 0x11431c0000000000, 0x924acb0000000000,
+    0x17ee180000000000, 0x94e7cf0000000000, 0x97b14d0000000000, 0x14b89a0000000000,
+    0x1ab4100000000000, 0x99bdc70000000000, 0x9aeb450000000000, 0x19e2920000000000,
+    0x9c46410000000000, 0x1f4f960000000000, 0x1c19140000000000, 0x9f10c30000000000,
+    0xa474690000000000, 0x277dbe0000000000, 0x242b3c0000000000, 0xa722eb0000000000,
+    0x2286380000000000, 0xa18fef0000000000, 0xa2d96d0000000000, 0x21d0ba0000000000,
+    0x2fdc300000000000, 0xacd5e70000000000, 0xaf83650000000000, 0x2c8ab20000000000,
+    0xa92e610000000000, 0x2a27b60000000000, 0x2971340000000000, 0xaa78e30000000000,
+    0x3568200000000000, 0xb661f70000000000, 0xb537750000000000, 0x363ea20000000000,
+    0xb39a710000000000, 0x3093a60000000000, 0x33c5240000000000, 0xb0ccf30000000000,
+    0xbec0790000000000, 0x3dc9ae0000000000, 0x3e9f2c0000000000, 0xbd96fb0000000000,
+    0x3832280000000000, 0xbb3bff0000000000, 0xb86d7d0000000000, 0x3b64aa0000000000,
+    0xcea4290000000000, 0x4dadfe0000000000, 0x4efb7c0000000000, 0xcdf2ab0000000000,
+    0x4856780000000000, 0xcb5faf0000000000, 0xc8092d0000000000, 0x4b00fa0000000000,
+    0x450c700000000000, 0xc605a70000000000, 0xc553250000000000, 0x465af20000000000,
+    0xc3fe210000000000, 0x40f7f60000000000, 0x43a1740000000000, 0xc0a8a30000000000,
+    0x5fb8600000000000, 0xdcb1b70000000000, 0xdfe7350000000000, 0x5ceee20000000000,
+    0xd94a310000000000, 0x5a43e60000000000, 0x5915640000000000, 0xda1cb30000000000,
+    0xd410390000000000, 0x5719ee0000000000, 0x544f6c0000000000, 0xd746bb0000000000,
+    0x52e2680000000000, 0xd1ebbf0000000000, 0xd2bd3d0000000000, 0x51b4ea0000000000,
+    0x6ad0400000000000, 0xe9d9970000000000, 0xea8f150000000000, 0x6986c20000000000,
+    0xec22110000000000, 0x6f2bc60000000000, 0x6c7d440000000000, 0xef74930000000000,
+    0xe178190000000000, 0x6271ce0000000000, 0x61274c0000000000, 0xe22e9b0000000000,
+    0x678a480000000000, 0xe4839f0000000000, 0xe7d51d0000000000, 0x64dcca0000000000,
+    0xfbcc090000000000, 0x78c5de0000000000, 0x7b935c0000000000, 0xf89a8b0000000000,
+    0x7d3e580000000000, 0xfe378f0000000000, 0xfd610d0000000000, 0x7e68da0000000000,
+    0x7064500000000000, 0xf36d870000000000, 0xf03b050000000000, 0x7332d20000000000,
+    0xf696010000000000, 0x759fd60000000000, 0x76c9540000000000, 0xf5c0830000000000,
+    0x1b04a90000000000, 0x980d7e0000000000, 0x9b5bfc0000000000, 0x18522b0000000000,
+    0x9df6f80000000000, 0x1eff2f0000000000, 0x1da9ad0000000000, 0x9ea07a0000000000,
+    0x90acf00000000000, 0x13a5270000000000, 0x10f3a50000000000, 0x93fa720000000000,
+    0x165ea10000000000, 0x9557760000000000, 0x9601f40000000000, 0x1508230000000000,
+    0x8a18e00000000000, 0x911370000000000, 0xa47b50000000000, 0x894e620000000000,
+    0xceab10000000000, 0x8fe3660000000000, 0x8cb5e40000000000, 0xfbc330000000000,
+    0x1b0b90000000000, 0x82b96e0000000000, 0x81efec0000000000, 0x2e63b0000000000,
+    0x8742e80000000000, 0x44b3f0000000000, 0x71dbd0000000000, 0x84146a0000000000,
+    0xbf70c00000000000, 0x3c79170000000000, 0x3f2f950000000000, 0xbc26420000000000,
+    0x3982910000000000, 0xba8b460000000000, 0xb9ddc40000000000, 0x3ad4130000000000,
+    0x34d8990000000000, 0xb7d14e0000000000, 0xb487cc0000000000, 0x378e1b0000000000,
+    0xb22ac80000000000, 0x31231f0000000000, 0x32759d0000000000, 0xb17c4a0000000000,
+    0x2e6c890000000000, 0xad655e0000000000, 0xae33dc0000000000, 0x2d3a0b0000000000,
+    0xa89ed80000000000, 0x2b970f0000000000, 0x28c18d0000000000, 0xabc85a0000000000,
+    0xa5c4d00000000000, 0x26cd070000000000, 0x259b850000000000, 0xa692520000000000,
+    0x2336810000000000, 0xa03f560000000000, 0xa369d40000000000, 0x2060030000000000,
+    0xd5a0800000000000, 0x56a9570000000000, 0x55ffd50000000000, 0xd6f6020000000000,
+    0x5352d10000000000, 0xd05b060000000000, 0xd30d840000000000, 0x5004530000000000,
+    0x5e08d90000000000, 0xdd010e0000000000, 0xde578c0000000000, 0x5d5e5b0000000000,
+    0xd8fa880000000000, 0x5bf35f0000000000, 0x58a5dd0000000000, 0xdbac0a0000000000,
+    0x44bcc90000000000, 0xc7b51e0000000000, 0xc4e39c0000000000, 0x47ea4b0000000000,
+    0xc24e980000000000, 0x41474f0000000000, 0x4211cd0000000000, 0xc1181a0000000000,
+    0xcf14900000000000, 0x4c1d470000000000, 0x4f4bc50000000000, 0xcc42120000000000,
+    0x49e6c10000000000, 0xcaef160000000000, 0xc9b9940000000000, 0x4ab0430000000000,
+    0x71d4e90000000000, 0xf2dd3e0000000000, 0xf18bbc0000000000, 0x72826b0000000000,
+    0xf726b80000000000, 0x742f6f0000000000, 0x7779ed0000000000, 0xf4703a0000000000,
+    0xfa7cb00000000000, 0x7975670000000000, 0x7a23e50000000000, 0xf92a320000000000,
+    0x7c8ee10000000000, 0xff87360000000000, 0xfcd1b40000000000, 0x7fd8630000000000,
+    0xe0c8a00000000000, 0x63c1770000000000, 0x6097f50000000000, 0xe39e220000000000,
+    0x663af10000000000, 0xe533260000000000, 0xe665a40000000000, 0x656c730000000000,
+    0x6b60f90000000000, 0xe8692e0000000000, 0xeb3fac0000000000, 0x68367b0000000000,
+    0xed92a80000000000, 0x6e9b7f0000000000, 0x6dcdfd0000000000, 0xeec42a0000000000,
+  },
+  {
+    0, 0x3609520000000000, 0x6c12a40000000000, 0x5a1bf60000000000,
+    0xd825480000000000, 0xee2c1a0000000000, 0xb437ec0000000000, 0x823ebe0000000000,
+    0x36066b0000000000, 0xf390000000000, 0x5a14cf0000000000, 0x6c1d9d0000000000,
+    0xee23230000000000, 0xd82a710000000000, 0x8231870000000000, 0xb438d50000000000,
+    0x6c0cd60000000000, 0x5a05840000000000, 0x1e720000000000, 0x3617200000000000,
+    0xb4299e0000000000, 0x8220cc0000000000, 0xd83b3a0000000000, 0xee32680000000000,
+    0x5a0abd0000000000, 0x6c03ef0000000000, 0x3618190000000000, 0x114b0000000000,
+    0x822ff50000000000, 0xb426a70000000000, 0xee3d510000000000, 0xd834030000000000,
+    0xd819ac0000000000, 0xee10fe0000000000, 0xb40b080000000000, 0x82025a0000000000,
+    0x3ce40000000000, 0x3635b60000000000, 0x6c2e400000000000, 0x5a27120000000000,
+    0xee1fc70000000000, 0xd816950000000000, 0x820d630000000000, 0xb404310000000000,
+    0x363a8f0000000000, 0x33dd0000000000, 0x5a282b0000000000, 0x6c21790000000000,
+    0xb4157a0000000000, 0x821c280000000000, 0xd807de0000000000, 0xee0e8c0000000000,
+    0x6c30320000000000, 0x5a39600000000000, 0x22960000000000, 0x362bc40000000000,
+    0x8213110000000000, 0xb41a430000000000, 0xee01b50000000000, 0xd808e70000000000,
+    0x5a36590000000000, 0x6c3f0b0000000000, 0x3624fd0000000000, 0x2daf0000000000,
+    0x367fa30000000000, 0x76f10000000000, 0x5a6d070000000000, 0x6c64550000000000,
+    0xee5aeb0000000000, 0xd853b90000000000, 0x82484f0000000000, 0xb4411d0000000000,
+    0x79c80000000000, 0x36709a0000000000, 0x6c6b6c0000000000, 0x5a623e0000000000,
+    0xd85c800000000000, 0xee55d20000000000, 0xb44e240000000000, 0x8247760000000000,
+    0x5a73750000000000, 0x6c7a270000000000, 0x3661d10000000000, 0x68830000000000,
+    0x82563d0000000000, 0xb45f6f0000000000, 0xee44990000000000, 0xd84dcb0000000000,
+    0x6c751e0000000000, 0x5a7c4c0000000000, 0x67ba0000000000, 0x366ee80000000000,
+    0xb450560000000000, 0x8259040000000000, 0xd842f20000000000, 0xee4ba00000000000,
+    0xee660f0000000000, 0xd86f5d0000000000, 0x8274ab0000000000, 0xb47df90000000000,
+    0x3643470000000000, 0x4a150000000000, 0x5a51e30000000000, 0x6c58b10000000000,
+    0xd860640000000000, 0xee69360000000000, 0xb472c00000000000, 0x827b920000000000,
+    0x452c0000000000, 0x364c7e0000000000, 0x6c57880000000000, 0x5a5eda0000000000,
+    0x826ad90000000000, 0xb4638b0000000000, 0xee787d0000000000, 0xd8712f0000000000,
+    0x5a4f910000000000, 0x6c46c30000000000, 0x365d350000000000, 0x54670000000000,
+    0xb46cb20000000000, 0x8265e00000000000, 0xd87e160000000000, 0xee77440000000000,
+    0x6c49fa0000000000, 0x5a40a80000000000, 0x5b5e0000000000, 0x36520c0000000000,
+    0x6cff460000000000, 0x5af6140000000000, 0xede20000000000, 0x36e4b00000000000,
+    0xb4da0e0000000000, 0x82d35c0000000000, 0xd8c8aa0000000000, 0xeec1f80000000000,
+    0x5af92d0000000000, 0x6cf07f0000000000, 0x36eb890000000000, 0xe2db0000000000,
+    0x82dc650000000000, 0xb4d5370000000000, 0xeecec10000000000, 0xd8c7930000000000,
+    0xf3900000000000, 0x36fac20000000000, 0x6ce1340000000000, 0x5ae8660000000000,
+    0xd8d6d80000000000, 0xeedf8a0000000000, 0xb4c47c0000000000, 0x82cd2e0000000000,
+    0x36f5fb0000000000, 0xfca90000000000, 0x5ae75f0000000000, 0x6cee0d0000000000,
+    0xeed0b30000000000, 0xd8d9e10000000000, 0x82c2170000000000, 0xb4cb450000000000,
+    0xb4e6ea0000000000, 0x82efb80000000000, 0xd8f44e0000000000, 0xeefd1c0000000000,
+    0x6cc3a20000000000, 0x5acaf00000000000, 0xd1060000000000, 0x36d8540000000000,
+    0x82e0810000000000, 0xb4e9d30000000000, 0xeef2250000000000, 0xd8fb770000000000,
+    0x5ac5c90000000000, 0x6ccc9b0000000000, 0x36d76d0000000000, 0xde3f0000000000,
+    0xd8ea3c0000000000, 0xeee36e0000000000, 0xb4f8980000000000, 0x82f1ca0000000000,
+    0xcf740000000000, 0x36c6260000000000, 0x6cddd00000000000, 0x5ad4820000000000,
+    0xeeec570000000000, 0xd8e5050000000000, 0x82fef30000000000, 0xb4f7a10000000000,
+    0x36c91f0000000000, 0xc04d0000000000, 0x5adbbb0000000000, 0x6cd2e90000000000,
+    0x5a80e50000000000, 0x6c89b70000000000, 0x3692410000000000, 0x9b130000000000,
+    0x82a5ad0000000000, 0xb4acff0000000000, 0xeeb7090000000000, 0xd8be5b0000000000,
+    0x6c868e0000000000, 0x5a8fdc0000000000, 0x942a0000000000, 0x369d780000000000,
+    0xb4a3c60000000000, 0x82aa940000000000, 0xd8b1620000000000, 0xeeb8300000000000,
+    0x368c330000000000, 0x85610000000000, 0x5a9e970000000000, 0x6c97c50000000000,
+    0xeea97b0000000000, 0xd8a0290000000000, 0x82bbdf0000000000, 0xb4b28d0000000000,
+    0x8a580000000000, 0x36830a0000000000, 0x6c98fc0000000000, 0x5a91ae0000000000,
+    0xd8af100000000000, 0xeea6420000000000, 0xb4bdb40000000000, 0x82b4e60000000000,
+    0x8299490000000000, 0xb4901b0000000000, 0xee8bed0000000000, 0xd882bf0000000000,
+    0x5abc010000000000, 0x6cb5530000000000, 0x36aea50000000000, 0xa7f70000000000,
+    0xb49f220000000000, 0x8296700000000000, 0xd88d860000000000, 0xee84d40000000000,
+    0x6cba6a0000000000, 0x5ab3380000000000, 0xa8ce0000000000, 0x36a19c0000000000,
+    0xee959f0000000000, 0xd89ccd0000000000, 0x82873b0000000000, 0xb48e690000000000,
+    0x36b0d70000000000, 0xb9850000000000, 0x5aa2730000000000, 0x6cab210000000000,
+    0xd893f40000000000, 0xee9aa60000000000, 0xb481500000000000, 0x8288020000000000,
+    0xb6bc0000000000, 0x36bfee0000000000, 0x6ca4180000000000, 0x5aad4a0000000000,
+  },
+  {
+    0, 0xd9fe8c0000000000, 0x35b1e30000000000, 0xec4f6f0000000000,
+    0x6b63c60000000000, 0xb29d4a0000000000, 0x5ed2250000000000, 0x872ca90000000000,
+    0xd6c78c0000000000, 0xf39000000000000, 0xe3766f0000000000, 0x3a88e30000000000,
+    0xbda44a0000000000, 0x645ac60000000000, 0x8815a90000000000, 0x51eb250000000000,
+    0x2bc3e30000000000, 0xf23d6f0000000000, 0x1e72000000000000, 0xc78c8c0000000000,
+    0x40a0250000000000, 0x995ea90000000000, 0x7511c60000000000, 0xacef4a0000000000,
+    0xfd046f0000000000, 0x24fae30000000000, 0xc8b58c0000000000, 0x114b000000000000,
+    0x9667a90000000000, 0x4f99250000000000, 0xa3d64a0000000000, 0x7a28c60000000000,
+    0x5787c60000000000, 0x8e794a0000000000, 0x6236250000000000, 0xbbc8a90000000000,
+    0x3ce4000000000000, 0xe51a8c0000000000, 0x955e30000000000, 0xd0ab6f0000000000,
+    0x81404a0000000000, 0x58bec60000000000, 0xb4f1a90000000000, 0x6d0f250000000000,
+    0xea238c0000000000, 0x33dd000000000000, 0xdf926f0000000000, 0x66ce30000000000,
+    0x7c44250000000000, 0xa5baa90000000000, 0x49f5c60000000000, 0x900b4a0000000000,
+    0x1727e30000000000, 0xced96f0000000000, 0x2296000000000000, 0xfb688c0000000000,
+    0xaa83a90000000000, 0x737d250000000000, 0x9f324a0000000000, 0x46ccc60000000000,
+    0xc1e06f0000000000, 0x181ee30000000000, 0xf4518c0000000000, 0x2daf000000000000,
+    0xaf0f8c0000000000, 0x76f1000000000000, 0x9abe6f0000000000, 0x4340e30000000000,
+    0xc46c4a0000000000, 0x1d92c60000000000, 0xf1dda90000000000, 0x2823250000000000,
+    0x79c8000000000000, 0xa0368c0000000000, 0x4c79e30000000000, 0x95876f0000000000,
+    0x12abc60000000000, 0xcb554a0000000000, 0x271a250000000000, 0xfee4a90000000000,
+    0x84cc6f0000000000, 0x5d32e30000000000, 0xb17d8c0000000000, 0x6883000000000000,
+    0xefafa90000000000, 0x3651250000000000, 0xda1e4a0000000000, 0x3e0c60000000000,
+    0x520be30000000000, 0x8bf56f0000000000, 0x67ba000000000000, 0xbe448c0000000000,
+    0x3968250000000000, 0xe096a90000000000, 0xcd9c60000000000, 0xd5274a0000000000,
+    0xf8884a0000000000, 0x2176c60000000000, 0xcd39a90000000000, 0x14c7250000000000,
+    0x93eb8c0000000000, 0x4a15000000000000, 0xa65a6f0000000000, 0x7fa4e30000000000,
+    0x2e4fc60000000000, 0xf7b14a0000000000, 0x1bfe250000000000, 0xc200a90000000000,
+    0x452c000000000000, 0x9cd28c0000000000, 0x709de30000000000, 0xa9636f0000000000,
+    0xd34ba90000000000, 0xab5250000000000, 0xe6fa4a0000000000, 0x3f04c60000000000,
+    0xb8286f0000000000, 0x61d6e30000000000, 0x8d998c0000000000, 0x5467000000000000,
+    0x58c250000000000, 0xdc72a90000000000, 0x303dc60000000000, 0xe9c34a0000000000,
+    0x6eefe30000000000, 0xb7116f0000000000, 0x5b5e000000000000, 0x82a08c0000000000,
+    0xd853e30000000000, 0x1ad6f0000000000, 0xede2000000000000, 0x341c8c0000000000,
+    0xb330250000000000, 0x6acea90000000000, 0x8681c60000000000, 0x5f7f4a0000000000,
+    0xe946f0000000000, 0xd76ae30000000000, 0x3b258c0000000000, 0xe2db000000000000,
+    0x65f7a90000000000, 0xbc09250000000000, 0x50464a0000000000, 0x89b8c60000000000,
+    0xf390000000000000, 0x2a6e8c0000000000, 0xc621e30000000000, 0x1fdf6f0000000000,
+    0x98f3c60000000000, 0x410d4a0000000000, 0xad42250000000000, 0x74bca90000000000,
+    0x25578c0000000000, 0xfca9000000000000, 0x10e66f0000000000, 0xc918e30000000000,
+    0x4e344a0000000000, 0x97cac60000000000, 0x7b85a90000000000, 0xa27b250000000000,
+    0x8fd4250000000000, 0x562aa90000000000, 0xba65c60000000000, 0x639b4a0000000000,
+    0xe4b7e30000000000, 0x3d496f0000000000, 0xd106000000000000, 0x8f88c0000000000,
+    0x5913a90000000000, 0x80ed250000000000, 0x6ca24a0000000000, 0xb55cc60000000000,
+    0x32706f0000000000, 0xeb8ee30000000000, 0x7c18c0000000000, 0xde3f000000000000,
+    0xa417c60000000000, 0x7de94a0000000000, 0x91a6250000000000, 0x4858a90000000000,
+    0xcf74000000000000, 0x168a8c0000000000, 0xfac5e30000000000, 0x233b6f0000000000,
+    0x72d04a0000000000, 0xab2ec60000000000, 0x4761a90000000000, 0x9e9f250000000000,
+    0x19b38c0000000000, 0xc04d000000000000, 0x2c026f0000000000, 0xf5fce30000000000,
+    0x775c6f0000000000, 0xaea2e30000000000, 0x42ed8c0000000000, 0x9b13000000000000,
+    0x1c3fa90000000000, 0xc5c1250000000000, 0x298e4a0000000000, 0xf070c60000000000,
+    0xa19be30000000000, 0x78656f0000000000, 0x942a000000000000, 0x4dd48c0000000000,
+    0xcaf8250000000000, 0x1306a90000000000, 0xff49c60000000000, 0x26b74a0000000000,
+    0x5c9f8c0000000000, 0x8561000000000000, 0x692e6f0000000000, 0xb0d0e30000000000,
+    0x37fc4a0000000000, 0xee02c60000000000, 0x24da90000000000, 0xdbb3250000000000,
+    0x8a58000000000000, 0x53a68c0000000000, 0xbfe9e30000000000, 0x66176f0000000000,
+    0xe13bc60000000000, 0x38c54a0000000000, 0xd48a250000000000, 0xd74a90000000000,
+    0x20dba90000000000, 0xf925250000000000, 0x156a4a0000000000, 0xcc94c60000000000,
+    0x4bb86f0000000000, 0x9246e30000000000, 0x7e098c0000000000, 0xa7f7000000000000,
+    0xf61c250000000000, 0x2fe2a90000000000, 0xc3adc60000000000, 0x1a534a0000000000,
+    0x9d7fe30000000000, 0x44816f0000000000, 0xa8ce000000000000, 0x71308c0000000000,
+    0xb184a0000000000, 0xd2e6c60000000000, 0x3ea9a90000000000, 0xe757250000000000,
+    0x607b8c0000000000, 0xb985000000000000, 0x55ca6f0000000000, 0x8c34e30000000000,
+    0xdddfc60000000000, 0x4214a0000000000, 0xe86e250000000000, 0x3190a90000000000,
+    0xb6bc000000000000, 0x6f428c0000000000, 0x830de30000000000, 0x5af36f0000000000,
+  },
+  {
+    0, 0x36eb3d0000000000, 0x6dd67a0000000000, 0x5b3d470000000000,
+    0xdbacf40000000000, 0xed47c90000000000, 0xb67a8e0000000000, 0x8091b30000000000,
+    0x3115130000000000, 0x7fe2e0000000000, 0x5cc3690000000000, 0x6a28540000000000,
+    0xeab9e70000000000, 0xdc52da0000000000, 0x876f9d0000000000, 0xb184a00000000000,
+    0x622a260000000000, 0x54c11b0000000000, 0xffc5c0000000000, 0x3917610000000000,
+    0xb986d20000000000, 0x8f6def0000000000, 0xd450a80000000000, 0xe2bb950000000000,
+    0x533f350000000000, 0x65d4080000000000, 0x3ee94f0000000000, 0x802720000000000,
+    0x8893c10000000000, 0xbe78fc0000000000, 0xe545bb0000000000, 0xd3ae860000000000,
+    0xc4544c0000000000, 0xf2bf710000000000, 0xa982360000000000, 0x9f690b0000000000,
+    0x1ff8b80000000000, 0x2913850000000000, 0x722ec20000000000, 0x44c5ff0000000000,
+    0xf5415f0000000000, 0xc3aa620000000000, 0x9897250000000000, 0xae7c180000000000,
+    0x2eedab0000000000, 0x1806960000000000, 0x433bd10000000000, 0x75d0ec0000000000,
+    0xa67e6a0000000000, 0x9095570000000000, 0xcba8100000000000, 0xfd432d0000000000,
+    0x7dd29e0000000000, 0x4b39a30000000000, 0x1004e40000000000, 0x26efd90000000000,
+    0x976b790000000000, 0xa180440000000000, 0xfabd030000000000, 0xcc563e0000000000,
+    0x4cc78d0000000000, 0x7a2cb00000000000, 0x2111f70000000000, 0x17faca0000000000,
+    0xee4630000000000, 0x380f5e0000000000, 0x6332190000000000, 0x55d9240000000000,
+    0xd548970000000000, 0xe3a3aa0000000000, 0xb89eed0000000000, 0x8e75d00000000000,
+    0x3ff1700000000000, 0x91a4d0000000000, 0x52270a0000000000, 0x64cc370000000000,
+    0xe45d840000000000, 0xd2b6b90000000000, 0x898bfe0000000000, 0xbf60c30000000000,
+    0x6cce450000000000, 0x5a25780000000000, 0x1183f0000000000, 0x37f3020000000000,
+    0xb762b10000000000, 0x81898c0000000000, 0xdab4cb0000000000, 0xec5ff60000000000,
+    0x5ddb560000000000, 0x6b306b0000000000, 0x300d2c0000000000, 0x6e6110000000000,
+    0x8677a20000000000, 0xb09c9f0000000000, 0xeba1d80000000000, 0xdd4ae50000000000,
+    0xcab02f0000000000, 0xfc5b120000000000, 0xa766550000000000, 0x918d680000000000,
+    0x111cdb0000000000, 0x27f7e60000000000, 0x7ccaa10000000000, 0x4a219c0000000000,
+    0xfba53c0000000000, 0xcd4e010000000000, 0x9673460000000000, 0xa0987b0000000000,
+    0x2009c80000000000, 0x16e2f50000000000, 0x4ddfb20000000000, 0x7b348f0000000000,
+    0xa89a090000000000, 0x9e71340000000000, 0xc54c730000000000, 0xf3a74e0000000000,
+    0x7336fd0000000000, 0x45ddc00000000000, 0x1ee0870000000000, 0x280bba0000000000,
+    0x998f1a0000000000, 0xaf64270000000000, 0xf459600000000000, 0xc2b25d0000000000,
+    0x4223ee0000000000, 0x74c8d30000000000, 0x2ff5940000000000, 0x191ea90000000000,
+    0x1dc8c60000000000, 0x2b23fb0000000000, 0x701ebc0000000000, 0x46f5810000000000,
+    0xc664320000000000, 0xf08f0f0000000000, 0xabb2480000000000, 0x9d59750000000000,
+    0x2cddd50000000000, 0x1a36e80000000000, 0x410baf0000000000, 0x77e0920000000000,
+    0xf771210000000000, 0xc19a1c0000000000, 0x9aa75b0000000000, 0xac4c660000000000,
+    0x7fe2e00000000000, 0x4909dd0000000000, 0x12349a0000000000, 0x24dfa70000000000,
+    0xa44e140000000000, 0x92a5290000000000, 0xc9986e0000000000, 0xff73530000000000,
+    0x4ef7f30000000000, 0x781cce0000000000, 0x2321890000000000, 0x15cab40000000000,
+    0x955b070000000000, 0xa3b03a0000000000, 0xf88d7d0000000000, 0xce66400000000000,
+    0xd99c8a0000000000, 0xef77b70000000000, 0xb44af00000000000, 0x82a1cd0000000000,
+    0x2307e0000000000, 0x34db430000000000, 0x6fe6040000000000, 0x590d390000000000,
+    0xe889990000000000, 0xde62a40000000000, 0x855fe30000000000, 0xb3b4de0000000000,
+    0x33256d0000000000, 0x5ce500000000000, 0x5ef3170000000000, 0x68182a0000000000,
+    0xbbb6ac0000000000, 0x8d5d910000000000, 0xd660d60000000000, 0xe08beb0000000000,
+    0x601a580000000000, 0x56f1650000000000, 0xdcc220000000000, 0x3b271f0000000000,
+    0x8aa3bf0000000000, 0xbc48820000000000, 0xe775c50000000000, 0xd19ef80000000000,
+    0x510f4b0000000000, 0x67e4760000000000, 0x3cd9310000000000, 0xa320c0000000000,
+    0x132ca50000000000, 0x25c7980000000000, 0x7efadf0000000000, 0x4811e20000000000,
+    0xc880510000000000, 0xfe6b6c0000000000, 0xa5562b0000000000, 0x93bd160000000000,
+    0x2239b60000000000, 0x14d28b0000000000, 0x4fefcc0000000000, 0x7904f10000000000,
+    0xf995420000000000, 0xcf7e7f0000000000, 0x9443380000000000, 0xa2a8050000000000,
+    0x7106830000000000, 0x47edbe0000000000, 0x1cd0f90000000000, 0x2a3bc40000000000,
+    0xaaaa770000000000, 0x9c414a0000000000, 0xc77c0d0000000000, 0xf197300000000000,
+    0x4013900000000000, 0x76f8ad0000000000, 0x2dc5ea0000000000, 0x1b2ed70000000000,
+    0x9bbf640000000000, 0xad54590000000000, 0xf6691e0000000000, 0xc082230000000000,
+    0xd778e90000000000, 0xe193d40000000000, 0xbaae930000000000, 0x8c45ae0000000000,
+    0xcd41d0000000000, 0x3a3f200000000000, 0x6102670000000000, 0x57e95a0000000000,
+    0xe66dfa0000000000, 0xd086c70000000000, 0x8bbb800000000000, 0xbd50bd0000000000,
+    0x3dc10e0000000000, 0xb2a330000000000, 0x5017740000000000, 0x66fc490000000000,
+    0xb552cf0000000000, 0x83b9f20000000000, 0xd884b50000000000, 0xee6f880000000000,
+    0x6efe3b0000000000, 0x5815060000000000, 0x328410000000000, 0x35c37c0000000000,
+    0x8447dc0000000000, 0xb2ace10000000000, 0xe991a60000000000, 0xdf7a9b0000000000,
+    0x5feb280000000000, 0x6900150000000000, 0x323d520000000000, 0x4d66f0000000000,
+  },
+  {
+    0, 0x3b918c0000000000, 0x7723180000000000, 0x4cb2940000000000,
+    0xee46300000000000, 0xd5d7bc0000000000, 0x9965280000000000, 0xa2f4a40000000000,
+    0x5ac09b0000000000, 0x6151170000000000, 0x2de3830000000000, 0x16720f0000000000,
+    0xb486ab0000000000, 0x8f17270000000000, 0xc3a5b30000000000, 0xf8343f0000000000,
+    0xb581360000000000, 0x8e10ba0000000000, 0xc2a22e0000000000, 0xf933a20000000000,
+    0x5bc7060000000000, 0x60568a0000000000, 0x2ce41e0000000000, 0x1775920000000000,
+    0xef41ad0000000000, 0xd4d0210000000000, 0x9862b50000000000, 0xa3f3390000000000,
+    0x1079d0000000000, 0x3a96110000000000, 0x7624850000000000, 0x4db5090000000000,
+    0xed4e970000000000, 0xd6df1b0000000000, 0x9a6d8f0000000000, 0xa1fc030000000000,
+    0x308a70000000000, 0x38992b0000000000, 0x742bbf0000000000, 0x4fba330000000000,
+    0xb78e0c0000000000, 0x8c1f800000000000, 0xc0ad140000000000, 0xfb3c980000000000,
+    0x59c83c0000000000, 0x6259b00000000000, 0x2eeb240000000000, 0x157aa80000000000,
+    0x58cfa10000000000, 0x635e2d0000000000, 0x2fecb90000000000, 0x147d350000000000,
+    0xb689910000000000, 0x8d181d0000000000, 0xc1aa890000000000, 0xfa3b050000000000,
+    0x20f3a0000000000, 0x399eb60000000000, 0x752c220000000000, 0x4ebdae0000000000,
+    0xec490a0000000000, 0xd7d8860000000000, 0x9b6a120000000000, 0xa0fb9e0000000000,
+    0x5cd1d50000000000, 0x6740590000000000, 0x2bf2cd0000000000, 0x1063410000000000,
+    0xb297e50000000000, 0x8906690000000000, 0xc5b4fd0000000000, 0xfe25710000000000,
+    0x6114e0000000000, 0x3d80c20000000000, 0x7132560000000000, 0x4aa3da0000000000,
+    0xe8577e0000000000, 0xd3c6f20000000000, 0x9f74660000000000, 0xa4e5ea0000000000,
+    0xe950e30000000000, 0xd2c16f0000000000, 0x9e73fb0000000000, 0xa5e2770000000000,
+    0x716d30000000000, 0x3c875f0000000000, 0x7035cb0000000000, 0x4ba4470000000000,
+    0xb390780000000000, 0x8801f40000000000, 0xc4b3600000000000, 0xff22ec0000000000,
+    0x5dd6480000000000, 0x6647c40000000000, 0x2af5500000000000, 0x1164dc0000000000,
+    0xb19f420000000000, 0x8a0ece0000000000, 0xc6bc5a0000000000, 0xfd2dd60000000000,
+    0x5fd9720000000000, 0x6448fe0000000000, 0x28fa6a0000000000, 0x136be60000000000,
+    0xeb5fd90000000000, 0xd0ce550000000000, 0x9c7cc10000000000, 0xa7ed4d0000000000,
+    0x519e90000000000, 0x3e88650000000000, 0x723af10000000000, 0x49ab7d0000000000,
+    0x41e740000000000, 0x3f8ff80000000000, 0x733d6c0000000000, 0x48ace00000000000,
+    0xea58440000000000, 0xd1c9c80000000000, 0x9d7b5c0000000000, 0xa6ead00000000000,
+    0x5edeef0000000000, 0x654f630000000000, 0x29fdf70000000000, 0x126c7b0000000000,
+    0xb098df0000000000, 0x8b09530000000000, 0xc7bbc70000000000, 0xfc2a4b0000000000,
+    0xb9a3aa0000000000, 0x8232260000000000, 0xce80b20000000000, 0xf5113e0000000000,
+    0x57e59a0000000000, 0x6c74160000000000, 0x20c6820000000000, 0x1b570e0000000000,
+    0xe363310000000000, 0xd8f2bd0000000000, 0x9440290000000000, 0xafd1a50000000000,
+    0xd25010000000000, 0x36b48d0000000000, 0x7a06190000000000, 0x4197950000000000,
+    0xc229c0000000000, 0x37b3100000000000, 0x7b01840000000000, 0x4090080000000000,
+    0xe264ac0000000000, 0xd9f5200000000000, 0x9547b40000000000, 0xaed6380000000000,
+    0x56e2070000000000, 0x6d738b0000000000, 0x21c11f0000000000, 0x1a50930000000000,
+    0xb8a4370000000000, 0x8335bb0000000000, 0xcf872f0000000000, 0xf416a30000000000,
+    0x54ed3d0000000000, 0x6f7cb10000000000, 0x23ce250000000000, 0x185fa90000000000,
+    0xbaab0d0000000000, 0x813a810000000000, 0xcd88150000000000, 0xf619990000000000,
+    0xe2da60000000000, 0x35bc2a0000000000, 0x790ebe0000000000, 0x429f320000000000,
+    0xe06b960000000000, 0xdbfa1a0000000000, 0x97488e0000000000, 0xacd9020000000000,
+    0xe16c0b0000000000, 0xdafd870000000000, 0x964f130000000000, 0xadde9f0000000000,
+    0xf2a3b0000000000, 0x34bbb70000000000, 0x7809230000000000, 0x4398af0000000000,
+    0xbbac900000000000, 0x803d1c0000000000, 0xcc8f880000000000, 0xf71e040000000000,
+    0x55eaa00000000000, 0x6e7b2c0000000000, 0x22c9b80000000000, 0x1958340000000000,
+    0xe5727f0000000000, 0xdee3f30000000000, 0x9251670000000000, 0xa9c0eb0000000000,
+    0xb344f0000000000, 0x30a5c30000000000, 0x7c17570000000000, 0x4786db0000000000,
+    0xbfb2e40000000000, 0x8423680000000000, 0xc891fc0000000000, 0xf300700000000000,
+    0x51f4d40000000000, 0x6a65580000000000, 0x26d7cc0000000000, 0x1d46400000000000,
+    0x50f3490000000000, 0x6b62c50000000000, 0x27d0510000000000, 0x1c41dd0000000000,
+    0xbeb5790000000000, 0x8524f50000000000, 0xc996610000000000, 0xf207ed0000000000,
+    0xa33d20000000000, 0x31a25e0000000000, 0x7d10ca0000000000, 0x4681460000000000,
+    0xe475e20000000000, 0xdfe46e0000000000, 0x9356fa0000000000, 0xa8c7760000000000,
+    0x83ce80000000000, 0x33ad640000000000, 0x7f1ff00000000000, 0x448e7c0000000000,
+    0xe67ad80000000000, 0xddeb540000000000, 0x9159c00000000000, 0xaac84c0000000000,
+    0x52fc730000000000, 0x696dff0000000000, 0x25df6b0000000000, 0x1e4ee70000000000,
+    0xbcba430000000000, 0x872bcf0000000000, 0xcb995b0000000000, 0xf008d70000000000,
+    0xbdbdde0000000000, 0x862c520000000000, 0xca9ec60000000000, 0xf10f4a0000000000,
+    0x53fbee0000000000, 0x686a620000000000, 0x24d8f60000000000, 0x1f497a0000000000,
+    0xe77d450000000000, 0xdcecc90000000000, 0x905e5d0000000000, 0xabcfd10000000000,
+    0x93b750000000000, 0x32aaf90000000000, 0x7e186d0000000000, 0x4589e10000000000,
+  },
+  {
+    0, 0xf50baf0000000000, 0x6c5ba50000000000, 0x99500a0000000000,
+    0xd8b74a0000000000, 0x2dbce50000000000, 0xb4ecef0000000000, 0x41e7400000000000,
+    0x37226f0000000000, 0xc229c00000000000, 0x5b79ca0000000000, 0xae72650000000000,
+    0xef95250000000000, 0x1a9e8a0000000000, 0x83ce800000000000, 0x76c52f0000000000,
+    0x6e44de0000000000, 0x9b4f710000000000, 0x21f7b0000000000, 0xf714d40000000000,
+    0xb6f3940000000000, 0x43f83b0000000000, 0xdaa8310000000000, 0x2fa39e0000000000,
+    0x5966b10000000000, 0xac6d1e0000000000, 0x353d140000000000, 0xc036bb0000000000,
+    0x81d1fb0000000000, 0x74da540000000000, 0xed8a5e0000000000, 0x1881f10000000000,
+    0xdc89bc0000000000, 0x2982130000000000, 0xb0d2190000000000, 0x45d9b60000000000,
+    0x43ef60000000000, 0xf135590000000000, 0x6865530000000000, 0x9d6efc0000000000,
+    0xebabd30000000000, 0x1ea07c0000000000, 0x87f0760000000000, 0x72fbd90000000000,
+    0x331c990000000000, 0xc617360000000000, 0x5f473c0000000000, 0xaa4c930000000000,
+    0xb2cd620000000000, 0x47c6cd0000000000, 0xde96c70000000000, 0x2b9d680000000000,
+    0x6a7a280000000000, 0x9f71870000000000, 0x6218d0000000000, 0xf32a220000000000,
+    0x85ef0d0000000000, 0x70e4a20000000000, 0xe9b4a80000000000, 0x1cbf070000000000,
+    0x5d58470000000000, 0xa853e80000000000, 0x3103e20000000000, 0xc4084d0000000000,
+    0x3f5f830000000000, 0xca542c0000000000, 0x5304260000000000, 0xa60f890000000000,
+    0xe7e8c90000000000, 0x12e3660000000000, 0x8bb36c0000000000, 0x7eb8c30000000000,
+    0x87dec0000000000, 0xfd76430000000000, 0x6426490000000000, 0x912de60000000000,
+    0xd0caa60000000000, 0x25c1090000000000, 0xbc91030000000000, 0x499aac0000000000,
+    0x511b5d0000000000, 0xa410f20000000000, 0x3d40f80000000000, 0xc84b570000000000,
+    0x89ac170000000000, 0x7ca7b80000000000, 0xe5f7b20000000000, 0x10fc1d0000000000,
+    0x6639320000000000, 0x93329d0000000000, 0xa62970000000000, 0xff69380000000000,
+    0xbe8e780000000000, 0x4b85d70000000000, 0xd2d5dd0000000000, 0x27de720000000000,
+    0xe3d63f0000000000, 0x16dd900000000000, 0x8f8d9a0000000000, 0x7a86350000000000,
+    0x3b61750000000000, 0xce6ada0000000000, 0x573ad00000000000, 0xa2317f0000000000,
+    0xd4f4500000000000, 0x21ffff0000000000, 0xb8aff50000000000, 0x4da45a0000000000,
+    0xc431a0000000000, 0xf948b50000000000, 0x6018bf0000000000, 0x9513100000000000,
+    0x8d92e10000000000, 0x78994e0000000000, 0xe1c9440000000000, 0x14c2eb0000000000,
+    0x5525ab0000000000, 0xa02e040000000000, 0x397e0e0000000000, 0xcc75a10000000000,
+    0xbab08e0000000000, 0x4fbb210000000000, 0xd6eb2b0000000000, 0x23e0840000000000,
+    0x6207c40000000000, 0x970c6b0000000000, 0xe5c610000000000, 0xfb57ce0000000000,
+    0x7ebf060000000000, 0x8bb4a90000000000, 0x12e4a30000000000, 0xe7ef0c0000000000,
+    0xa6084c0000000000, 0x5303e30000000000, 0xca53e90000000000, 0x3f58460000000000,
+    0x499d690000000000, 0xbc96c60000000000, 0x25c6cc0000000000, 0xd0cd630000000000,
+    0x912a230000000000, 0x64218c0000000000, 0xfd71860000000000, 0x87a290000000000,
+    0x10fbd80000000000, 0xe5f0770000000000, 0x7ca07d0000000000, 0x89abd20000000000,
+    0xc84c920000000000, 0x3d473d0000000000, 0xa417370000000000, 0x511c980000000000,
+    0x27d9b70000000000, 0xd2d2180000000000, 0x4b82120000000000, 0xbe89bd0000000000,
+    0xff6efd0000000000, 0xa65520000000000, 0x9335580000000000, 0x663ef70000000000,
+    0xa236ba0000000000, 0x573d150000000000, 0xce6d1f0000000000, 0x3b66b00000000000,
+    0x7a81f00000000000, 0x8f8a5f0000000000, 0x16da550000000000, 0xe3d1fa0000000000,
+    0x9514d50000000000, 0x601f7a0000000000, 0xf94f700000000000, 0xc44df0000000000,
+    0x4da39f0000000000, 0xb8a8300000000000, 0x21f83a0000000000, 0xd4f3950000000000,
+    0xcc72640000000000, 0x3979cb0000000000, 0xa029c10000000000, 0x55226e0000000000,
+    0x14c52e0000000000, 0xe1ce810000000000, 0x789e8b0000000000, 0x8d95240000000000,
+    0xfb500b0000000000, 0xe5ba40000000000, 0x970bae0000000000, 0x6200010000000000,
+    0x23e7410000000000, 0xd6ecee0000000000, 0x4fbce40000000000, 0xbab74b0000000000,
+    0x41e0850000000000, 0xb4eb2a0000000000, 0x2dbb200000000000, 0xd8b08f0000000000,
+    0x9957cf0000000000, 0x6c5c600000000000, 0xf50c6a0000000000, 0x7c50000000000,
+    0x76c2ea0000000000, 0x83c9450000000000, 0x1a994f0000000000, 0xef92e00000000000,
+    0xae75a00000000000, 0x5b7e0f0000000000, 0xc22e050000000000, 0x3725aa0000000000,
+    0x2fa45b0000000000, 0xdaaff40000000000, 0x43fffe0000000000, 0xb6f4510000000000,
+    0xf713110000000000, 0x218be0000000000, 0x9b48b40000000000, 0x6e431b0000000000,
+    0x1886340000000000, 0xed8d9b0000000000, 0x74dd910000000000, 0x81d63e0000000000,
+    0xc0317e0000000000, 0x353ad10000000000, 0xac6adb0000000000, 0x5961740000000000,
+    0x9d69390000000000, 0x6862960000000000, 0xf1329c0000000000, 0x439330000000000,
+    0x45de730000000000, 0xb0d5dc0000000000, 0x2985d60000000000, 0xdc8e790000000000,
+    0xaa4b560000000000, 0x5f40f90000000000, 0xc610f30000000000, 0x331b5c0000000000,
+    0x72fc1c0000000000, 0x87f7b30000000000, 0x1ea7b90000000000, 0xebac160000000000,
+    0xf32de70000000000, 0x626480000000000, 0x9f76420000000000, 0x6a7ded0000000000,
+    0x2b9aad0000000000, 0xde91020000000000, 0x47c1080000000000, 0xb2caa70000000000,
+    0xc40f880000000000, 0x3104270000000000, 0xa8542d0000000000, 0x5d5f820000000000,
+    0x1cb8c20000000000, 0xe9b36d0000000000, 0x70e3670000000000, 0x85e8c80000000000,
+  },
+};
+static const CrcFold crc_cat_f10 = {
+    24, 0, 0x864cfb0000000000,
+    { 0x2134270000000000, 0x5d2b630000000000 }, { 0x8289a0000000000, 0x74b44a0000000000 }, { 0xc4b14d0000000000, 0xfd7e0c0000000000 },
+    0xfd7e0c0000000000, 0xf845fe2493242da4
+};
+
+/* CRC-32/ISO-HDLC */
+static const uint64_t crc_cat_t11[8][256] = {
+  {
+    0, 0x77073096, 0xee0e612c, 0x990951ba,
+    0x76dc419, 0x706af48f, 0xe963a535, 0x9e6495a3,
+    0xedb8832, 0x79dcb8a4, 0xe0d5e91e, 0x97d2d988,
+    0x9b64c2b, 0x7eb17cbd, 0xe7b82d07, 0x90bf1d91,
+    0x1db71064, 0x6ab020f2, 0xf3b97148, 0x84be41de,
+    0x1adad47d, 0x6ddde4eb, 0xf4d4b551, 0x83d385c7,
+    0x136c9856, 0x646ba8c0, 0xfd62f97a, 0x8a65c9ec,
+    0x14015c4f, 0x63066cd9, 0xfa0f3d63, 0x8d080df5,
+    0x3b6e20c8, 0x4c69105e, 0xd56041e4, 0xa2677172,
+    0x3c03e4d1, 0x4b04d447, 0xd20d85fd, 0xa50ab56b,
+    0x35b5a8fa, 0x42b2986c, 0xdbbbc9d6, 0xacbcf940,
+    0x32d86ce3, 0x45df5c75, 0xdcd60dcf, 0xabd13d59,
+    0x26d930ac, 0x51de003a, 0xc8d75180, 0xbfd06116,
+    0x21b4f4b5, 0x56b3c423, 0xcfba9599, 0xb8bda50f,
+    0x2802b89e, 0x5f058808, 0xc60cd9b2, 0xb10be924,
+    0x2f6f7c87, 0x58684c11, 0xc1611dab, 0xb6662d3d,
+    0x76dc4190, 0x1db7106, 0x98d220bc, 0xefd5102a,
+    0x71b18589, 0x6b6b51f, 0x9fbfe4a5, 0xe8b8d433,
+    0x7807c9a2, 0xf00f934, 0x9609a88e, 0xe10e9818,
+    0x7f6a0dbb, 0x86d3d2d, 0x91646c97, 0xe6635c01,
+    0x6b6b51f4, 0x1c6c6162, 0x856530d8, 0xf262004e,
+    0x6c0695ed, 0x1b01a57b, 0x8208f4c1, 0xf50fc457,
+    0x65b0d9c6, 0x12b7e950, 0x8bbeb8ea, 0xfcb9887c,
+    0x62dd1ddf, 0x15da2d49, 0x8cd37cf3, 0xfbd44c65,
+    0x4db26158, 0x3ab551ce, 0xa3bc0074, 0xd4bb30e2,
+    0x4adfa541, 0x3dd895d7, 0xa4d1c46d, 0xd3d6f4fb,
+    0x4369e96a, 0x346ed9fc, 0xad678846, 0xda60b8d0,
+    0x44042d73, 0x33031de5, 0xaa0a4c5f, 0xdd0d7cc9,
+    0x5005713c, 0x270241aa, 0xbe0b1010, 0xc90c2086,
+    0x5768b525, 0x206f85b3, 0xb966d409, 0xce61e49f,
+    0x5edef90e, 0x29d9c998, 0xb0d09822, 0xc7d7a8b4,
+    0x59b33d17, 0x2eb40d81, 0xb7bd5c3b, 0xc0ba6cad,
+    0xedb88320, 0x9abfb3b6, 0x3b6e20c, 0x74b1d29a,
+    0xead54739, 0x9dd277af, 0x4db2615, 0x73dc1683,
+    0xe3630b12, 0x94643b84, 0xd6d6a3e, 0x7a6a5aa8,
+    0xe40ecf0b, 0x9309ff9d, 0xa00ae27, 0x7d079eb1,
+    0xf00f9344, 0x8708a3d2, 0x1e01f268, 0x6906c2fe,
+    0xf762575d, 0x806567cb, 0x196c3671, 0x6e6b06e7,
+    0xfed41b76, 0x89d32be0, 0x10da7a5a, 0x67dd4acc,
+    0xf9b9df6f, 0x8ebeeff9, 0x17b7be43, 0x60b08ed5,
+    0xd6d6a3e8, 0xa1d1937e, 0x38d8c2c4, 0x4fdff252,
+    0xd1bb67f1, 0xa6bc5767, 0x3fb506dd, 0x48b2364b,
+    0xd80d2bda, 0xaf0a1b4c, 0x36034af6, 0x41047a60,
+    0xdf60efc3, 0xa867df55, 0x316e8eef, 0x4669be79,
+    0xcb61b38c, 0xbc66831a, 0x256fd2a0, 0x5268e236,
+    0xcc0c7795, 0xbb0b4703, 0x220216b9, 0x5505262f,
+    0xc5ba3bbe, 0xb2bd0b28, 0x2bb45a92, 0x5cb36a04,
+    0xc2d7ffa7, 0xb5d0cf31, 0x2cd99e8b, 0x5bdeae1d,
+    0x9b64c2b0, 0xec63f226, 0x756aa39c, 0x26d930a,
+    0x9c0906a9, 0xeb0e363f, 0x72076785, 0x5005713,
+    0x95bf4a82, 0xe2b87a14, 0x7bb12bae, 0xcb61b38,
+    0x92d28e9b, 0xe5d5be0d, 0x7cdcefb7, 0xbdbdf21,
+    0x86d3d2d4, 0xf1d4e242, 0x68ddb3f8, 0x1fda836e,
+    0x81be16cd, 0xf6b9265b, 0x6fb077e1, 0x18b74777,
+    0x88085ae6, 0xff0f6a70, 0x66063bca, 0x11010b5c,
+    0x8f659eff, 0xf862ae69, 0x616bffd3, 0x166ccf45,
+    0xa00ae278, 0xd70dd2ee, 0x4e048354, 0x3903b3c2,
+    0xa7672661, 0xd06016f7, 0x4969474d, 0x3e6e77db,
+    0xaed16a4a, 0xd9d65adc, 0x40df0b66, 0x37d83bf0,
+    0xa9bcae53, 0xdebb9ec5, 0x47b2cf7f, 0x30b5ffe9,
+    0xbdbdf21c, 0xcabac28a, 0x53b39330, 0x24b4a3a6,
+    0xbad03605, 0xcdd70693, 0x54de5729, 0x23d967bf,
+    0xb3667a2e, 0xc4614ab8, 0x5d681b02, 0x2a6f2b94,
+    0xb40bbe37, 0xc30c8ea1, 0x5a05df1b, 0x2d02ef8d,
+  },
+  {
+    0, 0x191b3141, 0x32366282, 0x2b2d53c3,
+    0x646cc504, 0x7d77f445, 0x565aa786, 0x4f4196c7,
+    0xc8d98a08, 0xd1c2bb49, 0xfaefe88a, 0xe3f4d9cb,
+    0xacb54f0c, 0xb5ae7e4d, 0x9e832d8e, 0x87981ccf,
+    0x4ac21251, 0x53d92310, 0x78f470d3, 0x61ef4192,
+    0x2eaed755, 0x37b5e614, 0x1c98b5d7, 0x5838496,
+    0x821b9859, 0x9b00a918, 0xb02dfadb, 0xa936cb9a,
+    0xe6775d5d, 0xff6c6c1c, 0xd4413fdf, 0xcd5a0e9e,
+    0x958424a2, 0x8c9f15e3, 0xa7b24620, 0xbea97761,
+    0xf1e8e1a6, 0xe8f3d0e7, 0xc3de8324, 0xdac5b265,
+    0x5d5daeaa, 0x44469feb, 0x6f6bcc28, 0x7670fd69,
+    0x39316bae, 0x202a5aef, 0xb07092c, 0x121c386d,
+    0xdf4636f3, 0xc65d07b2, 0xed705471, 0xf46b6530,
+    0xbb2af3f7, 0xa231c2b6, 0x891c9175, 0x9007a034,
+    0x179fbcfb, 0xe848dba, 0x25a9de79, 0x3cb2ef38,
+    0x73f379ff, 0x6ae848be, 0x41c51b7d, 0x58de2a3c,
+    0xf0794f05, 0xe9627e44, 0xc24f2d87, 0xdb541cc6,
+    0x94158a01, 0x8d0ebb40, 0xa623e883, 0xbf38d9c2,
+    0x38a0c50d, 0x21bbf44c, 0xa96a78f, 0x138d96ce,
+    0x5ccc0009, 0x45d73148, 0x6efa628b, 0x77e153ca,
+    0xbabb5d54, 0xa3a06c15, 0x888d3fd6, 0x91960e97,
+    0xded79850, 0xc7cca911, 0xece1fad2, 0xf5facb93,
+    0x7262d75c, 0x6b79e61d, 0x4054b5de, 0x594f849f,
+    0x160e1258, 0xf152319, 0x243870da, 0x3d23419b,
+    0x65fd6ba7, 0x7ce65ae6, 0x57cb0925, 0x4ed03864,
+    0x191aea3, 0x188a9fe2, 0x33a7cc21, 0x2abcfd60,
+    0xad24e1af, 0xb43fd0ee, 0x9f12832d, 0x8609b26c,
+    0xc94824ab, 0xd05315ea, 0xfb7e4629, 0xe2657768,
+    0x2f3f79f6, 0x362448b7, 0x1d091b74, 0x4122a35,
+    0x4b53bcf2, 0x52488db3, 0x7965de70, 0x607eef31,
+    0xe7e6f3fe, 0xfefdc2bf, 0xd5d0917c, 0xcccba03d,
+    0x838a36fa, 0x9a9107bb, 0xb1bc5478, 0xa8a76539,
+    0x3b83984b, 0x2298a90a, 0x9b5fac9, 0x10aecb88,
+    0x5fef5d4f, 0x46f46c0e, 0x6dd93fcd, 0x74c20e8c,
+    0xf35a1243, 0xea412302, 0xc16c70c1, 0xd8774180,
+    0x9736d747, 0x8e2de606, 0xa500b5c5, 0xbc1b8484,
+    0x71418a1a, 0x685abb5b, 0x4377e898, 0x5a6cd9d9,
+    0x152d4f1e, 0xc367e5f, 0x271b2d9c, 0x3e001cdd,
+    0xb9980012, 0xa0833153, 0x8bae6290, 0x92b553d1,
+    0xddf4c516, 0xc4eff457, 0xefc2a794, 0xf6d996d5,
+    0xae07bce9, 0xb71c8da8, 0x9c31de6b, 0x852aef2a,
+    0xca6b79ed, 0xd37048ac, 0xf85d1b6f, 0xe1462a2e,
+    0x66de36e1, 0x7fc507a0, 0x54e85463, 0x4df36522,
+    0x2b2f3e5, 0x1ba9c2a4, 0x30849167, 0x299fa026,
+    0xe4c5aeb8, 0xfdde9ff9, 0xd6f3cc3a, 0xcfe8fd7b,
+    0x80a96bbc, 0x99b25afd, 0xb29f093e, 0xab84387f,
+    0x2c1c24b0, 0x350715f1, 0x1e2a4632, 0x7317773,
+    0x4870e1b4, 0x516bd0f5, 0x7a468336, 0x635db277,
+    0xcbfad74e, 0xd2e1e60f, 0xf9ccb5cc, 0xe0d7848d,
+    0xaf96124a, 0xb68d230b, 0x9da070c8, 0x84bb4189,
+    0x3235d46, 0x1a386c07, 0x31153fc4, 0x280e0e85,
+    0x674f9842, 0x7e54a903, 0x5579fac0, 0x4c62cb81,
+    0x8138c51f, 0x9823f45e, 0xb30ea79d, 0xaa1596dc,
+    0xe554001b, 0xfc4f315a, 0xd7626299, 0xce7953d8,
+    0x49e14f17, 0x50fa7e56, 0x7bd72d95, 0x62cc1cd4,
+    0x2d8d8a13, 0x3496bb52, 0x1fbbe891, 0x6a0d9d0,
+    0x5e7ef3ec, 0x4765c2ad, 0x6c48916e, 0x7553a02f,
+    0x3a1236e8, 0x230907a9, 0x824546a, 0x113f652b,
+    0x96a779e4, 0x8fbc48a5, 0xa4911b66, 0xbd8a2a27,
+    0xf2cbbce0, 0xebd08da1, 0xc0fdde62, 0xd9e6ef23,
+    0x14bce1bd, 0xda7d0fc, 0x268a833f, 0x3f91b27e,
+    0x70d024b9, 0x69cb15f8, 0x42e6463b, 0x5bfd777a,
+    0xdc656bb5, 0xc57e5af4, 0xee530937, 0xf7483876,
+    0xb809aeb1, 0xa1129ff0, 0x8a3fcc33, 0x9324fd72,
+  },
+  {
+    0, 0x1c26a37, 0x384d46e, 0x246be59,
+    0x709a8dc, 0x6cbc2eb, 0x48d7cb2, 0x54f1685,
+    0xe1351b8, 0xfd13b8f, 0xd9785d6, 0xc55efe1,
+    0x91af964, 0x8d89353, 0xa9e2d0a, 0xb5c473d,
+    0x1c26a370, 0x1de4c947, 0x1fa2771e, 0x1e601d29,
+    0x1b2f0bac, 0x1aed619b, 0x18abdfc2, 0x1969b5f5,
+    0x1235f2c8, 0x13f798ff, 0x11b126a6, 0x10734c91,
+    0x153c5a14, 0x14fe3023, 0x16b88e7a, 0x177ae44d,
+    0x384d46e0, 0x398f2cd7, 0x3bc9928e, 0x3a0bf8b9,
+    0x3f44ee3c, 0x3e86840b, 0x3cc03a52, 0x3d025065,
+    0x365e1758, 0x379c7d6f, 0x35dac336, 0x3418a901,
+    0x3157bf84, 0x3095d5b3, 0x32d36bea, 0x331101dd,
+    0x246be590, 0x25a98fa7, 0x27ef31fe, 0x262d5bc9,
+    0x23624d4c, 0x22a0277b, 0x20e69922, 0x2124f315,
+    0x2a78b428, 0x2bbade1f, 0x29fc6046, 0x283e0a71,
+    0x2d711cf4, 0x2cb376c3, 0x2ef5c89a, 0x2f37a2ad,
+    0x709a8dc0, 0x7158e7f7, 0x731e59ae, 0x72dc3399,
+    0x7793251c, 0x76514f2b, 0x7417f172, 0x75d59b45,
+    0x7e89dc78, 0x7f4bb64f, 0x7d0d0816, 0x7ccf6221,
+    0x798074a4, 0x78421e93, 0x7a04a0ca, 0x7bc6cafd,
+    0x6cbc2eb0, 0x6d7e4487, 0x6f38fade, 0x6efa90e9,
+    0x6bb5866c, 0x6a77ec5b, 0x68315202, 0x69f33835,
+    0x62af7f08, 0x636d153f, 0x612bab66, 0x60e9c151,
+    0x65a6d7d4, 0x6464bde3, 0x662203ba, 0x67e0698d,
+    0x48d7cb20, 0x4915a117, 0x4b531f4e, 0x4a917579,
+    0x4fde63fc, 0x4e1c09cb, 0x4c5ab792, 0x4d98dda5,
+    0x46c49a98, 0x4706f0af, 0x45404ef6, 0x448224c1,
+    0x41cd3244, 0x400f5873, 0x4249e62a, 0x438b8c1d,
+    0x54f16850, 0x55330267, 0x5775bc3e, 0x56b7d609,
+    0x53f8c08c, 0x523aaabb, 0x507c14e2, 0x51be7ed5,
+    0x5ae239e8, 0x5b2053df, 0x5966ed86, 0x58a487b1,
+    0x5deb9134, 0x5c29fb03, 0x5e6f455a, 0x5fad2f6d,
+    0xe1351b80, 0xe0f771b7, 0xe2b1cfee, 0xe373a5d9,
+    0xe63cb35c, 0xe7fed96b, 0xe5b86732, 0xe47a0d05,
+    0xef264a38, 0xeee4200f, 0xeca29e56, 0xed60f461,
+    0xe82fe2e4, 0xe9ed88d3, 0xebab368a, 0xea695cbd,
+    0xfd13b8f0, 0xfcd1d2c7, 0xfe976c9e, 0xff5506a9,
+    0xfa1a102c, 0xfbd87a1b, 0xf99ec442, 0xf85cae75,
+    0xf300e948, 0xf2c2837f, 0xf0843d26, 0xf1465711,
+    0xf4094194, 0xf5cb2ba3, 0xf78d95fa, 0xf64fffcd,
+    0xd9785d60, 0xd8ba3757, 0xdafc890e, 0xdb3ee339,
+    0xde71f5bc, 0xdfb39f8b, 0xddf521d2, 0xdc374be5,
+    0xd76b0cd8, 0xd6a966ef, 0xd4efd8b6, 0xd52db281,
+    0xd062a404, 0xd1a0ce33, 0xd3e6706a, 0xd2241a5d,
+    0xc55efe10, 0xc49c9427, 0xc6da2a7e, 0xc7184049,
+    0xc25756cc, 0xc3953cfb, 0xc1d382a2, 0xc011e895,
+    0xcb4dafa8, 0xca8fc59f, 0xc8c97bc6, 0xc90b11f1,
+    0xcc440774, 0xcd866d43, 0xcfc0d31a, 0xce02b92d,
+    0x91af9640, 0x906dfc77, 0x922b422e, 0x93e92819,
+    0x96a63e9c, 0x976454ab, 0x9522eaf2, 0x94e080c5,
+    0x9fbcc7f8, 0x9e7eadcf, 0x9c381396, 0x9dfa79a1,
+    0x98b56f24, 0x99770513, 0x9b31bb4a, 0x9af3d17d,
+    0x8d893530, 0x8c4b5f07, 0x8e0de15e, 0x8fcf8b69,
+    0x8a809dec, 0x8b42f7db, 0x89044982, 0x88c623b5,
+    0x839a6488, 0x82580ebf, 0x801eb0e6, 0x81dcdad1,
+    0x8493cc54, 0x8551a663, 0x8717183a, 0x86d5720d,
+    0xa9e2d0a0, 0xa820ba97, 0xaa6604ce, 0xaba46ef9,
+    0xaeeb787c, 0xaf29124b, 0xad6fac12, 0xacadc625,
+    0xa7f18118, 0xa633eb2f, 0xa4755576, 0xa5b73f41,
+    0xa0f829c4, 0xa13a43f3, 0xa37cfdaa, 0xa2be979d,
+    0xb5c473d0, 0xb40619e7, 0xb640a7be, 0xb782cd89,
+    0xb2cddb0c, 0xb30fb13b, 0xb1490f62, 0xb08b6555,
+    0xbbd72268, 0xba15485f, 0xb853f606, 0xb9919c31,
+    0xbcde8ab4, 0xbd1ce083, 0xbf5a5eda, 0xbe9834ed,
+  },
+  {
+    0, 0xb8bc6765, 0xaa09c88b, 0x12b5afee,
+    0x8f629757, 0x37def032, 0x256b5fdc, 0x9dd738b9,
+    0xc5b428ef, 0x7d084f8a, 0x6fbde064, 0xd7018701,
+    0x4ad6bfb8, 0xf26ad8dd, 0xe0df7733, 0x58631056,
+    0x5019579f, 0xe8a530fa, 0xfa109f14, 0x42acf871,
+    0xdf7bc0c8, 0x67c7a7ad, 0x75720843, 0xcdce6f26,
+    0x95ad7f70, 0x2d111815, 0x3fa4b7fb, 0x8718d09e,
+    0x1acfe827, 0xa2738f42, 0xb0c620ac, 0x87a47c9,
+    0xa032af3e, 0x188ec85b, 0xa3b67b5, 0xb28700d0,
+    0x2f503869, 0x97ec5f0c, 0x8559f0e2, 0x3de59787,
+    0x658687d1, 0xdd3ae0b4, 0xcf8f4f5a, 0x7733283f,
+    0xeae41086, 0x525877e3, 0x40edd80d, 0xf851bf68,
+    0xf02bf8a1, 0x48979fc4, 0x5a22302a, 0xe29e574f,
+    0x7f496ff6, 0xc7f50893, 0xd540a77d, 0x6dfcc018,
+    0x359fd04e, 0x8d23b72b, 0x9f9618c5, 0x272a7fa0,
+    0xbafd4719, 0x241207c, 0x10f48f92, 0xa848e8f7,
+    0x9b14583d, 0x23a83f58, 0x311d90b6, 0x89a1f7d3,
+    0x1476cf6a, 0xaccaa80f, 0xbe7f07e1, 0x6c36084,
+    0x5ea070d2, 0xe61c17b7, 0xf4a9b859, 0x4c15df3c,
+    0xd1c2e785, 0x697e80e0, 0x7bcb2f0e, 0xc377486b,
+    0xcb0d0fa2, 0x73b168c7, 0x6104c729, 0xd9b8a04c,
+    0x446f98f5, 0xfcd3ff90, 0xee66507e, 0x56da371b,
+    0xeb9274d, 0xb6054028, 0xa4b0efc6, 0x1c0c88a3,
+    0x81dbb01a, 0x3967d77f, 0x2bd27891, 0x936e1ff4,
+    0x3b26f703, 0x839a9066, 0x912f3f88, 0x299358ed,
+    0xb4446054, 0xcf80731, 0x1e4da8df, 0xa6f1cfba,
+    0xfe92dfec, 0x462eb889, 0x549b1767, 0xec277002,
+    0x71f048bb, 0xc94c2fde, 0xdbf98030, 0x6345e755,
+    0x6b3fa09c, 0xd383c7f9, 0xc1366817, 0x798a0f72,
+    0xe45d37cb, 0x5ce150ae, 0x4e54ff40, 0xf6e89825,
+    0xae8b8873, 0x1637ef16, 0x48240f8, 0xbc3e279d,
+    0x21e91f24, 0x99557841, 0x8be0d7af, 0x335cb0ca,
+    0xed59b63b, 0x55e5d15e, 0x47507eb0, 0xffec19d5,
+    0x623b216c, 0xda874609, 0xc832e9e7, 0x708e8e82,
+    0x28ed9ed4, 0x9051f9b1, 0x82e4565f, 0x3a58313a,
+    0xa78f0983, 0x1f336ee6, 0xd86c108, 0xb53aa66d,
+    0xbd40e1a4, 0x5fc86c1, 0x1749292f, 0xaff54e4a,
+    0x322276f3, 0x8a9e1196, 0x982bbe78, 0x2097d91d,
+    0x78f4c94b, 0xc048ae2e, 0xd2fd01c0, 0x6a4166a5,
+    0xf7965e1c, 0x4f2a3979, 0x5d9f9697, 0xe523f1f2,
+    0x4d6b1905, 0xf5d77e60, 0xe762d18e, 0x5fdeb6eb,
+    0xc2098e52, 0x7ab5e937, 0x680046d9, 0xd0bc21bc,
+    0x88df31ea, 0x3063568f, 0x22d6f961, 0x9a6a9e04,
+    0x7bda6bd, 0xbf01c1d8, 0xadb46e36, 0x15080953,
+    0x1d724e9a, 0xa5ce29ff, 0xb77b8611, 0xfc7e174,
+    0x9210d9cd, 0x2aacbea8, 0x38191146, 0x80a57623,
+    0xd8c66675, 0x607a0110, 0x72cfaefe, 0xca73c99b,
+    0x57a4f122, 0xef189647, 0xfdad39a9, 0x45115ecc,
+    0x764dee06, 0xcef18963, 0xdc44268d, 0x64f841e8,
+    0xf92f7951, 0x41931e34, 0x5326b1da, 0xeb9ad6bf,
+    0xb3f9c6e9, 0xb45a18c, 0x19f00e62, 0xa14c6907,
+    0x3c9b51be, 0x842736db, 0x96929935, 0x2e2efe50,
+    0x2654b999, 0x9ee8defc, 0x8c5d7112, 0x34e11677,
+    0xa9362ece, 0x118a49ab, 0x33fe645, 0xbb838120,
+    0xe3e09176, 0x5b5cf613, 0x49e959fd, 0xf1553e98,
+    0x6c820621, 0xd43e6144, 0xc68bceaa, 0x7e37a9cf,
+    0xd67f4138, 0x6ec3265d, 0x7c7689b3, 0xc4caeed6,
+    0x591dd66f, 0xe1a1b10a, 0xf3141ee4, 0x4ba87981,
+    0x13cb69d7, 0xab770eb2, 0xb9c2a15c, 0x17ec639,
+    0x9ca9fe80, 0x241599e5, 0x36a0360b, 0x8e1c516e,
+    0x866616a7, 0x3eda71c2, 0x2c6fde2c, 0x94d3b949,
+    0x90481f0, 0xb1b8e695, 0xa30d497b, 0x1bb12e1e,
+    0x43d23e48, 0xfb6e592d, 0xe9dbf6c3, 0x516791a6,
+    0xccb0a91f, 0x740cce7a, 0x66b96194, 0xde0506f1,
+  },
+  {
+    0, 0x3d6029b0, 0x7ac05360, 0x47a07ad0,
+    0xf580a6c0, 0xc8e08f70, 0x8f40f5a0, 0xb220dc10,
+    0x30704bc1, 0xd106271, 0x4ab018a1, 0x77d03111,
+    0xc5f0ed01, 0xf890c4b1, 0xbf30be61, 0x825097d1,
+    0x60e09782, 0x5d80be32, 0x1a20c4e2, 0x2740ed52,
+    0x95603142, 0xa80018f2, 0xefa06222, 0xd2c04b92,
+    0x5090dc43, 0x6df0f5f3, 0x2a508f23, 0x1730a693,
+    0xa5107a83, 0x98705333, 0xdfd029e3, 0xe2b00053,
+    0xc1c12f04, 0xfca106b4, 0xbb017c64, 0x866155d4,
+    0x344189c4, 0x921a074, 0x4e81daa4, 0x73e1f314,
+    0xf1b164c5, 0xccd14d75, 0x8b7137a5, 0xb6111e15,
+    0x431c205, 0x3951ebb5, 0x7ef19165, 0x4391b8d5,
+    0xa121b886, 0x9c419136, 0xdbe1ebe6, 0xe681c256,
+    0x54a11e46, 0x69c137f6, 0x2e614d26, 0x13016496,
+    0x9151f347, 0xac31daf7, 0xeb91a027, 0xd6f18997,
+    0x64d15587, 0x59b17c37, 0x1e1106e7, 0x23712f57,
+    0x58f35849, 0x659371f9, 0x22330b29, 0x1f532299,
+    0xad73fe89, 0x9013d739, 0xd7b3ade9, 0xead38459,
+    0x68831388, 0x55e33a38, 0x124340e8, 0x2f236958,
+    0x9d03b548, 0xa0639cf8, 0xe7c3e628, 0xdaa3cf98,
+    0x3813cfcb, 0x573e67b, 0x42d39cab, 0x7fb3b51b,
+    0xcd93690b, 0xf0f340bb, 0xb7533a6b, 0x8a3313db,
+    0x863840a, 0x3503adba, 0x72a3d76a, 0x4fc3feda,
+    0xfde322ca, 0xc0830b7a, 0x872371aa, 0xba43581a,
+    0x9932774d, 0xa4525efd, 0xe3f2242d, 0xde920d9d,
+    0x6cb2d18d, 0x51d2f83d, 0x167282ed, 0x2b12ab5d,
+    0xa9423c8c, 0x9422153c, 0xd3826fec, 0xeee2465c,
+    0x5cc29a4c, 0x61a2b3fc, 0x2602c92c, 0x1b62e09c,
+    0xf9d2e0cf, 0xc4b2c97f, 0x8312b3af, 0xbe729a1f,
+    0xc52460f, 0x31326fbf, 0x7692156f, 0x4bf23cdf,
+    0xc9a2ab0e, 0xf4c282be, 0xb362f86e, 0x8e02d1de,
+    0x3c220dce, 0x142247e, 0x46e25eae, 0x7b82771e,
+    0xb1e6b092, 0x8c869922, 0xcb26e3f2, 0xf646ca42,
+    0x44661652, 0x79063fe2, 0x3ea64532, 0x3c66c82,
+    0x8196fb53, 0xbcf6d2e3, 0xfb56a833, 0xc6368183,
+    0x74165d93, 0x49767423, 0xed60ef3, 0x33b62743,
+    0xd1062710, 0xec660ea0, 0xabc67470, 0x96a65dc0,
+    0x248681d0, 0x19e6a860, 0x5e46d2b0, 0x6326fb00,
+    0xe1766cd1, 0xdc164561, 0x9bb63fb1, 0xa6d61601,
+    0x14f6ca11, 0x2996e3a1, 0x6e369971, 0x5356b0c1,
+    0x70279f96, 0x4d47b626, 0xae7ccf6, 0x3787e546,
+    0x85a73956, 0xb8c710e6, 0xff676a36, 0xc2074386,
+    0x4057d457, 0x7d37fde7, 0x3a978737, 0x7f7ae87,
+    0xb5d77297, 0x88b75b27, 0xcf1721f7, 0xf2770847,
+    0x10c70814, 0x2da721a4, 0x6a075b74, 0x576772c4,
+    0xe547aed4, 0xd8278764, 0x9f87fdb4, 0xa2e7d404,
+    0x20b743d5, 0x1dd76a65, 0x5a7710b5, 0x67173905,
+    0xd537e515, 0xe857cca5, 0xaff7b675, 0x92979fc5,
+    0xe915e8db, 0xd475c16b, 0x93d5bbbb, 0xaeb5920b,
+    0x1c954e1b, 0x21f567ab, 0x66551d7b, 0x5b3534cb,
+    0xd965a31a, 0xe4058aaa, 0xa3a5f07a, 0x9ec5d9ca,
+    0x2ce505da, 0x11852c6a, 0x562556ba, 0x6b457f0a,
+    0x89f57f59, 0xb49556e9, 0xf3352c39, 0xce550589,
+    0x7c75d999, 0x4115f029, 0x6b58af9, 0x3bd5a349,
+    0xb9853498, 0x84e51d28, 0xc34567f8, 0xfe254e48,
+    0x4c059258, 0x7165bbe8, 0x36c5c138, 0xba5e888,
+    0x28d4c7df, 0x15b4ee6f, 0x521494bf, 0x6f74bd0f,
+    0xdd54611f, 0xe03448af, 0xa794327f, 0x9af41bcf,
+    0x18a48c1e, 0x25c4a5ae, 0x6264df7e, 0x5f04f6ce,
+    0xed242ade, 0xd044036e, 0x97e479be, 0xaa84500e,
+    0x4834505d, 0x755479ed, 0x32f4033d, 0xf942a8d,
+    0xbdb4f69d, 0x80d4df2d, 0xc774a5fd, 0xfa148c4d,
+    0x78441b9c, 0x4524322c, 0x28448fc, 0x3fe4614c,
+    0x8dc4bd5c, 0xb0a494ec, 0xf704ee3c, 0xca64c78c,
+  },
+  {
+    0, 0xcb5cd3a5, 0x4dc8a10b, 0x869472ae,
+    0x9b914216, 0x50cd91b3, 0xd659e31d, 0x1d0530b8,
+    0xec53826d, 0x270f51c8, 0xa19b2366, 0x6ac7f0c3,
+    0x77c2c07b, 0xbc9e13de, 0x3a0a6170, 0xf156b2d5,
+    0x3d6029b, 0xc88ad13e, 0x4e1ea390, 0x85427035,
+    0x9847408d, 0x531b9328, 0xd58fe186, 0x1ed33223,
+    0xef8580f6, 0x24d95353, 0xa24d21fd, 0x6911f258,
+    0x7414c2e0, 0xbf481145, 0x39dc63eb, 0xf280b04e,
+    0x7ac0536, 0xccf0d693, 0x4a64a43d, 0x81387798,
+    0x9c3d4720, 0x57619485, 0xd1f5e62b, 0x1aa9358e,
+    0xebff875b, 0x20a354fe, 0xa6372650, 0x6d6bf5f5,
+    0x706ec54d, 0xbb3216e8, 0x3da66446, 0xf6fab7e3,
+    0x47a07ad, 0xcf26d408, 0x49b2a6a6, 0x82ee7503,
+    0x9feb45bb, 0x54b7961e, 0xd223e4b0, 0x197f3715,
+    0xe82985c0, 0x23755665, 0xa5e124cb, 0x6ebdf76e,
+    0x73b8c7d6, 0xb8e41473, 0x3e7066dd, 0xf52cb578,
+    0xf580a6c, 0xc404d9c9, 0x4290ab67, 0x89cc78c2,
+    0x94c9487a, 0x5f959bdf, 0xd901e971, 0x125d3ad4,
+    0xe30b8801, 0x28575ba4, 0xaec3290a, 0x659ffaaf,
+    0x789aca17, 0xb3c619b2, 0x35526b1c, 0xfe0eb8b9,
+    0xc8e08f7, 0xc7d2db52, 0x4146a9fc, 0x8a1a7a59,
+    0x971f4ae1, 0x5c439944, 0xdad7ebea, 0x118b384f,
+    0xe0dd8a9a, 0x2b81593f, 0xad152b91, 0x6649f834,
+    0x7b4cc88c, 0xb0101b29, 0x36846987, 0xfdd8ba22,
+    0x8f40f5a, 0xc3a8dcff, 0x453cae51, 0x8e607df4,
+    0x93654d4c, 0x58399ee9, 0xdeadec47, 0x15f13fe2,
+    0xe4a78d37, 0x2ffb5e92, 0xa96f2c3c, 0x6233ff99,
+    0x7f36cf21, 0xb46a1c84, 0x32fe6e2a, 0xf9a2bd8f,
+    0xb220dc1, 0xc07ede64, 0x46eaacca, 0x8db67f6f,
+    0x90b34fd7, 0x5bef9c72, 0xdd7beedc, 0x16273d79,
+    0xe7718fac, 0x2c2d5c09, 0xaab92ea7, 0x61e5fd02,
+    0x7ce0cdba, 0xb7bc1e1f, 0x31286cb1, 0xfa74bf14,
+    0x1eb014d8, 0xd5ecc77d, 0x5378b5d3, 0x98246676,
+    0x852156ce, 0x4e7d856b, 0xc8e9f7c5, 0x3b52460,
+    0xf2e396b5, 0x39bf4510, 0xbf2b37be, 0x7477e41b,
+    0x6972d4a3, 0xa22e0706, 0x24ba75a8, 0xefe6a60d,
+    0x1d661643, 0xd63ac5e6, 0x50aeb748, 0x9bf264ed,
+    0x86f75455, 0x4dab87f0, 0xcb3ff55e, 0x6326fb,
+    0xf135942e, 0x3a69478b, 0xbcfd3525, 0x77a1e680,
+    0x6aa4d638, 0xa1f8059d, 0x276c7733, 0xec30a496,
+    0x191c11ee, 0xd240c24b, 0x54d4b0e5, 0x9f886340,
+    0x828d53f8, 0x49d1805d, 0xcf45f2f3, 0x4192156,
+    0xf54f9383, 0x3e134026, 0xb8873288, 0x73dbe12d,
+    0x6eded195, 0xa5820230, 0x2316709e, 0xe84aa33b,
+    0x1aca1375, 0xd196c0d0, 0x5702b27e, 0x9c5e61db,
+    0x815b5163, 0x4a0782c6, 0xcc93f068, 0x7cf23cd,
+    0xf6999118, 0x3dc542bd, 0xbb513013, 0x700de3b6,
+    0x6d08d30e, 0xa65400ab, 0x20c07205, 0xeb9ca1a0,
+    0x11e81eb4, 0xdab4cd11, 0x5c20bfbf, 0x977c6c1a,
+    0x8a795ca2, 0x41258f07, 0xc7b1fda9, 0xced2e0c,
+    0xfdbb9cd9, 0x36e74f7c, 0xb0733dd2, 0x7b2fee77,
+    0x662adecf, 0xad760d6a, 0x2be27fc4, 0xe0beac61,
+    0x123e1c2f, 0xd962cf8a, 0x5ff6bd24, 0x94aa6e81,
+    0x89af5e39, 0x42f38d9c, 0xc467ff32, 0xf3b2c97,
+    0xfe6d9e42, 0x35314de7, 0xb3a53f49, 0x78f9ecec,
+    0x65fcdc54, 0xaea00ff1, 0x28347d5f, 0xe368aefa,
+    0x16441b82, 0xdd18c827, 0x5b8cba89, 0x90d0692c,
+    0x8dd55994, 0x46898a31, 0xc01df89f, 0xb412b3a,
+    0xfa1799ef, 0x314b4a4a, 0xb7df38e4, 0x7c83eb41,
+    0x6186dbf9, 0xaada085c, 0x2c4e7af2, 0xe712a957,
+    0x15921919, 0xdececabc, 0x585ab812, 0x93066bb7,
+    0x8e035b0f, 0x455f88aa, 0xc3cbfa04, 0x89729a1,
+    0xf9c19b74, 0x329d48d1, 0xb4093a7f, 0x7f55e9da,
+    0x6250d962, 0xa90c0ac7, 0x2f987869, 0xe4c4abcc,
+  },
+  {
+    0, 0xa6770bb4, 0x979f1129, 0x31e81a9d,
+    0xf44f2413, 0x52382fa7, 0x63d0353a, 0xc5a73e8e,
+    0x33ef4e67, 0x959845d3, 0xa4705f4e, 0x20754fa,
+    0xc7a06a74, 0x61d761c0, 0x503f7b5d, 0xf64870e9,
+    0x67de9cce, 0xc1a9977a, 0xf0418de7, 0x56368653,
+    0x9391b8dd, 0x35e6b369, 0x40ea9f4, 0xa279a240,
+    0x5431d2a9, 0xf246d91d, 0xc3aec380, 0x65d9c834,
+    0xa07ef6ba, 0x609fd0e, 0x37e1e793, 0x9196ec27,
+    0xcfbd399c, 0x69ca3228, 0x582228b5, 0xfe552301,
+    0x3bf21d8f, 0x9d85163b, 0xac6d0ca6, 0xa1a0712,
+    0xfc5277fb, 0x5a257c4f, 0x6bcd66d2, 0xcdba6d66,
+    0x81d53e8, 0xae6a585c, 0x9f8242c1, 0x39f54975,
+    0xa863a552, 0xe14aee6, 0x3ffcb47b, 0x998bbfcf,
+    0x5c2c8141, 0xfa5b8af5, 0xcbb39068, 0x6dc49bdc,
+    0x9b8ceb35, 0x3dfbe081, 0xc13fa1c, 0xaa64f1a8,
+    0x6fc3cf26, 0xc9b4c492, 0xf85cde0f, 0x5e2bd5bb,
+    0x440b7579, 0xe27c7ecd, 0xd3946450, 0x75e36fe4,
+    0xb044516a, 0x16335ade, 0x27db4043, 0x81ac4bf7,
+    0x77e43b1e, 0xd19330aa, 0xe07b2a37, 0x460c2183,
+    0x83ab1f0d, 0x25dc14b9, 0x14340e24, 0xb2430590,
+    0x23d5e9b7, 0x85a2e203, 0xb44af89e, 0x123df32a,
+    0xd79acda4, 0x71edc610, 0x4005dc8d, 0xe672d739,
+    0x103aa7d0, 0xb64dac64, 0x87a5b6f9, 0x21d2bd4d,
+    0xe47583c3, 0x42028877, 0x73ea92ea, 0xd59d995e,
+    0x8bb64ce5, 0x2dc14751, 0x1c295dcc, 0xba5e5678,
+    0x7ff968f6, 0xd98e6342, 0xe86679df, 0x4e11726b,
+    0xb8590282, 0x1e2e0936, 0x2fc613ab, 0x89b1181f,
+    0x4c162691, 0xea612d25, 0xdb8937b8, 0x7dfe3c0c,
+    0xec68d02b, 0x4a1fdb9f, 0x7bf7c102, 0xdd80cab6,
+    0x1827f438, 0xbe50ff8c, 0x8fb8e511, 0x29cfeea5,
+    0xdf879e4c, 0x79f095f8, 0x48188f65, 0xee6f84d1,
+    0x2bc8ba5f, 0x8dbfb1eb, 0xbc57ab76, 0x1a20a0c2,
+    0x8816eaf2, 0x2e61e146, 0x1f89fbdb, 0xb9fef06f,
+    0x7c59cee1, 0xda2ec555, 0xebc6dfc8, 0x4db1d47c,
+    0xbbf9a495, 0x1d8eaf21, 0x2c66b5bc, 0x8a11be08,
+    0x4fb68086, 0xe9c18b32, 0xd82991af, 0x7e5e9a1b,
+    0xefc8763c, 0x49bf7d88, 0x78576715, 0xde206ca1,
+    0x1b87522f, 0xbdf0599b, 0x8c184306, 0x2a6f48b2,
+    0xdc27385b, 0x7a5033ef, 0x4bb82972, 0xedcf22c6,
+    0x28681c48, 0x8e1f17fc, 0xbff70d61, 0x198006d5,
+    0x47abd36e, 0xe1dcd8da, 0xd034c247, 0x7643c9f3,
+    0xb3e4f77d, 0x1593fcc9, 0x247be654, 0x820cede0,
+    0x74449d09, 0xd23396bd, 0xe3db8c20, 0x45ac8794,
+    0x800bb91a, 0x267cb2ae, 0x1794a833, 0xb1e3a387,
+    0x20754fa0, 0x86024414, 0xb7ea5e89, 0x119d553d,
+    0xd43a6bb3, 0x724d6007, 0x43a57a9a, 0xe5d2712e,
+    0x139a01c7, 0xb5ed0a73, 0x840510ee, 0x22721b5a,
+    0xe7d525d4, 0x41a22e60, 0x704a34fd, 0xd63d3f49,
+    0xcc1d9f8b, 0x6a6a943f, 0x5b828ea2, 0xfdf58516,
+    0x3852bb98, 0x9e25b02c, 0xafcdaab1, 0x9baa105,
+    0xfff2d1ec, 0x5985da58, 0x686dc0c5, 0xce1acb71,
+    0xbbdf5ff, 0xadcafe4b, 0x9c22e4d6, 0x3a55ef62,
+    0xabc30345, 0xdb408f1, 0x3c5c126c, 0x9a2b19d8,
+    0x5f8c2756, 0xf9fb2ce2, 0xc813367f, 0x6e643dcb,
+    0x982c4d22, 0x3e5b4696, 0xfb35c0b, 0xa9c457bf,
+    0x6c636931, 0xca146285, 0xfbfc7818, 0x5d8b73ac,
+    0x3a0a617, 0xa5d7ada3, 0x943fb73e, 0x3248bc8a,
+    0xf7ef8204, 0x519889b0, 0x6070932d, 0xc6079899,
+    0x304fe870, 0x9638e3c4, 0xa7d0f959, 0x1a7f2ed,
+    0xc400cc63, 0x6277c7d7, 0x539fdd4a, 0xf5e8d6fe,
+    0x647e3ad9, 0xc209316d, 0xf3e12bf0, 0x55962044,
+    0x90311eca, 0x3646157e, 0x7ae0fe3, 0xa1d90457,
+    0x579174be, 0xf1e67f0a, 0xc00e6597, 0x66796e23,
+    0xa3de50ad, 0x5a95b19, 0x34414184, 0x92364a30,
+  },
+  {
+    0, 0xccaa009e, 0x4225077d, 0x8e8f07e3,
+    0x844a0efa, 0x48e00e64, 0xc66f0987, 0xac50919,
+    0xd3e51bb5, 0x1f4f1b2b, 0x91c01cc8, 0x5d6a1c56,
+    0x57af154f, 0x9b0515d1, 0x158a1232, 0xd92012ac,
+    0x7cbb312b, 0xb01131b5, 0x3e9e3656, 0xf23436c8,
+    0xf8f13fd1, 0x345b3f4f, 0xbad438ac, 0x767e3832,
+    0xaf5e2a9e, 0x63f42a00, 0xed7b2de3, 0x21d12d7d,
+    0x2b142464, 0xe7be24fa, 0x69312319, 0xa59b2387,
+    0xf9766256, 0x35dc62c8, 0xbb53652b, 0x77f965b5,
+    0x7d3c6cac, 0xb1966c32, 0x3f196bd1, 0xf3b36b4f,
+    0x2a9379e3, 0xe639797d, 0x68b67e9e, 0xa41c7e00,
+    0xaed97719, 0x62737787, 0xecfc7064, 0x205670fa,
+    0x85cd537d, 0x496753e3, 0xc7e85400, 0xb42549e,
+    0x1875d87, 0xcd2d5d19, 0x43a25afa, 0x8f085a64,
+    0x562848c8, 0x9a824856, 0x140d4fb5, 0xd8a74f2b,
+    0xd2624632, 0x1ec846ac, 0x9047414f, 0x5ced41d1,
+    0x299dc2ed, 0xe537c273, 0x6bb8c590, 0xa712c50e,
+    0xadd7cc17, 0x617dcc89, 0xeff2cb6a, 0x2358cbf4,
+    0xfa78d958, 0x36d2d9c6, 0xb85dde25, 0x74f7debb,
+    0x7e32d7a2, 0xb298d73c, 0x3c17d0df, 0xf0bdd041,
+    0x5526f3c6, 0x998cf358, 0x1703f4bb, 0xdba9f425,
+    0xd16cfd3c, 0x1dc6fda2, 0x9349fa41, 0x5fe3fadf,
+    0x86c3e873, 0x4a69e8ed, 0xc4e6ef0e, 0x84cef90,
+    0x289e689, 0xce23e617, 0x40ace1f4, 0x8c06e16a,
+    0xd0eba0bb, 0x1c41a025, 0x92cea7c6, 0x5e64a758,
+    0x54a1ae41, 0x980baedf, 0x1684a93c, 0xda2ea9a2,
+    0x30ebb0e, 0xcfa4bb90, 0x412bbc73, 0x8d81bced,
+    0x8744b5f4, 0x4beeb56a, 0xc561b289, 0x9cbb217,
+    0xac509190, 0x60fa910e, 0xee7596ed, 0x22df9673,
+    0x281a9f6a, 0xe4b09ff4, 0x6a3f9817, 0xa6959889,
+    0x7fb58a25, 0xb31f8abb, 0x3d908d58, 0xf13a8dc6,
+    0xfbff84df, 0x37558441, 0xb9da83a2, 0x7570833c,
+    0x533b85da, 0x9f918544, 0x111e82a7, 0xddb48239,
+    0xd7718b20, 0x1bdb8bbe, 0x95548c5d, 0x59fe8cc3,
+    0x80de9e6f, 0x4c749ef1, 0xc2fb9912, 0xe51998c,
+    0x4949095, 0xc83e900b, 0x46b197e8, 0x8a1b9776,
+    0x2f80b4f1, 0xe32ab46f, 0x6da5b38c, 0xa10fb312,
+    0xabcaba0b, 0x6760ba95, 0xe9efbd76, 0x2545bde8,
+    0xfc65af44, 0x30cfafda, 0xbe40a839, 0x72eaa8a7,
+    0x782fa1be, 0xb485a120, 0x3a0aa6c3, 0xf6a0a65d,
+    0xaa4de78c, 0x66e7e712, 0xe868e0f1, 0x24c2e06f,
+    0x2e07e976, 0xe2ade9e8, 0x6c22ee0b, 0xa088ee95,
+    0x79a8fc39, 0xb502fca7, 0x3b8dfb44, 0xf727fbda,
+    0xfde2f2c3, 0x3148f25d, 0xbfc7f5be, 0x736df520,
+    0xd6f6d6a7, 0x1a5cd639, 0x94d3d1da, 0x5879d144,
+    0x52bcd85d, 0x9e16d8c3, 0x1099df20, 0xdc33dfbe,
+    0x513cd12, 0xc9b9cd8c, 0x4736ca6f, 0x8b9ccaf1,
+    0x8159c3e8, 0x4df3c376, 0xc37cc495, 0xfd6c40b,
+    0x7aa64737, 0xb60c47a9, 0x3883404a, 0xf42940d4,
+    0xfeec49cd, 0x32464953, 0xbcc94eb0, 0x70634e2e,
+    0xa9435c82, 0x65e95c1c, 0xeb665bff, 0x27cc5b61,
+    0x2d095278, 0xe1a352e6, 0x6f2c5505, 0xa386559b,
+    0x61d761c, 0xcab77682, 0x44387161, 0x889271ff,
+    0x825778e6, 0x4efd7878, 0xc0727f9b, 0xcd87f05,
+    0xd5f86da9, 0x19526d37, 0x97dd6ad4, 0x5b776a4a,
+    0x51b26353, 0x9d1863cd, 0x1397642e, 0xdf3d64b0,
+    0x83d02561, 0x4f7a25ff, 0xc1f5221c, 0xd5f2282,
+    0x79a2b9b, 0xcb302b05, 0x45bf2ce6, 0x89152c78,
+    0x50353ed4, 0x9c9f3e4a, 0x121039a9, 0xdeba3937,
+    0xd47f302e, 0x18d530b0, 0x965a3753, 0x5af037cd,
+    0xff6b144a, 0x33c114d4, 0xbd4e1337, 0x71e413a9,
+    0x7b211ab0, 0xb78b1a2e, 0x39041dcd, 0xf5ae1d53,
+    0x2c8e0fff, 0xe0240f61, 0x6eab0882, 0xa201081c,
+    0xa8c40105, 0x646e019b, 0xeae10678, 0x264b06e6,
+  },
+};
+static const CrcFold crc_cat_f11 = {
+    32, 1, 0xedb88320,
+    { 0xe95c1271, 0xce3371cb }, { 0x1d9513d7, 0x8f352d95 }, { 0xccaa009e, 0xae689191 },
+    0xccaa009e, 0x5a72d812fb808b20
+};
+
+/* CRC-32/BZIP2 */
+static const uint64_t crc_cat_t12[8][256] = {
+  {
+    0, 0x4c11db700000000, 0x9823b6e00000000, 0xd4326d900000000,
+    0x130476dc00000000, 0x17c56b6b00000000, 0x1a864db200000000, 0x1e47500500000000,
+    0x2608edb800000000, 0x22c9f00f00000000, 0x2f8ad6d600000000, 0x2b4bcb6100000000,
+    0x350c9b6400000000, 0x31cd86d300000000, 0x3c8ea00a00000000, 0x384fbdbd00000000,
+    0x4c11db7000000000, 0x48d0c6c700000000, 0x4593e01e00000000, 0x4152fda900000000,
+    0x5f15adac00000000, 0x5bd4b01b00000000, 0x569796c200000000, 0x52568b7500000000,
+    0x6a1936c800000000, 0x6ed82b7f00000000, 0x639b0da600000000, 0x675a101100000000,
+    0x791d401400000000, 0x7ddc5da300000000, 0x709f7b7a00000000, 0x745e66cd00000000,
+    0x9823b6e000000000, 0x9ce2ab5700000000, 0x91a18d8e00000000, 0x9560903900000000,
+    0x8b27c03c00000000, 0x8fe6dd8b00000000, 0x82a5fb5200000000, 0x8664e6e500000000,
+    0xbe2b5b5800000000, 0xbaea46ef00000000, 0xb7a9603600000000, 0xb3687d8100000000,
+    0xad2f2d8400000000, 0xa9ee303300000000, 0xa4ad16ea00000000, 0xa06c0b5d00000000,
+    0xd4326d9000000000, 0xd0f3702700000000, 0xddb056fe00000000, 0xd9714b4900000000,
+    0xc7361b4c00000000, 0xc3f706fb00000000, 0xceb4202200000000, 0xca753d9500000000,
+    0xf23a802800000000, 0xf6fb9d9f00000000, 0xfbb8bb4600000000, 0xff79a6f100000000,
+    0xe13ef6f400000000, 0xe5ffeb4300000000, 0xe8bccd9a00000000, 0xec7dd02d00000000,
+    0x3486707700000000, 0x30476dc000000000, 0x3d044b1900000000, 0x39c556ae00000000,
+    0x278206ab00000000, 0x23431b1c00000000, 0x2e003dc500000000, 0x2ac1207200000000,
+    0x128e9dcf00000000, 0x164f807800000000, 0x1b0ca6a100000000, 0x1fcdbb1600000000,
+    0x18aeb1300000000, 0x54bf6a400000000, 0x808d07d00000000, 0xcc9cdca00000000,
+    0x7897ab0700000000, 0x7c56b6b000000000, 0x7115906900000000, 0x75d48dde00000000,
+    0x6b93dddb00000000, 0x6f52c06c00000000, 0x6211e6b500000000, 0x66d0fb0200000000,
+    0x5e9f46bf00000000, 0x5a5e5b0800000000, 0x571d7dd100000000, 0x53dc606600000000,
+    0x4d9b306300000000, 0x495a2dd400000000, 0x44190b0d00000000, 0x40d816ba00000000,
+    0xaca5c69700000000, 0xa864db2000000000, 0xa527fdf900000000, 0xa1e6e04e00000000,
+    0xbfa1b04b00000000, 0xbb60adfc00000000, 0xb6238b2500000000, 0xb2e2969200000000,
+    0x8aad2b2f00000000, 0x8e6c369800000000, 0x832f104100000000, 0x87ee0df600000000,
+    0x99a95df300000000, 0x9d68404400000000, 0x902b669d00000000, 0x94ea7b2a00000000,
+    0xe0b41de700000000, 0xe475005000000000, 0xe936268900000000, 0xedf73b3e00000000,
+    0xf3b06b3b00000000, 0xf771768c00000000, 0xfa32505500000000, 0xfef34de200000000,
+    0xc6bcf05f00000000, 0xc27dede800000000, 0xcf3ecb3100000000, 0xcbffd68600000000,
+    0xd5b8868300000000, 0xd1799b3400000000, 0xdc3abded00000000, 0xd8fba05a00000000,
+    0x690ce0ee00000000, 0x6dcdfd5900000000, 0x608edb8000000000, 0x644fc63700000000,
+    0x7a08963200000000, 0x7ec98b8500000000, 0x738aad5c00000000, 0x774bb0eb00000000,
+    0x4f040d5600000000, 0x4bc510e100000000, 0x4686363800000000, 0x42472b8f00000000,
+    0x5c007b8a00000000, 0x58c1663d00000000, 0x558240e400000000, 0x51435d5300000000,
+    0x251d3b9e00000000, 0x21dc262900000000, 0x2c9f00f000000000, 0x285e1d4700000000,
+    0x36194d4200000000, 0x32d850f500000000, 0x3f9b762c00000000, 0x3b5a6b9b00000000,
+    0x315d62600000000, 0x7d4cb9100000000, 0xa97ed4800000000, 0xe56f0ff00000000,
+    0x1011a0fa00000000, 0x14d0bd4d00000000, 0x19939b9400000000, 0x1d52862300000000,
+    0xf12f560e00000000, 0xf5ee4bb900000000, 0xf8ad6d6000000000, 0xfc6c70d700000000,
+    0xe22b20d200000000, 0xe6ea3d6500000000, 0xeba91bbc00000000, 0xef68060b00000000,
+    0xd727bbb600000000, 0xd3e6a60100000000, 0xdea580d800000000, 0xda649d6f00000000,
+    0xc423cd6a00000000, 0xc0e2d0dd00000000, 0xcda1f60400000000, 0xc960ebb300000000,
+    0xbd3e8d7e00000000, 0xb9ff90c900000000, 0xb4bcb61000000000, 0xb07daba700000000,
+    0xae3afba200000000, 0xaafbe61500000000, 0xa7b8c0cc00000000, 0xa379dd7b00000000,
+    0x9b3660c600000000, 0x9ff77d7100000000, 0x92b45ba800000000, 0x9675461f00000000,
+    0x8832161a00000000, 0x8cf30bad00000000, 0x81b02d7400000000, 0x857130c300000000,
+    0x5d8a909900000000, 0x594b8d2e00000000, 0x5408abf700000000, 0x50c9b64000000000,
+    0x4e8ee64500000000, 0x4a4ffbf200000000, 0x470cdd2b00000000, 0x43cdc09c00000000,
+    0x7b827d2100000000, 0x7f43609600000000, 0x7200464f00000000, 0x76c15bf800000000,
+    0x68860bfd00000000, 0x6c47164a00000000, 0x6104309300000000, 0x65c52d2400000000,
+    0x119b4be900000000, 0x155a565e00000000, 0x1819708700000000, 0x1cd86d3000000000,
+    0x29f3d3500000000, 0x65e208200000000, 0xb1d065b00000000, 0xfdc1bec00000000,
+    0x3793a65100000000, 0x3352bbe600000000, 0x3e119d3f00000000, 0x3ad0808800000000,
+    0x2497d08d00000000, 0x2056cd3a00000000, 0x2d15ebe300000000, 0x29d4f65400000000,
+    0xc5a9267900000000, 0xc1683bce00000000, 0xcc2b1d1700000000, 0xc8ea00a000000000,
+    0xd6ad50a500000000, 0xd26c4d1200000000, 0xdf2f6bcb00000000, 0xdbee767c00000000,
+    0xe3a1cbc100000000, 0xe760d67600000000, 0xea23f0af00000000, 0xeee2ed1800000000,
+    0xf0a5bd1d00000000, 0xf464a0aa00000000, 0xf927867300000000, 0xfde69bc400000000,
+    0x89b8fd0900000000, 0x8d79e0be00000000, 0x803ac66700000000, 0x84fbdbd000000000,
+    0x9abc8bd500000000, 0x9e7d966200000000, 0x933eb0bb00000000, 0x97ffad0c00000000,
+    0xafb010b100000000, 0xab710d0600000000, 0xa6322bdf00000000, 0xa2f3366800000000,
+    0xbcb4666d00000000, 0xb8757bda00000000, 0xb5365d0300000000, 0xb1f740b400000000,
+  },
+  {
+    0, 0xd219c1dc00000000, 0xa0f29e0f00000000, 0x72eb5fd300000000,
+    0x452421a900000000, 0x973de07500000000, 0xe5d6bfa600000000, 0x37cf7e7a00000000,
+    0x8a48435200000000, 0x5851828e00000000, 0x2abadd5d00000000, 0xf8a31c8100000000,
+    0xcf6c62fb00000000, 0x1d75a32700000000, 0x6f9efcf400000000, 0xbd873d2800000000,
+    0x10519b1300000000, 0xc2485acf00000000, 0xb0a3051c00000000, 0x62bac4c000000000,
+    0x5575baba00000000, 0x876c7b6600000000, 0xf58724b500000000, 0x279ee56900000000,
+    0x9a19d84100000000, 0x4800199d00000000, 0x3aeb464e00000000, 0xe8f2879200000000,
+    0xdf3df9e800000000, 0xd24383400000000, 0x7fcf67e700000000, 0xadd6a63b00000000,
+    0x20a3362600000000, 0xf2baf7fa00000000, 0x8051a82900000000, 0x524869f500000000,
+    0x6587178f00000000, 0xb79ed65300000000, 0xc575898000000000, 0x176c485c00000000,
+    0xaaeb757400000000, 0x78f2b4a800000000, 0xa19eb7b00000000, 0xd8002aa700000000,
+    0xefcf54dd00000000, 0x3dd6950100000000, 0x4f3dcad200000000, 0x9d240b0e00000000,
+    0x30f2ad3500000000, 0xe2eb6ce900000000, 0x9000333a00000000, 0x4219f2e600000000,
+    0x75d68c9c00000000, 0xa7cf4d4000000000, 0xd524129300000000, 0x73dd34f00000000,
+    0xbabaee6700000000, 0x68a32fbb00000000, 0x1a48706800000000, 0xc851b1b400000000,
+    0xff9ecfce00000000, 0x2d870e1200000000, 0x5f6c51c100000000, 0x8d75901d00000000,
+    0x41466c4c00000000, 0x935fad9000000000, 0xe1b4f24300000000, 0x33ad339f00000000,
+    0x4624de500000000, 0xd67b8c3900000000, 0xa490d3ea00000000, 0x7689123600000000,
+    0xcb0e2f1e00000000, 0x1917eec200000000, 0x6bfcb11100000000, 0xb9e570cd00000000,
+    0x8e2a0eb700000000, 0x5c33cf6b00000000, 0x2ed890b800000000, 0xfcc1516400000000,
+    0x5117f75f00000000, 0x830e368300000000, 0xf1e5695000000000, 0x23fca88c00000000,
+    0x1433d6f600000000, 0xc62a172a00000000, 0xb4c148f900000000, 0x66d8892500000000,
+    0xdb5fb40d00000000, 0x94675d100000000, 0x7bad2a0200000000, 0xa9b4ebde00000000,
+    0x9e7b95a400000000, 0x4c62547800000000, 0x3e890bab00000000, 0xec90ca7700000000,
+    0x61e55a6a00000000, 0xb3fc9bb600000000, 0xc117c46500000000, 0x130e05b900000000,
+    0x24c17bc300000000, 0xf6d8ba1f00000000, 0x8433e5cc00000000, 0x562a241000000000,
+    0xebad193800000000, 0x39b4d8e400000000, 0x4b5f873700000000, 0x994646eb00000000,
+    0xae89389100000000, 0x7c90f94d00000000, 0xe7ba69e00000000, 0xdc62674200000000,
+    0x71b4c17900000000, 0xa3ad00a500000000, 0xd1465f7600000000, 0x35f9eaa00000000,
+    0x3490e0d000000000, 0xe689210c00000000, 0x94627edf00000000, 0x467bbf0300000000,
+    0xfbfc822b00000000, 0x29e543f700000000, 0x5b0e1c2400000000, 0x8917ddf800000000,
+    0xbed8a38200000000, 0x6cc1625e00000000, 0x1e2a3d8d00000000, 0xcc33fc5100000000,
+    0x828cd89800000000, 0x5095194400000000, 0x227e469700000000, 0xf067874b00000000,
+    0xc7a8f93100000000, 0x15b138ed00000000, 0x675a673e00000000, 0xb543a6e200000000,
+    0x8c49bca00000000, 0xdadd5a1600000000, 0xa83605c500000000, 0x7a2fc41900000000,
+    0x4de0ba6300000000, 0x9ff97bbf00000000, 0xed12246c00000000, 0x3f0be5b000000000,
+    0x92dd438b00000000, 0x40c4825700000000, 0x322fdd8400000000, 0xe0361c5800000000,
+    0xd7f9622200000000, 0x5e0a3fe00000000, 0x770bfc2d00000000, 0xa5123df100000000,
+    0x189500d900000000, 0xca8cc10500000000, 0xb8679ed600000000, 0x6a7e5f0a00000000,
+    0x5db1217000000000, 0x8fa8e0ac00000000, 0xfd43bf7f00000000, 0x2f5a7ea300000000,
+    0xa22feebe00000000, 0x70362f6200000000, 0x2dd70b100000000, 0xd0c4b16d00000000,
+    0xe70bcf1700000000, 0x35120ecb00000000, 0x47f9511800000000, 0x95e090c400000000,
+    0x2867adec00000000, 0xfa7e6c3000000000, 0x889533e300000000, 0x5a8cf23f00000000,
+    0x6d438c4500000000, 0xbf5a4d9900000000, 0xcdb1124a00000000, 0x1fa8d39600000000,
+    0xb27e75ad00000000, 0x6067b47100000000, 0x128ceba200000000, 0xc0952a7e00000000,
+    0xf75a540400000000, 0x254395d800000000, 0x57a8ca0b00000000, 0x85b10bd700000000,
+    0x383636ff00000000, 0xea2ff72300000000, 0x98c4a8f000000000, 0x4add692c00000000,
+    0x7d12175600000000, 0xaf0bd68a00000000, 0xdde0895900000000, 0xff9488500000000,
+    0xc3cab4d400000000, 0x11d3750800000000, 0x63382adb00000000, 0xb121eb0700000000,
+    0x86ee957d00000000, 0x54f754a100000000, 0x261c0b7200000000, 0xf405caae00000000,
+    0x4982f78600000000, 0x9b9b365a00000000, 0xe970698900000000, 0x3b69a85500000000,
+    0xca6d62f00000000, 0xdebf17f300000000, 0xac54482000000000, 0x7e4d89fc00000000,
+    0xd39b2fc700000000, 0x182ee1b00000000, 0x7369b1c800000000, 0xa170701400000000,
+    0x96bf0e6e00000000, 0x44a6cfb200000000, 0x364d906100000000, 0xe45451bd00000000,
+    0x59d36c9500000000, 0x8bcaad4900000000, 0xf921f29a00000000, 0x2b38334600000000,
+    0x1cf74d3c00000000, 0xceee8ce000000000, 0xbc05d33300000000, 0x6e1c12ef00000000,
+    0xe36982f200000000, 0x3170432e00000000, 0x439b1cfd00000000, 0x9182dd2100000000,
+    0xa64da35b00000000, 0x7454628700000000, 0x6bf3d5400000000, 0xd4a6fc8800000000,
+    0x6921c1a000000000, 0xbb38007c00000000, 0xc9d35faf00000000, 0x1bca9e7300000000,
+    0x2c05e00900000000, 0xfe1c21d500000000, 0x8cf77e0600000000, 0x5eeebfda00000000,
+    0xf33819e100000000, 0x2121d83d00000000, 0x53ca87ee00000000, 0x81d3463200000000,
+    0xb61c384800000000, 0x6405f99400000000, 0x16eea64700000000, 0xc4f7679b00000000,
+    0x79705ab300000000, 0xab699b6f00000000, 0xd982c4bc00000000, 0xb9b056000000000,
+    0x3c547b1a00000000, 0xee4dbac600000000, 0x9ca6e51500000000, 0x4ebf24c900000000,
+  },
+  {
+    0, 0x1d8ac8700000000, 0x3b1590e00000000, 0x269f58900000000,
+    0x762b21c00000000, 0x6ba1e9b00000000, 0x4d3eb1200000000, 0x50b479500000000,
+    0xec5643800000000, 0xf1dc8bf00000000, 0xd743d3600000000, 0xcac91b100000000,
+    0x9a7d62400000000, 0x87f7aa300000000, 0xa168f2a00000000, 0xbce23ad00000000,
+    0x1d8ac87000000000, 0x1c5264f700000000, 0x1e3b917e00000000, 0x1fe33df900000000,
+    0x1ae87a6c00000000, 0x1b30d6eb00000000, 0x1959236200000000, 0x18818fe500000000,
+    0x134fac4800000000, 0x129700cf00000000, 0x10fef54600000000, 0x112659c100000000,
+    0x142d1e5400000000, 0x15f5b2d300000000, 0x179c475a00000000, 0x1644ebdd00000000,
+    0x3b1590e000000000, 0x3acd3c6700000000, 0x38a4c9ee00000000, 0x397c656900000000,
+    0x3c7722fc00000000, 0x3daf8e7b00000000, 0x3fc67bf200000000, 0x3e1ed77500000000,
+    0x35d0f4d800000000, 0x3408585f00000000, 0x3661add600000000, 0x37b9015100000000,
+    0x32b246c400000000, 0x336aea4300000000, 0x31031fca00000000, 0x30dbb34d00000000,
+    0x269f589000000000, 0x2747f41700000000, 0x252e019e00000000, 0x24f6ad1900000000,
+    0x21fdea8c00000000, 0x2025460b00000000, 0x224cb38200000000, 0x23941f0500000000,
+    0x285a3ca800000000, 0x2982902f00000000, 0x2beb65a600000000, 0x2a33c92100000000,
+    0x2f388eb400000000, 0x2ee0223300000000, 0x2c89d7ba00000000, 0x2d517b3d00000000,
+    0x762b21c000000000, 0x77f38d4700000000, 0x759a78ce00000000, 0x7442d44900000000,
+    0x714993dc00000000, 0x70913f5b00000000, 0x72f8cad200000000, 0x7320665500000000,
+    0x78ee45f800000000, 0x7936e97f00000000, 0x7b5f1cf600000000, 0x7a87b07100000000,
+    0x7f8cf7e400000000, 0x7e545b6300000000, 0x7c3daeea00000000, 0x7de5026d00000000,
+    0x6ba1e9b000000000, 0x6a79453700000000, 0x6810b0be00000000, 0x69c81c3900000000,
+    0x6cc35bac00000000, 0x6d1bf72b00000000, 0x6f7202a200000000, 0x6eaaae2500000000,
+    0x65648d8800000000, 0x64bc210f00000000, 0x66d5d48600000000, 0x670d780100000000,
+    0x62063f9400000000, 0x63de931300000000, 0x61b7669a00000000, 0x606fca1d00000000,
+    0x4d3eb12000000000, 0x4ce61da700000000, 0x4e8fe82e00000000, 0x4f5744a900000000,
+    0x4a5c033c00000000, 0x4b84afbb00000000, 0x49ed5a3200000000, 0x4835f6b500000000,
+    0x43fbd51800000000, 0x4223799f00000000, 0x404a8c1600000000, 0x4192209100000000,
+    0x4499670400000000, 0x4541cb8300000000, 0x47283e0a00000000, 0x46f0928d00000000,
+    0x50b4795000000000, 0x516cd5d700000000, 0x5305205e00000000, 0x52dd8cd900000000,
+    0x57d6cb4c00000000, 0x560e67cb00000000, 0x5467924200000000, 0x55bf3ec500000000,
+    0x5e711d6800000000, 0x5fa9b1ef00000000, 0x5dc0446600000000, 0x5c18e8e100000000,
+    0x5913af7400000000, 0x58cb03f300000000, 0x5aa2f67a00000000, 0x5b7a5afd00000000,
+    0xec56438000000000, 0xed8eef0700000000, 0xefe71a8e00000000, 0xee3fb60900000000,
+    0xeb34f19c00000000, 0xeaec5d1b00000000, 0xe885a89200000000, 0xe95d041500000000,
+    0xe29327b800000000, 0xe34b8b3f00000000, 0xe1227eb600000000, 0xe0fad23100000000,
+    0xe5f195a400000000, 0xe429392300000000, 0xe640ccaa00000000, 0xe798602d00000000,
+    0xf1dc8bf000000000, 0xf004277700000000, 0xf26dd2fe00000000, 0xf3b57e7900000000,
+    0xf6be39ec00000000, 0xf766956b00000000, 0xf50f60e200000000, 0xf4d7cc6500000000,
+    0xff19efc800000000, 0xfec1434f00000000, 0xfca8b6c600000000, 0xfd701a4100000000,
+    0xf87b5dd400000000, 0xf9a3f15300000000, 0xfbca04da00000000, 0xfa12a85d00000000,
+    0xd743d36000000000, 0xd69b7fe700000000, 0xd4f28a6e00000000, 0xd52a26e900000000,
+    0xd021617c00000000, 0xd1f9cdfb00000000, 0xd390387200000000, 0xd24894f500000000,
+    0xd986b75800000000, 0xd85e1bdf00000000, 0xda37ee5600000000, 0xdbef42d100000000,
+    0xdee4054400000000, 0xdf3ca9c300000000, 0xdd555c4a00000000, 0xdc8df0cd00000000,
+    0xcac91b1000000000, 0xcb11b79700000000, 0xc978421e00000000, 0xc8a0ee9900000000,
+    0xcdaba90c00000000, 0xcc73058b00000000, 0xce1af00200000000, 0xcfc25c8500000000,
+    0xc40c7f2800000000, 0xc5d4d3af00000000, 0xc7bd262600000000, 0xc6658aa100000000,
+    0xc36ecd3400000000, 0xc2b661b300000000, 0xc0df943a00000000, 0xc10738bd00000000,
+    0x9a7d624000000000, 0x9ba5cec700000000, 0x99cc3b4e00000000, 0x981497c900000000,
+    0x9d1fd05c00000000, 0x9cc77cdb00000000, 0x9eae895200000000, 0x9f7625d500000000,
+    0x94b8067800000000, 0x9560aaff00000000, 0x97095f7600000000, 0x96d1f3f100000000,
+    0x93dab46400000000, 0x920218e300000000, 0x906bed6a00000000, 0x91b341ed00000000,
+    0x87f7aa3000000000, 0x862f06b700000000, 0x8446f33e00000000, 0x859e5fb900000000,
+    0x8095182c00000000, 0x814db4ab00000000, 0x8324412200000000, 0x82fceda500000000,
+    0x8932ce0800000000, 0x88ea628f00000000, 0x8a83970600000000, 0x8b5b3b8100000000,
+    0x8e507c1400000000, 0x8f88d09300000000, 0x8de1251a00000000, 0x8c39899d00000000,
+    0xa168f2a000000000, 0xa0b05e2700000000, 0xa2d9abae00000000, 0xa301072900000000,
+    0xa60a40bc00000000, 0xa7d2ec3b00000000, 0xa5bb19b200000000, 0xa463b53500000000,
+    0xafad969800000000, 0xae753a1f00000000, 0xac1ccf9600000000, 0xadc4631100000000,
+    0xa8cf248400000000, 0xa917880300000000, 0xab7e7d8a00000000, 0xaaa6d10d00000000,
+    0xbce23ad000000000, 0xbd3a965700000000, 0xbf5363de00000000, 0xbe8bcf5900000000,
+    0xbb8088cc00000000, 0xba58244b00000000, 0xb831d1c200000000, 0xb9e97d4500000000,
+    0xb2275ee800000000, 0xb3fff26f00000000, 0xb19607e600000000, 0xb04eab6100000000,
+    0xb545ecf400000000, 0xb49d407300000000, 0xb6f4b5fa00000000, 0xb72c197d00000000,
+  },
+  {
+    0, 0xdc6d9ab700000000, 0xbc1a28d900000000, 0x6077b26e00000000,
+    0x7cf54c0500000000, 0xa098d6b200000000, 0xc0ef64dc00000000, 0x1c82fe6b00000000,
+    0xf9ea980a00000000, 0x258702bd00000000, 0x45f0b0d300000000, 0x999d2a6400000000,
+    0x851fd40f00000000, 0x59724eb800000000, 0x3905fcd600000000, 0xe568666100000000,
+    0xf7142da300000000, 0x2b79b71400000000, 0x4b0e057a00000000, 0x97639fcd00000000,
+    0x8be161a600000000, 0x578cfb1100000000, 0x37fb497f00000000, 0xeb96d3c800000000,
+    0xefeb5a900000000, 0xd2932f1e00000000, 0xb2e49d7000000000, 0x6e8907c700000000,
+    0x720bf9ac00000000, 0xae66631b00000000, 0xce11d17500000000, 0x127c4bc200000000,
+    0xeae946f100000000, 0x3684dc4600000000, 0x56f36e2800000000, 0x8a9ef49f00000000,
+    0x961c0af400000000, 0x4a71904300000000, 0x2a06222d00000000, 0xf66bb89a00000000,
+    0x1303defb00000000, 0xcf6e444c00000000, 0xaf19f62200000000, 0x73746c9500000000,
+    0x6ff692fe00000000, 0xb39b084900000000, 0xd3ecba2700000000, 0xf81209000000000,
+    0x1dfd6b5200000000, 0xc190f1e500000000, 0xa1e7438b00000000, 0x7d8ad93c00000000,
+    0x6108275700000000, 0xbd65bde000000000, 0xdd120f8e00000000, 0x17f953900000000,
+    0xe417f35800000000, 0x387a69ef00000000, 0x580ddb8100000000, 0x8460413600000000,
+    0x98e2bf5d00000000, 0x448f25ea00000000, 0x24f8978400000000, 0xf8950d3300000000,
+    0xd113905500000000, 0xd7e0ae200000000, 0x6d09b88c00000000, 0xb164223b00000000,
+    0xade6dc5000000000, 0x718b46e700000000, 0x11fcf48900000000, 0xcd916e3e00000000,
+    0x28f9085f00000000, 0xf49492e800000000, 0x94e3208600000000, 0x488eba3100000000,
+    0x540c445a00000000, 0x8861deed00000000, 0xe8166c8300000000, 0x347bf63400000000,
+    0x2607bdf600000000, 0xfa6a274100000000, 0x9a1d952f00000000, 0x46700f9800000000,
+    0x5af2f1f300000000, 0x869f6b4400000000, 0xe6e8d92a00000000, 0x3a85439d00000000,
+    0xdfed25fc00000000, 0x380bf4b00000000, 0x63f70d2500000000, 0xbf9a979200000000,
+    0xa31869f900000000, 0x7f75f34e00000000, 0x1f02412000000000, 0xc36fdb9700000000,
+    0x3bfad6a400000000, 0xe7974c1300000000, 0x87e0fe7d00000000, 0x5b8d64ca00000000,
+    0x470f9aa100000000, 0x9b62001600000000, 0xfb15b27800000000, 0x277828cf00000000,
+    0xc2104eae00000000, 0x1e7dd41900000000, 0x7e0a667700000000, 0xa267fcc000000000,
+    0xbee502ab00000000, 0x6288981c00000000, 0x2ff2a7200000000, 0xde92b0c500000000,
+    0xcceefb0700000000, 0x108361b000000000, 0x70f4d3de00000000, 0xac99496900000000,
+    0xb01bb70200000000, 0x6c762db500000000, 0xc019fdb00000000, 0xd06c056c00000000,
+    0x3504630d00000000, 0xe969f9ba00000000, 0x891e4bd400000000, 0x5573d16300000000,
+    0x49f12f0800000000, 0x959cb5bf00000000, 0xf5eb07d100000000, 0x29869d6600000000,
+    0xa6e63d1d00000000, 0x7a8ba7aa00000000, 0x1afc15c400000000, 0xc6918f7300000000,
+    0xda13711800000000, 0x67eebaf00000000, 0x660959c100000000, 0xba64c37600000000,
+    0x5f0ca51700000000, 0x83613fa000000000, 0xe3168dce00000000, 0x3f7b177900000000,
+    0x23f9e91200000000, 0xff9473a500000000, 0x9fe3c1cb00000000, 0x438e5b7c00000000,
+    0x51f210be00000000, 0x8d9f8a0900000000, 0xede8386700000000, 0x3185a2d000000000,
+    0x2d075cbb00000000, 0xf16ac60c00000000, 0x911d746200000000, 0x4d70eed500000000,
+    0xa81888b400000000, 0x7475120300000000, 0x1402a06d00000000, 0xc86f3ada00000000,
+    0xd4edc4b100000000, 0x8805e0600000000, 0x68f7ec6800000000, 0xb49a76df00000000,
+    0x4c0f7bec00000000, 0x9062e15b00000000, 0xf015533500000000, 0x2c78c98200000000,
+    0x30fa37e900000000, 0xec97ad5e00000000, 0x8ce01f3000000000, 0x508d858700000000,
+    0xb5e5e3e600000000, 0x6988795100000000, 0x9ffcb3f00000000, 0xd592518800000000,
+    0xc910afe300000000, 0x157d355400000000, 0x750a873a00000000, 0xa9671d8d00000000,
+    0xbb1b564f00000000, 0x6776ccf800000000, 0x7017e9600000000, 0xdb6ce42100000000,
+    0xc7ee1a4a00000000, 0x1b8380fd00000000, 0x7bf4329300000000, 0xa799a82400000000,
+    0x42f1ce4500000000, 0x9e9c54f200000000, 0xfeebe69c00000000, 0x22867c2b00000000,
+    0x3e04824000000000, 0xe26918f700000000, 0x821eaa9900000000, 0x5e73302e00000000,
+    0x77f5ad4800000000, 0xab9837ff00000000, 0xcbef859100000000, 0x17821f2600000000,
+    0xb00e14d00000000, 0xd76d7bfa00000000, 0xb71ac99400000000, 0x6b77532300000000,
+    0x8e1f354200000000, 0x5272aff500000000, 0x32051d9b00000000, 0xee68872c00000000,
+    0xf2ea794700000000, 0x2e87e3f000000000, 0x4ef0519e00000000, 0x929dcb2900000000,
+    0x80e180eb00000000, 0x5c8c1a5c00000000, 0x3cfba83200000000, 0xe096328500000000,
+    0xfc14ccee00000000, 0x2079565900000000, 0x400ee43700000000, 0x9c637e8000000000,
+    0x790b18e100000000, 0xa566825600000000, 0xc511303800000000, 0x197caa8f00000000,
+    0x5fe54e400000000, 0xd993ce5300000000, 0xb9e47c3d00000000, 0x6589e68a00000000,
+    0x9d1cebb900000000, 0x4171710e00000000, 0x2106c36000000000, 0xfd6b59d700000000,
+    0xe1e9a7bc00000000, 0x3d843d0b00000000, 0x5df38f6500000000, 0x819e15d200000000,
+    0x64f673b300000000, 0xb89be90400000000, 0xd8ec5b6a00000000, 0x481c1dd00000000,
+    0x18033fb600000000, 0xc46ea50100000000, 0xa419176f00000000, 0x78748dd800000000,
+    0x6a08c61a00000000, 0xb6655cad00000000, 0xd612eec300000000, 0xa7f747400000000,
+    0x16fd8a1f00000000, 0xca9010a800000000, 0xaae7a2c600000000, 0x768a387100000000,
+    0x93e25e1000000000, 0x4f8fc4a700000000, 0x2ff876c900000000, 0xf395ec7e00000000,
+    0xef17121500000000, 0x337a88a200000000, 0x530d3acc00000000, 0x8f60a07b00000000,
+  },
+  {
+    0, 0x490d678d00000000, 0x921acf1a00000000, 0xdb17a89700000000,
+    0x20f4838300000000, 0x69f9e40e00000000, 0xb2ee4c9900000000, 0xfbe32b1400000000,
+    0x41e9070600000000, 0x8e4608b00000000, 0xd3f3c81c00000000, 0x9afeaf9100000000,
+    0x611d848500000000, 0x2810e30800000000, 0xf3074b9f00000000, 0xba0a2c1200000000,
+    0x83d20e0c00000000, 0xcadf698100000000, 0x11c8c11600000000, 0x58c5a69b00000000,
+    0xa3268d8f00000000, 0xea2bea0200000000, 0x313c429500000000, 0x7831251800000000,
+    0xc23b090a00000000, 0x8b366e8700000000, 0x5021c61000000000, 0x192ca19d00000000,
+    0xe2cf8a8900000000, 0xabc2ed0400000000, 0x70d5459300000000, 0x39d8221e00000000,
+    0x36501af00000000, 0x4a68662200000000, 0x917fceb500000000, 0xd872a93800000000,
+    0x2391822c00000000, 0x6a9ce5a100000000, 0xb18b4d3600000000, 0xf8862abb00000000,
+    0x428c06a900000000, 0xb81612400000000, 0xd096c9b300000000, 0x999bae3e00000000,
+    0x6278852a00000000, 0x2b75e2a700000000, 0xf0624a3000000000, 0xb96f2dbd00000000,
+    0x80b70fa300000000, 0xc9ba682e00000000, 0x12adc0b900000000, 0x5ba0a73400000000,
+    0xa0438c2000000000, 0xe94eebad00000000, 0x3259433a00000000, 0x7b5424b700000000,
+    0xc15e08a500000000, 0x88536f2800000000, 0x5344c7bf00000000, 0x1a49a03200000000,
+    0xe1aa8b2600000000, 0xa8a7ecab00000000, 0x73b0443c00000000, 0x3abd23b100000000,
+    0x6ca035e00000000, 0x4fc764d300000000, 0x94d0cc4400000000, 0xddddabc900000000,
+    0x263e80dd00000000, 0x6f33e75000000000, 0xb4244fc700000000, 0xfd29284a00000000,
+    0x4723045800000000, 0xe2e63d500000000, 0xd539cb4200000000, 0x9c34accf00000000,
+    0x67d787db00000000, 0x2edae05600000000, 0xf5cd48c100000000, 0xbcc02f4c00000000,
+    0x85180d5200000000, 0xcc156adf00000000, 0x1702c24800000000, 0x5e0fa5c500000000,
+    0xa5ec8ed100000000, 0xece1e95c00000000, 0x37f641cb00000000, 0x7efb264600000000,
+    0xc4f10a5400000000, 0x8dfc6dd900000000, 0x56ebc54e00000000, 0x1fe6a2c300000000,
+    0xe40589d700000000, 0xad08ee5a00000000, 0x761f46cd00000000, 0x3f12214000000000,
+    0x5af02f100000000, 0x4ca2657c00000000, 0x97b5cdeb00000000, 0xdeb8aa6600000000,
+    0x255b817200000000, 0x6c56e6ff00000000, 0xb7414e6800000000, 0xfe4c29e500000000,
+    0x444605f700000000, 0xd4b627a00000000, 0xd65ccaed00000000, 0x9f51ad6000000000,
+    0x64b2867400000000, 0x2dbfe1f900000000, 0xf6a8496e00000000, 0xbfa52ee300000000,
+    0x867d0cfd00000000, 0xcf706b7000000000, 0x1467c3e700000000, 0x5d6aa46a00000000,
+    0xa6898f7e00000000, 0xef84e8f300000000, 0x3493406400000000, 0x7d9e27e900000000,
+    0xc7940bfb00000000, 0x8e996c7600000000, 0x558ec4e100000000, 0x1c83a36c00000000,
+    0xe760887800000000, 0xae6deff500000000, 0x757a476200000000, 0x3c7720ef00000000,
+    0xd9406bc00000000, 0x4499613100000000, 0x9f8ec9a600000000, 0xd683ae2b00000000,
+    0x2d60853f00000000, 0x646de2b200000000, 0xbf7a4a2500000000, 0xf6772da800000000,
+    0x4c7d01ba00000000, 0x570663700000000, 0xde67cea000000000, 0x976aa92d00000000,
+    0x6c89823900000000, 0x2584e5b400000000, 0xfe934d2300000000, 0xb79e2aae00000000,
+    0x8e4608b000000000, 0xc74b6f3d00000000, 0x1c5cc7aa00000000, 0x5551a02700000000,
+    0xaeb28b3300000000, 0xe7bfecbe00000000, 0x3ca8442900000000, 0x75a523a400000000,
+    0xcfaf0fb600000000, 0x86a2683b00000000, 0x5db5c0ac00000000, 0x14b8a72100000000,
+    0xef5b8c3500000000, 0xa656ebb800000000, 0x7d41432f00000000, 0x344c24a200000000,
+    0xef1071300000000, 0x47fc609e00000000, 0x9cebc80900000000, 0xd5e6af8400000000,
+    0x2e05849000000000, 0x6708e31d00000000, 0xbc1f4b8a00000000, 0xf5122c0700000000,
+    0x4f18001500000000, 0x615679800000000, 0xdd02cf0f00000000, 0x940fa88200000000,
+    0x6fec839600000000, 0x26e1e41b00000000, 0xfdf64c8c00000000, 0xb4fb2b0100000000,
+    0x8d23091f00000000, 0xc42e6e9200000000, 0x1f39c60500000000, 0x5634a18800000000,
+    0xadd78a9c00000000, 0xe4daed1100000000, 0x3fcd458600000000, 0x76c0220b00000000,
+    0xccca0e1900000000, 0x85c7699400000000, 0x5ed0c10300000000, 0x17dda68e00000000,
+    0xec3e8d9a00000000, 0xa533ea1700000000, 0x7e24428000000000, 0x3729250d00000000,
+    0xb5e05e200000000, 0x4253626f00000000, 0x9944caf800000000, 0xd049ad7500000000,
+    0x2baa866100000000, 0x62a7e1ec00000000, 0xb9b0497b00000000, 0xf0bd2ef600000000,
+    0x4ab702e400000000, 0x3ba656900000000, 0xd8adcdfe00000000, 0x91a0aa7300000000,
+    0x6a43816700000000, 0x234ee6ea00000000, 0xf8594e7d00000000, 0xb15429f000000000,
+    0x888c0bee00000000, 0xc1816c6300000000, 0x1a96c4f400000000, 0x539ba37900000000,
+    0xa878886d00000000, 0xe175efe000000000, 0x3a62477700000000, 0x736f20fa00000000,
+    0xc9650ce800000000, 0x80686b6500000000, 0x5b7fc3f200000000, 0x1272a47f00000000,
+    0xe9918f6b00000000, 0xa09ce8e600000000, 0x7b8b407100000000, 0x328627fc00000000,
+    0x83b044d00000000, 0x413663c000000000, 0x9a21cb5700000000, 0xd32cacda00000000,
+    0x28cf87ce00000000, 0x61c2e04300000000, 0xbad548d400000000, 0xf3d82f5900000000,
+    0x49d2034b00000000, 0xdf64c600000000, 0xdbc8cc5100000000, 0x92c5abdc00000000,
+    0x692680c800000000, 0x202be74500000000, 0xfb3c4fd200000000, 0xb231285f00000000,
+    0x8be90a4100000000, 0xc2e46dcc00000000, 0x19f3c55b00000000, 0x50fea2d600000000,
+    0xab1d89c200000000, 0xe210ee4f00000000, 0x390746d800000000, 0x700a215500000000,
+    0xca000d4700000000, 0x830d6aca00000000, 0x581ac25d00000000, 0x1117a5d000000000,
+    0xeaf48ec400000000, 0xa3f9e94900000000, 0x78ee41de00000000, 0x31e3265300000000,
+  },
+  {
+    0, 0x1b280d7800000000, 0x36501af000000000, 0x2d78178800000000,
+    0x6ca035e000000000, 0x7788389800000000, 0x5af02f1000000000, 0x41d8226800000000,
+    0xd9406bc000000000, 0xc26866b800000000, 0xef10713000000000, 0xf4387c4800000000,
+    0xb5e05e2000000000, 0xaec8535800000000, 0x83b044d000000000, 0x989849a800000000,
+    0xb641ca3700000000, 0xad69c74f00000000, 0x8011d0c700000000, 0x9b39ddbf00000000,
+    0xdae1ffd700000000, 0xc1c9f2af00000000, 0xecb1e52700000000, 0xf799e85f00000000,
+    0x6f01a1f700000000, 0x7429ac8f00000000, 0x5951bb0700000000, 0x4279b67f00000000,
+    0x3a1941700000000, 0x1889996f00000000, 0x35f18ee700000000, 0x2ed9839f00000000,
+    0x684289d900000000, 0x736a84a100000000, 0x5e12932900000000, 0x453a9e5100000000,
+    0x4e2bc3900000000, 0x1fcab14100000000, 0x32b2a6c900000000, 0x299aabb100000000,
+    0xb102e21900000000, 0xaa2aef6100000000, 0x8752f8e900000000, 0x9c7af59100000000,
+    0xdda2d7f900000000, 0xc68ada8100000000, 0xebf2cd0900000000, 0xf0dac07100000000,
+    0xde0343ee00000000, 0xc52b4e9600000000, 0xe853591e00000000, 0xf37b546600000000,
+    0xb2a3760e00000000, 0xa98b7b7600000000, 0x84f36cfe00000000, 0x9fdb618600000000,
+    0x743282e00000000, 0x1c6b255600000000, 0x311332de00000000, 0x2a3b3fa600000000,
+    0x6be31dce00000000, 0x70cb10b600000000, 0x5db3073e00000000, 0x469b0a4600000000,
+    0xd08513b200000000, 0xcbad1eca00000000, 0xe6d5094200000000, 0xfdfd043a00000000,
+    0xbc25265200000000, 0xa70d2b2a00000000, 0x8a753ca200000000, 0x915d31da00000000,
+    0x9c5787200000000, 0x12ed750a00000000, 0x3f95628200000000, 0x24bd6ffa00000000,
+    0x65654d9200000000, 0x7e4d40ea00000000, 0x5335576200000000, 0x481d5a1a00000000,
+    0x66c4d98500000000, 0x7decd4fd00000000, 0x5094c37500000000, 0x4bbcce0d00000000,
+    0xa64ec6500000000, 0x114ce11d00000000, 0x3c34f69500000000, 0x271cfbed00000000,
+    0xbf84b24500000000, 0xa4acbf3d00000000, 0x89d4a8b500000000, 0x92fca5cd00000000,
+    0xd32487a500000000, 0xc80c8add00000000, 0xe5749d5500000000, 0xfe5c902d00000000,
+    0xb8c79a6b00000000, 0xa3ef971300000000, 0x8e97809b00000000, 0x95bf8de300000000,
+    0xd467af8b00000000, 0xcf4fa2f300000000, 0xe237b57b00000000, 0xf91fb80300000000,
+    0x6187f1ab00000000, 0x7aaffcd300000000, 0x57d7eb5b00000000, 0x4cffe62300000000,
+    0xd27c44b00000000, 0x160fc93300000000, 0x3b77debb00000000, 0x205fd3c300000000,
+    0xe86505c00000000, 0x15ae5d2400000000, 0x38d64aac00000000, 0x23fe47d400000000,
+    0x622665bc00000000, 0x790e68c400000000, 0x54767f4c00000000, 0x4f5e723400000000,
+    0xd7c63b9c00000000, 0xccee36e400000000, 0xe196216c00000000, 0xfabe2c1400000000,
+    0xbb660e7c00000000, 0xa04e030400000000, 0x8d36148c00000000, 0x961e19f400000000,
+    0xa5cb3ad300000000, 0xbee337ab00000000, 0x939b202300000000, 0x88b32d5b00000000,
+    0xc96b0f3300000000, 0xd243024b00000000, 0xff3b15c300000000, 0xe41318bb00000000,
+    0x7c8b511300000000, 0x67a35c6b00000000, 0x4adb4be300000000, 0x51f3469b00000000,
+    0x102b64f300000000, 0xb03698b00000000, 0x267b7e0300000000, 0x3d53737b00000000,
+    0x138af0e400000000, 0x8a2fd9c00000000, 0x25daea1400000000, 0x3ef2e76c00000000,
+    0x7f2ac50400000000, 0x6402c87c00000000, 0x497adff400000000, 0x5252d28c00000000,
+    0xcaca9b2400000000, 0xd1e2965c00000000, 0xfc9a81d400000000, 0xe7b28cac00000000,
+    0xa66aaec400000000, 0xbd42a3bc00000000, 0x903ab43400000000, 0x8b12b94c00000000,
+    0xcd89b30a00000000, 0xd6a1be7200000000, 0xfbd9a9fa00000000, 0xe0f1a48200000000,
+    0xa12986ea00000000, 0xba018b9200000000, 0x97799c1a00000000, 0x8c51916200000000,
+    0x14c9d8ca00000000, 0xfe1d5b200000000, 0x2299c23a00000000, 0x39b1cf4200000000,
+    0x7869ed2a00000000, 0x6341e05200000000, 0x4e39f7da00000000, 0x5511faa200000000,
+    0x7bc8793d00000000, 0x60e0744500000000, 0x4d9863cd00000000, 0x56b06eb500000000,
+    0x17684cdd00000000, 0xc4041a500000000, 0x2138562d00000000, 0x3a105b5500000000,
+    0xa28812fd00000000, 0xb9a01f8500000000, 0x94d8080d00000000, 0x8ff0057500000000,
+    0xce28271d00000000, 0xd5002a6500000000, 0xf8783ded00000000, 0xe350309500000000,
+    0x754e296100000000, 0x6e66241900000000, 0x431e339100000000, 0x58363ee900000000,
+    0x19ee1c8100000000, 0x2c611f900000000, 0x2fbe067100000000, 0x34960b0900000000,
+    0xac0e42a100000000, 0xb7264fd900000000, 0x9a5e585100000000, 0x8176552900000000,
+    0xc0ae774100000000, 0xdb867a3900000000, 0xf6fe6db100000000, 0xedd660c900000000,
+    0xc30fe35600000000, 0xd827ee2e00000000, 0xf55ff9a600000000, 0xee77f4de00000000,
+    0xafafd6b600000000, 0xb487dbce00000000, 0x99ffcc4600000000, 0x82d7c13e00000000,
+    0x1a4f889600000000, 0x16785ee00000000, 0x2c1f926600000000, 0x37379f1e00000000,
+    0x76efbd7600000000, 0x6dc7b00e00000000, 0x40bfa78600000000, 0x5b97aafe00000000,
+    0x1d0ca0b800000000, 0x624adc000000000, 0x2b5cba4800000000, 0x3074b73000000000,
+    0x71ac955800000000, 0x6a84982000000000, 0x47fc8fa800000000, 0x5cd482d000000000,
+    0xc44ccb7800000000, 0xdf64c60000000000, 0xf21cd18800000000, 0xe934dcf000000000,
+    0xa8ecfe9800000000, 0xb3c4f3e000000000, 0x9ebce46800000000, 0x8594e91000000000,
+    0xab4d6a8f00000000, 0xb06567f700000000, 0x9d1d707f00000000, 0x86357d0700000000,
+    0xc7ed5f6f00000000, 0xdcc5521700000000, 0xf1bd459f00000000, 0xea9548e700000000,
+    0x720d014f00000000, 0x69250c3700000000, 0x445d1bbf00000000, 0x5f7516c700000000,
+    0x1ead34af00000000, 0x58539d700000000, 0x28fd2e5f00000000, 0x33d5232700000000,
+  },
+  {
+    0, 0x4f57681100000000, 0x9eaed02200000000, 0xd1f9b83300000000,
+    0x399cbdf300000000, 0x76cbd5e200000000, 0xa7326dd100000000, 0xe86505c000000000,
+    0x73397be600000000, 0x3c6e13f700000000, 0xed97abc400000000, 0xa2c0c3d500000000,
+    0x4aa5c61500000000, 0x5f2ae0400000000, 0xd40b163700000000, 0x9b5c7e2600000000,
+    0xe672f7cc00000000, 0xa9259fdd00000000, 0x78dc27ee00000000, 0x378b4fff00000000,
+    0xdfee4a3f00000000, 0x90b9222e00000000, 0x41409a1d00000000, 0xe17f20c00000000,
+    0x954b8c2a00000000, 0xda1ce43b00000000, 0xbe55c0800000000, 0x44b2341900000000,
+    0xacd731d900000000, 0xe38059c800000000, 0x3279e1fb00000000, 0x7d2e89ea00000000,
+    0xc824f22f00000000, 0x87739a3e00000000, 0x568a220d00000000, 0x19dd4a1c00000000,
+    0xf1b84fdc00000000, 0xbeef27cd00000000, 0x6f169ffe00000000, 0x2041f7ef00000000,
+    0xbb1d89c900000000, 0xf44ae1d800000000, 0x25b359eb00000000, 0x6ae431fa00000000,
+    0x8281343a00000000, 0xcdd65c2b00000000, 0x1c2fe41800000000, 0x53788c0900000000,
+    0x2e5605e300000000, 0x61016df200000000, 0xb0f8d5c100000000, 0xffafbdd000000000,
+    0x17cab81000000000, 0x589dd00100000000, 0x8964683200000000, 0xc633002300000000,
+    0x5d6f7e0500000000, 0x1238161400000000, 0xc3c1ae2700000000, 0x8c96c63600000000,
+    0x64f3c3f600000000, 0x2ba4abe700000000, 0xfa5d13d400000000, 0xb50a7bc500000000,
+    0x9488f9e900000000, 0xdbdf91f800000000, 0xa2629cb00000000, 0x457141da00000000,
+    0xad14441a00000000, 0xe2432c0b00000000, 0x33ba943800000000, 0x7cedfc2900000000,
+    0xe7b1820f00000000, 0xa8e6ea1e00000000, 0x791f522d00000000, 0x36483a3c00000000,
+    0xde2d3ffc00000000, 0x917a57ed00000000, 0x4083efde00000000, 0xfd487cf00000000,
+    0x72fa0e2500000000, 0x3dad663400000000, 0xec54de0700000000, 0xa303b61600000000,
+    0x4b66b3d600000000, 0x431dbc700000000, 0xd5c863f400000000, 0x9a9f0be500000000,
+    0x1c375c300000000, 0x4e941dd200000000, 0x9f6da5e100000000, 0xd03acdf000000000,
+    0x385fc83000000000, 0x7708a02100000000, 0xa6f1181200000000, 0xe9a6700300000000,
+    0x5cac0bc600000000, 0x13fb63d700000000, 0xc202dbe400000000, 0x8d55b3f500000000,
+    0x6530b63500000000, 0x2a67de2400000000, 0xfb9e661700000000, 0xb4c90e0600000000,
+    0x2f95702000000000, 0x60c2183100000000, 0xb13ba00200000000, 0xfe6cc81300000000,
+    0x1609cdd300000000, 0x595ea5c200000000, 0x88a71df100000000, 0xc7f075e000000000,
+    0xbadefc0a00000000, 0xf589941b00000000, 0x24702c2800000000, 0x6b27443900000000,
+    0x834241f900000000, 0xcc1529e800000000, 0x1dec91db00000000, 0x52bbf9ca00000000,
+    0xc9e787ec00000000, 0x86b0effd00000000, 0x574957ce00000000, 0x181e3fdf00000000,
+    0xf07b3a1f00000000, 0xbf2c520e00000000, 0x6ed5ea3d00000000, 0x2182822c00000000,
+    0x2dd0ee6500000000, 0x6287867400000000, 0xb37e3e4700000000, 0xfc29565600000000,
+    0x144c539600000000, 0x5b1b3b8700000000, 0x8ae283b400000000, 0xc5b5eba500000000,
+    0x5ee9958300000000, 0x11befd9200000000, 0xc04745a100000000, 0x8f102db000000000,
+    0x6775287000000000, 0x2822406100000000, 0xf9dbf85200000000, 0xb68c904300000000,
+    0xcba219a900000000, 0x84f571b800000000, 0x550cc98b00000000, 0x1a5ba19a00000000,
+    0xf23ea45a00000000, 0xbd69cc4b00000000, 0x6c90747800000000, 0x23c71c6900000000,
+    0xb89b624f00000000, 0xf7cc0a5e00000000, 0x2635b26d00000000, 0x6962da7c00000000,
+    0x8107dfbc00000000, 0xce50b7ad00000000, 0x1fa90f9e00000000, 0x50fe678f00000000,
+    0xe5f41c4a00000000, 0xaaa3745b00000000, 0x7b5acc6800000000, 0x340da47900000000,
+    0xdc68a1b900000000, 0x933fc9a800000000, 0x42c6719b00000000, 0xd91198a00000000,
+    0x96cd67ac00000000, 0xd99a0fbd00000000, 0x863b78e00000000, 0x4734df9f00000000,
+    0xaf51da5f00000000, 0xe006b24e00000000, 0x31ff0a7d00000000, 0x7ea8626c00000000,
+    0x386eb8600000000, 0x4cd1839700000000, 0x9d283ba400000000, 0xd27f53b500000000,
+    0x3a1a567500000000, 0x754d3e6400000000, 0xa4b4865700000000, 0xebe3ee4600000000,
+    0x70bf906000000000, 0x3fe8f87100000000, 0xee11404200000000, 0xa146285300000000,
+    0x49232d9300000000, 0x674458200000000, 0xd78dfdb100000000, 0x98da95a000000000,
+    0xb958178c00000000, 0xf60f7f9d00000000, 0x27f6c7ae00000000, 0x68a1afbf00000000,
+    0x80c4aa7f00000000, 0xcf93c26e00000000, 0x1e6a7a5d00000000, 0x513d124c00000000,
+    0xca616c6a00000000, 0x8536047b00000000, 0x54cfbc4800000000, 0x1b98d45900000000,
+    0xf3fdd19900000000, 0xbcaab98800000000, 0x6d5301bb00000000, 0x220469aa00000000,
+    0x5f2ae04000000000, 0x107d885100000000, 0xc184306200000000, 0x8ed3587300000000,
+    0x66b65db300000000, 0x29e135a200000000, 0xf8188d9100000000, 0xb74fe58000000000,
+    0x2c139ba600000000, 0x6344f3b700000000, 0xb2bd4b8400000000, 0xfdea239500000000,
+    0x158f265500000000, 0x5ad84e4400000000, 0x8b21f67700000000, 0xc4769e6600000000,
+    0x717ce5a300000000, 0x3e2b8db200000000, 0xefd2358100000000, 0xa0855d9000000000,
+    0x48e0585000000000, 0x7b7304100000000, 0xd64e887200000000, 0x9919e06300000000,
+    0x2459e4500000000, 0x4d12f65400000000, 0x9ceb4e6700000000, 0xd3bc267600000000,
+    0x3bd923b600000000, 0x748e4ba700000000, 0xa577f39400000000, 0xea209b8500000000,
+    0x970e126f00000000, 0xd8597a7e00000000, 0x9a0c24d00000000, 0x46f7aa5c00000000,
+    0xae92af9c00000000, 0xe1c5c78d00000000, 0x303c7fbe00000000, 0x7f6b17af00000000,
+    0xe437698900000000, 0xab60019800000000, 0x7a99b9ab00000000, 0x35ced1ba00000000,
+    0xddabd47a00000000, 0x92fcbc6b00000000, 0x4305045800000000, 0xc526c4900000000,
+  },
+  {
+    0, 0x5ba1dcca00000000, 0xb743b99400000000, 0xece2655e00000000,
+    0x6a466e9f00000000, 0x31e7b25500000000, 0xdd05d70b00000000, 0x86a40bc100000000,
+    0xd48cdd3e00000000, 0x8f2d01f400000000, 0x63cf64aa00000000, 0x386eb86000000000,
+    0xbecab3a100000000, 0xe56b6f6b00000000, 0x9890a3500000000, 0x5228d6ff00000000,
+    0xadd8a7cb00000000, 0xf6797b0100000000, 0x1a9b1e5f00000000, 0x413ac29500000000,
+    0xc79ec95400000000, 0x9c3f159e00000000, 0x70dd70c000000000, 0x2b7cac0a00000000,
+    0x79547af500000000, 0x22f5a63f00000000, 0xce17c36100000000, 0x95b61fab00000000,
+    0x1312146a00000000, 0x48b3c8a000000000, 0xa451adfe00000000, 0xfff0713400000000,
+    0x5f70522100000000, 0x4d18eeb00000000, 0xe833ebb500000000, 0xb392377f00000000,
+    0x35363cbe00000000, 0x6e97e07400000000, 0x8275852a00000000, 0xd9d459e000000000,
+    0x8bfc8f1f00000000, 0xd05d53d500000000, 0x3cbf368b00000000, 0x671eea4100000000,
+    0xe1bae18000000000, 0xba1b3d4a00000000, 0x56f9581400000000, 0xd5884de00000000,
+    0xf2a8f5ea00000000, 0xa909292000000000, 0x45eb4c7e00000000, 0x1e4a90b400000000,
+    0x98ee9b7500000000, 0xc34f47bf00000000, 0x2fad22e100000000, 0x740cfe2b00000000,
+    0x262428d400000000, 0x7d85f41e00000000, 0x9167914000000000, 0xcac64d8a00000000,
+    0x4c62464b00000000, 0x17c39a8100000000, 0xfb21ffdf00000000, 0xa080231500000000,
+    0xbee0a44200000000, 0xe541788800000000, 0x9a31dd600000000, 0x5202c11c00000000,
+    0xd4a6cadd00000000, 0x8f07161700000000, 0x63e5734900000000, 0x3844af8300000000,
+    0x6a6c797c00000000, 0x31cda5b600000000, 0xdd2fc0e800000000, 0x868e1c2200000000,
+    0x2a17e300000000, 0x5b8bcb2900000000, 0xb769ae7700000000, 0xecc872bd00000000,
+    0x1338038900000000, 0x4899df4300000000, 0xa47bba1d00000000, 0xffda66d700000000,
+    0x797e6d1600000000, 0x22dfb1dc00000000, 0xce3dd48200000000, 0x959c084800000000,
+    0xc7b4deb700000000, 0x9c15027d00000000, 0x70f7672300000000, 0x2b56bbe900000000,
+    0xadf2b02800000000, 0xf6536ce200000000, 0x1ab109bc00000000, 0x4110d57600000000,
+    0xe190f66300000000, 0xba312aa900000000, 0x56d34ff700000000, 0xd72933d00000000,
+    0x8bd698fc00000000, 0xd077443600000000, 0x3c95216800000000, 0x6734fda200000000,
+    0x351c2b5d00000000, 0x6ebdf79700000000, 0x825f92c900000000, 0xd9fe4e0300000000,
+    0x5f5a45c200000000, 0x4fb990800000000, 0xe819fc5600000000, 0xb3b8209c00000000,
+    0x4c4851a800000000, 0x17e98d6200000000, 0xfb0be83c00000000, 0xa0aa34f600000000,
+    0x260e3f3700000000, 0x7dafe3fd00000000, 0x914d86a300000000, 0xcaec5a6900000000,
+    0x98c48c9600000000, 0xc365505c00000000, 0x2f87350200000000, 0x7426e9c800000000,
+    0xf282e20900000000, 0xa9233ec300000000, 0x45c15b9d00000000, 0x1e60875700000000,
+    0x7900553300000000, 0x22a189f900000000, 0xce43eca700000000, 0x95e2306d00000000,
+    0x13463bac00000000, 0x48e7e76600000000, 0xa405823800000000, 0xffa45ef200000000,
+    0xad8c880d00000000, 0xf62d54c700000000, 0x1acf319900000000, 0x416eed5300000000,
+    0xc7cae69200000000, 0x9c6b3a5800000000, 0x70895f0600000000, 0x2b2883cc00000000,
+    0xd4d8f2f800000000, 0x8f792e3200000000, 0x639b4b6c00000000, 0x383a97a600000000,
+    0xbe9e9c6700000000, 0xe53f40ad00000000, 0x9dd25f300000000, 0x527cf93900000000,
+    0x542fc600000000, 0x5bf5f30c00000000, 0xb717965200000000, 0xecb64a9800000000,
+    0x6a12415900000000, 0x31b39d9300000000, 0xdd51f8cd00000000, 0x86f0240700000000,
+    0x2670071200000000, 0x7dd1dbd800000000, 0x9133be8600000000, 0xca92624c00000000,
+    0x4c36698d00000000, 0x1797b54700000000, 0xfb75d01900000000, 0xa0d40cd300000000,
+    0xf2fcda2c00000000, 0xa95d06e600000000, 0x45bf63b800000000, 0x1e1ebf7200000000,
+    0x98bab4b300000000, 0xc31b687900000000, 0x2ff90d2700000000, 0x7458d1ed00000000,
+    0x8ba8a0d900000000, 0xd0097c1300000000, 0x3ceb194d00000000, 0x674ac58700000000,
+    0xe1eece4600000000, 0xba4f128c00000000, 0x56ad77d200000000, 0xd0cab1800000000,
+    0x5f247de700000000, 0x485a12d00000000, 0xe867c47300000000, 0xb3c618b900000000,
+    0x3562137800000000, 0x6ec3cfb200000000, 0x8221aaec00000000, 0xd980762600000000,
+    0xc7e0f17100000000, 0x9c412dbb00000000, 0x70a348e500000000, 0x2b02942f00000000,
+    0xada69fee00000000, 0xf607432400000000, 0x1ae5267a00000000, 0x4144fab000000000,
+    0x136c2c4f00000000, 0x48cdf08500000000, 0xa42f95db00000000, 0xff8e491100000000,
+    0x792a42d000000000, 0x228b9e1a00000000, 0xce69fb4400000000, 0x95c8278e00000000,
+    0x6a3856ba00000000, 0x31998a7000000000, 0xdd7bef2e00000000, 0x86da33e400000000,
+    0x7e382500000000, 0x5bdfe4ef00000000, 0xb73d81b100000000, 0xec9c5d7b00000000,
+    0xbeb48b8400000000, 0xe515574e00000000, 0x9f7321000000000, 0x5256eeda00000000,
+    0xd4f2e51b00000000, 0x8f5339d100000000, 0x63b15c8f00000000, 0x3810804500000000,
+    0x9890a35000000000, 0xc3317f9a00000000, 0x2fd31ac400000000, 0x7472c60e00000000,
+    0xf2d6cdcf00000000, 0xa977110500000000, 0x4595745b00000000, 0x1e34a89100000000,
+    0x4c1c7e6e00000000, 0x17bda2a400000000, 0xfb5fc7fa00000000, 0xa0fe1b3000000000,
+    0x265a10f100000000, 0x7dfbcc3b00000000, 0x9119a96500000000, 0xcab875af00000000,
+    0x3548049b00000000, 0x6ee9d85100000000, 0x820bbd0f00000000, 0xd9aa61c500000000,
+    0x5f0e6a0400000000, 0x4afb6ce00000000, 0xe84dd39000000000, 0xb3ec0f5a00000000,
+    0xe1c4d9a500000000, 0xba65056f00000000, 0x5687603100000000, 0xd26bcfb00000000,
+    0x8b82b73a00000000, 0xd0236bf000000000, 0x3cc10eae00000000, 0x6760d26400000000,
+  },
+};
+static const CrcFold crc_cat_f12 = {
+    32, 0, 0x4c11db700000000,
+    { 0xa3dc855100000000, 0x1851689900000000 }, { 0x57a8445500000000, 0xd3504ec700000000 }, { 0x17d3315d00000000, 0xf200aa6600000000 },
+    0xf200aa6600000000, 0x4d101df481b4e5a
+};
+
+/* CRC-32/MPEG-2: mesmas tabelas de CRC-32/BZIP2 */
+
+/* CRC-32/ISCSI */
+static const uint64_t crc_cat_t14[8][256] = {
+  {
+    0, 0xf26b8303, 0xe13b70f7, 0x1350f3f4,
+    0xc79a971f, 0x35f1141c, 0x26a1e7e8, 0xd4ca64eb,
+    0x8ad958cf, 0x78b2dbcc, 0x6be22838, 0x9989ab3b,
+    0x4d43cfd0, 0xbf284cd3, 0xac78bf27, 0x5e133c24,
+    0x105ec76f, 0xe235446c, 0xf165b798, 0x30e349b,
+    0xd7c45070, 0x25afd373, 0x36ff2087, 0xc494a384,
+    0x9a879fa0, 0x68ec1ca3, 0x7bbcef57, 0x89d76c54,
+    0x5d1d08bf, 0xaf768bbc, 0xbc267848, 0x4e4dfb4b,
+    0x20bd8ede, 0xd2d60ddd, 0xc186fe29, 0x33ed7d2a,
+    0xe72719c1, 0x154c9ac2, 0x61c6936, 0xf477ea35,
+    0xaa64d611, 0x580f5512, 0x4b5fa6e6, 0xb93425e5,
+    0x6dfe410e, 0x9f95c20d, 0x8cc531f9, 0x7eaeb2fa,
+    0x30e349b1, 0xc288cab2, 0xd1d83946, 0x23b3ba45,
+    0xf779deae, 0x5125dad, 0x1642ae59, 0xe4292d5a,
+    0xba3a117e, 0x4851927d, 0x5b016189, 0xa96ae28a,
+    0x7da08661, 0x8fcb0562, 0x9c9bf696, 0x6ef07595,
+    0x417b1dbc, 0xb3109ebf, 0xa0406d4b, 0x522bee48,
+    0x86e18aa3, 0x748a09a0, 0x67dafa54, 0x95b17957,
+    0xcba24573, 0x39c9c670, 0x2a993584, 0xd8f2b687,
+    0xc38d26c, 0xfe53516f, 0xed03a29b, 0x1f682198,
+    0x5125dad3, 0xa34e59d0, 0xb01eaa24, 0x42752927,
+    0x96bf4dcc, 0x64d4cecf, 0x77843d3b, 0x85efbe38,
+    0xdbfc821c, 0x2997011f, 0x3ac7f2eb, 0xc8ac71e8,
+    0x1c661503, 0xee0d9600, 0xfd5d65f4, 0xf36e6f7,
+    0x61c69362, 0x93ad1061, 0x80fde395, 0x72966096,
+    0xa65c047d, 0x5437877e, 0x4767748a, 0xb50cf789,
+    0xeb1fcbad, 0x197448ae, 0xa24bb5a, 0xf84f3859,
+    0x2c855cb2, 0xdeeedfb1, 0xcdbe2c45, 0x3fd5af46,
+    0x7198540d, 0x83f3d70e, 0x90a324fa, 0x62c8a7f9,
+    0xb602c312, 0x44694011, 0x5739b3e5, 0xa55230e6,
+    0xfb410cc2, 0x92a8fc1, 0x1a7a7c35, 0xe811ff36,
+    0x3cdb9bdd, 0xceb018de, 0xdde0eb2a, 0x2f8b6829,
+    0x82f63b78, 0x709db87b, 0x63cd4b8f, 0x91a6c88c,
+    0x456cac67, 0xb7072f64, 0xa457dc90, 0x563c5f93,
+    0x82f63b7, 0xfa44e0b4, 0xe9141340, 0x1b7f9043,
+    0xcfb5f4a8, 0x3dde77ab, 0x2e8e845f, 0xdce5075c,
+    0x92a8fc17, 0x60c37f14, 0x73938ce0, 0x81f80fe3,
+    0x55326b08, 0xa759e80b, 0xb4091bff, 0x466298fc,
+    0x1871a4d8, 0xea1a27db, 0xf94ad42f, 0xb21572c,
+    0xdfeb33c7, 0x2d80b0c4, 0x3ed04330, 0xccbbc033,
+    0xa24bb5a6, 0x502036a5, 0x4370c551, 0xb11b4652,
+    0x65d122b9, 0x97baa1ba, 0x84ea524e, 0x7681d14d,
+    0x2892ed69, 0xdaf96e6a, 0xc9a99d9e, 0x3bc21e9d,
+    0xef087a76, 0x1d63f975, 0xe330a81, 0xfc588982,
+    0xb21572c9, 0x407ef1ca, 0x532e023e, 0xa145813d,
+    0x758fe5d6, 0x87e466d5, 0x94b49521, 0x66df1622,
+    0x38cc2a06, 0xcaa7a905, 0xd9f75af1, 0x2b9cd9f2,
+    0xff56bd19, 0xd3d3e1a, 0x1e6dcdee, 0xec064eed,
+    0xc38d26c4, 0x31e6a5c7, 0x22b65633, 0xd0ddd530,
+    0x417b1db, 0xf67c32d8, 0xe52cc12c, 0x1747422f,
+    0x49547e0b, 0xbb3ffd08, 0xa86f0efc, 0x5a048dff,
+    0x8ecee914, 0x7ca56a17, 0x6ff599e3, 0x9d9e1ae0,
+    0xd3d3e1ab, 0x21b862a8, 0x32e8915c, 0xc083125f,
+    0x144976b4, 0xe622f5b7, 0xf5720643, 0x7198540,
+    0x590ab964, 0xab613a67, 0xb831c993, 0x4a5a4a90,
+    0x9e902e7b, 0x6cfbad78, 0x7fab5e8c, 0x8dc0dd8f,
+    0xe330a81a, 0x115b2b19, 0x20bd8ed, 0xf0605bee,
+    0x24aa3f05, 0xd6c1bc06, 0xc5914ff2, 0x37faccf1,
+    0x69e9f0d5, 0x9b8273d6, 0x88d28022, 0x7ab90321,
+    0xae7367ca, 0x5c18e4c9, 0x4f48173d, 0xbd23943e,
+    0xf36e6f75, 0x105ec76, 0x12551f82, 0xe03e9c81,
+    0x34f4f86a, 0xc69f7b69, 0xd5cf889d, 0x27a40b9e,
+    0x79b737ba, 0x8bdcb4b9, 0x988c474d, 0x6ae7c44e,
+    0xbe2da0a5, 0x4c4623a6, 0x5f16d052, 0xad7d5351,
+  },
+  {
+    0, 0x13a29877, 0x274530ee, 0x34e7a899,
+    0x4e8a61dc, 0x5d28f9ab, 0x69cf5132, 0x7a6dc945,
+    0x9d14c3b8, 0x8eb65bcf, 0xba51f356, 0xa9f36b21,
+    0xd39ea264, 0xc03c3a13, 0xf4db928a, 0xe7790afd,
+    0x3fc5f181, 0x2c6769f6, 0x1880c16f, 0xb225918,
+    0x714f905d, 0x62ed082a, 0x560aa0b3, 0x45a838c4,
+    0xa2d13239, 0xb173aa4e, 0x859402d7, 0x96369aa0,
+    0xec5b53e5, 0xfff9cb92, 0xcb1e630b, 0xd8bcfb7c,
+    0x7f8be302, 0x6c297b75, 0x58ced3ec, 0x4b6c4b9b,
+    0x310182de, 0x22a31aa9, 0x1644b230, 0x5e62a47,
+    0xe29f20ba, 0xf13db8cd, 0xc5da1054, 0xd6788823,
+    0xac154166, 0xbfb7d911, 0x8b507188, 0x98f2e9ff,
+    0x404e1283, 0x53ec8af4, 0x670b226d, 0x74a9ba1a,
+    0xec4735f, 0x1d66eb28, 0x298143b1, 0x3a23dbc6,
+    0xdd5ad13b, 0xcef8494c, 0xfa1fe1d5, 0xe9bd79a2,
+    0x93d0b0e7, 0x80722890, 0xb4958009, 0xa737187e,
+    0xff17c604, 0xecb55e73, 0xd852f6ea, 0xcbf06e9d,
+    0xb19da7d8, 0xa23f3faf, 0x96d89736, 0x857a0f41,
+    0x620305bc, 0x71a19dcb, 0x45463552, 0x56e4ad25,
+    0x2c896460, 0x3f2bfc17, 0xbcc548e, 0x186eccf9,
+    0xc0d23785, 0xd370aff2, 0xe797076b, 0xf4359f1c,
+    0x8e585659, 0x9dface2e, 0xa91d66b7, 0xbabffec0,
+    0x5dc6f43d, 0x4e646c4a, 0x7a83c4d3, 0x69215ca4,
+    0x134c95e1, 0xee0d96, 0x3409a50f, 0x27ab3d78,
+    0x809c2506, 0x933ebd71, 0xa7d915e8, 0xb47b8d9f,
+    0xce1644da, 0xddb4dcad, 0xe9537434, 0xfaf1ec43,
+    0x1d88e6be, 0xe2a7ec9, 0x3acdd650, 0x296f4e27,
+    0x53028762, 0x40a01f15, 0x7447b78c, 0x67e52ffb,
+    0xbf59d487, 0xacfb4cf0, 0x981ce469, 0x8bbe7c1e,
+    0xf1d3b55b, 0xe2712d2c, 0xd69685b5, 0xc5341dc2,
+    0x224d173f, 0x31ef8f48, 0x50827d1, 0x16aabfa6,
+    0x6cc776e3, 0x7f65ee94, 0x4b82460d, 0x5820de7a,
+    0xfbc3faf9, 0xe861628e, 0xdc86ca17, 0xcf245260,
+    0xb5499b25, 0xa6eb0352, 0x920cabcb, 0x81ae33bc,
+    0x66d73941, 0x7575a136, 0x419209af, 0x523091d8,
+    0x285d589d, 0x3bffc0ea, 0xf186873, 0x1cbaf004,
+    0xc4060b78, 0xd7a4930f, 0xe3433b96, 0xf0e1a3e1,
+    0x8a8c6aa4, 0x992ef2d3, 0xadc95a4a, 0xbe6bc23d,
+    0x5912c8c0, 0x4ab050b7, 0x7e57f82e, 0x6df56059,
+    0x1798a91c, 0x43a316b, 0x30dd99f2, 0x237f0185,
+    0x844819fb, 0x97ea818c, 0xa30d2915, 0xb0afb162,
+    0xcac27827, 0xd960e050, 0xed8748c9, 0xfe25d0be,
+    0x195cda43, 0xafe4234, 0x3e19eaad, 0x2dbb72da,
+    0x57d6bb9f, 0x447423e8, 0x70938b71, 0x63311306,
+    0xbb8de87a, 0xa82f700d, 0x9cc8d894, 0x8f6a40e3,
+    0xf50789a6, 0xe6a511d1, 0xd242b948, 0xc1e0213f,
+    0x26992bc2, 0x353bb3b5, 0x1dc1b2c, 0x127e835b,
+    0x68134a1e, 0x7bb1d269, 0x4f567af0, 0x5cf4e287,
+    0x4d43cfd, 0x1776a48a, 0x23910c13, 0x30339464,
+    0x4a5e5d21, 0x59fcc556, 0x6d1b6dcf, 0x7eb9f5b8,
+    0x99c0ff45, 0x8a626732, 0xbe85cfab, 0xad2757dc,
+    0xd74a9e99, 0xc4e806ee, 0xf00fae77, 0xe3ad3600,
+    0x3b11cd7c, 0x28b3550b, 0x1c54fd92, 0xff665e5,
+    0x759baca0, 0x663934d7, 0x52de9c4e, 0x417c0439,
+    0xa6050ec4, 0xb5a796b3, 0x81403e2a, 0x92e2a65d,
+    0xe88f6f18, 0xfb2df76f, 0xcfca5ff6, 0xdc68c781,
+    0x7b5fdfff, 0x68fd4788, 0x5c1aef11, 0x4fb87766,
+    0x35d5be23, 0x26772654, 0x12908ecd, 0x13216ba,
+    0xe64b1c47, 0xf5e98430, 0xc10e2ca9, 0xd2acb4de,
+    0xa8c17d9b, 0xbb63e5ec, 0x8f844d75, 0x9c26d502,
+    0x449a2e7e, 0x5738b609, 0x63df1e90, 0x707d86e7,
+    0xa104fa2, 0x19b2d7d5, 0x2d557f4c, 0x3ef7e73b,
+    0xd98eedc6, 0xca2c75b1, 0xfecbdd28, 0xed69455f,
+    0x97048c1a, 0x84a6146d, 0xb041bcf4, 0xa3e32483,
+  },
+  {
+    0, 0xa541927e, 0x4f6f520d, 0xea2ec073,
+    0x9edea41a, 0x3b9f3664, 0xd1b1f617, 0x74f06469,
+    0x38513ec5, 0x9d10acbb, 0x773e6cc8, 0xd27ffeb6,
+    0xa68f9adf, 0x3ce08a1, 0xe9e0c8d2, 0x4ca15aac,
+    0x70a27d8a, 0xd5e3eff4, 0x3fcd2f87, 0x9a8cbdf9,
+    0xee7cd990, 0x4b3d4bee, 0xa1138b9d, 0x45219e3,
+    0x48f3434f, 0xedb2d131, 0x79c1142, 0xa2dd833c,
+    0xd62de755, 0x736c752b, 0x9942b558, 0x3c032726,
+    0xe144fb14, 0x4405696a, 0xae2ba919, 0xb6a3b67,
+    0x7f9a5f0e, 0xdadbcd70, 0x30f50d03, 0x95b49f7d,
+    0xd915c5d1, 0x7c5457af, 0x967a97dc, 0x333b05a2,
+    0x47cb61cb, 0xe28af3b5, 0x8a433c6, 0xade5a1b8,
+    0x91e6869e, 0x34a714e0, 0xde89d493, 0x7bc846ed,
+    0xf382284, 0xaa79b0fa, 0x40577089, 0xe516e2f7,
+    0xa9b7b85b, 0xcf62a25, 0xe6d8ea56, 0x43997828,
+    0x37691c41, 0x92288e3f, 0x78064e4c, 0xdd47dc32,
+    0xc76580d9, 0x622412a7, 0x880ad2d4, 0x2d4b40aa,
+    0x59bb24c3, 0xfcfab6bd, 0x16d476ce, 0xb395e4b0,
+    0xff34be1c, 0x5a752c62, 0xb05bec11, 0x151a7e6f,
+    0x61ea1a06, 0xc4ab8878, 0x2e85480b, 0x8bc4da75,
+    0xb7c7fd53, 0x12866f2d, 0xf8a8af5e, 0x5de93d20,
+    0x29195949, 0x8c58cb37, 0x66760b44, 0xc337993a,
+    0x8f96c396, 0x2ad751e8, 0xc0f9919b, 0x65b803e5,
+    0x1148678c, 0xb409f5f2, 0x5e273581, 0xfb66a7ff,
+    0x26217bcd, 0x8360e9b3, 0x694e29c0, 0xcc0fbbbe,
+    0xb8ffdfd7, 0x1dbe4da9, 0xf7908dda, 0x52d11fa4,
+    0x1e704508, 0xbb31d776, 0x511f1705, 0xf45e857b,
+    0x80aee112, 0x25ef736c, 0xcfc1b31f, 0x6a802161,
+    0x56830647, 0xf3c29439, 0x19ec544a, 0xbcadc634,
+    0xc85da25d, 0x6d1c3023, 0x8732f050, 0x2273622e,
+    0x6ed23882, 0xcb93aafc, 0x21bd6a8f, 0x84fcf8f1,
+    0xf00c9c98, 0x554d0ee6, 0xbf63ce95, 0x1a225ceb,
+    0x8b277743, 0x2e66e53d, 0xc448254e, 0x6109b730,
+    0x15f9d359, 0xb0b84127, 0x5a968154, 0xffd7132a,
+    0xb3764986, 0x1637dbf8, 0xfc191b8b, 0x595889f5,
+    0x2da8ed9c, 0x88e97fe2, 0x62c7bf91, 0xc7862def,
+    0xfb850ac9, 0x5ec498b7, 0xb4ea58c4, 0x11abcaba,
+    0x655baed3, 0xc01a3cad, 0x2a34fcde, 0x8f756ea0,
+    0xc3d4340c, 0x6695a672, 0x8cbb6601, 0x29faf47f,
+    0x5d0a9016, 0xf84b0268, 0x1265c21b, 0xb7245065,
+    0x6a638c57, 0xcf221e29, 0x250cde5a, 0x804d4c24,
+    0xf4bd284d, 0x51fcba33, 0xbbd27a40, 0x1e93e83e,
+    0x5232b292, 0xf77320ec, 0x1d5de09f, 0xb81c72e1,
+    0xccec1688, 0x69ad84f6, 0x83834485, 0x26c2d6fb,
+    0x1ac1f1dd, 0xbf8063a3, 0x55aea3d0, 0xf0ef31ae,
+    0x841f55c7, 0x215ec7b9, 0xcb7007ca, 0x6e3195b4,
+    0x2290cf18, 0x87d15d66, 0x6dff9d15, 0xc8be0f6b,
+    0xbc4e6b02, 0x190ff97c, 0xf321390f, 0x5660ab71,
+    0x4c42f79a, 0xe90365e4, 0x32da597, 0xa66c37e9,
+    0xd29c5380, 0x77ddc1fe, 0x9df3018d, 0x38b293f3,
+    0x7413c95f, 0xd1525b21, 0x3b7c9b52, 0x9e3d092c,
+    0xeacd6d45, 0x4f8cff3b, 0xa5a23f48, 0xe3ad36,
+    0x3ce08a10, 0x99a1186e, 0x738fd81d, 0xd6ce4a63,
+    0xa23e2e0a, 0x77fbc74, 0xed517c07, 0x4810ee79,
+    0x4b1b4d5, 0xa1f026ab, 0x4bdee6d8, 0xee9f74a6,
+    0x9a6f10cf, 0x3f2e82b1, 0xd50042c2, 0x7041d0bc,
+    0xad060c8e, 0x8479ef0, 0xe2695e83, 0x4728ccfd,
+    0x33d8a894, 0x96993aea, 0x7cb7fa99, 0xd9f668e7,
+    0x9557324b, 0x3016a035, 0xda386046, 0x7f79f238,
+    0xb899651, 0xaec8042f, 0x44e6c45c, 0xe1a75622,
+    0xdda47104, 0x78e5e37a, 0x92cb2309, 0x378ab177,
+    0x437ad51e, 0xe63b4760, 0xc158713, 0xa954156d,
+    0xe5f54fc1, 0x40b4ddbf, 0xaa9a1dcc, 0xfdb8fb2,
+    0x7b2bebdb, 0xde6a79a5, 0x3444b9d6, 0x91052ba8,
+  },
+  {
+    0, 0xdd45aab8, 0xbf672381, 0x62228939,
+    0x7b2231f3, 0xa6679b4b, 0xc4451272, 0x1900b8ca,
+    0xf64463e6, 0x2b01c95e, 0x49234067, 0x9466eadf,
+    0x8d665215, 0x5023f8ad, 0x32017194, 0xef44db2c,
+    0xe964b13d, 0x34211b85, 0x560392bc, 0x8b463804,
+    0x924680ce, 0x4f032a76, 0x2d21a34f, 0xf06409f7,
+    0x1f20d2db, 0xc2657863, 0xa047f15a, 0x7d025be2,
+    0x6402e328, 0xb9474990, 0xdb65c0a9, 0x6206a11,
+    0xd725148b, 0xa60be33, 0x6842370a, 0xb5079db2,
+    0xac072578, 0x71428fc0, 0x136006f9, 0xce25ac41,
+    0x2161776d, 0xfc24ddd5, 0x9e0654ec, 0x4343fe54,
+    0x5a43469e, 0x8706ec26, 0xe524651f, 0x3861cfa7,
+    0x3e41a5b6, 0xe3040f0e, 0x81268637, 0x5c632c8f,
+    0x45639445, 0x98263efd, 0xfa04b7c4, 0x27411d7c,
+    0xc805c650, 0x15406ce8, 0x7762e5d1, 0xaa274f69,
+    0xb327f7a3, 0x6e625d1b, 0xc40d422, 0xd1057e9a,
+    0xaba65fe7, 0x76e3f55f, 0x14c17c66, 0xc984d6de,
+    0xd0846e14, 0xdc1c4ac, 0x6fe34d95, 0xb2a6e72d,
+    0x5de23c01, 0x80a796b9, 0xe2851f80, 0x3fc0b538,
+    0x26c00df2, 0xfb85a74a, 0x99a72e73, 0x44e284cb,
+    0x42c2eeda, 0x9f874462, 0xfda5cd5b, 0x20e067e3,
+    0x39e0df29, 0xe4a57591, 0x8687fca8, 0x5bc25610,
+    0xb4868d3c, 0x69c32784, 0xbe1aebd, 0xd6a40405,
+    0xcfa4bccf, 0x12e11677, 0x70c39f4e, 0xad8635f6,
+    0x7c834b6c, 0xa1c6e1d4, 0xc3e468ed, 0x1ea1c255,
+    0x7a17a9f, 0xdae4d027, 0xb8c6591e, 0x6583f3a6,
+    0x8ac7288a, 0x57828232, 0x35a00b0b, 0xe8e5a1b3,
+    0xf1e51979, 0x2ca0b3c1, 0x4e823af8, 0x93c79040,
+    0x95e7fa51, 0x48a250e9, 0x2a80d9d0, 0xf7c57368,
+    0xeec5cba2, 0x3380611a, 0x51a2e823, 0x8ce7429b,
+    0x63a399b7, 0xbee6330f, 0xdcc4ba36, 0x181108e,
+    0x1881a844, 0xc5c402fc, 0xa7e68bc5, 0x7aa3217d,
+    0x52a0c93f, 0x8fe56387, 0xedc7eabe, 0x30824006,
+    0x2982f8cc, 0xf4c75274, 0x96e5db4d, 0x4ba071f5,
+    0xa4e4aad9, 0x79a10061, 0x1b838958, 0xc6c623e0,
+    0xdfc69b2a, 0x2833192, 0x60a1b8ab, 0xbde41213,
+    0xbbc47802, 0x6681d2ba, 0x4a35b83, 0xd9e6f13b,
+    0xc0e649f1, 0x1da3e349, 0x7f816a70, 0xa2c4c0c8,
+    0x4d801be4, 0x90c5b15c, 0xf2e73865, 0x2fa292dd,
+    0x36a22a17, 0xebe780af, 0x89c50996, 0x5480a32e,
+    0x8585ddb4, 0x58c0770c, 0x3ae2fe35, 0xe7a7548d,
+    0xfea7ec47, 0x23e246ff, 0x41c0cfc6, 0x9c85657e,
+    0x73c1be52, 0xae8414ea, 0xcca69dd3, 0x11e3376b,
+    0x8e38fa1, 0xd5a62519, 0xb784ac20, 0x6ac10698,
+    0x6ce16c89, 0xb1a4c631, 0xd3864f08, 0xec3e5b0,
+    0x17c35d7a, 0xca86f7c2, 0xa8a47efb, 0x75e1d443,
+    0x9aa50f6f, 0x47e0a5d7, 0x25c22cee, 0xf8878656,
+    0xe1873e9c, 0x3cc29424, 0x5ee01d1d, 0x83a5b7a5,
+    0xf90696d8, 0x24433c60, 0x4661b559, 0x9b241fe1,
+    0x8224a72b, 0x5f610d93, 0x3d4384aa, 0xe0062e12,
+    0xf42f53e, 0xd2075f86, 0xb025d6bf, 0x6d607c07,
+    0x7460c4cd, 0xa9256e75, 0xcb07e74c, 0x16424df4,
+    0x106227e5, 0xcd278d5d, 0xaf050464, 0x7240aedc,
+    0x6b401616, 0xb605bcae, 0xd4273597, 0x9629f2f,
+    0xe6264403, 0x3b63eebb, 0x59416782, 0x8404cd3a,
+    0x9d0475f0, 0x4041df48, 0x22635671, 0xff26fcc9,
+    0x2e238253, 0xf36628eb, 0x9144a1d2, 0x4c010b6a,
+    0x5501b3a0, 0x88441918, 0xea669021, 0x37233a99,
+    0xd867e1b5, 0x5224b0d, 0x6700c234, 0xba45688c,
+    0xa345d046, 0x7e007afe, 0x1c22f3c7, 0xc167597f,
+    0xc747336e, 0x1a0299d6, 0x782010ef, 0xa565ba57,
+    0xbc65029d, 0x6120a825, 0x302211c, 0xde478ba4,
+    0x31035088, 0xec46fa30, 0x8e647309, 0x5321d9b1,
+    0x4a21617b, 0x9764cbc3, 0xf54642fa, 0x2803e842,
+  },
+  {
+    0, 0x38116fac, 0x7022df58, 0x4833b0f4,
+    0xe045beb0, 0xd854d11c, 0x906761e8, 0xa8760e44,
+    0xc5670b91, 0xfd76643d, 0xb545d4c9, 0x8d54bb65,
+    0x2522b521, 0x1d33da8d, 0x55006a79, 0x6d1105d5,
+    0x8f2261d3, 0xb7330e7f, 0xff00be8b, 0xc711d127,
+    0x6f67df63, 0x5776b0cf, 0x1f45003b, 0x27546f97,
+    0x4a456a42, 0x725405ee, 0x3a67b51a, 0x276dab6,
+    0xaa00d4f2, 0x9211bb5e, 0xda220baa, 0xe2336406,
+    0x1ba8b557, 0x23b9dafb, 0x6b8a6a0f, 0x539b05a3,
+    0xfbed0be7, 0xc3fc644b, 0x8bcfd4bf, 0xb3debb13,
+    0xdecfbec6, 0xe6ded16a, 0xaeed619e, 0x96fc0e32,
+    0x3e8a0076, 0x69b6fda, 0x4ea8df2e, 0x76b9b082,
+    0x948ad484, 0xac9bbb28, 0xe4a80bdc, 0xdcb96470,
+    0x74cf6a34, 0x4cde0598, 0x4edb56c, 0x3cfcdac0,
+    0x51eddf15, 0x69fcb0b9, 0x21cf004d, 0x19de6fe1,
+    0xb1a861a5, 0x89b90e09, 0xc18abefd, 0xf99bd151,
+    0x37516aae, 0xf400502, 0x4773b5f6, 0x7f62da5a,
+    0xd714d41e, 0xef05bbb2, 0xa7360b46, 0x9f2764ea,
+    0xf236613f, 0xca270e93, 0x8214be67, 0xba05d1cb,
+    0x1273df8f, 0x2a62b023, 0x625100d7, 0x5a406f7b,
+    0xb8730b7d, 0x806264d1, 0xc851d425, 0xf040bb89,
+    0x5836b5cd, 0x6027da61, 0x28146a95, 0x10050539,
+    0x7d1400ec, 0x45056f40, 0xd36dfb4, 0x3527b018,
+    0x9d51be5c, 0xa540d1f0, 0xed736104, 0xd5620ea8,
+    0x2cf9dff9, 0x14e8b055, 0x5cdb00a1, 0x64ca6f0d,
+    0xccbc6149, 0xf4ad0ee5, 0xbc9ebe11, 0x848fd1bd,
+    0xe99ed468, 0xd18fbbc4, 0x99bc0b30, 0xa1ad649c,
+    0x9db6ad8, 0x31ca0574, 0x79f9b580, 0x41e8da2c,
+    0xa3dbbe2a, 0x9bcad186, 0xd3f96172, 0xebe80ede,
+    0x439e009a, 0x7b8f6f36, 0x33bcdfc2, 0xbadb06e,
+    0x66bcb5bb, 0x5eadda17, 0x169e6ae3, 0x2e8f054f,
+    0x86f90b0b, 0xbee864a7, 0xf6dbd453, 0xcecabbff,
+    0x6ea2d55c, 0x56b3baf0, 0x1e800a04, 0x269165a8,
+    0x8ee76bec, 0xb6f60440, 0xfec5b4b4, 0xc6d4db18,
+    0xabc5decd, 0x93d4b161, 0xdbe70195, 0xe3f66e39,
+    0x4b80607d, 0x73910fd1, 0x3ba2bf25, 0x3b3d089,
+    0xe180b48f, 0xd991db23, 0x91a26bd7, 0xa9b3047b,
+    0x1c50a3f, 0x39d46593, 0x71e7d567, 0x49f6bacb,
+    0x24e7bf1e, 0x1cf6d0b2, 0x54c56046, 0x6cd40fea,
+    0xc4a201ae, 0xfcb36e02, 0xb480def6, 0x8c91b15a,
+    0x750a600b, 0x4d1b0fa7, 0x528bf53, 0x3d39d0ff,
+    0x954fdebb, 0xad5eb117, 0xe56d01e3, 0xdd7c6e4f,
+    0xb06d6b9a, 0x887c0436, 0xc04fb4c2, 0xf85edb6e,
+    0x5028d52a, 0x6839ba86, 0x200a0a72, 0x181b65de,
+    0xfa2801d8, 0xc2396e74, 0x8a0ade80, 0xb21bb12c,
+    0x1a6dbf68, 0x227cd0c4, 0x6a4f6030, 0x525e0f9c,
+    0x3f4f0a49, 0x75e65e5, 0x4f6dd511, 0x777cbabd,
+    0xdf0ab4f9, 0xe71bdb55, 0xaf286ba1, 0x9739040d,
+    0x59f3bff2, 0x61e2d05e, 0x29d160aa, 0x11c00f06,
+    0xb9b60142, 0x81a76eee, 0xc994de1a, 0xf185b1b6,
+    0x9c94b463, 0xa485dbcf, 0xecb66b3b, 0xd4a70497,
+    0x7cd10ad3, 0x44c0657f, 0xcf3d58b, 0x34e2ba27,
+    0xd6d1de21, 0xeec0b18d, 0xa6f30179, 0x9ee26ed5,
+    0x36946091, 0xe850f3d, 0x46b6bfc9, 0x7ea7d065,
+    0x13b6d5b0, 0x2ba7ba1c, 0x63940ae8, 0x5b856544,
+    0xf3f36b00, 0xcbe204ac, 0x83d1b458, 0xbbc0dbf4,
+    0x425b0aa5, 0x7a4a6509, 0x3279d5fd, 0xa68ba51,
+    0xa21eb415, 0x9a0fdbb9, 0xd23c6b4d, 0xea2d04e1,
+    0x873c0134, 0xbf2d6e98, 0xf71ede6c, 0xcf0fb1c0,
+    0x6779bf84, 0x5f68d028, 0x175b60dc, 0x2f4a0f70,
+    0xcd796b76, 0xf56804da, 0xbd5bb42e, 0x854adb82,
+    0x2d3cd5c6, 0x152dba6a, 0x5d1e0a9e, 0x650f6532,
+    0x81e60e7, 0x300f0f4b, 0x783cbfbf, 0x402dd013,
+    0xe85bde57, 0xd04ab1fb, 0x9879010f, 0xa0686ea3,
+  },
+  {
+    0, 0xef306b19, 0xdb8ca0c3, 0x34bccbda,
+    0xb2f53777, 0x5dc55c6e, 0x697997b4, 0x8649fcad,
+    0x6006181f, 0x8f367306, 0xbb8ab8dc, 0x54bad3c5,
+    0xd2f32f68, 0x3dc34471, 0x97f8fab, 0xe64fe4b2,
+    0xc00c303e, 0x2f3c5b27, 0x1b8090fd, 0xf4b0fbe4,
+    0x72f90749, 0x9dc96c50, 0xa975a78a, 0x4645cc93,
+    0xa00a2821, 0x4f3a4338, 0x7b8688e2, 0x94b6e3fb,
+    0x12ff1f56, 0xfdcf744f, 0xc973bf95, 0x2643d48c,
+    0x85f4168d, 0x6ac47d94, 0x5e78b64e, 0xb148dd57,
+    0x370121fa, 0xd8314ae3, 0xec8d8139, 0x3bdea20,
+    0xe5f20e92, 0xac2658b, 0x3e7eae51, 0xd14ec548,
+    0x570739e5, 0xb83752fc, 0x8c8b9926, 0x63bbf23f,
+    0x45f826b3, 0xaac84daa, 0x9e748670, 0x7144ed69,
+    0xf70d11c4, 0x183d7add, 0x2c81b107, 0xc3b1da1e,
+    0x25fe3eac, 0xcace55b5, 0xfe729e6f, 0x1142f576,
+    0x970b09db, 0x783b62c2, 0x4c87a918, 0xa3b7c201,
+    0xe045beb, 0xe13430f2, 0xd588fb28, 0x3ab89031,
+    0xbcf16c9c, 0x53c10785, 0x677dcc5f, 0x884da746,
+    0x6e0243f4, 0x813228ed, 0xb58ee337, 0x5abe882e,
+    0xdcf77483, 0x33c71f9a, 0x77bd440, 0xe84bbf59,
+    0xce086bd5, 0x213800cc, 0x1584cb16, 0xfab4a00f,
+    0x7cfd5ca2, 0x93cd37bb, 0xa771fc61, 0x48419778,
+    0xae0e73ca, 0x413e18d3, 0x7582d309, 0x9ab2b810,
+    0x1cfb44bd, 0xf3cb2fa4, 0xc777e47e, 0x28478f67,
+    0x8bf04d66, 0x64c0267f, 0x507ceda5, 0xbf4c86bc,
+    0x39057a11, 0xd6351108, 0xe289dad2, 0xdb9b1cb,
+    0xebf65579, 0x4c63e60, 0x307af5ba, 0xdf4a9ea3,
+    0x5903620e, 0xb6330917, 0x828fc2cd, 0x6dbfa9d4,
+    0x4bfc7d58, 0xa4cc1641, 0x9070dd9b, 0x7f40b682,
+    0xf9094a2f, 0x16392136, 0x2285eaec, 0xcdb581f5,
+    0x2bfa6547, 0xc4ca0e5e, 0xf076c584, 0x1f46ae9d,
+    0x990f5230, 0x763f3929, 0x4283f2f3, 0xadb399ea,
+    0x1c08b7d6, 0xf338dccf, 0xc7841715, 0x28b47c0c,
+    0xaefd80a1, 0x41cdebb8, 0x75712062, 0x9a414b7b,
+    0x7c0eafc9, 0x933ec4d0, 0xa7820f0a, 0x48b26413,
+    0xcefb98be, 0x21cbf3a7, 0x1577387d, 0xfa475364,
+    0xdc0487e8, 0x3334ecf1, 0x788272b, 0xe8b84c32,
+    0x6ef1b09f, 0x81c1db86, 0xb57d105c, 0x5a4d7b45,
+    0xbc029ff7, 0x5332f4ee, 0x678e3f34, 0x88be542d,
+    0xef7a880, 0xe1c7c399, 0xd57b0843, 0x3a4b635a,
+    0x99fca15b, 0x76ccca42, 0x42700198, 0xad406a81,
+    0x2b09962c, 0xc439fd35, 0xf08536ef, 0x1fb55df6,
+    0xf9fab944, 0x16cad25d, 0x22761987, 0xcd46729e,
+    0x4b0f8e33, 0xa43fe52a, 0x90832ef0, 0x7fb345e9,
+    0x59f09165, 0xb6c0fa7c, 0x827c31a6, 0x6d4c5abf,
+    0xeb05a612, 0x435cd0b, 0x308906d1, 0xdfb96dc8,
+    0x39f6897a, 0xd6c6e263, 0xe27a29b9, 0xd4a42a0,
+    0x8b03be0d, 0x6433d514, 0x508f1ece, 0xbfbf75d7,
+    0x120cec3d, 0xfd3c8724, 0xc9804cfe, 0x26b027e7,
+    0xa0f9db4a, 0x4fc9b053, 0x7b757b89, 0x94451090,
+    0x720af422, 0x9d3a9f3b, 0xa98654e1, 0x46b63ff8,
+    0xc0ffc355, 0x2fcfa84c, 0x1b736396, 0xf443088f,
+    0xd200dc03, 0x3d30b71a, 0x98c7cc0, 0xe6bc17d9,
+    0x60f5eb74, 0x8fc5806d, 0xbb794bb7, 0x544920ae,
+    0xb206c41c, 0x5d36af05, 0x698a64df, 0x86ba0fc6,
+    0xf3f36b, 0xefc39872, 0xdb7f53a8, 0x344f38b1,
+    0x97f8fab0, 0x78c891a9, 0x4c745a73, 0xa344316a,
+    0x250dcdc7, 0xca3da6de, 0xfe816d04, 0x11b1061d,
+    0xf7fee2af, 0x18ce89b6, 0x2c72426c, 0xc3422975,
+    0x450bd5d8, 0xaa3bbec1, 0x9e87751b, 0x71b71e02,
+    0x57f4ca8e, 0xb8c4a197, 0x8c786a4d, 0x63480154,
+    0xe501fdf9, 0xa3196e0, 0x3e8d5d3a, 0xd1bd3623,
+    0x37f2d291, 0xd8c2b988, 0xec7e7252, 0x34e194b,
+    0x8507e5e6, 0x6a378eff, 0x5e8b4525, 0xb1bb2e3c,
+  },
+  {
+    0, 0x68032cc8, 0xd0065990, 0xb8057558,
+    0xa5e0c5d1, 0xcde3e919, 0x75e69c41, 0x1de5b089,
+    0x4e2dfd53, 0x262ed19b, 0x9e2ba4c3, 0xf628880b,
+    0xebcd3882, 0x83ce144a, 0x3bcb6112, 0x53c84dda,
+    0x9c5bfaa6, 0xf458d66e, 0x4c5da336, 0x245e8ffe,
+    0x39bb3f77, 0x51b813bf, 0xe9bd66e7, 0x81be4a2f,
+    0xd27607f5, 0xba752b3d, 0x2705e65, 0x6a7372ad,
+    0x7796c224, 0x1f95eeec, 0xa7909bb4, 0xcf93b77c,
+    0x3d5b83bd, 0x5558af75, 0xed5dda2d, 0x855ef6e5,
+    0x98bb466c, 0xf0b86aa4, 0x48bd1ffc, 0x20be3334,
+    0x73767eee, 0x1b755226, 0xa370277e, 0xcb730bb6,
+    0xd696bb3f, 0xbe9597f7, 0x690e2af, 0x6e93ce67,
+    0xa100791b, 0xc90355d3, 0x7106208b, 0x19050c43,
+    0x4e0bcca, 0x6ce39002, 0xd4e6e55a, 0xbce5c992,
+    0xef2d8448, 0x872ea880, 0x3f2bddd8, 0x5728f110,
+    0x4acd4199, 0x22ce6d51, 0x9acb1809, 0xf2c834c1,
+    0x7ab7077a, 0x12b42bb2, 0xaab15eea, 0xc2b27222,
+    0xdf57c2ab, 0xb754ee63, 0xf519b3b, 0x6752b7f3,
+    0x349afa29, 0x5c99d6e1, 0xe49ca3b9, 0x8c9f8f71,
+    0x917a3ff8, 0xf9791330, 0x417c6668, 0x297f4aa0,
+    0xe6ecfddc, 0x8eefd114, 0x36eaa44c, 0x5ee98884,
+    0x430c380d, 0x2b0f14c5, 0x930a619d, 0xfb094d55,
+    0xa8c1008f, 0xc0c22c47, 0x78c7591f, 0x10c475d7,
+    0xd21c55e, 0x6522e996, 0xdd279cce, 0xb524b006,
+    0x47ec84c7, 0x2fefa80f, 0x97eadd57, 0xffe9f19f,
+    0xe20c4116, 0x8a0f6dde, 0x320a1886, 0x5a09344e,
+    0x9c17994, 0x61c2555c, 0xd9c72004, 0xb1c40ccc,
+    0xac21bc45, 0xc422908d, 0x7c27e5d5, 0x1424c91d,
+    0xdbb77e61, 0xb3b452a9, 0xbb127f1, 0x63b20b39,
+    0x7e57bbb0, 0x16549778, 0xae51e220, 0xc652cee8,
+    0x959a8332, 0xfd99affa, 0x459cdaa2, 0x2d9ff66a,
+    0x307a46e3, 0x58796a2b, 0xe07c1f73, 0x887f33bb,
+    0xf56e0ef4, 0x9d6d223c, 0x25685764, 0x4d6b7bac,
+    0x508ecb25, 0x388de7ed, 0x808892b5, 0xe88bbe7d,
+    0xbb43f3a7, 0xd340df6f, 0x6b45aa37, 0x34686ff,
+    0x1ea33676, 0x76a01abe, 0xcea56fe6, 0xa6a6432e,
+    0x6935f452, 0x136d89a, 0xb933adc2, 0xd130810a,
+    0xccd53183, 0xa4d61d4b, 0x1cd36813, 0x74d044db,
+    0x27180901, 0x4f1b25c9, 0xf71e5091, 0x9f1d7c59,
+    0x82f8ccd0, 0xeafbe018, 0x52fe9540, 0x3afdb988,
+    0xc8358d49, 0xa036a181, 0x1833d4d9, 0x7030f811,
+    0x6dd54898, 0x5d66450, 0xbdd31108, 0xd5d03dc0,
+    0x8618701a, 0xee1b5cd2, 0x561e298a, 0x3e1d0542,
+    0x23f8b5cb, 0x4bfb9903, 0xf3feec5b, 0x9bfdc093,
+    0x546e77ef, 0x3c6d5b27, 0x84682e7f, 0xec6b02b7,
+    0xf18eb23e, 0x998d9ef6, 0x2188ebae, 0x498bc766,
+    0x1a438abc, 0x7240a674, 0xca45d32c, 0xa246ffe4,
+    0xbfa34f6d, 0xd7a063a5, 0x6fa516fd, 0x7a63a35,
+    0x8fd9098e, 0xe7da2546, 0x5fdf501e, 0x37dc7cd6,
+    0x2a39cc5f, 0x423ae097, 0xfa3f95cf, 0x923cb907,
+    0xc1f4f4dd, 0xa9f7d815, 0x11f2ad4d, 0x79f18185,
+    0x6414310c, 0xc171dc4, 0xb412689c, 0xdc114454,
+    0x1382f328, 0x7b81dfe0, 0xc384aab8, 0xab878670,
+    0xb66236f9, 0xde611a31, 0x66646f69, 0xe6743a1,
+    0x5daf0e7b, 0x35ac22b3, 0x8da957eb, 0xe5aa7b23,
+    0xf84fcbaa, 0x904ce762, 0x2849923a, 0x404abef2,
+    0xb2828a33, 0xda81a6fb, 0x6284d3a3, 0xa87ff6b,
+    0x17624fe2, 0x7f61632a, 0xc7641672, 0xaf673aba,
+    0xfcaf7760, 0x94ac5ba8, 0x2ca92ef0, 0x44aa0238,
+    0x594fb2b1, 0x314c9e79, 0x8949eb21, 0xe14ac7e9,
+    0x2ed97095, 0x46da5c5d, 0xfedf2905, 0x96dc05cd,
+    0x8b39b544, 0xe33a998c, 0x5b3fecd4, 0x333cc01c,
+    0x60f48dc6, 0x8f7a10e, 0xb0f2d456, 0xd8f1f89e,
+    0xc5144817, 0xad1764df, 0x15121187, 0x7d113d4f,
+  },
+  {
+    0, 0x493c7d27, 0x9278fa4e, 0xdb448769,
+    0x211d826d, 0x6821ff4a, 0xb3657823, 0xfa590504,
+    0x423b04da, 0xb0779fd, 0xd043fe94, 0x997f83b3,
+    0x632686b7, 0x2a1afb90, 0xf15e7cf9, 0xb86201de,
+    0x847609b4, 0xcd4a7493, 0x160ef3fa, 0x5f328edd,
+    0xa56b8bd9, 0xec57f6fe, 0x37137197, 0x7e2f0cb0,
+    0xc64d0d6e, 0x8f717049, 0x5435f720, 0x1d098a07,
+    0xe7508f03, 0xae6cf224, 0x7528754d, 0x3c14086a,
+    0xd006599, 0x443c18be, 0x9f789fd7, 0xd644e2f0,
+    0x2c1de7f4, 0x65219ad3, 0xbe651dba, 0xf759609d,
+    0x4f3b6143, 0x6071c64, 0xdd439b0d, 0x947fe62a,
+    0x6e26e32e, 0x271a9e09, 0xfc5e1960, 0xb5626447,
+    0x89766c2d, 0xc04a110a, 0x1b0e9663, 0x5232eb44,
+    0xa86bee40, 0xe1579367, 0x3a13140e, 0x732f6929,
+    0xcb4d68f7, 0x827115d0, 0x593592b9, 0x1009ef9e,
+    0xea50ea9a, 0xa36c97bd, 0x782810d4, 0x31146df3,
+    0x1a00cb32, 0x533cb615, 0x8878317c, 0xc1444c5b,
+    0x3b1d495f, 0x72213478, 0xa965b311, 0xe059ce36,
+    0x583bcfe8, 0x1107b2cf, 0xca4335a6, 0x837f4881,
+    0x79264d85, 0x301a30a2, 0xeb5eb7cb, 0xa262caec,
+    0x9e76c286, 0xd74abfa1, 0xc0e38c8, 0x453245ef,
+    0xbf6b40eb, 0xf6573dcc, 0x2d13baa5, 0x642fc782,
+    0xdc4dc65c, 0x9571bb7b, 0x4e353c12, 0x7094135,
+    0xfd504431, 0xb46c3916, 0x6f28be7f, 0x2614c358,
+    0x1700aeab, 0x5e3cd38c, 0x857854e5, 0xcc4429c2,
+    0x361d2cc6, 0x7f2151e1, 0xa465d688, 0xed59abaf,
+    0x553baa71, 0x1c07d756, 0xc743503f, 0x8e7f2d18,
+    0x7426281c, 0x3d1a553b, 0xe65ed252, 0xaf62af75,
+    0x9376a71f, 0xda4ada38, 0x10e5d51, 0x48322076,
+    0xb26b2572, 0xfb575855, 0x2013df3c, 0x692fa21b,
+    0xd14da3c5, 0x9871dee2, 0x4335598b, 0xa0924ac,
+    0xf05021a8, 0xb96c5c8f, 0x6228dbe6, 0x2b14a6c1,
+    0x34019664, 0x7d3deb43, 0xa6796c2a, 0xef45110d,
+    0x151c1409, 0x5c20692e, 0x8764ee47, 0xce589360,
+    0x763a92be, 0x3f06ef99, 0xe44268f0, 0xad7e15d7,
+    0x572710d3, 0x1e1b6df4, 0xc55fea9d, 0x8c6397ba,
+    0xb0779fd0, 0xf94be2f7, 0x220f659e, 0x6b3318b9,
+    0x916a1dbd, 0xd856609a, 0x312e7f3, 0x4a2e9ad4,
+    0xf24c9b0a, 0xbb70e62d, 0x60346144, 0x29081c63,
+    0xd3511967, 0x9a6d6440, 0x4129e329, 0x8159e0e,
+    0x3901f3fd, 0x703d8eda, 0xab7909b3, 0xe2457494,
+    0x181c7190, 0x51200cb7, 0x8a648bde, 0xc358f6f9,
+    0x7b3af727, 0x32068a00, 0xe9420d69, 0xa07e704e,
+    0x5a27754a, 0x131b086d, 0xc85f8f04, 0x8163f223,
+    0xbd77fa49, 0xf44b876e, 0x2f0f0007, 0x66337d20,
+    0x9c6a7824, 0xd5560503, 0xe12826a, 0x472eff4d,
+    0xff4cfe93, 0xb67083b4, 0x6d3404dd, 0x240879fa,
+    0xde517cfe, 0x976d01d9, 0x4c2986b0, 0x515fb97,
+    0x2e015d56, 0x673d2071, 0xbc79a718, 0xf545da3f,
+    0xf1cdf3b, 0x4620a21c, 0x9d642575, 0xd4585852,
+    0x6c3a598c, 0x250624ab, 0xfe42a3c2, 0xb77edee5,
+    0x4d27dbe1, 0x41ba6c6, 0xdf5f21af, 0x96635c88,
+    0xaa7754e2, 0xe34b29c5, 0x380faeac, 0x7133d38b,
+    0x8b6ad68f, 0xc256aba8, 0x19122cc1, 0x502e51e6,
+    0xe84c5038, 0xa1702d1f, 0x7a34aa76, 0x3308d751,
+    0xc951d255, 0x806daf72, 0x5b29281b, 0x1215553c,
+    0x230138cf, 0x6a3d45e8, 0xb179c281, 0xf845bfa6,
+    0x21cbaa2, 0x4b20c785, 0x906440ec, 0xd9583dcb,
+    0x613a3c15, 0x28064132, 0xf342c65b, 0xba7ebb7c,
+    0x4027be78, 0x91bc35f, 0xd25f4436, 0x9b633911,
+    0xa777317b, 0xee4b4c5c, 0x350fcb35, 0x7c33b612,
+    0x866ab316, 0xcf56ce31, 0x14124958, 0x5d2e347f,
+    0xe54c35a1, 0xac704886, 0x7734cfef, 0x3e08b2c8,
+    0xc451b7cc, 0x8d6dcaeb, 0x56294d82, 0x1f1530a5,
+  },
+};
+static const CrcFold crc_cat_f14 = {
+    32, 1, 0x82f63b78,
+    { 0xb9e02b86, 0xdcb17aa4 }, { 0x9e4addf8, 0x740eef02 }, { 0x493c7d27, 0xf20c0dfe },
+    0x493c7d27, 0xa434f61c6f5389f8
+};
+
+/* CRC-64/ECMA-182 */
+static const uint64_t crc_cat_t15[8][256] = {
+  {
+    0, 0x42f0e1eba9ea3693, 0x85e1c3d753d46d26, 0xc711223cfa3e5bb5,
+    0x493366450e42ecdf, 0xbc387aea7a8da4c, 0xccd2a5925d9681f9, 0x8e224479f47cb76a,
+    0x9266cc8a1c85d9be, 0xd0962d61b56fef2d, 0x17870f5d4f51b498, 0x5577eeb6e6bb820b,
+    0xdb55aacf12c73561, 0x99a54b24bb2d03f2, 0x5eb4691841135847, 0x1c4488f3e8f96ed4,
+    0x663d78ff90e185ef, 0x24cd9914390bb37c, 0xe3dcbb28c335e8c9, 0xa12c5ac36adfde5a,
+    0x2f0e1eba9ea36930, 0x6dfeff5137495fa3, 0xaaefdd6dcd770416, 0xe81f3c86649d3285,
+    0xf45bb4758c645c51, 0xb6ab559e258e6ac2, 0x71ba77a2dfb03177, 0x334a9649765a07e4,
+    0xbd68d2308226b08e, 0xff9833db2bcc861d, 0x388911e7d1f2dda8, 0x7a79f00c7818eb3b,
+    0xcc7af1ff21c30bde, 0x8e8a101488293d4d, 0x499b3228721766f8, 0xb6bd3c3dbfd506b,
+    0x854997ba2f81e701, 0xc7b97651866bd192, 0xa8546d7c558a27, 0x4258b586d5bfbcb4,
+    0x5e1c3d753d46d260, 0x1cecdc9e94ace4f3, 0xdbfdfea26e92bf46, 0x990d1f49c77889d5,
+    0x172f5b3033043ebf, 0x55dfbadb9aee082c, 0x92ce98e760d05399, 0xd03e790cc93a650a,
+    0xaa478900b1228e31, 0xe8b768eb18c8b8a2, 0x2fa64ad7e2f6e317, 0x6d56ab3c4b1cd584,
+    0xe374ef45bf6062ee, 0xa1840eae168a547d, 0x66952c92ecb40fc8, 0x2465cd79455e395b,
+    0x3821458aada7578f, 0x7ad1a461044d611c, 0xbdc0865dfe733aa9, 0xff3067b657990c3a,
+    0x711223cfa3e5bb50, 0x33e2c2240a0f8dc3, 0xf4f3e018f031d676, 0xb60301f359dbe0e5,
+    0xda050215ea6c212f, 0x98f5e3fe438617bc, 0x5fe4c1c2b9b84c09, 0x1d14202910527a9a,
+    0x93366450e42ecdf0, 0xd1c685bb4dc4fb63, 0x16d7a787b7faa0d6, 0x5427466c1e109645,
+    0x4863ce9ff6e9f891, 0xa932f745f03ce02, 0xcd820d48a53d95b7, 0x8f72eca30cd7a324,
+    0x150a8daf8ab144e, 0x43a04931514122dd, 0x84b16b0dab7f7968, 0xc6418ae602954ffb,
+    0xbc387aea7a8da4c0, 0xfec89b01d3679253, 0x39d9b93d2959c9e6, 0x7b2958d680b3ff75,
+    0xf50b1caf74cf481f, 0xb7fbfd44dd257e8c, 0x70eadf78271b2539, 0x321a3e938ef113aa,
+    0x2e5eb66066087d7e, 0x6cae578bcfe24bed, 0xabbf75b735dc1058, 0xe94f945c9c3626cb,
+    0x676dd025684a91a1, 0x259d31cec1a0a732, 0xe28c13f23b9efc87, 0xa07cf2199274ca14,
+    0x167ff3eacbaf2af1, 0x548f120162451c62, 0x939e303d987b47d7, 0xd16ed1d631917144,
+    0x5f4c95afc5edc62e, 0x1dbc74446c07f0bd, 0xdaad56789639ab08, 0x985db7933fd39d9b,
+    0x84193f60d72af34f, 0xc6e9de8b7ec0c5dc, 0x1f8fcb784fe9e69, 0x43081d5c2d14a8fa,
+    0xcd2a5925d9681f90, 0x8fdab8ce70822903, 0x48cb9af28abc72b6, 0xa3b7b1923564425,
+    0x70428b155b4eaf1e, 0x32b26afef2a4998d, 0xf5a348c2089ac238, 0xb753a929a170f4ab,
+    0x3971ed50550c43c1, 0x7b810cbbfce67552, 0xbc902e8706d82ee7, 0xfe60cf6caf321874,
+    0xe224479f47cb76a0, 0xa0d4a674ee214033, 0x67c58448141f1b86, 0x253565a3bdf52d15,
+    0xab1721da49899a7f, 0xe9e7c031e063acec, 0x2ef6e20d1a5df759, 0x6c0603e6b3b7c1ca,
+    0xf6fae5c07d3274cd, 0xb40a042bd4d8425e, 0x731b26172ee619eb, 0x31ebc7fc870c2f78,
+    0xbfc9838573709812, 0xfd39626eda9aae81, 0x3a28405220a4f534, 0x78d8a1b9894ec3a7,
+    0x649c294a61b7ad73, 0x266cc8a1c85d9be0, 0xe17dea9d3263c055, 0xa38d0b769b89f6c6,
+    0x2daf4f0f6ff541ac, 0x6f5faee4c61f773f, 0xa84e8cd83c212c8a, 0xeabe6d3395cb1a19,
+    0x90c79d3fedd3f122, 0xd2377cd44439c7b1, 0x15265ee8be079c04, 0x57d6bf0317edaa97,
+    0xd9f4fb7ae3911dfd, 0x9b041a914a7b2b6e, 0x5c1538adb04570db, 0x1ee5d94619af4648,
+    0x2a151b5f156289c, 0x4051b05e58bc1e0f, 0x87409262a28245ba, 0xc5b073890b687329,
+    0x4b9237f0ff14c443, 0x962d61b56fef2d0, 0xce73f427acc0a965, 0x8c8315cc052a9ff6,
+    0x3a80143f5cf17f13, 0x7870f5d4f51b4980, 0xbf61d7e80f251235, 0xfd913603a6cf24a6,
+    0x73b3727a52b393cc, 0x31439391fb59a55f, 0xf652b1ad0167feea, 0xb4a25046a88dc879,
+    0xa8e6d8b54074a6ad, 0xea16395ee99e903e, 0x2d071b6213a0cb8b, 0x6ff7fa89ba4afd18,
+    0xe1d5bef04e364a72, 0xa3255f1be7dc7ce1, 0x64347d271de22754, 0x26c49cccb40811c7,
+    0x5cbd6cc0cc10fafc, 0x1e4d8d2b65facc6f, 0xd95caf179fc497da, 0x9bac4efc362ea149,
+    0x158e0a85c2521623, 0x577eeb6e6bb820b0, 0x906fc95291867b05, 0xd29f28b9386c4d96,
+    0xcedba04ad0952342, 0x8c2b41a1797f15d1, 0x4b3a639d83414e64, 0x9ca82762aab78f7,
+    0x87e8c60fded7cf9d, 0xc51827e4773df90e, 0x20905d88d03a2bb, 0x40f9e43324e99428,
+    0x2cffe7d5975e55e2, 0x6e0f063e3eb46371, 0xa91e2402c48a38c4, 0xebeec5e96d600e57,
+    0x65cc8190991cb93d, 0x273c607b30f68fae, 0xe02d4247cac8d41b, 0xa2dda3ac6322e288,
+    0xbe992b5f8bdb8c5c, 0xfc69cab42231bacf, 0x3b78e888d80fe17a, 0x7988096371e5d7e9,
+    0xf7aa4d1a85996083, 0xb55aacf12c735610, 0x724b8ecdd64d0da5, 0x30bb6f267fa73b36,
+    0x4ac29f2a07bfd00d, 0x8327ec1ae55e69e, 0xcf235cfd546bbd2b, 0x8dd3bd16fd818bb8,
+    0x3f1f96f09fd3cd2, 0x41011884a0170a41, 0x86103ab85a2951f4, 0xc4e0db53f3c36767,
+    0xd8a453a01b3a09b3, 0x9a54b24bb2d03f20, 0x5d45907748ee6495, 0x1fb5719ce1045206,
+    0x919735e51578e56c, 0xd367d40ebc92d3ff, 0x1476f63246ac884a, 0x568617d9ef46bed9,
+    0xe085162ab69d5e3c, 0xa275f7c11f7768af, 0x6564d5fde549331a, 0x279434164ca30589,
+    0xa9b6706fb8dfb2e3, 0xeb46918411358470, 0x2c57b3b8eb0bdfc5, 0x6ea7525342e1e956,
+    0x72e3daa0aa188782, 0x30133b4b03f2b111, 0xf7021977f9cceaa4, 0xb5f2f89c5026dc37,
+    0x3bd0bce5a45a6b5d, 0x79205d0e0db05dce, 0xbe317f32f78e067b, 0xfcc19ed95e6430e8,
+    0x86b86ed5267cdbd3, 0xc4488f3e8f96ed40, 0x359ad0275a8b6f5, 0x41a94ce9dc428066,
+    0xcf8b0890283e370c, 0x8d7be97b81d4019f, 0x4a6acb477bea5a2a, 0x89a2aacd2006cb9,
+    0x14dea25f3af9026d, 0x562e43b4931334fe, 0x913f6188692d6f4b, 0xd3cf8063c0c759d8,
+    0x5dedc41a34bbeeb2, 0x1f1d25f19d51d821, 0xd80c07cd676f8394, 0x9afce626ce85b507,
+  },
+  {
+    0, 0xaf052a6b538edf09, 0x1cfab53d0ef78881, 0xb3ff9f565d795788,
+    0x39f56a7a1def1102, 0x96f040114e61ce0b, 0x250fdf4713189983, 0x8a0af52c4096468a,
+    0x73ead4f43bde2204, 0xdceffe9f6850fd0d, 0x6f1061c93529aa85, 0xc0154ba266a7758c,
+    0x4a1fbe8e26313306, 0xe51a94e575bfec0f, 0x56e50bb328c6bb87, 0xf9e021d87b48648e,
+    0xe7d5a9e877bc4408, 0x48d0838324329b01, 0xfb2f1cd5794bcc89, 0x542a36be2ac51380,
+    0xde20c3926a53550a, 0x7125e9f939dd8a03, 0xc2da76af64a4dd8b, 0x6ddf5cc4372a0282,
+    0x943f7d1c4c62660c, 0x3b3a57771fecb905, 0x88c5c8214295ee8d, 0x27c0e24a111b3184,
+    0xadca1766518d770e, 0x2cf3d0d0203a807, 0xb130a25b5f7aff8f, 0x1e3588300cf42086,
+    0x8d5bb23b4692be83, 0x225e9850151c618a, 0x91a1070648653602, 0x3ea42d6d1bebe90b,
+    0xb4aed8415b7daf81, 0x1babf22a08f37088, 0xa8546d7c558a2700, 0x75147170604f809,
+    0xfeb166cf7d4c9c87, 0x51b44ca42ec2438e, 0xe24bd3f273bb1406, 0x4d4ef9992035cb0f,
+    0xc7440cb560a38d85, 0x684126de332d528c, 0xdbbeb9886e540504, 0x74bb93e33ddada0d,
+    0x6a8e1bd3312efa8b, 0xc58b31b862a02582, 0x7674aeee3fd9720a, 0xd97184856c57ad03,
+    0x537b71a92cc1eb89, 0xfc7e5bc27f4f3480, 0x4f81c49422366308, 0xe084eeff71b8bc01,
+    0x1964cf270af0d88f, 0xb661e54c597e0786, 0x59e7a1a0407500e, 0xaa9b507157898f07,
+    0x2091a55d171fc98d, 0x8f948f3644911684, 0x3c6b106019e8410c, 0x936e3a0b4a669e05,
+    0x5847859d24cf4b95, 0xf742aff67741949c, 0x44bd30a02a38c314, 0xebb81acb79b61c1d,
+    0x61b2efe739205a97, 0xceb7c58c6aae859e, 0x7d485ada37d7d216, 0xd24d70b164590d1f,
+    0x2bad51691f116991, 0x84a87b024c9fb698, 0x3757e45411e6e110, 0x9852ce3f42683e19,
+    0x12583b1302fe7893, 0xbd5d11785170a79a, 0xea28e2e0c09f012, 0xa1a7a4455f872f1b,
+    0xbf922c7553730f9d, 0x1097061e00fdd094, 0xa36899485d84871c, 0xc6db3230e0a5815,
+    0x8667460f4e9c1e9f, 0x29626c641d12c196, 0x9a9df332406b961e, 0x3598d95913e54917,
+    0xcc78f88168ad2d99, 0x637dd2ea3b23f290, 0xd0824dbc665aa518, 0x7f8767d735d47a11,
+    0xf58d92fb75423c9b, 0x5a88b89026cce392, 0xe97727c67bb5b41a, 0x46720dad283b6b13,
+    0xd51c37a6625df516, 0x7a191dcd31d32a1f, 0xc9e6829b6caa7d97, 0x66e3a8f03f24a29e,
+    0xece95ddc7fb2e414, 0x43ec77b72c3c3b1d, 0xf013e8e171456c95, 0x5f16c28a22cbb39c,
+    0xa6f6e3525983d712, 0x9f3c9390a0d081b, 0xba0c566f57745f93, 0x15097c0404fa809a,
+    0x9f038928446cc610, 0x3006a34317e21919, 0x83f93c154a9b4e91, 0x2cfc167e19159198,
+    0x32c99e4e15e1b11e, 0x9dccb425466f6e17, 0x2e332b731b16399f, 0x813601184898e696,
+    0xb3cf434080ea01c, 0xa439de5f5b807f15, 0x17c6410906f9289d, 0xb8c36b625577f794,
+    0x41234aba2e3f931a, 0xee2660d17db14c13, 0x5dd9ff8720c81b9b, 0xf2dcd5ec7346c492,
+    0x78d620c033d08218, 0xd7d30aab605e5d11, 0x642c95fd3d270a99, 0xcb29bf966ea9d590,
+    0xb08f0b3a499e972a, 0x1f8a21511a104823, 0xac75be0747691fab, 0x370946c14e7c0a2,
+    0x897a614054718628, 0x267f4b2b07ff5921, 0x9580d47d5a860ea9, 0x3a85fe160908d1a0,
+    0xc365dfce7240b52e, 0x6c60f5a521ce6a27, 0xdf9f6af37cb73daf, 0x709a40982f39e2a6,
+    0xfa90b5b46fafa42c, 0x55959fdf3c217b25, 0xe66a008961582cad, 0x496f2ae232d6f3a4,
+    0x575aa2d23e22d322, 0xf85f88b96dac0c2b, 0x4ba017ef30d55ba3, 0xe4a53d84635b84aa,
+    0x6eafc8a823cdc220, 0xc1aae2c370431d29, 0x72557d952d3a4aa1, 0xdd5057fe7eb495a8,
+    0x24b0762605fcf126, 0x8bb55c4d56722e2f, 0x384ac31b0b0b79a7, 0x974fe9705885a6ae,
+    0x1d451c5c1813e024, 0xb24036374b9d3f2d, 0x1bfa96116e468a5, 0xaeba830a456ab7ac,
+    0x3dd4b9010f0c29a9, 0x92d1936a5c82f6a0, 0x212e0c3c01fba128, 0x8e2b265752757e21,
+    0x421d37b12e338ab, 0xab24f910416de7a2, 0x18db66461c14b02a, 0xb7de4c2d4f9a6f23,
+    0x4e3e6df534d20bad, 0xe13b479e675cd4a4, 0x52c4d8c83a25832c, 0xfdc1f2a369ab5c25,
+    0x77cb078f293d1aaf, 0xd8ce2de47ab3c5a6, 0x6b31b2b227ca922e, 0xc43498d974444d27,
+    0xda0110e978b06da1, 0x75043a822b3eb2a8, 0xc6fba5d47647e520, 0x69fe8fbf25c93a29,
+    0xe3f47a93655f7ca3, 0x4cf150f836d1a3aa, 0xff0ecfae6ba8f422, 0x500be5c538262b2b,
+    0xa9ebc41d436e4fa5, 0x6eeee7610e090ac, 0xb51171204d99c724, 0x1a145b4b1e17182d,
+    0x901eae675e815ea7, 0x3f1b840c0d0f81ae, 0x8ce41b5a5076d626, 0x23e1313103f8092f,
+    0xe8c88ea76d51dcbf, 0x47cda4cc3edf03b6, 0xf4323b9a63a6543e, 0x5b3711f130288b37,
+    0xd13de4dd70becdbd, 0x7e38ceb6233012b4, 0xcdc751e07e49453c, 0x62c27b8b2dc79a35,
+    0x9b225a53568ffebb, 0x34277038050121b2, 0x87d8ef6e5878763a, 0x28ddc5050bf6a933,
+    0xa2d730294b60efb9, 0xdd21a4218ee30b0, 0xbe2d851445976738, 0x1128af7f1619b831,
+    0xf1d274f1aed98b7, 0xa0180d24496347be, 0x13e79272141a1036, 0xbce2b8194794cf3f,
+    0x36e84d35070289b5, 0x99ed675e548c56bc, 0x2a12f80809f50134, 0x8517d2635a7bde3d,
+    0x7cf7f3bb2133bab3, 0xd3f2d9d072bd65ba, 0x600d46862fc43232, 0xcf086ced7c4aed3b,
+    0x450299c13cdcabb1, 0xea07b3aa6f5274b8, 0x59f82cfc322b2330, 0xf6fd069761a5fc39,
+    0x65933c9c2bc3623c, 0xca9616f7784dbd35, 0x796989a12534eabd, 0xd66ca3ca76ba35b4,
+    0x5c6656e6362c733e, 0xf3637c8d65a2ac37, 0x409ce3db38dbfbbf, 0xef99c9b06b5524b6,
+    0x1679e868101d4038, 0xb97cc20343939f31, 0xa835d551eeac8b9, 0xa586773e4d6417b0,
+    0x2f8c82120df2513a, 0x8089a8795e7c8e33, 0x3376372f0305d9bb, 0x9c731d44508b06b2,
+    0x824695745c7f2634, 0x2d43bf1f0ff1f93d, 0x9ebc20495288aeb5, 0x31b90a22010671bc,
+    0xbbb3ff0e41903736, 0x14b6d565121ee83f, 0xa7494a334f67bfb7, 0x84c60581ce960be,
+    0xf1ac418067a10430, 0x5ea96beb342fdb39, 0xed56f4bd69568cb1, 0x4253ded63ad853b8,
+    0xc8592bfa7a4e1532, 0x675c019129c0ca3b, 0xd4a39ec774b99db3, 0x7ba6b4ac273742ba,
+  },
+  {
+    0, 0x23eef79f3ad718c7, 0x47ddef3e75ae318e, 0x643318a14f792949,
+    0x8fbbde7ceb5c631c, 0xac5529e3d18b7bdb, 0xc86631429ef25292, 0xeb88c6dda4254a55,
+    0x5d875d127f52f0ab, 0x7e69aa8d4585e86c, 0x1a5ab22c0afcc125, 0x39b445b3302bd9e2,
+    0xd23c836e940e93b7, 0xf1d274f1aed98b70, 0x95e16c50e1a0a239, 0xb60f9bcfdb77bafe,
+    0xbb0eba24fea5e156, 0x98e04dbbc472f991, 0xfcd3551a8b0bd0d8, 0xdf3da285b1dcc81f,
+    0x34b5645815f9824a, 0x175b93c72f2e9a8d, 0x73688b666057b3c4, 0x50867cf95a80ab03,
+    0xe689e73681f711fd, 0xc56710a9bb20093a, 0xa1540808f4592073, 0x82baff97ce8e38b4,
+    0x6932394a6aab72e1, 0x4adcced5507c6a26, 0x2eefd6741f05436f, 0xd0121eb25d25ba8,
+    0x34ed95a254a1f43f, 0x1703623d6e76ecf8, 0x73307a9c210fc5b1, 0x50de8d031bd8dd76,
+    0xbb564bdebffd9723, 0x98b8bc41852a8fe4, 0xfc8ba4e0ca53a6ad, 0xdf65537ff084be6a,
+    0x696ac8b02bf30494, 0x4a843f2f11241c53, 0x2eb7278e5e5d351a, 0xd59d011648a2ddd,
+    0xe6d116ccc0af6788, 0xc53fe153fa787f4f, 0xa10cf9f2b5015606, 0x82e20e6d8fd64ec1,
+    0x8fe32f86aa041569, 0xac0dd81990d30dae, 0xc83ec0b8dfaa24e7, 0xebd03727e57d3c20,
+    0x58f1fa41587675, 0x23b606657b8f6eb2, 0x47851ec434f647fb, 0x646be95b0e215f3c,
+    0xd2647294d556e5c2, 0xf18a850bef81fd05, 0x95b99daaa0f8d44c, 0xb6576a359a2fcc8b,
+    0x5ddface83e0a86de, 0x7e315b7704dd9e19, 0x1a0243d64ba4b750, 0x39ecb4497173af97,
+    0x69db2b44a943e87e, 0x4a35dcdb9394f0b9, 0x2e06c47adcedd9f0, 0xde833e5e63ac137,
+    0xe660f538421f8b62, 0xc58e02a778c893a5, 0xa1bd1a0637b1baec, 0x8253ed990d66a22b,
+    0x345c7656d61118d5, 0x17b281c9ecc60012, 0x73819968a3bf295b, 0x506f6ef79968319c,
+    0xbbe7a82a3d4d7bc9, 0x98095fb5079a630e, 0xfc3a471448e34a47, 0xdfd4b08b72345280,
+    0xd2d5916057e60928, 0xf13b66ff6d3111ef, 0x95087e5e224838a6, 0xb6e689c1189f2061,
+    0x5d6e4f1cbcba6a34, 0x7e80b883866d72f3, 0x1ab3a022c9145bba, 0x395d57bdf3c3437d,
+    0x8f52cc7228b4f983, 0xacbc3bed1263e144, 0xc88f234c5d1ac80d, 0xeb61d4d367cdd0ca,
+    0xe9120ec3e89a9f, 0x2307e591f93f8258, 0x4734fd30b646ab11, 0x64da0aaf8c91b3d6,
+    0x5d36bee6fde21c41, 0x7ed84979c7350486, 0x1aeb51d8884c2dcf, 0x3905a647b29b3508,
+    0xd28d609a16be7f5d, 0xf16397052c69679a, 0x95508fa463104ed3, 0xb6be783b59c75614,
+    0xb1e3f482b0ecea, 0x235f146bb867f42d, 0x476c0ccaf71edd64, 0x6482fb55cdc9c5a3,
+    0x8f0a3d8869ec8ff6, 0xace4ca17533b9731, 0xc8d7d2b61c42be78, 0xeb3925292695a6bf,
+    0xe63804c20347fd17, 0xc5d6f35d3990e5d0, 0xa1e5ebfc76e9cc99, 0x820b1c634c3ed45e,
+    0x6983dabee81b9e0b, 0x4a6d2d21d2cc86cc, 0x2e5e35809db5af85, 0xdb0c21fa762b742,
+    0xbbbf59d07c150dbc, 0x9851ae4f46c2157b, 0xfc62b6ee09bb3c32, 0xdf8c4171336c24f5,
+    0x340487ac97496ea0, 0x17ea7033ad9e7667, 0x73d96892e2e75f2e, 0x50379f0dd83047e9,
+    0xd3b656895287d0fc, 0xf058a1166850c83b, 0x946bb9b72729e172, 0xb7854e281dfef9b5,
+    0x5c0d88f5b9dbb3e0, 0x7fe37f6a830cab27, 0x1bd067cbcc75826e, 0x383e9054f6a29aa9,
+    0x8e310b9b2dd52057, 0xaddffc0417023890, 0xc9ece4a5587b11d9, 0xea02133a62ac091e,
+    0x18ad5e7c689434b, 0x22642278fc5e5b8c, 0x46573ad9b32772c5, 0x65b9cd4689f06a02,
+    0x68b8ecadac2231aa, 0x4b561b3296f5296d, 0x2f650393d98c0024, 0xc8bf40ce35b18e3,
+    0xe70332d1477e52b6, 0xc4edc54e7da94a71, 0xa0deddef32d06338, 0x83302a7008077bff,
+    0x353fb1bfd370c101, 0x16d14620e9a7d9c6, 0x72e25e81a6def08f, 0x510ca91e9c09e848,
+    0xba846fc3382ca21d, 0x996a985c02fbbada, 0xfd5980fd4d829393, 0xdeb7776277558b54,
+    0xe75bc32b062624c3, 0xc4b534b43cf13c04, 0xa0862c157388154d, 0x8368db8a495f0d8a,
+    0x68e01d57ed7a47df, 0x4b0eeac8d7ad5f18, 0x2f3df26998d47651, 0xcd305f6a2036e96,
+    0xbadc9e397974d468, 0x993269a643a3ccaf, 0xfd0171070cdae5e6, 0xdeef8698360dfd21,
+    0x356740459228b774, 0x1689b7daa8ffafb3, 0x72baaf7be78686fa, 0x515458e4dd519e3d,
+    0x5c55790ff883c595, 0x7fbb8e90c254dd52, 0x1b8896318d2df41b, 0x386661aeb7faecdc,
+    0xd3eea77313dfa689, 0xf00050ec2908be4e, 0x9433484d66719707, 0xb7ddbfd25ca68fc0,
+    0x1d2241d87d1353e, 0x223cd382bd062df9, 0x460fcb23f27f04b0, 0x65e13cbcc8a81c77,
+    0x8e69fa616c8d5622, 0xad870dfe565a4ee5, 0xc9b4155f192367ac, 0xea5ae2c023f47f6b,
+    0xba6d7dcdfbc43882, 0x99838a52c1132045, 0xfdb092f38e6a090c, 0xde5e656cb4bd11cb,
+    0x35d6a3b110985b9e, 0x1638542e2a4f4359, 0x720b4c8f65366a10, 0x51e5bb105fe172d7,
+    0xe7ea20df8496c829, 0xc404d740be41d0ee, 0xa037cfe1f138f9a7, 0x83d9387ecbefe160,
+    0x6851fea36fcaab35, 0x4bbf093c551db3f2, 0x2f8c119d1a649abb, 0xc62e60220b3827c,
+    0x163c7e90561d9d4, 0x228d30763fb6c113, 0x46be28d770cfe85a, 0x6550df484a18f09d,
+    0x8ed81995ee3dbac8, 0xad36ee0ad4eaa20f, 0xc905f6ab9b938b46, 0xeaeb0134a1449381,
+    0x5ce49afb7a33297f, 0x7f0a6d6440e431b8, 0x1b3975c50f9d18f1, 0x38d7825a354a0036,
+    0xd35f4487916f4a63, 0xf0b1b318abb852a4, 0x9482abb9e4c17bed, 0xb76c5c26de16632a,
+    0x8e80e86faf65ccbd, 0xad6e1ff095b2d47a, 0xc95d0751dacbfd33, 0xeab3f0cee01ce5f4,
+    0x13b36134439afa1, 0x22d5c18c7eeeb766, 0x46e6d92d31979e2f, 0x65082eb20b4086e8,
+    0xd307b57dd0373c16, 0xf0e942e2eae024d1, 0x94da5a43a5990d98, 0xb734addc9f4e155f,
+    0x5cbc6b013b6b5f0a, 0x7f529c9e01bc47cd, 0x1b61843f4ec56e84, 0x388f73a074127643,
+    0x358e524b51c02deb, 0x1660a5d46b17352c, 0x7253bd75246e1c65, 0x51bd4aea1eb904a2,
+    0xba358c37ba9c4ef7, 0x99db7ba8804b5630, 0xfde86309cf327f79, 0xde069496f5e567be,
+    0x68090f592e92dd40, 0x4be7f8c61445c587, 0x2fd4e0675b3cecce, 0xc3a17f861ebf409,
+    0xe7b2d125c5cebe5c, 0xc45c26baff19a69b, 0xa06f3e1bb0608fd2, 0x8381c9848ab79715,
+  },
+  {
+    0, 0xe59c4cf90ce5976b, 0x89c87819b0211845, 0x6c5434e0bcc48f2e,
+    0x516011d8c9a80619, 0xb4fc5d21c54d9172, 0xd8a869c179891e5c, 0x3d342538756c8937,
+    0xa2c023b193500c32, 0x475c6f489fb59b59, 0x2b085ba823711477, 0xce9417512f94831c,
+    0xf3a032695af80a2b, 0x163c7e90561d9d40, 0x7a684a70ead9126e, 0x9ff40689e63c8505,
+    0x770a6888f4a2ef7, 0xe2ecea7183afb99c, 0x8eb8de913f6b36b2, 0x6b249268338ea1d9,
+    0x5610b75046e228ee, 0xb38cfba94a07bf85, 0xdfd8cf49f6c330ab, 0x3a4483b0fa26a7c0,
+    0xa5b085391c1a22c5, 0x402cc9c010ffb5ae, 0x2c78fd20ac3b3a80, 0xc9e4b1d9a0deadeb,
+    0xf4d094e1d5b224dc, 0x114cd818d957b3b7, 0x7d18ecf865933c99, 0x9884a0016976abf2,
+    0xee14d111e945dee, 0xeb7d01e81271ca85, 0x87293508aeb545ab, 0x62b579f1a250d2c0,
+    0x5f815cc9d73c5bf7, 0xba1d1030dbd9cc9c, 0xd64924d0671d43b2, 0x33d568296bf8d4d9,
+    0xac216ea08dc451dc, 0x49bd22598121c6b7, 0x25e916b93de54999, 0xc0755a403100def2,
+    0xfd417f78446c57c5, 0x18dd33814889c0ae, 0x74890761f44d4f80, 0x91154b98f8a8d8eb,
+    0x991eb9991de7319, 0xec0da7609d3be472, 0x8059938021ff6b5c, 0x65c5df792d1afc37,
+    0x58f1fa4158767500, 0xbd6db6b85493e26b, 0xd1398258e8576d45, 0x34a5cea1e4b2fa2e,
+    0xab51c828028e7f2b, 0x4ecd84d10e6be840, 0x2299b031b2af676e, 0xc705fcc8be4af005,
+    0xfa31d9f0cb267932, 0x1fad9509c7c3ee59, 0x73f9a1e97b076177, 0x9665ed1077e2f61c,
+    0x1dc29a223d28bbdc, 0xf85ed6db31cd2cb7, 0x940ae23b8d09a399, 0x7196aec281ec34f2,
+    0x4ca28bfaf480bdc5, 0xa93ec703f8652aae, 0xc56af3e344a1a580, 0x20f6bf1a484432eb,
+    0xbf02b993ae78b7ee, 0x5a9ef56aa29d2085, 0x36cac18a1e59afab, 0xd3568d7312bc38c0,
+    0xee62a84b67d0b1f7, 0xbfee4b26b35269c, 0x67aad052d7f1a9b2, 0x82369cabdb143ed9,
+    0x1ab23caab262952b, 0xff2e7053be870240, 0x937a44b302438d6e, 0x76e6084a0ea61a05,
+    0x4bd22d727bca9332, 0xae4e618b772f0459, 0xc21a556bcbeb8b77, 0x27861992c70e1c1c,
+    0xb8721f1b21329919, 0x5dee53e22dd70e72, 0x31ba67029113815c, 0xd4262bfb9df61637,
+    0xe9120ec3e89a9f00, 0xc8e423ae47f086b, 0x60da76da58bb8745, 0x85463a23545e102e,
+    0x1323d73323bce632, 0xf6bf9bca2f597159, 0x9aebaf2a939dfe77, 0x7f77e3d39f78691c,
+    0x4243c6ebea14e02b, 0xa7df8a12e6f17740, 0xcb8bbef25a35f86e, 0x2e17f20b56d06f05,
+    0xb1e3f482b0ecea00, 0x547fb87bbc097d6b, 0x382b8c9b00cdf245, 0xddb7c0620c28652e,
+    0xe083e55a7944ec19, 0x51fa9a375a17b72, 0x694b9d43c965f45c, 0x8cd7d1bac5806337,
+    0x145371bbacf6c8c5, 0xf1cf3d42a0135fae, 0x9d9b09a21cd7d080, 0x7807455b103247eb,
+    0x45336063655ecedc, 0xa0af2c9a69bb59b7, 0xccfb187ad57fd699, 0x29675483d99a41f2,
+    0xb693520a3fa6c4f7, 0x530f1ef33343539c, 0x3f5b2a138f87dcb2, 0xdac766ea83624bd9,
+    0xe7f343d2f60ec2ee, 0x26f0f2bfaeb5585, 0x6e3b3bcb462fdaab, 0x8ba777324aca4dc0,
+    0x3b8534447a5177b8, 0xde1978bd76b4e0d3, 0xb24d4c5dca706ffd, 0x57d100a4c695f896,
+    0x6ae5259cb3f971a1, 0x8f796965bf1ce6ca, 0xe32d5d8503d869e4, 0x6b1117c0f3dfe8f,
+    0x994517f5e9017b8a, 0x7cd95b0ce5e4ece1, 0x108d6fec592063cf, 0xf511231555c5f4a4,
+    0xc825062d20a97d93, 0x2db94ad42c4ceaf8, 0x41ed7e34908865d6, 0xa47132cd9c6df2bd,
+    0x3cf592ccf51b594f, 0xd969de35f9fece24, 0xb53dead5453a410a, 0x50a1a62c49dfd661,
+    0x6d9583143cb35f56, 0x8809cfed3056c83d, 0xe45dfb0d8c924713, 0x1c1b7f48077d078,
+    0x9e35b17d664b557d, 0x7ba9fd846aaec216, 0x17fdc964d66a4d38, 0xf261859dda8fda53,
+    0xcf55a0a5afe35364, 0x2ac9ec5ca306c40f, 0x469dd8bc1fc24b21, 0xa30194451327dc4a,
+    0x3564795564c52a56, 0xd0f835ac6820bd3d, 0xbcac014cd4e43213, 0x59304db5d801a578,
+    0x6404688dad6d2c4f, 0x81982474a188bb24, 0xedcc10941d4c340a, 0x8505c6d11a9a361,
+    0x97a45ae4f7952664, 0x7238161dfb70b10f, 0x1e6c22fd47b43e21, 0xfbf06e044b51a94a,
+    0xc6c44b3c3e3d207d, 0x235807c532d8b716, 0x4f0c33258e1c3838, 0xaa907fdc82f9af53,
+    0x3214dfddeb8f04a1, 0xd7889324e76a93ca, 0xbbdca7c45bae1ce4, 0x5e40eb3d574b8b8f,
+    0x6374ce05222702b8, 0x86e882fc2ec295d3, 0xeabcb61c92061afd, 0xf20fae59ee38d96,
+    0x90d4fc6c78df0893, 0x7548b095743a9ff8, 0x191c8475c8fe10d6, 0xfc80c88cc41b87bd,
+    0xc1b4edb4b1770e8a, 0x2428a14dbd9299e1, 0x487c95ad015616cf, 0xade0d9540db381a4,
+    0x2647ae664779cc64, 0xc3dbe29f4b9c5b0f, 0xaf8fd67ff758d421, 0x4a139a86fbbd434a,
+    0x7727bfbe8ed1ca7d, 0x92bbf34782345d16, 0xfeefc7a73ef0d238, 0x1b738b5e32154553,
+    0x84878dd7d429c056, 0x611bc12ed8cc573d, 0xd4ff5ce6408d813, 0xe8d3b93768ed4f78,
+    0xd5e79c0f1d81c64f, 0x307bd0f611645124, 0x5c2fe416ada0de0a, 0xb9b3a8efa1454961,
+    0x213708eec833e293, 0xc4ab4417c4d675f8, 0xa8ff70f77812fad6, 0x4d633c0e74f76dbd,
+    0x70571936019be48a, 0x95cb55cf0d7e73e1, 0xf99f612fb1bafccf, 0x1c032dd6bd5f6ba4,
+    0x83f72b5f5b63eea1, 0x666b67a6578679ca, 0xa3f5346eb42f6e4, 0xefa31fbfe7a7618f,
+    0xd2973a8792cbe8b8, 0x370b767e9e2e7fd3, 0x5b5f429e22eaf0fd, 0xbec30e672e0f6796,
+    0x28a6e37759ed918a, 0xcd3aaf8e550806e1, 0xa16e9b6ee9cc89cf, 0x44f2d797e5291ea4,
+    0x79c6f2af90459793, 0x9c5abe569ca000f8, 0xf00e8ab620648fd6, 0x1592c64f2c8118bd,
+    0x8a66c0c6cabd9db8, 0x6ffa8c3fc6580ad3, 0x3aeb8df7a9c85fd, 0xe632f42676791296,
+    0xdb06d11e03159ba1, 0x3e9a9de70ff00cca, 0x52cea907b33483e4, 0xb752e5febfd1148f,
+    0x2fd645ffd6a7bf7d, 0xca4a0906da422816, 0xa61e3de66686a738, 0x4382711f6a633053,
+    0x7eb654271f0fb964, 0x9b2a18de13ea2e0f, 0xf77e2c3eaf2ea121, 0x12e260c7a3cb364a,
+    0x8d16664e45f7b34f, 0x688a2ab749122424, 0x4de1e57f5d6ab0a, 0xe14252aef9333c61,
+    0xdc7677968c5fb556, 0x39ea3b6f80ba223d, 0x55be0f8f3c7ead13, 0xb0224376309b3a78,
+  },
+  {
+    0, 0x770a6888f4a2ef70, 0xee14d111e945dee0, 0x991eb9991de73190,
+    0x9ed943c87b618b53, 0xe9d32b408fc36423, 0x70cd92d9922455b3, 0x7c7fa516686bac3,
+    0x7f42667b5f292035, 0x8480ef3ab8bcf45, 0x9156b76ab66cfed5, 0xe65cdfe242ce11a5,
+    0xe19b25b32448ab66, 0x96914d3bd0ea4416, 0xf8ff4a2cd0d7586, 0x78859c2a39af9af6,
+    0xfe84ccf6be52406a, 0x898ea47e4af0af1a, 0x10901de757179e8a, 0x679a756fa3b571fa,
+    0x605d8f3ec533cb39, 0x1757e7b631912449, 0x8e495e2f2c7615d9, 0xf94336a7d8d4faa9,
+    0x81c6aa8de17b605f, 0xf6ccc20515d98f2f, 0x6fd27b9c083ebebf, 0x18d81314fc9c51cf,
+    0x1f1fe9459a1aeb0c, 0x681581cd6eb8047c, 0xf10b3854735f35ec, 0x860150dc87fdda9c,
+    0xbff97806d54eb647, 0xc8f3108e21ec5937, 0x51eda9173c0b68a7, 0x26e7c19fc8a987d7,
+    0x21203bceae2f3d14, 0x562a53465a8dd264, 0xcf34eadf476ae3f4, 0xb83e8257b3c80c84,
+    0xc0bb1e7d8a679672, 0xb7b176f57ec57902, 0x2eafcf6c63224892, 0x59a5a7e49780a7e2,
+    0x5e625db5f1061d21, 0x2968353d05a4f251, 0xb0768ca41843c3c1, 0xc77ce42cece12cb1,
+    0x417db4f06b1cf62d, 0x3677dc789fbe195d, 0xaf6965e1825928cd, 0xd8630d6976fbc7bd,
+    0xdfa4f738107d7d7e, 0xa8ae9fb0e4df920e, 0x31b02629f938a39e, 0x46ba4ea10d9a4cee,
+    0x3e3fd28b3435d618, 0x4935ba03c0973968, 0xd02b039add7008f8, 0xa7216b1229d2e788,
+    0xa0e691434f545d4b, 0xd7ecf9cbbbf6b23b, 0x4ef24052a61183ab, 0x39f828da52b36cdb,
+    0x3d0211e603775a1d, 0x4a08796ef7d5b56d, 0xd316c0f7ea3284fd, 0xa41ca87f1e906b8d,
+    0xa3db522e7816d14e, 0xd4d13aa68cb43e3e, 0x4dcf833f91530fae, 0x3ac5ebb765f1e0de,
+    0x4240779d5c5e7a28, 0x354a1f15a8fc9558, 0xac54a68cb51ba4c8, 0xdb5ece0441b94bb8,
+    0xdc993455273ff17b, 0xab935cddd39d1e0b, 0x328de544ce7a2f9b, 0x45878dcc3ad8c0eb,
+    0xc386dd10bd251a77, 0xb48cb5984987f507, 0x2d920c015460c497, 0x5a986489a0c22be7,
+    0x5d5f9ed8c6449124, 0x2a55f65032e67e54, 0xb34b4fc92f014fc4, 0xc4412741dba3a0b4,
+    0xbcc4bb6be20c3a42, 0xcbced3e316aed532, 0x52d06a7a0b49e4a2, 0x25da02f2ffeb0bd2,
+    0x221df8a3996db111, 0x5517902b6dcf5e61, 0xcc0929b270286ff1, 0xbb03413a848a8081,
+    0x82fb69e0d639ec5a, 0xf5f10168229b032a, 0x6cefb8f13f7c32ba, 0x1be5d079cbdeddca,
+    0x1c222a28ad586709, 0x6b2842a059fa8879, 0xf236fb39441db9e9, 0x853c93b1b0bf5699,
+    0xfdb90f9b8910cc6f, 0x8ab367137db2231f, 0x13adde8a6055128f, 0x64a7b60294f7fdff,
+    0x63604c53f271473c, 0x146a24db06d3a84c, 0x8d749d421b3499dc, 0xfa7ef5caef9676ac,
+    0x7c7fa516686bac30, 0xb75cd9e9cc94340, 0x926b7407812e72d0, 0xe5611c8f758c9da0,
+    0xe2a6e6de130a2763, 0x95ac8e56e7a8c813, 0xcb237cffa4ff983, 0x7bb85f470eed16f3,
+    0x33dc36d37428c05, 0x7437abe5c3e06375, 0xed29127cde0752e5, 0x9a237af42aa5bd95,
+    0x9de480a54c230756, 0xeaeee82db881e826, 0x73f051b4a566d9b6, 0x4fa393c51c436c6,
+    0x7a0423cc06eeb43a, 0xd0e4b44f24c5b4a, 0x9410f2ddefab6ada, 0xe31a9a551b0985aa,
+    0xe4dd60047d8f3f69, 0x93d7088c892dd019, 0xac9b11594cae189, 0x7dc3d99d60680ef9,
+    0x54645b759c7940f, 0x724c2d3fad657b7f, 0xeb5294a6b0824aef, 0x9c58fc2e4420a59f,
+    0x9b9f067f22a61f5c, 0xec956ef7d604f02c, 0x758bd76ecbe3c1bc, 0x281bfe63f412ecc,
+    0x8480ef3ab8bcf450, 0xf38a87b24c1e1b20, 0x6a943e2b51f92ab0, 0x1d9e56a3a55bc5c0,
+    0x1a59acf2c3dd7f03, 0x6d53c47a377f9073, 0xf44d7de32a98a1e3, 0x8347156bde3a4e93,
+    0xfbc28941e795d465, 0x8cc8e1c913373b15, 0x15d658500ed00a85, 0x62dc30d8fa72e5f5,
+    0x651bca899cf45f36, 0x1211a2016856b046, 0x8b0f1b9875b181d6, 0xfc05731081136ea6,
+    0xc5fd5bcad3a0027d, 0xb2f733422702ed0d, 0x2be98adb3ae5dc9d, 0x5ce3e253ce4733ed,
+    0x5b241802a8c1892e, 0x2c2e708a5c63665e, 0xb530c913418457ce, 0xc23aa19bb526b8be,
+    0xbabf3db18c892248, 0xcdb55539782bcd38, 0x54abeca065ccfca8, 0x23a18428916e13d8,
+    0x24667e79f7e8a91b, 0x536c16f1034a466b, 0xca72af681ead77fb, 0xbd78c7e0ea0f988b,
+    0x3b79973c6df24217, 0x4c73ffb49950ad67, 0xd56d462d84b79cf7, 0xa2672ea570157387,
+    0xa5a0d4f41693c944, 0xd2aabc7ce2312634, 0x4bb405e5ffd617a4, 0x3cbe6d6d0b74f8d4,
+    0x443bf14732db6222, 0x333199cfc6798d52, 0xaa2f2056db9ebcc2, 0xdd2548de2f3c53b2,
+    0xdae2b28f49bae971, 0xade8da07bd180601, 0x34f6639ea0ff3791, 0x43fc0b16545dd8e1,
+    0x4706322a0599ee27, 0x300c5aa2f13b0157, 0xa912e33becdc30c7, 0xde188bb3187edfb7,
+    0xd9df71e27ef86574, 0xaed5196a8a5a8a04, 0x37cba0f397bdbb94, 0x40c1c87b631f54e4,
+    0x384454515ab0ce12, 0x4f4e3cd9ae122162, 0xd6508540b3f510f2, 0xa15aedc84757ff82,
+    0xa69d179921d14541, 0xd1977f11d573aa31, 0x4889c688c8949ba1, 0x3f83ae003c3674d1,
+    0xb982fedcbbcbae4d, 0xce8896544f69413d, 0x57962fcd528e70ad, 0x209c4745a62c9fdd,
+    0x275bbd14c0aa251e, 0x5051d59c3408ca6e, 0xc94f6c0529effbfe, 0xbe45048ddd4d148e,
+    0xc6c098a7e4e28e78, 0xb1caf02f10406108, 0x28d449b60da75098, 0x5fde213ef905bfe8,
+    0x5819db6f9f83052b, 0x2f13b3e76b21ea5b, 0xb60d0a7e76c6dbcb, 0xc10762f6826434bb,
+    0xf8ff4a2cd0d75860, 0x8ff522a42475b710, 0x16eb9b3d39928680, 0x61e1f3b5cd3069f0,
+    0x662609e4abb6d333, 0x112c616c5f143c43, 0x8832d8f542f30dd3, 0xff38b07db651e2a3,
+    0x87bd2c578ffe7855, 0xf0b744df7b5c9725, 0x69a9fd4666bba6b5, 0x1ea395ce921949c5,
+    0x19646f9ff49ff306, 0x6e6e0717003d1c76, 0xf770be8e1dda2de6, 0x807ad606e978c296,
+    0x67b86da6e85180a, 0x7171ee529a27f77a, 0xe86f57cb87c0c6ea, 0x9f653f437362299a,
+    0x98a2c51215e49359, 0xefa8ad9ae1467c29, 0x76b61403fca14db9, 0x1bc7c8b0803a2c9,
+    0x7939e0a131ac383f, 0xe338829c50ed74f, 0x972d31b0d8e9e6df, 0xe02759382c4b09af,
+    0xe7e0a3694acdb36c, 0x90eacbe1be6f5c1c, 0x9f47278a3886d8c, 0x7efe1af0572a82fc,
+  },
+  {
+    0, 0xf40847980ddd6874, 0xaae06edbb250e67b, 0x5ee82943bf8d8e0f,
+    0x17303c5ccd4bfa65, 0xe3387bc4c0969211, 0xbdd052877f1b1c1e, 0x49d8151f72c6746a,
+    0x2e6078b99a97f4ca, 0xda683f21974a9cbe, 0x8480166228c712b1, 0x708851fa251a7ac5,
+    0x395044e557dc0eaf, 0xcd58037d5a0166db, 0x93b02a3ee58ce8d4, 0x67b86da6e85180a0,
+    0x5cc0f173352fe994, 0xa8c8b6eb38f281e0, 0xf6209fa8877f0fef, 0x228d8308aa2679b,
+    0x4bf0cd2ff86413f1, 0xbff88ab7f5b97b85, 0xe110a3f44a34f58a, 0x1518e46c47e99dfe,
+    0x72a089caafb81d5e, 0x86a8ce52a265752a, 0xd840e7111de8fb25, 0x2c48a08910359351,
+    0x6590b59662f3e73b, 0x9198f20e6f2e8f4f, 0xcf70db4dd0a30140, 0x3b789cd5dd7e6934,
+    0xb981e2e66a5fd328, 0x4d89a57e6782bb5c, 0x13618c3dd80f3553, 0xe769cba5d5d25d27,
+    0xaeb1debaa714294d, 0x5ab99922aac94139, 0x451b0611544cf36, 0xf059f7f91899a742,
+    0x97e19a5ff0c827e2, 0x63e9ddc7fd154f96, 0x3d01f4844298c199, 0xc909b31c4f45a9ed,
+    0x80d1a6033d83dd87, 0x74d9e19b305eb5f3, 0x2a31c8d88fd33bfc, 0xde398f40820e5388,
+    0xe54113955f703abc, 0x1149540d52ad52c8, 0x4fa17d4eed20dcc7, 0xbba93ad6e0fdb4b3,
+    0xf2712fc9923bc0d9, 0x67968519fe6a8ad, 0x58914112206b26a2, 0xac99068a2db64ed6,
+    0xcb216b2cc5e7ce76, 0x3f292cb4c83aa602, 0x61c105f777b7280d, 0x95c9426f7a6a4079,
+    0xdc11577008ac3413, 0x281910e805715c67, 0x76f139abbafcd268, 0x82f97e33b721ba1c,
+    0x31f324277d5590c3, 0xc5fb63bf7088f8b7, 0x9b134afccf0576b8, 0x6f1b0d64c2d81ecc,
+    0x26c3187bb01e6aa6, 0xd2cb5fe3bdc302d2, 0x8c2376a0024e8cdd, 0x782b31380f93e4a9,
+    0x1f935c9ee7c26409, 0xeb9b1b06ea1f0c7d, 0xb573324555928272, 0x417b75dd584fea06,
+    0x8a360c22a899e6c, 0xfcab275a2754f618, 0xa2430e1998d97817, 0x564b498195041063,
+    0x6d33d554487a7957, 0x993b92cc45a71123, 0xc7d3bb8ffa2a9f2c, 0x33dbfc17f7f7f758,
+    0x7a03e90885318332, 0x8e0bae9088eceb46, 0xd0e387d337616549, 0x24ebc04b3abc0d3d,
+    0x4353adedd2ed8d9d, 0xb75bea75df30e5e9, 0xe9b3c33660bd6be6, 0x1dbb84ae6d600392,
+    0x546391b11fa677f8, 0xa06bd629127b1f8c, 0xfe83ff6aadf69183, 0xa8bb8f2a02bf9f7,
+    0x8872c6c1170a43eb, 0x7c7a81591ad72b9f, 0x2292a81aa55aa590, 0xd69aef82a887cde4,
+    0x9f42fa9dda41b98e, 0x6b4abd05d79cd1fa, 0x35a2944668115ff5, 0xc1aad3de65cc3781,
+    0xa612be788d9db721, 0x521af9e08040df55, 0xcf2d0a33fcd515a, 0xf8fa973b3210392e,
+    0xb122822440d64d44, 0x452ac5bc4d0b2530, 0x1bc2ecfff286ab3f, 0xefcaab67ff5bc34b,
+    0xd4b237b22225aa7f, 0x20ba702a2ff8c20b, 0x7e52596990754c04, 0x8a5a1ef19da82470,
+    0xc3820beeef6e501a, 0x378a4c76e2b3386e, 0x696265355d3eb661, 0x9d6a22ad50e3de15,
+    0xfad24f0bb8b25eb5, 0xeda0893b56f36c1, 0x503221d00ae2b8ce, 0xa43a6648073fd0ba,
+    0xede2735775f9a4d0, 0x19ea34cf7824cca4, 0x47021d8cc7a942ab, 0xb30a5a14ca742adf,
+    0x63e6484efaab2186, 0x97ee0fd6f77649f2, 0xc906269548fbc7fd, 0x3d0e610d4526af89,
+    0x74d6741237e0dbe3, 0x80de338a3a3db397, 0xde361ac985b03d98, 0x2a3e5d51886d55ec,
+    0x4d8630f7603cd54c, 0xb98e776f6de1bd38, 0xe7665e2cd26c3337, 0x136e19b4dfb15b43,
+    0x5ab60cabad772f29, 0xaebe4b33a0aa475d, 0xf05662701f27c952, 0x45e25e812faa126,
+    0x3f26b93dcf84c812, 0xcb2efea5c259a066, 0x95c6d7e67dd42e69, 0x61ce907e7009461d,
+    0x2816856102cf3277, 0xdc1ec2f90f125a03, 0x82f6ebbab09fd40c, 0x76feac22bd42bc78,
+    0x1146c18455133cd8, 0xe54e861c58ce54ac, 0xbba6af5fe743daa3, 0x4faee8c7ea9eb2d7,
+    0x676fdd89858c6bd, 0xf27eba409585aec9, 0xac9693032a0820c6, 0x589ed49b27d548b2,
+    0xda67aaa890f4f2ae, 0x2e6fed309d299ada, 0x7087c47322a414d5, 0x848f83eb2f797ca1,
+    0xcd5796f45dbf08cb, 0x395fd16c506260bf, 0x67b7f82fefefeeb0, 0x93bfbfb7e23286c4,
+    0xf407d2110a630664, 0xf958907be6e10, 0x5ee7bccab833e01f, 0xaaeffb52b5ee886b,
+    0xe337ee4dc728fc01, 0x173fa9d5caf59475, 0x49d7809675781a7a, 0xbddfc70e78a5720e,
+    0x86a75bdba5db1b3a, 0x72af1c43a806734e, 0x2c473500178bfd41, 0xd84f72981a569535,
+    0x919767876890e15f, 0x659f201f654d892b, 0x3b77095cdac00724, 0xcf7f4ec4d71d6f50,
+    0xa8c723623f4ceff0, 0x5ccf64fa32918784, 0x2274db98d1c098b, 0xf62f0a2180c161ff,
+    0xbff71f3ef2071595, 0x4bff58a6ffda7de1, 0x151771e54057f3ee, 0xe11f367d4d8a9b9a,
+    0x52156c6987feb145, 0xa61d2bf18a23d931, 0xf8f502b235ae573e, 0xcfd452a38733f4a,
+    0x452550354ab54b20, 0xb12d17ad47682354, 0xefc53eeef8e5ad5b, 0x1bcd7976f538c52f,
+    0x7c7514d01d69458f, 0x887d534810b42dfb, 0xd6957a0baf39a3f4, 0x229d3d93a2e4cb80,
+    0x6b45288cd022bfea, 0x9f4d6f14ddffd79e, 0xc1a5465762725991, 0x35ad01cf6faf31e5,
+    0xed59d1ab2d158d1, 0xfaddda82bf0c30a5, 0xa435f3c10081beaa, 0x503db4590d5cd6de,
+    0x19e5a1467f9aa2b4, 0xedede6de7247cac0, 0xb305cf9dcdca44cf, 0x470d8805c0172cbb,
+    0x20b5e5a32846ac1b, 0xd4bda23b259bc46f, 0x8a558b789a164a60, 0x7e5dcce097cb2214,
+    0x3785d9ffe50d567e, 0xc38d9e67e8d03e0a, 0x9d65b724575db005, 0x696df0bc5a80d871,
+    0xeb948e8feda1626d, 0x1f9cc917e07c0a19, 0x4174e0545ff18416, 0xb57ca7cc522cec62,
+    0xfca4b2d320ea9808, 0x8acf54b2d37f07c, 0x5644dc0892ba7e73, 0xa24c9b909f671607,
+    0xc5f4f636773696a7, 0x31fcb1ae7aebfed3, 0x6f1498edc56670dc, 0x9b1cdf75c8bb18a8,
+    0xd2c4ca6aba7d6cc2, 0x26cc8df2b7a004b6, 0x7824a4b1082d8ab9, 0x8c2ce32905f0e2cd,
+    0xb7547ffcd88e8bf9, 0x435c3864d553e38d, 0x1db411276ade6d82, 0xe9bc56bf670305f6,
+    0xa06443a015c5719c, 0x546c0438181819e8, 0xa842d7ba79597e7, 0xfe8c6ae3aa48ff93,
+    0x9934074542197f33, 0x6d3c40dd4fc41747, 0x33d4699ef0499948, 0xc7dc2e06fd94f13c,
+    0x8e043b198f528556, 0x7a0c7c81828fed22, 0x24e455c23d02632d, 0xd0ec125a30df0b59,
+  },
+  {
+    0, 0xc7cc909df556430c, 0xcd69c0d04346b08b, 0xaa5504db610f387,
+    0xd823604b2f675785, 0x1feff0d6da311489, 0x154aa09b6c21e70e, 0xd28630069977a402,
+    0xf2b6217df7249999, 0x357ab1e00272da95, 0x3fdfe1adb4622912, 0xf813713041346a1e,
+    0x2a954136d843ce1c, 0xed59d1ab2d158d10, 0xe7fc81e69b057e97, 0x2030117b6e533d9b,
+    0xa79ca31047a305a1, 0x6050338db2f546ad, 0x6af563c004e5b52a, 0xad39f35df1b3f626,
+    0x7fbfc35b68c45224, 0xb87353c69d921128, 0xb2d6038b2b82e2af, 0x751a9316ded4a1a3,
+    0x552a826db0879c38, 0x92e612f045d1df34, 0x984342bdf3c12cb3, 0x5f8fd22006976fbf,
+    0x8d09e2269fe0cbbd, 0x4ac572bb6ab688b1, 0x406022f6dca67b36, 0x87acb26b29f0383a,
+    0xdc9a7cb26ac3dd1, 0xca053756d3fa7edd, 0xc0a0671b65ea8d5a, 0x76cf78690bcce56,
+    0xd5eac78009cb6a54, 0x1226571dfc9d2958, 0x188307504a8ddadf, 0xdf4f97cdbfdb99d3,
+    0xff7f86b6d188a448, 0x38b3162b24dee744, 0x3216466692ce14c3, 0xf5dad6fb679857cf,
+    0x275ce6fdfeeff3cd, 0xe09076600bb9b0c1, 0xea35262dbda94346, 0x2df9b6b048ff004a,
+    0xaa5504db610f3870, 0x6d99944694597b7c, 0x673cc40b224988fb, 0xa0f05496d71fcbf7,
+    0x727664904e686ff5, 0xb5baf40dbb3e2cf9, 0xbf1fa4400d2edf7e, 0x78d334ddf8789c72,
+    0x58e325a6962ba1e9, 0x9f2fb53b637de2e5, 0x958ae576d56d1162, 0x524675eb203b526e,
+    0x80c045edb94cf66c, 0x470cd5704c1ab560, 0x4da9853dfa0a46e7, 0x8a6515a00f5c05eb,
+    0x1b934f964d587ba2, 0xdc5fdf0bb80e38ae, 0xd6fa8f460e1ecb29, 0x11361fdbfb488825,
+    0xc3b02fdd623f2c27, 0x47cbf4097696f2b, 0xed9ef0d21799cac, 0xc9157f90d42fdfa0,
+    0xe9256eebba7ce23b, 0x2ee9fe764f2aa137, 0x244cae3bf93a52b0, 0xe3803ea60c6c11bc,
+    0x31060ea0951bb5be, 0xf6ca9e3d604df6b2, 0xfc6fce70d65d0535, 0x3ba35eed230b4639,
+    0xbc0fec860afb7e03, 0x7bc37c1bffad3d0f, 0x71662c5649bdce88, 0xb6aabccbbceb8d84,
+    0x642c8ccd259c2986, 0xa3e01c50d0ca6a8a, 0xa9454c1d66da990d, 0x6e89dc80938cda01,
+    0x4eb9cdfbfddfe79a, 0x89755d660889a496, 0x83d00d2bbe995711, 0x441c9db64bcf141d,
+    0x969aadb0d2b8b01f, 0x51563d2d27eef313, 0x5bf36d6091fe0094, 0x9c3ffdfd64a84398,
+    0x165ae85d6bf44673, 0xd19678c09ea2057f, 0xdb33288d28b2f6f8, 0x1cffb810dde4b5f4,
+    0xce798816449311f6, 0x9b5188bb1c552fa, 0x31048c607d5a17d, 0xc4dcd85bf283e271,
+    0xe4ecc9209cd0dfea, 0x232059bd69869ce6, 0x298509f0df966f61, 0xee49996d2ac02c6d,
+    0x3ccfa96bb3b7886f, 0xfb0339f646e1cb63, 0xf1a669bbf0f138e4, 0x366af92605a77be8,
+    0xb1c64b4d2c5743d2, 0x760adbd0d90100de, 0x7caf8b9d6f11f359, 0xbb631b009a47b055,
+    0x69e52b0603301457, 0xae29bb9bf666575b, 0xa48cebd64076a4dc, 0x63407b4bb520e7d0,
+    0x43706a30db73da4b, 0x84bcfaad2e259947, 0x8e19aae098356ac0, 0x49d53a7d6d6329cc,
+    0x9b530a7bf4148dce, 0x5c9f9ae60142cec2, 0x563acaabb7523d45, 0x91f65a3642047e49,
+    0x37269f2c9ab0f744, 0xf0ea0fb16fe6b448, 0xfa4f5ffcd9f647cf, 0x3d83cf612ca004c3,
+    0xef05ff67b5d7a0c1, 0x28c96ffa4081e3cd, 0x226c3fb7f691104a, 0xe5a0af2a03c75346,
+    0xc590be516d946edd, 0x25c2ecc98c22dd1, 0x8f97e812ed2de56, 0xcf35ee1cdb849d5a,
+    0x1db3de1a42f33958, 0xda7f4e87b7a57a54, 0xd0da1eca01b589d3, 0x17168e57f4e3cadf,
+    0x90ba3c3cdd13f2e5, 0x5776aca12845b1e9, 0x5dd3fcec9e55426e, 0x9a1f6c716b030162,
+    0x48995c77f274a560, 0x8f55ccea0722e66c, 0x85f09ca7b13215eb, 0x423c0c3a446456e7,
+    0x620c1d412a376b7c, 0xa5c08ddcdf612870, 0xaf65dd916971dbf7, 0x68a94d0c9c2798fb,
+    0xba2f7d0a05503cf9, 0x7de3ed97f0067ff5, 0x7746bdda46168c72, 0xb08a2d47b340cf7e,
+    0x3aef38e7bc1cca95, 0xfd23a87a494a8999, 0xf786f837ff5a7a1e, 0x304a68aa0a0c3912,
+    0xe2cc58ac937b9d10, 0x2500c831662dde1c, 0x2fa5987cd03d2d9b, 0xe86908e1256b6e97,
+    0xc859199a4b38530c, 0xf958907be6e1000, 0x530d94a087ee387, 0xc2fc49d7fd28a08b,
+    0x107a79d1645f0489, 0xd7b6e94c91094785, 0xdd13b9012719b402, 0x1adf299cd24ff70e,
+    0x9d739bf7fbbfcf34, 0x5abf0b6a0ee98c38, 0x501a5b27b8f97fbf, 0x97d6cbba4daf3cb3,
+    0x4550fbbcd4d898b1, 0x829c6b21218edbbd, 0x88393b6c979e283a, 0x4ff5abf162c86b36,
+    0x6fc5ba8a0c9b56ad, 0xa8092a17f9cd15a1, 0xa2ac7a5a4fdde626, 0x6560eac7ba8ba52a,
+    0xb7e6dac123fc0128, 0x702a4a5cd6aa4224, 0x7a8f1a1160bab1a3, 0xbd438a8c95ecf2af,
+    0x2cb5d0bad7e88ce6, 0xeb79402722becfea, 0xe1dc106a94ae3c6d, 0x261080f761f87f61,
+    0xf496b0f1f88fdb63, 0x335a206c0dd9986f, 0x39ff7021bbc96be8, 0xfe33e0bc4e9f28e4,
+    0xde03f1c720cc157f, 0x19cf615ad59a5673, 0x136a3117638aa5f4, 0xd4a6a18a96dce6f8,
+    0x620918c0fab42fa, 0xc1ec0111fafd01f6, 0xcb49515c4cedf271, 0xc85c1c1b9bbb17d,
+    0x8b2973aa904b8947, 0x4ce5e337651dca4b, 0x4640b37ad30d39cc, 0x818c23e7265b7ac0,
+    0x530a13e1bf2cdec2, 0x94c6837c4a7a9dce, 0x9e63d331fc6a6e49, 0x59af43ac093c2d45,
+    0x799f52d7676f10de, 0xbe53c24a923953d2, 0xb4f692072429a055, 0x733a029ad17fe359,
+    0xa1bc329c4808475b, 0x6670a201bd5e0457, 0x6cd5f24c0b4ef7d0, 0xab1962d1fe18b4dc,
+    0x217c7771f144b137, 0xe6b0e7ec0412f23b, 0xec15b7a1b20201bc, 0x2bd9273c475442b0,
+    0xf95f173ade23e6b2, 0x3e9387a72b75a5be, 0x3436d7ea9d655639, 0xf3fa477768331535,
+    0xd3ca560c066028ae, 0x1406c691f3366ba2, 0x1ea396dc45269825, 0xd96f0641b070db29,
+    0xbe9364729077f2b, 0xcc25a6dadc513c27, 0xc680f6976a41cfa0, 0x14c660a9f178cac,
+    0x86e0d461b6e7b496, 0x412c44fc43b1f79a, 0x4b8914b1f5a1041d, 0x8c45842c00f74711,
+    0x5ec3b42a9980e313, 0x990f24b76cd6a01f, 0x93aa74fadac65398, 0x5466e4672f901094,
+    0x7456f51c41c32d0f, 0xb39a6581b4956e03, 0xb93f35cc02859d84, 0x7ef3a551f7d3de88,
+    0xac7595576ea47a8a, 0x6bb905ca9bf23986, 0x611c55872de2ca01, 0xa6d0c51ad8b4890d,
+  },
+  {
+    0, 0x6e4d3e593561ee88, 0xdc9a7cb26ac3dd10, 0xb2d742eb5fa23398,
+    0xfbc4188f7c6d8cb3, 0x958926d6490c623b, 0x275e643d16ae51a3, 0x49135a6423cfbf2b,
+    0xb578d0f551312ff5, 0xdb35eeac6450c17d, 0x69e2ac473bf2f2e5, 0x7af921e0e931c6d,
+    0x4ebcc87a2d5ca346, 0x20f1f623183d4dce, 0x9226b4c8479f7e56, 0xfc6b8a9172fe90de,
+    0x280140010b886979, 0x464c7e583ee987f1, 0xf49b3cb3614bb469, 0x9ad602ea542a5ae1,
+    0xd3c5588e77e5e5ca, 0xbd8866d742840b42, 0xf5f243c1d2638da, 0x61121a652847d652,
+    0x9d7990f45ab9468c, 0xf334aead6fd8a804, 0x41e3ec46307a9b9c, 0x2faed21f051b7514,
+    0x66bd887b26d4ca3f, 0x8f0b62213b524b7, 0xba27f4c94c17172f, 0xd46aca907976f9a7,
+    0x500280021710d2f2, 0x3e4fbe5b22713c7a, 0x8c98fcb07dd30fe2, 0xe2d5c2e948b2e16a,
+    0xabc6988d6b7d5e41, 0xc58ba6d45e1cb0c9, 0x775ce43f01be8351, 0x1911da6634df6dd9,
+    0xe57a50f74621fd07, 0x8b376eae7340138f, 0x39e02c452ce22017, 0x57ad121c1983ce9f,
+    0x1ebe48783a4c71b4, 0x70f376210f2d9f3c, 0xc22434ca508faca4, 0xac690a9365ee422c,
+    0x7803c0031c98bb8b, 0x164efe5a29f95503, 0xa499bcb1765b669b, 0xcad482e8433a8813,
+    0x83c7d88c60f53738, 0xed8ae6d55594d9b0, 0x5f5da43e0a36ea28, 0x31109a673f5704a0,
+    0xcd7b10f64da9947e, 0xa3362eaf78c87af6, 0x11e16c44276a496e, 0x7fac521d120ba7e6,
+    0x36bf087931c418cd, 0x58f2362004a5f645, 0xea2574cb5b07c5dd, 0x84684a926e662b55,
+    0xa00500042e21a5e4, 0xce483e5d1b404b6c, 0x7c9f7cb644e278f4, 0x12d242ef7183967c,
+    0x5bc1188b524c2957, 0x358c26d2672dc7df, 0x875b6439388ff447, 0xe9165a600dee1acf,
+    0x157dd0f17f108a11, 0x7b30eea84a716499, 0xc9e7ac4315d35701, 0xa7aa921a20b2b989,
+    0xeeb9c87e037d06a2, 0x80f4f627361ce82a, 0x3223b4cc69bedbb2, 0x5c6e8a955cdf353a,
+    0x8804400525a9cc9d, 0xe6497e5c10c82215, 0x549e3cb74f6a118d, 0x3ad302ee7a0bff05,
+    0x73c0588a59c4402e, 0x1d8d66d36ca5aea6, 0xaf5a243833079d3e, 0xc1171a61066673b6,
+    0x3d7c90f07498e368, 0x5331aea941f90de0, 0xe1e6ec421e5b3e78, 0x8fabd21b2b3ad0f0,
+    0xc6b8887f08f56fdb, 0xa8f5b6263d948153, 0x1a22f4cd6236b2cb, 0x746fca9457575c43,
+    0xf007800639317716, 0x9e4abe5f0c50999e, 0x2c9dfcb453f2aa06, 0x42d0c2ed6693448e,
+    0xbc39889455cfba5, 0x658ea6d0703d152d, 0xd759e43b2f9f26b5, 0xb914da621afec83d,
+    0x457f50f3680058e3, 0x2b326eaa5d61b66b, 0x99e52c4102c385f3, 0xf7a8121837a26b7b,
+    0xbebb487c146dd450, 0xd0f67625210c3ad8, 0x622134ce7eae0940, 0xc6c0a974bcfe7c8,
+    0xd806c00732b91e6f, 0xb64bfe5e07d8f0e7, 0x49cbcb5587ac37f, 0x6ad182ec6d1b2df7,
+    0x23c2d8884ed492dc, 0x4d8fe6d17bb57c54, 0xff58a43a24174fcc, 0x91159a631176a144,
+    0x6d7e10f26388319a, 0x3332eab56e9df12, 0xb1e46c40094bec8a, 0xdfa952193c2a0202,
+    0x96ba087d1fe5bd29, 0xf8f736242a8453a1, 0x4a2074cf75266039, 0x246d4a9640478eb1,
+    0x2fae1e3f5a97d5b, 0x6cb7dfbac0c893d3, 0xde609d519f6aa04b, 0xb02da308aa0b4ec3,
+    0xf93ef96c89c4f1e8, 0x9773c735bca51f60, 0x25a485dee3072cf8, 0x4be9bb87d666c270,
+    0xb7823116a49852ae, 0xd9cf0f4f91f9bc26, 0x6b184da4ce5b8fbe, 0x55573fdfb3a6136,
+    0x4c462999d8f5de1d, 0x220b17c0ed943095, 0x90dc552bb236030d, 0xfe916b728757ed85,
+    0x2afba1e2fe211422, 0x44b69fbbcb40faaa, 0xf661dd5094e2c932, 0x982ce309a18327ba,
+    0xd13fb96d824c9891, 0xbf728734b72d7619, 0xda5c5dfe88f4581, 0x63e8fb86ddeeab09,
+    0x9f837117af103bd7, 0xf1ce4f4e9a71d55f, 0x43190da5c5d3e6c7, 0x2d5433fcf0b2084f,
+    0x64476998d37db764, 0xa0a57c1e61c59ec, 0xb8dd152ab9be6a74, 0xd6902b738cdf84fc,
+    0x52f861e1e2b9afa9, 0x3cb55fb8d7d84121, 0x8e621d53887a72b9, 0xe02f230abd1b9c31,
+    0xa93c796e9ed4231a, 0xc7714737abb5cd92, 0x75a605dcf417fe0a, 0x1beb3b85c1761082,
+    0xe780b114b388805c, 0x89cd8f4d86e96ed4, 0x3b1acda6d94b5d4c, 0x5557f3ffec2ab3c4,
+    0x1c44a99bcfe50cef, 0x720997c2fa84e267, 0xc0ded529a526d1ff, 0xae93eb7090473f77,
+    0x7af921e0e931c6d0, 0x14b41fb9dc502858, 0xa6635d5283f21bc0, 0xc82e630bb693f548,
+    0x813d396f955c4a63, 0xef700736a03da4eb, 0x5da745ddff9f9773, 0x33ea7b84cafe79fb,
+    0xcf81f115b800e925, 0xa1cccf4c8d6107ad, 0x131b8da7d2c33435, 0x7d56b3fee7a2dabd,
+    0x3445e99ac46d6596, 0x5a08d7c3f10c8b1e, 0xe8df9528aeaeb886, 0x8692ab719bcf560e,
+    0xa2ffe1e7db88d8bf, 0xccb2dfbeeee93637, 0x7e659d55b14b05af, 0x1028a30c842aeb27,
+    0x593bf968a7e5540c, 0x3776c7319284ba84, 0x85a185dacd26891c, 0xebecbb83f8476794,
+    0x178731128ab9f74a, 0x79ca0f4bbfd819c2, 0xcb1d4da0e07a2a5a, 0xa55073f9d51bc4d2,
+    0xec43299df6d47bf9, 0x820e17c4c3b59571, 0x30d9552f9c17a6e9, 0x5e946b76a9764861,
+    0x8afea1e6d000b1c6, 0xe4b39fbfe5615f4e, 0x5664dd54bac36cd6, 0x3829e30d8fa2825e,
+    0x713ab969ac6d3d75, 0x1f778730990cd3fd, 0xada0c5dbc6aee065, 0xc3edfb82f3cf0eed,
+    0x3f86711381319e33, 0x51cb4f4ab45070bb, 0xe31c0da1ebf24323, 0x8d5133f8de93adab,
+    0xc442699cfd5c1280, 0xaa0f57c5c83dfc08, 0x18d8152e979fcf90, 0x76952b77a2fe2118,
+    0xf2fd61e5cc980a4d, 0x9cb05fbcf9f9e4c5, 0x2e671d57a65bd75d, 0x402a230e933a39d5,
+    0x939796ab0f586fe, 0x6774473385946876, 0xd5a305d8da365bee, 0xbbee3b81ef57b566,
+    0x4785b1109da925b8, 0x29c88f49a8c8cb30, 0x9b1fcda2f76af8a8, 0xf552f3fbc20b1620,
+    0xbc41a99fe1c4a90b, 0xd20c97c6d4a54783, 0x60dbd52d8b07741b, 0xe96eb74be669a93,
+    0xdafc21e4c7106334, 0xb4b11fbdf2718dbc, 0x6665d56add3be24, 0x682b630f98b250ac,
+    0x2138396bbb7def87, 0x4f7507328e1c010f, 0xfda245d9d1be3297, 0x93ef7b80e4dfdc1f,
+    0x6f84f11196214cc1, 0x1c9cf48a340a249, 0xb31e8da3fce291d1, 0xdd53b3fac9837f59,
+    0x9440e99eea4cc072, 0xfa0dd7c7df2d2efa, 0x48da952c808f1d62, 0x2697ab75b5eef3ea,
+  },
+};
+static const CrcFold crc_cat_f15 = {
+    64, 0, 0x42f0e1eba9ea3693,
+    { 0x7036b0389f6a0c82, 0x7f52691a60ddc70d }, { 0xddf4b6981205b83f, 0x5f6843ca540df020 }, { 0x4eb938a7d257740e, 0x5f5c3c7eb52fab6 },
+    0x5f5c3c7eb52fab6, 0x578d29d06cc4f872
+};
+
+/* CRC-64/XZ */
+static const uint64_t crc_cat_t16[8][256] = {
+  {
+    0, 0xb32e4cbe03a75f6f, 0xf4843657a840a05b, 0x47aa7ae9abe7ff34,
+    0x7bd0c384ff8f5e33, 0xc8fe8f3afc28015c, 0x8f54f5d357cffe68, 0x3c7ab96d5468a107,
+    0xf7a18709ff1ebc66, 0x448fcbb7fcb9e309, 0x325b15e575e1c3d, 0xb00bfde054f94352,
+    0x8c71448d0091e255, 0x3f5f08330336bd3a, 0x78f572daa8d1420e, 0xcbdb3e64ab761d61,
+    0x7d9ba13851336649, 0xceb5ed8652943926, 0x891f976ff973c612, 0x3a31dbd1fad4997d,
+    0x64b62bcaebc387a, 0xb5652e02ad1b6715, 0xf2cf54eb06fc9821, 0x41e11855055bc74e,
+    0x8a3a2631ae2dda2f, 0x39146a8fad8a8540, 0x7ebe1066066d7a74, 0xcd905cd805ca251b,
+    0xf1eae5b551a2841c, 0x42c4a90b5205db73, 0x56ed3e2f9e22447, 0xb6409f5cfa457b28,
+    0xfb374270a266cc92, 0x48190ecea1c193fd, 0xfb374270a266cc9, 0xbc9d3899098133a6,
+    0x80e781f45de992a1, 0x33c9cd4a5e4ecdce, 0x7463b7a3f5a932fa, 0xc74dfb1df60e6d95,
+    0xc96c5795d7870f4, 0xbfb889c75edf2f9b, 0xf812f32ef538d0af, 0x4b3cbf90f69f8fc0,
+    0x774606fda2f72ec7, 0xc4684a43a15071a8, 0x83c230aa0ab78e9c, 0x30ec7c140910d1f3,
+    0x86ace348f355aadb, 0x3582aff6f0f2f5b4, 0x7228d51f5b150a80, 0xc10699a158b255ef,
+    0xfd7c20cc0cdaf4e8, 0x4e526c720f7dab87, 0x9f8169ba49a54b3, 0xbad65a25a73d0bdc,
+    0x710d64410c4b16bd, 0xc22328ff0fec49d2, 0x85895216a40bb6e6, 0x36a71ea8a7ace989,
+    0xadda7c5f3c4488e, 0xb9f3eb7bf06317e1, 0xfe5991925b84e8d5, 0x4d77dd2c5823b7ba,
+    0x64b62bcaebc387a1, 0xd7986774e864d8ce, 0x90321d9d438327fa, 0x231c512340247895,
+    0x1f66e84e144cd992, 0xac48a4f017eb86fd, 0xebe2de19bc0c79c9, 0x58cc92a7bfab26a6,
+    0x9317acc314dd3bc7, 0x2039e07d177a64a8, 0x67939a94bc9d9b9c, 0xd4bdd62abf3ac4f3,
+    0xe8c76f47eb5265f4, 0x5be923f9e8f53a9b, 0x1c4359104312c5af, 0xaf6d15ae40b59ac0,
+    0x192d8af2baf0e1e8, 0xaa03c64cb957be87, 0xeda9bca512b041b3, 0x5e87f01b11171edc,
+    0x62fd4976457fbfdb, 0xd1d305c846d8e0b4, 0x96797f21ed3f1f80, 0x2557339fee9840ef,
+    0xee8c0dfb45ee5d8e, 0x5da24145464902e1, 0x1a083bacedaefdd5, 0xa9267712ee09a2ba,
+    0x955cce7fba6103bd, 0x267282c1b9c65cd2, 0x61d8f8281221a3e6, 0xd2f6b4961186fc89,
+    0x9f8169ba49a54b33, 0x2caf25044a02145c, 0x6b055fede1e5eb68, 0xd82b1353e242b407,
+    0xe451aa3eb62a1500, 0x577fe680b58d4a6f, 0x10d59c691e6ab55b, 0xa3fbd0d71dcdea34,
+    0x6820eeb3b6bbf755, 0xdb0ea20db51ca83a, 0x9ca4d8e41efb570e, 0x2f8a945a1d5c0861,
+    0x13f02d374934a966, 0xa0de61894a93f609, 0xe7741b60e174093d, 0x545a57dee2d35652,
+    0xe21ac88218962d7a, 0x5134843c1b317215, 0x169efed5b0d68d21, 0xa5b0b26bb371d24e,
+    0x99ca0b06e7197349, 0x2ae447b8e4be2c26, 0x6d4e3d514f59d312, 0xde6071ef4cfe8c7d,
+    0x15bb4f8be788911c, 0xa6950335e42fce73, 0xe13f79dc4fc83147, 0x521135624c6f6e28,
+    0x6e6b8c0f1807cf2f, 0xdd45c0b11ba09040, 0x9aefba58b0476f74, 0x29c1f6e6b3e0301b,
+    0xc96c5795d7870f42, 0x7a421b2bd420502d, 0x3de861c27fc7af19, 0x8ec62d7c7c60f076,
+    0xb2bc941128085171, 0x192d8af2baf0e1e, 0x4638a2468048f12a, 0xf516eef883efae45,
+    0x3ecdd09c2899b324, 0x8de39c222b3eec4b, 0xca49e6cb80d9137f, 0x7967aa75837e4c10,
+    0x451d1318d716ed17, 0xf6335fa6d4b1b278, 0xb199254f7f564d4c, 0x2b769f17cf11223,
+    0xb4f7f6ad86b4690b, 0x7d9ba1385133664, 0x4073c0fa2ef4c950, 0xf35d8c442d53963f,
+    0xcf273529793b3738, 0x7c0979977a9c6857, 0x3ba3037ed17b9763, 0x888d4fc0d2dcc80c,
+    0x435671a479aad56d, 0xf0783d1a7a0d8a02, 0xb7d247f3d1ea7536, 0x4fc0b4dd24d2a59,
+    0x3886b22086258b5e, 0x8ba8fe9e8582d431, 0xcc0284772e652b05, 0x7f2cc8c92dc2746a,
+    0x325b15e575e1c3d0, 0x8175595b76469cbf, 0xc6df23b2dda1638b, 0x75f16f0cde063ce4,
+    0x498bd6618a6e9de3, 0xfaa59adf89c9c28c, 0xbd0fe036222e3db8, 0xe21ac88218962d7,
+    0xc5fa92ec8aff7fb6, 0x76d4de52895820d9, 0x317ea4bb22bfdfed, 0x8250e80521188082,
+    0xbe2a516875702185, 0xd041dd676d77eea, 0x4aae673fdd3081de, 0xf9802b81de97deb1,
+    0x4fc0b4dd24d2a599, 0xfceef8632775faf6, 0xbb44828a8c9205c2, 0x86ace348f355aad,
+    0x34107759db5dfbaa, 0x873e3be7d8faa4c5, 0xc094410e731d5bf1, 0x73ba0db070ba049e,
+    0xb86133d4dbcc19ff, 0xb4f7f6ad86b4690, 0x4ce50583738cb9a4, 0xffcb493d702be6cb,
+    0xc3b1f050244347cc, 0x709fbcee27e418a3, 0x3735c6078c03e797, 0x841b8ab98fa4b8f8,
+    0xadda7c5f3c4488e3, 0x1ef430e13fe3d78c, 0x595e4a08940428b8, 0xea7006b697a377d7,
+    0xd60abfdbc3cbd6d0, 0x6524f365c06c89bf, 0x228e898c6b8b768b, 0x91a0c532682c29e4,
+    0x5a7bfb56c35a3485, 0xe955b7e8c0fd6bea, 0xaeffcd016b1a94de, 0x1dd181bf68bdcbb1,
+    0x21ab38d23cd56ab6, 0x9285746c3f7235d9, 0xd52f0e859495caed, 0x6601423b97329582,
+    0xd041dd676d77eeaa, 0x636f91d96ed0b1c5, 0x24c5eb30c5374ef1, 0x97eba78ec690119e,
+    0xab911ee392f8b099, 0x18bf525d915feff6, 0x5f1528b43ab810c2, 0xec3b640a391f4fad,
+    0x27e05a6e926952cc, 0x94ce16d091ce0da3, 0xd3646c393a29f297, 0x604a2087398eadf8,
+    0x5c3099ea6de60cff, 0xef1ed5546e415390, 0xa8b4afbdc5a6aca4, 0x1b9ae303c601f3cb,
+    0x56ed3e2f9e224471, 0xe5c372919d851b1e, 0xa26908783662e42a, 0x114744c635c5bb45,
+    0x2d3dfdab61ad1a42, 0x9e13b115620a452d, 0xd9b9cbfcc9edba19, 0x6a978742ca4ae576,
+    0xa14cb926613cf817, 0x1262f598629ba778, 0x55c88f71c97c584c, 0xe6e6c3cfcadb0723,
+    0xda9c7aa29eb3a624, 0x69b2361c9d14f94b, 0x2e184cf536f3067f, 0x9d36004b35545910,
+    0x2b769f17cf112238, 0x9858d3a9ccb67d57, 0xdff2a94067518263, 0x6cdce5fe64f6dd0c,
+    0x50a65c93309e7c0b, 0xe388102d33392364, 0xa4226ac498dedc50, 0x170c267a9b79833f,
+    0xdcd7181e300f9e5e, 0x6ff954a033a8c131, 0x28532e49984f3e05, 0x9b7d62f79be8616a,
+    0xa707db9acf80c06d, 0x14299724cc279f02, 0x5383edcd67c06036, 0xe0ada17364673f59,
+  },
+  {
+    0, 0x54e979925cd0f10d, 0xa9d2f324b9a1e21a, 0xfd3b8ab6e5711317,
+    0xc17d4962dc4ddab1, 0x959430f0809d2bbc, 0x68afba4665ec38ab, 0x3c46c3d4393cc9a6,
+    0x10223dee1795abe7, 0x44cb447c4b455aea, 0xb9f0cecaae3449fd, 0xed19b758f2e4b8f0,
+    0xd15f748ccbd87156, 0x85b60d1e9708805b, 0x788d87a87279934c, 0x2c64fe3a2ea96241,
+    0x20447bdc2f2b57ce, 0x74ad024e73fba6c3, 0x899688f8968ab5d4, 0xdd7ff16aca5a44d9,
+    0xe13932bef3668d7f, 0xb5d04b2cafb67c72, 0x48ebc19a4ac76f65, 0x1c02b80816179e68,
+    0x3066463238befc29, 0x648f3fa0646e0d24, 0x99b4b516811f1e33, 0xcd5dcc84ddcfef3e,
+    0xf11b0f50e4f32698, 0xa5f276c2b823d795, 0x58c9fc745d52c482, 0xc2085e60182358f,
+    0x4088f7b85e56af9c, 0x14618e2a02865e91, 0xe95a049ce7f74d86, 0xbdb37d0ebb27bc8b,
+    0x81f5beda821b752d, 0xd51cc748decb8420, 0x28274dfe3bba9737, 0x7cce346c676a663a,
+    0x50aaca5649c3047b, 0x443b3c41513f576, 0xf9783972f062e661, 0xad9140e0acb2176c,
+    0x91d78334958edeca, 0xc53efaa6c95e2fc7, 0x380570102c2f3cd0, 0x6cec098270ffcddd,
+    0x60cc8c64717df852, 0x3425f5f62dad095f, 0xc91e7f40c8dc1a48, 0x9df706d2940ceb45,
+    0xa1b1c506ad3022e3, 0xf558bc94f1e0d3ee, 0x86336221491c0f9, 0x5c8a4fb0484131f4,
+    0x70eeb18a66e853b5, 0x2407c8183a38a2b8, 0xd93c42aedf49b1af, 0x8dd53b3c839940a2,
+    0xb193f8e8baa58904, 0xe57a817ae6757809, 0x18410bcc03046b1e, 0x4ca8725e5fd49a13,
+    0x8111ef70bcad5f38, 0xd5f896e2e07dae35, 0x28c31c54050cbd22, 0x7c2a65c659dc4c2f,
+    0x406ca61260e08589, 0x1485df803c307484, 0xe9be5536d9416793, 0xbd572ca48591969e,
+    0x9133d29eab38f4df, 0xc5daab0cf7e805d2, 0x38e121ba129916c5, 0x6c0858284e49e7c8,
+    0x504e9bfc77752e6e, 0x4a7e26e2ba5df63, 0xf99c68d8ced4cc74, 0xad75114a92043d79,
+    0xa15594ac938608f6, 0xf5bced3ecf56f9fb, 0x88767882a27eaec, 0x5c6e1e1a76f71be1,
+    0x6028ddce4fcbd247, 0x34c1a45c131b234a, 0xc9fa2eeaf66a305d, 0x9d135778aabac150,
+    0xb177a9428413a311, 0xe59ed0d0d8c3521c, 0x18a55a663db2410b, 0x4c4c23f46162b006,
+    0x700ae020585e79a0, 0x24e399b2048e88ad, 0xd9d81304e1ff9bba, 0x8d316a96bd2f6ab7,
+    0xc19918c8e2fbf0a4, 0x9570615abe2b01a9, 0x684bebec5b5a12be, 0x3ca2927e078ae3b3,
+    0xe451aa3eb62a15, 0x540d28386266db18, 0xa936a28e8717c80f, 0xfddfdb1cdbc73902,
+    0xd1bb2526f56e5b43, 0x85525cb4a9beaa4e, 0x7869d6024ccfb959, 0x2c80af90101f4854,
+    0x10c66c44292381f2, 0x442f15d675f370ff, 0xb9149f60908263e8, 0xedfde6f2cc5292e5,
+    0xe1dd6314cdd0a76a, 0xb5341a8691005667, 0x480f903074714570, 0x1ce6e9a228a1b47d,
+    0x20a02a76119d7ddb, 0x744953e44d4d8cd6, 0x8972d952a83c9fc1, 0xdd9ba0c0f4ec6ecc,
+    0xf1ff5efada450c8d, 0xa51627688695fd80, 0x582dadde63e4ee97, 0xcc4d44c3f341f9a,
+    0x308217980608d63c, 0x646b6e0a5ad82731, 0x9950e4bcbfa93426, 0xcdb99d2ee379c52b,
+    0x90fb71cad654a0f5, 0xc41208588a8451f8, 0x392982ee6ff542ef, 0x6dc0fb7c3325b3e2,
+    0x518638a80a197a44, 0x56f413a56c98b49, 0xf854cb8cb3b8985e, 0xacbdb21eef686953,
+    0x80d94c24c1c10b12, 0xd43035b69d11fa1f, 0x290bbf007860e908, 0x7de2c69224b01805,
+    0x41a405461d8cd1a3, 0x154d7cd4415c20ae, 0xe876f662a42d33b9, 0xbc9f8ff0f8fdc2b4,
+    0xb0bf0a16f97ff73b, 0xe4567384a5af0636, 0x196df93240de1521, 0x4d8480a01c0ee42c,
+    0x71c2437425322d8a, 0x252b3ae679e2dc87, 0xd810b0509c93cf90, 0x8cf9c9c2c0433e9d,
+    0xa09d37f8eeea5cdc, 0xf4744e6ab23aadd1, 0x94fc4dc574bbec6, 0x5da6bd4e0b9b4fcb,
+    0x61e07e9a32a7866d, 0x350907086e777760, 0xc8328dbe8b066477, 0x9cdbf42cd7d6957a,
+    0xd073867288020f69, 0x849affe0d4d2fe64, 0x79a1755631a3ed73, 0x2d480cc46d731c7e,
+    0x110ecf10544fd5d8, 0x45e7b682089f24d5, 0xb8dc3c34edee37c2, 0xec3545a6b13ec6cf,
+    0xc051bb9c9f97a48e, 0x94b8c20ec3475583, 0x698348b826364694, 0x3d6a312a7ae6b799,
+    0x12cf2fe43da7e3f, 0x55c58b6c1f0a8f32, 0xa8fe01dafa7b9c25, 0xfc177848a6ab6d28,
+    0xf037fdaea72958a7, 0xa4de843cfbf9a9aa, 0x59e50e8a1e88babd, 0xd0c771842584bb0,
+    0x314ab4cc7b648216, 0x65a3cd5e27b4731b, 0x989847e8c2c5600c, 0xcc713e7a9e159101,
+    0xe015c040b0bcf340, 0xb4fcb9d2ec6c024d, 0x49c73364091d115a, 0x1d2e4af655cde057,
+    0x216889226cf129f1, 0x7581f0b03021d8fc, 0x88ba7a06d550cbeb, 0xdc53039489803ae6,
+    0x11ea9eba6af9ffcd, 0x4503e72836290ec0, 0xb8386d9ed3581dd7, 0xecd1140c8f88ecda,
+    0xd097d7d8b6b4257c, 0x847eae4aea64d471, 0x794524fc0f15c766, 0x2dac5d6e53c5366b,
+    0x1c8a3547d6c542a, 0x5521dac621bca527, 0xa81a5070c4cdb630, 0xfcf329e2981d473d,
+    0xc0b5ea36a1218e9b, 0x945c93a4fdf17f96, 0x6967191218806c81, 0x3d8e608044509d8c,
+    0x31aee56645d2a803, 0x65479cf41902590e, 0x987c1642fc734a19, 0xcc956fd0a0a3bb14,
+    0xf0d3ac04999f72b2, 0xa43ad596c54f83bf, 0x59015f20203e90a8, 0xde826b27cee61a5,
+    0x218cd888524703e4, 0x7565a11a0e97f2e9, 0x885e2bacebe6e1fe, 0xdcb7523eb73610f3,
+    0xe0f191ea8e0ad955, 0xb418e878d2da2858, 0x492362ce37ab3b4f, 0x1dca1b5c6b7bca42,
+    0x5162690234af5051, 0x58b1090687fa15c, 0xf8b09a268d0eb24b, 0xac59e3b4d1de4346,
+    0x901f2060e8e28ae0, 0xc4f659f2b4327bed, 0x39cdd344514368fa, 0x6d24aad60d9399f7,
+    0x414054ec233afbb6, 0x15a92d7e7fea0abb, 0xe892a7c89a9b19ac, 0xbc7bde5ac64be8a1,
+    0x803d1d8eff772107, 0xd4d4641ca3a7d00a, 0x29efeeaa46d6c31d, 0x7d0697381a063210,
+    0x712612de1b84079f, 0x25cf6b4c4754f692, 0xd8f4e1faa225e585, 0x8c1d9868fef51488,
+    0xb05b5bbcc7c9dd2e, 0xe4b2222e9b192c23, 0x1989a8987e683f34, 0x4d60d10a22b8ce39,
+    0x61042f300c11ac78, 0x35ed56a250c15d75, 0xc8d6dc14b5b04e62, 0x9c3fa586e960bf6f,
+    0xa0796652d05c76c9, 0xf4901fc08c8c87c4, 0x9ab957669fd94d3, 0x5d42ece4352d65de,
+  },
+  {
+    0, 0x3f0be14a916a6dcb, 0x7e17c29522d4db96, 0x411c23dfb3beb65d,
+    0xfc2f852a45a9b72c, 0xc3246460d4c3dae7, 0x823847bf677d6cba, 0xbd33a6f5f6170171,
+    0x6a87a57f245d70dd, 0x558c4435b5371d16, 0x149067ea0689ab4b, 0x2b9b86a097e3c680,
+    0x96a8205561f4c7f1, 0xa9a3c11ff09eaa3a, 0xe8bfe2c043201c67, 0xd7b4038ad24a71ac,
+    0xd50f4afe48bae1ba, 0xea04abb4d9d08c71, 0xab18886b6a6e3a2c, 0x94136921fb0457e7,
+    0x2920cfd40d135696, 0x162b2e9e9c793b5d, 0x57370d412fc78d00, 0x683cec0bbeade0cb,
+    0xbf88ef816ce79167, 0x80830ecbfd8dfcac, 0xc19f2d144e334af1, 0xfe94cc5edf59273a,
+    0x43a76aab294e264b, 0x7cac8be1b8244b80, 0x3db0a83e0b9afddd, 0x2bb49749af09016,
+    0x38c63ad73e7bddf1, 0x7cddb9daf11b03a, 0x46d1f8421caf0667, 0x79da19088dc56bac,
+    0xc4e9bffd7bd26add, 0xfbe25eb7eab80716, 0xbafe7d685906b14b, 0x85f59c22c86cdc80,
+    0x52419fa81a26ad2c, 0x6d4a7ee28b4cc0e7, 0x2c565d3d38f276ba, 0x135dbc77a9981b71,
+    0xae6e1a825f8f1a00, 0x9165fbc8cee577cb, 0xd079d8177d5bc196, 0xef72395dec31ac5d,
+    0xedc9702976c13c4b, 0xd2c29163e7ab5180, 0x93deb2bc5415e7dd, 0xacd553f6c57f8a16,
+    0x11e6f50333688b67, 0x2eed1449a202e6ac, 0x6ff1379611bc50f1, 0x50fad6dc80d63d3a,
+    0x874ed556529c4c96, 0xb845341cc3f6215d, 0xf95917c370489700, 0xc652f689e122facb,
+    0x7b61507c1735fbba, 0x446ab136865f9671, 0x57692e935e1202c, 0x3a7d73a3a48b4de7,
+    0x718c75ae7cf7bbe2, 0x4e8794e4ed9dd629, 0xf9bb73b5e236074, 0x30905671cf490dbf,
+    0x8da3f084395e0cce, 0xb2a811cea8346105, 0xf3b432111b8ad758, 0xccbfd35b8ae0ba93,
+    0x1b0bd0d158aacb3f, 0x2400319bc9c0a6f4, 0x651c12447a7e10a9, 0x5a17f30eeb147d62,
+    0xe72455fb1d037c13, 0xd82fb4b18c6911d8, 0x9933976e3fd7a785, 0xa6387624aebdca4e,
+    0xa4833f50344d5a58, 0x9b88de1aa5273793, 0xda94fdc5169981ce, 0xe59f1c8f87f3ec05,
+    0x58acba7a71e4ed74, 0x67a75b30e08e80bf, 0x26bb78ef533036e2, 0x19b099a5c25a5b29,
+    0xce049a2f10102a85, 0xf10f7b65817a474e, 0xb01358ba32c4f113, 0x8f18b9f0a3ae9cd8,
+    0x322b1f0555b99da9, 0xd20fe4fc4d3f062, 0x4c3cdd90776d463f, 0x73373cdae6072bf4,
+    0x494a4f79428c6613, 0x7641ae33d3e60bd8, 0x375d8dec6058bd85, 0x8566ca6f132d04e,
+    0xb565ca530725d13f, 0x8a6e2b19964fbcf4, 0xcb7208c625f10aa9, 0xf479e98cb49b6762,
+    0x23cdea0666d116ce, 0x1cc60b4cf7bb7b05, 0x5dda28934405cd58, 0x62d1c9d9d56fa093,
+    0xdfe26f2c2378a1e2, 0xe0e98e66b212cc29, 0xa1f5adb901ac7a74, 0x9efe4cf390c617bf,
+    0x9c4505870a3687a9, 0xa34ee4cd9b5cea62, 0xe252c71228e25c3f, 0xdd592658b98831f4,
+    0x606a80ad4f9f3085, 0x5f6161e7def55d4e, 0x1e7d42386d4beb13, 0x2176a372fc2186d8,
+    0xf6c2a0f82e6bf774, 0xc9c941b2bf019abf, 0x88d5626d0cbf2ce2, 0xb7de83279dd54129,
+    0xaed25d26bc24058, 0x35e6c498faa82d93, 0x74fae74749169bce, 0x4bf1060dd87cf605,
+    0xe318eb5cf9ef77c4, 0xdc130a1668851a0f, 0x9d0f29c9db3bac52, 0xa204c8834a51c199,
+    0x1f376e76bc46c0e8, 0x203c8f3c2d2cad23, 0x6120ace39e921b7e, 0x5e2b4da90ff876b5,
+    0x899f4e23ddb20719, 0xb694af694cd86ad2, 0xf7888cb6ff66dc8f, 0xc8836dfc6e0cb144,
+    0x75b0cb09981bb035, 0x4abb2a430971ddfe, 0xba7099cbacf6ba3, 0x34ace8d62ba50668,
+    0x3617a1a2b155967e, 0x91c40e8203ffbb5, 0x4800633793814de8, 0x770b827d02eb2023,
+    0xca382488f4fc2152, 0xf533c5c265964c99, 0xb42fe61dd628fac4, 0x8b2407574742970f,
+    0x5c9004dd9508e6a3, 0x639be59704628b68, 0x2287c648b7dc3d35, 0x1d8c270226b650fe,
+    0xa0bf81f7d0a1518f, 0x9fb460bd41cb3c44, 0xdea84362f2758a19, 0xe1a3a228631fe7d2,
+    0xdbded18bc794aa35, 0xe4d530c156fec7fe, 0xa5c9131ee54071a3, 0x9ac2f254742a1c68,
+    0x27f154a1823d1d19, 0x18fab5eb135770d2, 0x59e69634a0e9c68f, 0x66ed777e3183ab44,
+    0xb15974f4e3c9dae8, 0x8e5295be72a3b723, 0xcf4eb661c11d017e, 0xf045572b50776cb5,
+    0x4d76f1dea6606dc4, 0x727d1094370a000f, 0x3361334b84b4b652, 0xc6ad20115dedb99,
+    0xed19b758f2e4b8f, 0x31da7a3f1e442644, 0x70c659e0adfa9019, 0x4fcdb8aa3c90fdd2,
+    0xf2fe1e5fca87fca3, 0xcdf5ff155bed9168, 0x8ce9dccae8532735, 0xb3e23d8079394afe,
+    0x64563e0aab733b52, 0x5b5ddf403a195699, 0x1a41fc9f89a7e0c4, 0x254a1dd518cd8d0f,
+    0x9879bb20eeda8c7e, 0xa7725a6a7fb0e1b5, 0xe66e79b5cc0e57e8, 0xd96598ff5d643a23,
+    0x92949ef28518cc26, 0xad9f7fb81472a1ed, 0xec835c67a7cc17b0, 0xd388bd2d36a67a7b,
+    0x6ebb1bd8c0b17b0a, 0x51b0fa9251db16c1, 0x10acd94de265a09c, 0x2fa73807730fcd57,
+    0xf8133b8da145bcfb, 0xc718dac7302fd130, 0x8604f9188391676d, 0xb90f185212fb0aa6,
+    0x43cbea7e4ec0bd7, 0x3b375fed7586661c, 0x7a2b7c32c638d041, 0x45209d785752bd8a,
+    0x479bd40ccda22d9c, 0x789035465cc84057, 0x398c1699ef76f60a, 0x687f7d37e1c9bc1,
+    0xbbb45126880b9ab0, 0x84bfb06c1961f77b, 0xc5a393b3aadf4126, 0xfaa872f93bb52ced,
+    0x2d1c7173e9ff5d41, 0x121790397895308a, 0x530bb3e6cb2b86d7, 0x6c0052ac5a41eb1c,
+    0xd133f459ac56ea6d, 0xee3815133d3c87a6, 0xaf2436cc8e8231fb, 0x902fd7861fe85c30,
+    0xaa52a425bb6311d7, 0x9559456f2a097c1c, 0xd44566b099b7ca41, 0xeb4e87fa08dda78a,
+    0x567d210ffecaa6fb, 0x6976c0456fa0cb30, 0x286ae39adc1e7d6d, 0x176102d04d7410a6,
+    0xc0d5015a9f3e610a, 0xffdee0100e540cc1, 0xbec2c3cfbdeaba9c, 0x81c922852c80d757,
+    0x3cfa8470da97d626, 0x3f1653a4bfdbbed, 0x42ed46e5f8430db0, 0x7de6a7af6929607b,
+    0x7f5deedbf3d9f06d, 0x40560f9162b39da6, 0x14a2c4ed10d2bfb, 0x3e41cd0440674630,
+    0x83726bf1b6704741, 0xbc798abb271a2a8a, 0xfd65a96494a49cd7, 0xc26e482e05cef11c,
+    0x15da4ba4d78480b0, 0x2ad1aaee46eeed7b, 0x6bcd8931f5505b26, 0x54c6687b643a36ed,
+    0xe9f5ce8e922d379c, 0xd6fe2fc403475a57, 0x97e20c1bb0f9ec0a, 0xa8e9ed51219381c1,
+  },
+  {
+    0, 0x1dee8a5e222ca1dc, 0x3bdd14bc445943b8, 0x26339ee26675e264,
+    0x77ba297888b28770, 0x6a54a326aa9e26ac, 0x4c673dc4ccebc4c8, 0x5189b79aeec76514,
+    0xef7452f111650ee0, 0xf29ad8af3349af3c, 0xd4a9464d553c4d58, 0xc947cc137710ec84,
+    0x98ce7b8999d78990, 0x8520f1d7bbfb284c, 0xa3136f35dd8eca28, 0xbefde56bffa26bf4,
+    0x4c300ac98dc40345, 0x51de8097afe8a299, 0x77ed1e75c99d40fd, 0x6a03942bebb1e121,
+    0x3b8a23b105768435, 0x2664a9ef275a25e9, 0x57370d412fc78d, 0x1db9bd5363036651,
+    0xa34458389ca10da5, 0xbeaad266be8dac79, 0x98994c84d8f84e1d, 0x8577c6dafad4efc1,
+    0xd4fe714014138ad5, 0xc910fb1e363f2b09, 0xef2365fc504ac96d, 0xf2cdefa2726668b1,
+    0x986015931b88068a, 0x858e9fcd39a4a756, 0xa3bd012f5fd14532, 0xbe538b717dfde4ee,
+    0xefda3ceb933a81fa, 0xf234b6b5b1162026, 0xd4072857d763c242, 0xc9e9a209f54f639e,
+    0x771447620aed086a, 0x6afacd3c28c1a9b6, 0x4cc953de4eb44bd2, 0x5127d9806c98ea0e,
+    0xae6e1a825f8f1a, 0x1d40e444a0732ec6, 0x3b737aa6c606cca2, 0x269df0f8e42a6d7e,
+    0xd4501f5a964c05cf, 0xc9be9504b460a413, 0xef8d0be6d2154677, 0xf26381b8f039e7ab,
+    0xa3ea36221efe82bf, 0xbe04bc7c3cd22363, 0x9837229e5aa7c107, 0x85d9a8c0788b60db,
+    0x3b244dab87290b2f, 0x26cac7f5a505aaf3, 0xf95917c3704897, 0x1d17d349e15ce94b,
+    0x4c9e64d30f9b8c5f, 0x5170ee8d2db72d83, 0x7743706f4bc2cfe7, 0x6aadfa3169ee6e3b,
+    0xa218840d981e1391, 0xbff60e53ba32b24d, 0x99c590b1dc475029, 0x842b1aeffe6bf1f5,
+    0xd5a2ad7510ac94e1, 0xc84c272b3280353d, 0xee7fb9c954f5d759, 0xf391339776d97685,
+    0x4d6cd6fc897b1d71, 0x50825ca2ab57bcad, 0x76b1c240cd225ec9, 0x6b5f481eef0eff15,
+    0x3ad6ff8401c99a01, 0x273875da23e53bdd, 0x10beb384590d9b9, 0x1ce5616667bc7865,
+    0xee288ec415da10d4, 0xf3c6049a37f6b108, 0xd5f59a785183536c, 0xc81b102673aff2b0,
+    0x9992a7bc9d6897a4, 0x847c2de2bf443678, 0xa24fb300d931d41c, 0xbfa1395efb1d75c0,
+    0x15cdc3504bf1e34, 0x1cb2566b2693bfe8, 0x3a81c88940e65d8c, 0x276f42d762cafc50,
+    0x76e6f54d8c0d9944, 0x6b087f13ae213898, 0x4d3be1f1c854dafc, 0x50d56bafea787b20,
+    0x3a78919e8396151b, 0x27961bc0a1bab4c7, 0x1a58522c7cf56a3, 0x1c4b0f7ce5e3f77f,
+    0x4dc2b8e60b24926b, 0x502c32b8290833b7, 0x761fac5a4f7dd1d3, 0x6bf126046d51700f,
+    0xd50cc36f92f31bfb, 0xc8e24931b0dfba27, 0xeed1d7d3d6aa5843, 0xf33f5d8df486f99f,
+    0xa2b6ea171a419c8b, 0xbf586049386d3d57, 0x996bfeab5e18df33, 0x848574f57c347eef,
+    0x76489b570e52165e, 0x6ba611092c7eb782, 0x4d958feb4a0b55e6, 0x507b05b56827f43a,
+    0x1f2b22f86e0912e, 0x1c1c3871a4cc30f2, 0x3a2fa693c2b9d296, 0x27c12ccde095734a,
+    0x993cc9a61f3718be, 0x84d243f83d1bb962, 0xa2e1dd1a5b6e5b06, 0xbf0f57447942fada,
+    0xee86e0de97859fce, 0xf3686a80b5a93e12, 0xd55bf462d3dcdc76, 0xc8b57e3cf1f07daa,
+    0xd6e9a7309f3239a7, 0xcb072d6ebd1e987b, 0xed34b38cdb6b7a1f, 0xf0da39d2f947dbc3,
+    0xa1538e481780bed7, 0xbcbd041635ac1f0b, 0x9a8e9af453d9fd6f, 0x876010aa71f55cb3,
+    0x399df5c18e573747, 0x24737f9fac7b969b, 0x240e17dca0e74ff, 0x1fae6b23e822d523,
+    0x4e27dcb906e5b037, 0x53c956e724c911eb, 0x75fac80542bcf38f, 0x6814425b60905253,
+    0x9ad9adf912f63ae2, 0x873727a730da9b3e, 0xa104b94556af795a, 0xbcea331b7483d886,
+    0xed6384819a44bd92, 0xf08d0edfb8681c4e, 0xd6be903dde1dfe2a, 0xcb501a63fc315ff6,
+    0x75adff0803933402, 0x6843755621bf95de, 0x4e70ebb447ca77ba, 0x539e61ea65e6d666,
+    0x217d6708b21b372, 0x1ff95c2ea90d12ae, 0x39cac2cccf78f0ca, 0x24244892ed545116,
+    0x4e89b2a384ba3f2d, 0x536738fda6969ef1, 0x7554a61fc0e37c95, 0x68ba2c41e2cfdd49,
+    0x39339bdb0c08b85d, 0x24dd11852e241981, 0x2ee8f674851fbe5, 0x1f0005396a7d5a39,
+    0xa1fde05295df31cd, 0xbc136a0cb7f39011, 0x9a20f4eed1867275, 0x87ce7eb0f3aad3a9,
+    0xd647c92a1d6db6bd, 0xcba943743f411761, 0xed9add965934f505, 0xf07457c87b1854d9,
+    0x2b9b86a097e3c68, 0x1f5732342b529db4, 0x3964acd64d277fd0, 0x248a26886f0bde0c,
+    0x7503911281ccbb18, 0x68ed1b4ca3e01ac4, 0x4ede85aec595f8a0, 0x53300ff0e7b9597c,
+    0xedcdea9b181b3288, 0xf02360c53a379354, 0xd610fe275c427130, 0xcbfe74797e6ed0ec,
+    0x9a77c3e390a9b5f8, 0x879949bdb2851424, 0xa1aad75fd4f0f640, 0xbc445d01f6dc579c,
+    0x74f1233d072c2a36, 0x691fa96325008bea, 0x4f2c37814375698e, 0x52c2bddf6159c852,
+    0x34b0a458f9ead46, 0x1ea5801badb20c9a, 0x38961ef9cbc7eefe, 0x257894a7e9eb4f22,
+    0x9b8571cc164924d6, 0x866bfb923465850a, 0xa05865705210676e, 0xbdb6ef2e703cc6b2,
+    0xec3f58b49efba3a6, 0xf1d1d2eabcd7027a, 0xd7e24c08daa2e01e, 0xca0cc656f88e41c2,
+    0x38c129f48ae82973, 0x252fa3aaa8c488af, 0x31c3d48ceb16acb, 0x1ef2b716ec9dcb17,
+    0x4f7b008c025aae03, 0x52958ad220760fdf, 0x74a614304603edbb, 0x69489e6e642f4c67,
+    0xd7b57b059b8d2793, 0xca5bf15bb9a1864f, 0xec686fb9dfd4642b, 0xf186e5e7fdf8c5f7,
+    0xa00f527d133fa0e3, 0xbde1d8233113013f, 0x9bd246c15766e35b, 0x863ccc9f754a4287,
+    0xec9136ae1ca42cbc, 0xf17fbcf03e888d60, 0xd74c221258fd6f04, 0xcaa2a84c7ad1ced8,
+    0x9b2b1fd69416abcc, 0x86c59588b63a0a10, 0xa0f60b6ad04fe874, 0xbd188134f26349a8,
+    0x3e5645f0dc1225c, 0x1e0bee012fed8380, 0x383870e3499861e4, 0x25d6fabd6bb4c038,
+    0x745f4d278573a52c, 0x69b1c779a75f04f0, 0x4f82599bc12ae694, 0x526cd3c5e3064748,
+    0xa0a13c6791602ff9, 0xbd4fb639b34c8e25, 0x9b7c28dbd5396c41, 0x8692a285f715cd9d,
+    0xd71b151f19d2a889, 0xcaf59f413bfe0955, 0xecc601a35d8beb31, 0xf1288bfd7fa74aed,
+    0x4fd56e9680052119, 0x523be4c8a22980c5, 0x74087a2ac45c62a1, 0x69e6f074e670c37d,
+    0x386f47ee08b7a669, 0x2581cdb02a9b07b5, 0x3b253524ceee5d1, 0x1e5cd90c6ec2440d,
+  },
+  {
+    0, 0x5c2d776033c4205e, 0xb85aeec0678840bc, 0xe47799a0544c60e2,
+    0xe26d72ab601e9ffd, 0xbe4005cb53dabfa3, 0x5a379c6b0796df41, 0x61aeb0b3452ff1f,
+    0x56024a7d6f33217f, 0xa2f3d1d5cf70121, 0xee58a4bd08bb61c3, 0xb275d3dd3b7f419d,
+    0xb46f38d60f2dbe82, 0xe8424fb63ce99edc, 0xc35d61668a5fe3e, 0x5018a1765b61de60,
+    0xac0494fade6642fe, 0xf029e39aeda262a0, 0x145e7a3ab9ee0242, 0x48730d5a8a2a221c,
+    0x4e69e651be78dd03, 0x124491318dbcfd5d, 0xf6330891d9f09dbf, 0xaa1e7ff1ea34bde1,
+    0xfa06de87b1556381, 0xa62ba9e7829143df, 0x425c3047d6dd233d, 0x1e714727e5190363,
+    0x186bac2cd14bfc7c, 0x4446db4ce28fdc22, 0xa03142ecb6c3bcc0, 0xfc1c358c85079c9e,
+    0xcad186de13c29b79, 0x96fcf1be2006bb27, 0x728b681e744adbc5, 0x2ea61f7e478efb9b,
+    0x28bcf47573dc0484, 0x74918315401824da, 0x90e61ab514544438, 0xcccb6dd527906466,
+    0x9cd3cca37cf1ba06, 0xc0febbc34f359a58, 0x248922631b79faba, 0x78a4550328bddae4,
+    0x7ebebe081cef25fb, 0x2293c9682f2b05a5, 0xc6e450c87b676547, 0x9ac927a848a34519,
+    0x66d51224cda4d987, 0x3af86544fe60f9d9, 0xde8ffce4aa2c993b, 0x82a28b8499e8b965,
+    0x84b8608fadba467a, 0xd89517ef9e7e6624, 0x3ce28e4fca3206c6, 0x60cff92ff9f62698,
+    0x30d75859a297f8f8, 0x6cfa2f399153d8a6, 0x888db699c51fb844, 0xd4a0c1f9f6db981a,
+    0xd2ba2af2c2896705, 0x8e975d92f14d475b, 0x6ae0c432a50127b9, 0x36cdb35296c507e7,
+    0x77ba297888b2877, 0x5b56d5f7bb4f0829, 0xbf214c57ef0368cb, 0xe30c3b37dcc74895,
+    0xe516d03ce895b78a, 0xb93ba75cdb5197d4, 0x5d4c3efc8f1df736, 0x161499cbcd9d768,
+    0x5179e8eae7b80908, 0xd549f8ad47c2956, 0xe923062a803049b4, 0xb50e714ab3f469ea,
+    0xb3149a4187a696f5, 0xef39ed21b462b6ab, 0xb4e7481e02ed649, 0x576303e1d3eaf617,
+    0xab7f366d56ed6a89, 0xf752410d65294ad7, 0x1325d8ad31652a35, 0x4f08afcd02a10a6b,
+    0x491244c636f3f574, 0x153f33a60537d52a, 0xf148aa06517bb5c8, 0xad65dd6662bf9596,
+    0xfd7d7c1039de4bf6, 0xa1500b700a1a6ba8, 0x452792d05e560b4a, 0x190ae5b06d922b14,
+    0x1f100ebb59c0d40b, 0x433d79db6a04f455, 0xa74ae07b3e4894b7, 0xfb67971b0d8cb4e9,
+    0xcdaa24499b49b30e, 0x91875329a88d9350, 0x75f0ca89fcc1f3b2, 0x29ddbde9cf05d3ec,
+    0x2fc756e2fb572cf3, 0x73ea2182c8930cad, 0x979db8229cdf6c4f, 0xcbb0cf42af1b4c11,
+    0x9ba86e34f47a9271, 0xc7851954c7beb22f, 0x23f280f493f2d2cd, 0x7fdff794a036f293,
+    0x79c51c9f94640d8c, 0x25e86bffa7a02dd2, 0xc19ff25ff3ec4d30, 0x9db2853fc0286d6e,
+    0x61aeb0b3452ff1f0, 0x3d83c7d376ebd1ae, 0xd9f45e7322a7b14c, 0x85d9291311639112,
+    0x83c3c21825316e0d, 0xdfeeb57816f54e53, 0x3b992cd842b92eb1, 0x67b45bb8717d0eef,
+    0x37acface2a1cd08f, 0x6b818dae19d8f0d1, 0x8ff6140e4d949033, 0xd3db636e7e50b06d,
+    0xd5c188654a024f72, 0x89ecff0579c66f2c, 0x6d9b66a52d8a0fce, 0x31b611c51e4e2f90,
+    0xef7452f111650ee, 0x52da324f22d270b0, 0xb6adabef769e1052, 0xea80dc8f455a300c,
+    0xec9a37847108cf13, 0xb0b740e442ccef4d, 0x54c0d94416808faf, 0x8edae242544aff1,
+    0x58f50f527e257191, 0x4d878324de151cf, 0xe0afe19219ad312d, 0xbc8296f22a691173,
+    0xba987df91e3bee6c, 0xe6b50a992dffce32, 0x2c2933979b3aed0, 0x5eefe4594a778e8e,
+    0xa2f3d1d5cf701210, 0xfedea6b5fcb4324e, 0x1aa93f15a8f852ac, 0x468448759b3c72f2,
+    0x409ea37eaf6e8ded, 0x1cb3d41e9caaadb3, 0xf8c44dbec8e6cd51, 0xa4e93adefb22ed0f,
+    0xf4f19ba8a043336f, 0xa8dcecc893871331, 0x4cab7568c7cb73d3, 0x10860208f40f538d,
+    0x169ce903c05dac92, 0x4ab19e63f3998ccc, 0xaec607c3a7d5ec2e, 0xf2eb70a39411cc70,
+    0xc426c3f102d4cb97, 0x980bb4913110ebc9, 0x7c7c2d31655c8b2b, 0x20515a515698ab75,
+    0x264bb15a62ca546a, 0x7a66c63a510e7434, 0x9e115f9a054214d6, 0xc23c28fa36863488,
+    0x9224898c6de7eae8, 0xce09feec5e23cab6, 0x2a7e674c0a6faa54, 0x7653102c39ab8a0a,
+    0x7049fb270df97515, 0x2c648c473e3d554b, 0xc81315e76a7135a9, 0x943e628759b515f7,
+    0x6822570bdcb28969, 0x340f206bef76a937, 0xd078b9cbbb3ac9d5, 0x8c55ceab88fee98b,
+    0x8a4f25a0bcac1694, 0xd66252c08f6836ca, 0x3215cb60db245628, 0x6e38bc00e8e07676,
+    0x3e201d76b381a816, 0x620d6a1680458848, 0x867af3b6d409e8aa, 0xda5784d6e7cdc8f4,
+    0xdc4d6fddd39f37eb, 0x806018bde05b17b5, 0x6417811db4177757, 0x383af67d87d35709,
+    0x98ce7b8999d7899, 0x55a190d8aa5958c7, 0xb1d60978fe153825, 0xedfb7e18cdd1187b,
+    0xebe19513f983e764, 0xb7cce273ca47c73a, 0x53bb7bd39e0ba7d8, 0xf960cb3adcf8786,
+    0x5f8eadc5f6ae59e6, 0x3a3daa5c56a79b8, 0xe7d443059126195a, 0xbbf93465a2e23904,
+    0xbde3df6e96b0c61b, 0xe1cea80ea574e645, 0x5b931aef13886a7, 0x599446cec2fca6f9,
+    0xa588734247fb3a67, 0xf9a50422743f1a39, 0x1dd29d8220737adb, 0x41ffeae213b75a85,
+    0x47e501e927e5a59a, 0x1bc87689142185c4, 0xffbfef29406de526, 0xa392984973a9c578,
+    0xf38a393f28c81b18, 0xafa74e5f1b0c3b46, 0x4bd0d7ff4f405ba4, 0x17fda09f7c847bfa,
+    0x11e74b9448d684e5, 0x4dca3cf47b12a4bb, 0xa9bda5542f5ec459, 0xf590d2341c9ae407,
+    0xc35d61668a5fe3e0, 0x9f701606b99bc3be, 0x7b078fa6edd7a35c, 0x272af8c6de138302,
+    0x213013cdea417c1d, 0x7d1d64add9855c43, 0x996afd0d8dc93ca1, 0xc5478a6dbe0d1cff,
+    0x955f2b1be56cc29f, 0xc9725c7bd6a8e2c1, 0x2d05c5db82e48223, 0x7128b2bbb120a27d,
+    0x773259b085725d62, 0x2b1f2ed0b6b67d3c, 0xcf68b770e2fa1dde, 0x9345c010d13e3d80,
+    0x6f59f59c5439a11e, 0x337482fc67fd8140, 0xd7031b5c33b1e1a2, 0x8b2e6c3c0075c1fc,
+    0x8d34873734273ee3, 0xd119f05707e31ebd, 0x356e69f753af7e5f, 0x69431e97606b5e01,
+    0x395bbfe13b0a8061, 0x6576c88108cea03f, 0x810151215c82c0dd, 0xdd2c26416f46e083,
+    0xdb36cd4a5b141f9c, 0x871bba2a68d03fc2, 0x636c238a3c9c5f20, 0x3f4154ea0f587f7e,
+  },
+  {
+    0, 0x6184d55f721267c6, 0xc309aabee424cf8c, 0xa28d7fe19636a84a,
+    0x14cbfa566747819d, 0x754f2f091555e65b, 0xd7c250e883634e11, 0xb64685b7f17129d7,
+    0x2997f4acce8f033a, 0x481321f3bc9d64fc, 0xea9e5e122aabccb6, 0x8b1a8b4d58b9ab70,
+    0x3d5c0efaa9c882a7, 0x5cd8dba5dbdae561, 0xfe55a4444dec4d2b, 0x9fd1711b3ffe2aed,
+    0x532fe9599d1e0674, 0x32ab3c06ef0c61b2, 0x902643e7793ac9f8, 0xf1a296b80b28ae3e,
+    0x47e4130ffa5987e9, 0x2660c650884be02f, 0x84edb9b11e7d4865, 0xe5696cee6c6f2fa3,
+    0x7ab81df55391054e, 0x1b3cc8aa21836288, 0xb9b1b74bb7b5cac2, 0xd8356214c5a7ad04,
+    0x6e73e7a334d684d3, 0xff732fc46c4e315, 0xad7a4d1dd0f24b5f, 0xccfe9842a2e02c99,
+    0xa65fd2b33a3c0ce8, 0xc7db07ec482e6b2e, 0x6556780dde18c364, 0x4d2ad52ac0aa4a2,
+    0xb29428e55d7b8d75, 0xd310fdba2f69eab3, 0x719d825bb95f42f9, 0x10195704cb4d253f,
+    0x8fc8261ff4b30fd2, 0xee4cf34086a16814, 0x4cc18ca11097c05e, 0x2d4559fe6285a798,
+    0x9b03dc4993f48e4f, 0xfa870916e1e6e989, 0x580a76f777d041c3, 0x398ea3a805c22605,
+    0xf5703beaa7220a9c, 0x94f4eeb5d5306d5a, 0x367991544306c510, 0x57fd440b3114a2d6,
+    0xe1bbc1bcc0658b01, 0x803f14e3b277ecc7, 0x22b26b022441448d, 0x4336be5d5653234b,
+    0xdce7cf4669ad09a6, 0xbd631a191bbf6e60, 0x1fee65f88d89c62a, 0x7e6ab0a7ff9ba1ec,
+    0xc82c35100eea883b, 0xa9a8e04f7cf8effd, 0xb259faeeace47b7, 0x6aa14af198dc2071,
+    0xde670a4ddb760755, 0xbfe3df12a9646093, 0x1d6ea0f33f52c8d9, 0x7cea75ac4d40af1f,
+    0xcaacf01bbc3186c8, 0xab282544ce23e10e, 0x9a55aa558154944, 0x68218ffa2a072e82,
+    0xf7f0fee115f9046f, 0x96742bbe67eb63a9, 0x34f9545ff1ddcbe3, 0x557d810083cfac25,
+    0xe33b04b772be85f2, 0x82bfd1e800ace234, 0x2032ae09969a4a7e, 0x41b67b56e4882db8,
+    0x8d48e31446680121, 0xeccc364b347a66e7, 0x4e4149aaa24ccead, 0x2fc59cf5d05ea96b,
+    0x99831942212f80bc, 0xf807cc1d533de77a, 0x5a8ab3fcc50b4f30, 0x3b0e66a3b71928f6,
+    0xa4df17b888e7021b, 0xc55bc2e7faf565dd, 0x67d6bd066cc3cd97, 0x65268591ed1aa51,
+    0xb014edeeefa08386, 0xd19038b19db2e440, 0x731d47500b844c0a, 0x1299920f79962bcc,
+    0x7838d8fee14a0bbd, 0x19bc0da193586c7b, 0xbb317240056ec431, 0xdab5a71f777ca3f7,
+    0x6cf322a8860d8a20, 0xd77f7f7f41fede6, 0xaffa8816622945ac, 0xce7e5d49103b226a,
+    0x51af2c522fc50887, 0x302bf90d5dd76f41, 0x92a686eccbe1c70b, 0xf32253b3b9f3a0cd,
+    0x4564d6044882891a, 0x24e0035b3a90eedc, 0x866d7cbaaca64696, 0xe7e9a9e5deb42150,
+    0x2b1731a77c540dc9, 0x4a93e4f80e466a0f, 0xe81e9b199870c245, 0x899a4e46ea62a583,
+    0x3fdccbf11b138c54, 0x5e581eae6901eb92, 0xfcd5614fff3743d8, 0x9d51b4108d25241e,
+    0x280c50bb2db0ef3, 0x63041054c0c96935, 0xc1896fb556ffc17f, 0xa00dbaea24eda6b9,
+    0x164b3f5dd59c8f6e, 0x77cfea02a78ee8a8, 0xd54295e331b840e2, 0xb4c640bc43aa2724,
+    0x2e16bbb019e2102f, 0x4f926eef6bf077e9, 0xed1f110efdc6dfa3, 0x8c9bc4518fd4b865,
+    0x3add41e67ea591b2, 0x5b5994b90cb7f674, 0xf9d4eb589a815e3e, 0x98503e07e89339f8,
+    0x7814f1cd76d1315, 0x66059a43a57f74d3, 0xc488e5a23349dc99, 0xa50c30fd415bbb5f,
+    0x134ab54ab02a9288, 0x72ce6015c238f54e, 0xd0431ff4540e5d04, 0xb1c7caab261c3ac2,
+    0x7d3952e984fc165b, 0x1cbd87b6f6ee719d, 0xbe30f85760d8d9d7, 0xdfb42d0812cabe11,
+    0x69f2a8bfe3bb97c6, 0x8767de091a9f000, 0xaafb0201079f584a, 0xcb7fd75e758d3f8c,
+    0x54aea6454a731561, 0x352a731a386172a7, 0x97a70cfbae57daed, 0xf623d9a4dc45bd2b,
+    0x40655c132d3494fc, 0x21e1894c5f26f33a, 0x836cf6adc9105b70, 0xe2e823f2bb023cb6,
+    0x8849690323de1cc7, 0xe9cdbc5c51cc7b01, 0x4b40c3bdc7fad34b, 0x2ac416e2b5e8b48d,
+    0x9c82935544999d5a, 0xfd06460a368bfa9c, 0x5f8b39eba0bd52d6, 0x3e0fecb4d2af3510,
+    0xa1de9dafed511ffd, 0xc05a48f09f43783b, 0x62d737110975d071, 0x353e24e7b67b7b7,
+    0xb51567f98a169e60, 0xd491b2a6f804f9a6, 0x761ccd476e3251ec, 0x179818181c20362a,
+    0xdb66805abec01ab3, 0xbae25505ccd27d75, 0x186f2ae45ae4d53f, 0x79ebffbb28f6b2f9,
+    0xcfad7a0cd9879b2e, 0xae29af53ab95fce8, 0xca4d0b23da354a2, 0x6d2005ed4fb13364,
+    0xf2f174f6704f1989, 0x9375a1a9025d7e4f, 0x31f8de48946bd605, 0x507c0b17e679b1c3,
+    0xe63a8ea017089814, 0x87be5bff651affd2, 0x2533241ef32c5798, 0x44b7f141813e305e,
+    0xf071b1fdc294177a, 0x91f564a2b08670bc, 0x33781b4326b0d8f6, 0x52fcce1c54a2bf30,
+    0xe4ba4baba5d396e7, 0x853e9ef4d7c1f121, 0x27b3e11541f7596b, 0x4637344a33e53ead,
+    0xd9e645510c1b1440, 0xb862900e7e097386, 0x1aefefefe83fdbcc, 0x7b6b3ab09a2dbc0a,
+    0xcd2dbf076b5c95dd, 0xaca96a58194ef21b, 0xe2415b98f785a51, 0x6fa0c0e6fd6a3d97,
+    0xa35e58a45f8a110e, 0xc2da8dfb2d9876c8, 0x6057f21abbaede82, 0x1d32745c9bcb944,
+    0xb795a2f238cd9093, 0xd61177ad4adff755, 0x749c084cdce95f1f, 0x1518dd13aefb38d9,
+    0x8ac9ac0891051234, 0xeb4d7957e31775f2, 0x49c006b67521ddb8, 0x2844d3e90733ba7e,
+    0x9e02565ef64293a9, 0xff8683018450f46f, 0x5d0bfce012665c25, 0x3c8f29bf60743be3,
+    0x562e634ef8a81b92, 0x37aab6118aba7c54, 0x9527c9f01c8cd41e, 0xf4a31caf6e9eb3d8,
+    0x42e599189fef9a0f, 0x23614c47edfdfdc9, 0x81ec33a67bcb5583, 0xe068e6f909d93245,
+    0x7fb997e2362718a8, 0x1e3d42bd44357f6e, 0xbcb03d5cd203d724, 0xdd34e803a011b0e2,
+    0x6b726db451609935, 0xaf6b8eb2372fef3, 0xa87bc70ab54456b9, 0xc9ff1255c756317f,
+    0x5018a1765b61de6, 0x64855f4817a47a20, 0xc60820a98192d26a, 0xa78cf5f6f380b5ac,
+    0x11ca704102f19c7b, 0x704ea51e70e3fbbd, 0xd2c3daffe6d553f7, 0xb3470fa094c73431,
+    0x2c967ebbab391edc, 0x4d12abe4d92b791a, 0xef9fd4054f1dd150, 0x8e1b015a3d0fb696,
+    0x385d84edcc7e9f41, 0x59d951b2be6cf887, 0xfb542e53285a50cd, 0x9ad0fb0c5a48370b,
+  },
+  {
+    0, 0x22ef0d5934f964ec, 0x45de1ab269f2c9d8, 0x673117eb5d0bad34,
+    0x8bbc3564d3e593b0, 0xa953383de71cf75c, 0xce622fd6ba175a68, 0xec8d228f8eee3e84,
+    0x85a0c5e208c539e5, 0xa74fc8bb3c3c5d09, 0xc07edf506137f03d, 0xe291d20955ce94d1,
+    0xe1cf086db20aa55, 0x2cf3fddfefd9ceb9, 0x4bc2ea34b2d2638d, 0x692de76d862b0761,
+    0x999924efbe846d4f, 0xbb7629b68a7d09a3, 0xdc473e5dd776a497, 0xfea83304e38fc07b,
+    0x1225118b6d61feff, 0x30ca1cd259989a13, 0x57fb0b3904933727, 0x75140660306a53cb,
+    0x1c39e10db64154aa, 0x3ed6ec5482b83046, 0x59e7fbbfdfb39d72, 0x7b08f6e6eb4af99e,
+    0x9785d46965a4c71a, 0xb56ad930515da3f6, 0xd25bcedb0c560ec2, 0xf0b4c38238af6a2e,
+    0xa1eae6f4d206c41b, 0x8305ebade6ffa0f7, 0xe434fc46bbf40dc3, 0xc6dbf11f8f0d692f,
+    0x2a56d39001e357ab, 0x8b9dec9351a3347, 0x6f88c92268119e73, 0x4d67c47b5ce8fa9f,
+    0x244a2316dac3fdfe, 0x6a52e4fee3a9912, 0x619439a4b3313426, 0x437b34fd87c850ca,
+    0xaff6167209266e4e, 0x8d191b2b3ddf0aa2, 0xea280cc060d4a796, 0xc8c70199542dc37a,
+    0x3873c21b6c82a954, 0x1a9ccf42587bcdb8, 0x7dadd8a90570608c, 0x5f42d5f031890460,
+    0xb3cff77fbf673ae4, 0x9120fa268b9e5e08, 0xf611edcdd695f33c, 0xd4fee094e26c97d0,
+    0xbdd307f9644790b1, 0x9f3c0aa050bef45d, 0xf80d1d4b0db55969, 0xdae21012394c3d85,
+    0x366f329db7a20301, 0x14803fc4835b67ed, 0x73b1282fde50cad9, 0x515e2576eaa9ae35,
+    0xd10d62c20b0396b3, 0xf3e26f9b3ffaf25f, 0x94d3787062f15f6b, 0xb63c752956083b87,
+    0x5ab157a6d8e60503, 0x785e5affec1f61ef, 0x1f6f4d14b114ccdb, 0x3d80404d85eda837,
+    0x54ada72003c6af56, 0x7642aa79373fcbba, 0x1173bd926a34668e, 0x339cb0cb5ecd0262,
+    0xdf119244d0233ce6, 0xfdfe9f1de4da580a, 0x9acf88f6b9d1f53e, 0xb82085af8d2891d2,
+    0x4894462db587fbfc, 0x6a7b4b74817e9f10, 0xd4a5c9fdc753224, 0x2fa551c6e88c56c8,
+    0xc32873496662684c, 0xe1c77e10529b0ca0, 0x86f669fb0f90a194, 0xa41964a23b69c578,
+    0xcd3483cfbd42c219, 0xefdb8e9689bba6f5, 0x88ea997dd4b00bc1, 0xaa059424e0496f2d,
+    0x4688b6ab6ea751a9, 0x6467bbf25a5e3545, 0x356ac1907559871, 0x21b9a14033acfc9d,
+    0x70e78436d90552a8, 0x5208896fedfc3644, 0x35399e84b0f79b70, 0x17d693dd840eff9c,
+    0xfb5bb1520ae0c118, 0xd9b4bc0b3e19a5f4, 0xbe85abe0631208c0, 0x9c6aa6b957eb6c2c,
+    0xf54741d4d1c06b4d, 0xd7a84c8de5390fa1, 0xb0995b66b832a295, 0x9276563f8ccbc679,
+    0x7efb74b00225f8fd, 0x5c1479e936dc9c11, 0x3b256e026bd73125, 0x19ca635b5f2e55c9,
+    0xe97ea0d967813fe7, 0xcb91ad8053785b0b, 0xaca0ba6b0e73f63f, 0x8e4fb7323a8a92d3,
+    0x62c295bdb464ac57, 0x402d98e4809dc8bb, 0x271c8f0fdd96658f, 0x5f38256e96f0163,
+    0x6cde653b6f440602, 0x4e3168625bbd62ee, 0x29007f8906b6cfda, 0xbef72d0324fab36,
+    0xe762505fbca195b2, 0xc58d5d068858f15e, 0xa2bc4aedd5535c6a, 0x805347b4e1aa3886,
+    0x30c26aafb90933e3, 0x122d67f68df0570f, 0x751c701dd0fbfa3b, 0x57f37d44e4029ed7,
+    0xbb7e5fcb6aeca053, 0x999152925e15c4bf, 0xfea04579031e698b, 0xdc4f482037e70d67,
+    0xb562af4db1cc0a06, 0x978da21485356eea, 0xf0bcb5ffd83ec3de, 0xd253b8a6ecc7a732,
+    0x3ede9a29622999b6, 0x1c31977056d0fd5a, 0x7b00809b0bdb506e, 0x59ef8dc23f223482,
+    0xa95b4e40078d5eac, 0x8bb4431933743a40, 0xec8554f26e7f9774, 0xce6a59ab5a86f398,
+    0x22e77b24d468cd1c, 0x8767de091a9f0, 0x67396196bd9a04c4, 0x45d66ccf89636028,
+    0x2cfb8ba20f486749, 0xe1486fb3bb103a5, 0x6925911066baae91, 0x4bca9c495243ca7d,
+    0xa747bec6dcadf4f9, 0x85a8b39fe8549015, 0xe299a474b55f3d21, 0xc076a92d81a659cd,
+    0x91288c5b6b0ff7f8, 0xb3c781025ff69314, 0xd4f696e902fd3e20, 0xf6199bb036045acc,
+    0x1a94b93fb8ea6448, 0x387bb4668c1300a4, 0x5f4aa38dd118ad90, 0x7da5aed4e5e1c97c,
+    0x148849b963cace1d, 0x366744e05733aaf1, 0x5156530b0a3807c5, 0x73b95e523ec16329,
+    0x9f347cddb02f5dad, 0xbddb718484d63941, 0xdaea666fd9dd9475, 0xf8056b36ed24f099,
+    0x8b1a8b4d58b9ab7, 0x2a5ea5ede172fe5b, 0x4d6fb206bc79536f, 0x6f80bf5f88803783,
+    0x830d9dd0066e0907, 0xa1e2908932976deb, 0xc6d387626f9cc0df, 0xe43c8a3b5b65a433,
+    0x8d116d56dd4ea352, 0xaffe600fe9b7c7be, 0xc8cf77e4b4bc6a8a, 0xea207abd80450e66,
+    0x6ad58320eab30e2, 0x2442556b3a52540e, 0x437342806759f93a, 0x619c4fd953a09dd6,
+    0xe1cf086db20aa550, 0xc320053486f3c1bc, 0xa41112dfdbf86c88, 0x86fe1f86ef010864,
+    0x6a733d0961ef36e0, 0x489c30505516520c, 0x2fad27bb081dff38, 0xd422ae23ce49bd4,
+    0x646fcd8fbacf9cb5, 0x4680c0d68e36f859, 0x21b1d73dd33d556d, 0x35eda64e7c43181,
+    0xefd3f8eb692a0f05, 0xcd3cf5b25dd36be9, 0xaa0de25900d8c6dd, 0x88e2ef003421a231,
+    0x78562c820c8ec81f, 0x5ab921db3877acf3, 0x3d883630657c01c7, 0x1f673b695185652b,
+    0xf3ea19e6df6b5baf, 0xd10514bfeb923f43, 0xb6340354b6999277, 0x94db0e0d8260f69b,
+    0xfdf6e960044bf1fa, 0xdf19e43930b29516, 0xb828f3d26db93822, 0x9ac7fe8b59405cce,
+    0x764adc04d7ae624a, 0x54a5d15de35706a6, 0x3394c6b6be5cab92, 0x117bcbef8aa5cf7e,
+    0x4025ee99600c614b, 0x62cae3c054f505a7, 0x5fbf42b09fea893, 0x2714f9723d07cc7f,
+    0xcb99dbfdb3e9f2fb, 0xe976d6a487109617, 0x8e47c14fda1b3b23, 0xaca8cc16eee25fcf,
+    0xc5852b7b68c958ae, 0xe76a26225c303c42, 0x805b31c9013b9176, 0xa2b43c9035c2f59a,
+    0x4e391e1fbb2ccb1e, 0x6cd613468fd5aff2, 0xbe704add2de02c6, 0x290809f4e627662a,
+    0xd9bcca76de880c04, 0xfb53c72fea7168e8, 0x9c62d0c4b77ac5dc, 0xbe8ddd9d8383a130,
+    0x5200ff120d6d9fb4, 0x70eff24b3994fb58, 0x17dee5a0649f566c, 0x3531e8f950663280,
+    0x5c1c0f94d64d35e1, 0x7ef302cde2b4510d, 0x19c21526bfbffc39, 0x3b2d187f8b4698d5,
+    0xd7a03af005a8a651, 0xf54f37a93151c2bd, 0x927e20426c5a6f89, 0xb0912d1b58a30b65,
+  },
+  {
+    0, 0xdabe95afc7875f40, 0x27a584742000a005, 0xfd1b11dbe787ff45,
+    0x4f4b08e84001400a, 0x95f59d4787861f4a, 0x68ee8c9c6001e00f, 0xb2501933a786bf4f,
+    0x9e9611d080028014, 0x4428847f4785df54, 0xb93395a4a0022011, 0x638d000b67857f51,
+    0xd1dd1938c003c01e, 0xb638c9707849f5e, 0xf6789d4ce003601b, 0x2cc608e327843f5b,
+    0xaff48c8aaf0b1ead, 0x754a1925688c41ed, 0x885108fe8f0bbea8, 0x52ef9d51488ce1e8,
+    0xe0bf8462ef0a5ea7, 0x3a0111cd288d01e7, 0xc71a0016cf0afea2, 0x1da495b9088da1e2,
+    0x31629d5a2f099eb9, 0xebdc08f5e88ec1f9, 0x16c7192e0f093ebc, 0xcc798c81c88e61fc,
+    0x7e2995b26f08deb3, 0xa497001da88f81f3, 0x598c11c64f087eb6, 0x83328469888f21f6,
+    0xcd31b63ef11823df, 0x178f2391369f7c9f, 0xea94324ad11883da, 0x302aa7e5169fdc9a,
+    0x827abed6b11963d5, 0x58c42b79769e3c95, 0xa5df3aa29119c3d0, 0x7f61af0d569e9c90,
+    0x53a7a7ee711aa3cb, 0x89193241b69dfc8b, 0x7402239a511a03ce, 0xaebcb635969d5c8e,
+    0x1cecaf06311be3c1, 0xc6523aa9f69cbc81, 0x3b492b72111b43c4, 0xe1f7beddd69c1c84,
+    0x62c53ab45e133d72, 0xb87baf1b99946232, 0x4560bec07e139d77, 0x9fde2b6fb994c237,
+    0x2d8e325c1e127d78, 0xf730a7f3d9952238, 0xa2bb6283e12dd7d, 0xd0952387f995823d,
+    0xfc532b64de11bd66, 0x26edbecb1996e226, 0xdbf6af10fe111d63, 0x1483abf39964223,
+    0xb318238c9e10fd6c, 0x69a6b6235997a22c, 0x94bda7f8be105d69, 0x4e03325779970229,
+    0x8bbc3564d3e593b, 0xd20556f98ab9067b, 0x2f1e47226d3ef93e, 0xf5a0d28daab9a67e,
+    0x47f0cbbe0d3f1931, 0x9d4e5e11cab84671, 0x60554fca2d3fb934, 0xbaebda65eab8e674,
+    0x962dd286cd3cd92f, 0x4c9347290abb866f, 0xb18856f2ed3c792a, 0x6b36c35d2abb266a,
+    0xd966da6e8d3d9925, 0x3d84fc14abac665, 0xfec35e1aad3d3920, 0x247dcbb56aba6660,
+    0xa74f4fdce2354796, 0x7df1da7325b218d6, 0x80eacba8c235e793, 0x5a545e0705b2b8d3,
+    0xe8044734a234079c, 0x32bad29b65b358dc, 0xcfa1c3408234a799, 0x151f56ef45b3f8d9,
+    0x39d95e0c6237c782, 0xe367cba3a5b098c2, 0x1e7cda7842376787, 0xc4c24fd785b038c7,
+    0x769256e422368788, 0xac2cc34be5b1d8c8, 0x5137d2900236278d, 0x8b89473fc5b178cd,
+    0xc58a7568bc267ae4, 0x1f34e0c77ba125a4, 0xe22ff11c9c26dae1, 0x389164b35ba185a1,
+    0x8ac17d80fc273aee, 0x507fe82f3ba065ae, 0xad64f9f4dc279aeb, 0x77da6c5b1ba0c5ab,
+    0x5b1c64b83c24faf0, 0x81a2f117fba3a5b0, 0x7cb9e0cc1c245af5, 0xa6077563dba305b5,
+    0x14576c507c25bafa, 0xcee9f9ffbba2e5ba, 0x33f2e8245c251aff, 0xe94c7d8b9ba245bf,
+    0x6a7ef9e2132d6449, 0xb0c06c4dd4aa3b09, 0x4ddb7d96332dc44c, 0x9765e839f4aa9b0c,
+    0x2535f10a532c2443, 0xff8b64a594ab7b03, 0x290757e732c8446, 0xd82ee0d1b4abdb06,
+    0xf4e8e832932fe45d, 0x2e567d9d54a8bb1d, 0xd34d6c46b32f4458, 0x9f3f9e974a81b18,
+    0xbba3e0dad32ea457, 0x611d757514a9fb17, 0x9c0664aef32e0452, 0x46b8f10134a95b12,
+    0x117786ac9a7cb276, 0xcbc913035dfbed36, 0x36d202d8ba7c1273, 0xec6c97777dfb4d33,
+    0x5e3c8e44da7df27c, 0x84821beb1dfaad3c, 0x79990a30fa7d5279, 0xa3279f9f3dfa0d39,
+    0x8fe1977c1a7e3262, 0x555f02d3ddf96d22, 0xa84413083a7e9267, 0x72fa86a7fdf9cd27,
+    0xc0aa9f945a7f7268, 0x1a140a3b9df82d28, 0xe70f1be07a7fd26d, 0x3db18e4fbdf88d2d,
+    0xbe830a263577acdb, 0x643d9f89f2f0f39b, 0x99268e5215770cde, 0x43981bfdd2f0539e,
+    0xf1c802ce7576ecd1, 0x2b769761b2f1b391, 0xd66d86ba55764cd4, 0xcd3131592f11394,
+    0x20151bf6b5752ccf, 0xfaab8e5972f2738f, 0x7b09f8295758cca, 0xdd0e0a2d52f2d38a,
+    0x6f5e131ef5746cc5, 0xb5e086b132f33385, 0x48fb976ad574ccc0, 0x924502c512f39380,
+    0xdc4630926b6491a9, 0x6f8a53dace3cee9, 0xfbe3b4e64b6431ac, 0x215d21498ce36eec,
+    0x930d387a2b65d1a3, 0x49b3add5ece28ee3, 0xb4a8bc0e0b6571a6, 0x6e1629a1cce22ee6,
+    0x42d02142eb6611bd, 0x986eb4ed2ce14efd, 0x6575a536cb66b1b8, 0xbfcb30990ce1eef8,
+    0xd9b29aaab6751b7, 0xd725bc056ce00ef7, 0x2a3eadde8b67f1b2, 0xf08038714ce0aef2,
+    0x73b2bc18c46f8f04, 0xa90c29b703e8d044, 0x5417386ce46f2f01, 0x8ea9adc323e87041,
+    0x3cf9b4f0846ecf0e, 0xe647215f43e9904e, 0x1b5c3084a46e6f0b, 0xc1e2a52b63e9304b,
+    0xed24adc8446d0f10, 0x379a386783ea5050, 0xca8129bc646daf15, 0x103fbc13a3eaf055,
+    0xa26fa520046c4f1a, 0x78d1308fc3eb105a, 0x85ca2154246cef1f, 0x5f74b4fbe3ebb05f,
+    0x19cc45fad742eb4d, 0xc372d05510c5b40d, 0x3e69c18ef7424b48, 0xe4d7542130c51408,
+    0x56874d129743ab47, 0x8c39d8bd50c4f407, 0x7122c966b7430b42, 0xab9c5cc970c45402,
+    0x875a542a57406b59, 0x5de4c18590c73419, 0xa0ffd05e7740cb5c, 0x7a4145f1b0c7941c,
+    0xc8115cc217412b53, 0x12afc96dd0c67413, 0xefb4d8b637418b56, 0x350a4d19f0c6d416,
+    0xb638c9707849f5e0, 0x6c865cdfbfceaaa0, 0x919d4d04584955e5, 0x4b23d8ab9fce0aa5,
+    0xf973c1983848b5ea, 0x23cd5437ffcfeaaa, 0xded645ec184815ef, 0x468d043dfcf4aaf,
+    0x28aed8a0f84b75f4, 0xf2104d0f3fcc2ab4, 0xf0b5cd4d84bd5f1, 0xd5b5c97b1fcc8ab1,
+    0x67e5d048b84a35fe, 0xbd5b45e77fcd6abe, 0x4040543c984a95fb, 0x9afec1935fcdcabb,
+    0xd4fdf3c4265ac892, 0xe43666be1dd97d2, 0xf35877b0065a6897, 0x29e6e21fc1dd37d7,
+    0x9bb6fb2c665b8898, 0x41086e83a1dcd7d8, 0xbc137f58465b289d, 0x66adeaf781dc77dd,
+    0x4a6be214a6584886, 0x90d577bb61df17c6, 0x6dce66608658e883, 0xb770f3cf41dfb7c3,
+    0x520eafce659088c, 0xdf9e7f5321de57cc, 0x22856e88c659a889, 0xf83bfb2701def7c9,
+    0x7b097f4e8951d63f, 0xa1b7eae14ed6897f, 0x5cacfb3aa951763a, 0x86126e956ed6297a,
+    0x344277a6c9509635, 0xeefce2090ed7c975, 0x13e7f3d2e9503630, 0xc959667d2ed76970,
+    0xe59f6e9e0953562b, 0x3f21fb31ced4096b, 0xc23aeaea2953f62e, 0x18847f45eed4a96e,
+    0xaad4667649521621, 0x706af3d98ed54961, 0x8d71e2026952b624, 0x57cf77adaed5e964,
+  },
+};
+static const CrcFold crc_cat_f16 = {
+    64, 1, 0xc96c5795d7870f42,
+    { 0xf31fd9271e228b79, 0x8260adf2381ad81c }, { 0x81f6054a7842df4, 0x6ae3efbb9dd441f3 }, { 0xdabe95afc7875f40, 0xe05dd497ca393ae4 },
+    0xdabe95afc7875f40, 0x4e1f23360b94b1ea
+};
+
+/* CRC-82/DARC */
+static const u128 crc_cat_w17[256] = {
+    U128(0, 0), U128(0x19c21, 0x669478c59dc4529c),
+    U128(0x33842, 0xcd28f18b3b88a538), U128(0x2a463, 0xabbc894ea64cf7a4),
+    U128(0x23184, 0x8e50a7123310c211), U128(0x3ada5, 0xe8c4dfd7aed4908d),
+    U128(0x109c6, 0x4378569908986729), U128(0x95e7, 0x25ec2e5c955c35b5),
+    U128(0x2208, 0x8a00a2022200c43), U128(0x1be29, 0x6e3472e5bfe45edf),
+    U128(0x31a4a, 0xc588fbab19a8a97b), U128(0x2866b, 0xa31c836e846cfbe7),
+    U128(0x2138c, 0x86f0ad321130ce52), U128(0x38fad, 0xe064d5f78cf49cce),
+    U128(0x12bce, 0x4bd85cb92ab86b6a), U128(0xb7ef, 0x2d4c247cb77c39f6),
+    U128(0x4410, 0x1140144044401886), U128(0x1d831, 0x77d46c85d9844a1a),
+    U128(0x37c52, 0xdc68e5cb7fc8bdbe), U128(0x2e073, 0xbafc9d0ee20cef22),
+    U128(0x27594, 0x9f10b3527750da97), U128(0x3e9b5, 0xf984cb97ea94880b),
+    U128(0x14dd6, 0x523842d94cd87faf), U128(0xd1f7, 0x34ac3a1cd11c2d33),
+    U128(0x6618, 0x19e01e60666014c5), U128(0x1fa39, 0x7f7466a5fba44659),
+    U128(0x35e5a, 0xd4c8efeb5de8b1fd), U128(0x2c27b, 0xb25c972ec02ce361),
+    U128(0x2579c, 0x97b0b9725570d6d4), U128(0x3cbbd, 0xf124c1b7c8b48448),
+    U128(0x16fde, 0x5a9848f96ef873ec), U128(0xf3ff, 0x3c0c303cf33c2170),
+    U128(0x8820, 0x228028808880310c), U128(0x11401, 0x4414504515446390),
+    U128(0x3b062, 0xefa8d90bb3089434), U128(0x22c43, 0x893ca1ce2eccc6a8),
+    U128(0x2b9a4, 0xacd08f92bb90f31d), U128(0x32585, 0xca44f7572654a181),
+    U128(0x181e6, 0x61f87e1980185625), U128(0x1dc7, 0x76c06dc1ddc04b9),
+    U128(0xaa28, 0x2a2022a0aaa03d4f), U128(0x13609, 0x4cb45a6537646fd3),
+    U128(0x3926a, 0xe708d32b91289877), U128(0x20e4b, 0x819cabee0ceccaeb),
+    U128(0x29bac, 0xa47085b299b0ff5e), U128(0x3078d, 0xc2e4fd770474adc2),
+    U128(0x1a3ee, 0x69587439a2385a66), U128(0x3fcf, 0xfcc0cfc3ffc08fa),
+    U128(0xcc30, 0x33c03cc0ccc0298a), U128(0x15011, 0x5554440551047b16),
+    U128(0x3f472, 0xfee8cd4bf7488cb2), U128(0x26853, 0x987cb58e6a8cde2e),
+    U128(0x2fdb4, 0xbd909bd2ffd0eb9b), U128(0x36195, 0xdb04e3176214b907),
+    U128(0x1c5f6, 0x70b86a59c4584ea3), U128(0x59d7, 0x162c129c599c1c3f),
+    U128(0xee38, 0x3b6036e0eee025c9), U128(0x17219, 0x5df44e2573247755),
+    U128(0x3d67a, 0xf648c76bd56880f1), U128(0x24a5b, 0x90dcbfae48acd26d),
+    U128(0x2dfbc, 0xb53091f2ddf0e7d8), U128(0x3439d, 0xd3a4e9374034b544),
+    U128(0x1e7fe, 0x78186079e67842e0), U128(0x7bdf, 0x1e8c18bc7bbc107c),
+    U128(0x11040, 0x4500510111006218), U128(0x8c61, 0x239429c48cc43084),
+    U128(0x22802, 0x8828a08a2a88c720), U128(0x3b423, 0xeebcd84fb74c95bc),
+    U128(0x321c4, 0xcb50f6132210a009), U128(0x2bde5, 0xadc48ed6bfd4f295),
+    U128(0x1986, 0x678079819980531), U128(0x185a7, 0x60ec7f5d845c57ad),
+    U128(0x13248, 0x4da05b2133206e5b), U128(0xae69, 0x2b3423e4aee43cc7),
+    U128(0x20a0a, 0x8088aaaa08a8cb63), U128(0x3962b, 0xe61cd26f956c99ff),
+    U128(0x303cc, 0xc3f0fc330030ac4a), U128(0x29fed, 0xa56484f69df4fed6),
+    U128(0x3b8e, 0xed80db83bb80972), U128(0x1a7af, 0x684c757da67c5bee),
+    U128(0x15450, 0x5440454155407a9e), U128(0xc871, 0x32d43d84c8842802),
+    U128(0x26c12, 0x9968b4ca6ec8dfa6), U128(0x3f033, 0xfffccc0ff30c8d3a),
+    U128(0x365d4, 0xda10e2536650b88f), U128(0x2f9f5, 0xbc849a96fb94ea13),
+    U128(0x5d96, 0x173813d85dd81db7), U128(0x1c1b7, 0x71ac6b1dc01c4f2b),
+    U128(0x17658, 0x5ce04f61776076dd), U128(0xea79, 0x3a7437a4eaa42441),
+    U128(0x24e1a, 0x91c8beea4ce8d3e5), U128(0x3d23b, 0xf75cc62fd12c8179),
+    U128(0x347dc, 0xd2b0e8734470b4cc), U128(0x2dbfd, 0xb42490b6d9b4e650),
+    U128(0x7f9e, 0x1f9819f87ff811f4), U128(0x1e3bf, 0x790c613de23c4368),
+    U128(0x19860, 0x6780798199805314), U128(0x441, 0x114014404440188),
+    U128(0x2a022, 0xaaa8880aa208f62c), U128(0x33c03, 0xcc3cf0cf3fcca4b0),
+    U128(0x3a9e4, 0xe9d0de93aa909105), U128(0x235c5, 0x8f44a6563754c399),
+    U128(0x91a6, 0x24f82f189118343d), U128(0x10d87, 0x426c57dd0cdc66a1),
+    U128(0x1ba68, 0x6f2073a1bba05f57), U128(0x2649, 0x9b40b6426640dcb),
+    U128(0x2822a, 0xa208822a8028fa6f), U128(0x31e0b, 0xc49cfaef1deca8f3),
+    U128(0x38bec, 0xe170d4b388b09d46), U128(0x217cd, 0x87e4ac761574cfda),
+    U128(0xb3ae, 0x2c582538b338387e), U128(0x12f8f, 0x4acc5dfd2efc6ae2),
+    U128(0x1dc70, 0x76c06dc1ddc04b92), U128(0x4051, 0x105415044004190e),
+    U128(0x2e432, 0xbbe89c4ae648eeaa), U128(0x37813, 0xdd7ce48f7b8cbc36),
+    U128(0x3edf4, 0xf890cad3eed08983), U128(0x271d5, 0x9e04b2167314db1f),
+    U128(0xd5b6, 0x35b83b58d5582cbb), U128(0x14997, 0x532c439d489c7e27),
+    U128(0x1fe78, 0x7e6067e1ffe047d1), U128(0x6259, 0x18f41f246224154d),
+    U128(0x2c63a, 0xb348966ac468e2e9), U128(0x35a1b, 0xd5dceeaf59acb075),
+    U128(0x3cffc, 0xf030c0f3ccf085c0), U128(0x253dd, 0x96a4b8365134d75c),
+    U128(0xf7be, 0x3d183178f77820f8), U128(0x16b9f, 0x5b8c49bd6abc7264),
+    U128(0x22080, 0x8a00a2022200c430), U128(0x3bca1, 0xec94dac7bfc496ac),
+    U128(0x118c2, 0x4728538919886108), U128(0x84e3, 0x21bc2b4c844c3394),
+    U128(0x1104, 0x450051011100621), U128(0x18d25, 0x62c47dd58cd454bd),
+    U128(0x32946, 0xc978f49b2a98a319), U128(0x2b567, 0xafec8c5eb75cf185),
+    U128(0x20288, 0x82a0a8220020c873), U128(0x39ea9, 0xe434d0e79de49aef),
+    U128(0x13aca, 0x4f8859a93ba86d4b), U128(0xa6eb, 0x291c216ca66c3fd7),
+    U128(0x330c, 0xcf00f3033300a62), U128(0x1af2d, 0x6a6477f5aef458fe),
+    U128(0x30b4e, 0xc1d8febb08b8af5a), U128(0x2976f, 0xa74c867e957cfdc6),
+    U128(0x26490, 0x9b40b6426640dcb6), U128(0x3f8b1, 0xfdd4ce87fb848e2a),
+    U128(0x15cd2, 0x566847c95dc8798e), U128(0xc0f3, 0x30fc3f0cc00c2b12),
+    U128(0x5514, 0x1510115055501ea7), U128(0x1c935, 0x73846995c8944c3b),
+    U128(0x36d56, 0xd838e0db6ed8bb9f), U128(0x2f177, 0xbeac981ef31ce903),
+    U128(0x24698, 0x93e0bc624460d0f5), U128(0x3dab9, 0xf574c4a7d9a48269),
+    U128(0x17eda, 0x5ec84de97fe875cd), U128(0xe2fb, 0x385c352ce22c2751),
+    U128(0x771c, 0x1db01b70777012e4), U128(0x1eb3d, 0x7b2463b5eab44078),
+    U128(0x34f5e, 0xd098eafb4cf8b7dc), U128(0x2d37f, 0xb60c923ed13ce540),
+    U128(0x2a8a0, 0xa8808a82aa80f53c), U128(0x33481, 0xce14f2473744a7a0),
+    U128(0x190e2, 0x65a87b0991085004), U128(0xcc3, 0x33c03cc0ccc0298),
+    U128(0x9924, 0x26d02d909990372d), U128(0x10505, 0x40445555045465b1),
+    U128(0x3a166, 0xebf8dc1ba2189215), U128(0x23d47, 0x8d6ca4de3fdcc089),
+    U128(0x28aa8, 0xa02080a288a0f97f), U128(0x31689, 0xc6b4f8671564abe3),
+    U128(0x1b2ea, 0x6d087129b3285c47), U128(0x2ecb, 0xb9c09ec2eec0edb),
+    U128(0xbb2c, 0x2e7027b0bbb03b6e), U128(0x1270d, 0x48e45f75267469f2),
+    U128(0x3836e, 0xe358d63b80389e56), U128(0x21f4f, 0x85ccaefe1dfcccca),
+    U128(0x2ecb0, 0xb9c09ec2eec0edba), U128(0x37091, 0xdf54e6077304bf26),
+    U128(0x1d4f2, 0x74e86f49d5484882), U128(0x48d3, 0x127c178c488c1a1e),
+    U128(0xdd34, 0x379039d0ddd02fab), U128(0x14115, 0x5104411540147d37),
+    U128(0x3e576, 0xfab8c85be6588a93), U128(0x27957, 0x9c2cb09e7b9cd80f),
+    U128(0x2ceb8, 0xb16094e2cce0e1f9), U128(0x35299, 0xd7f4ec275124b365),
+    U128(0x1f6fa, 0x7c486569f76844c1), U128(0x6adb, 0x1adc1dac6aac165d),
+    U128(0xff3c, 0x3f3033f0fff023e8), U128(0x1631d, 0x59a44b3562347174),
+    U128(0x3c77e, 0xf218c27bc47886d0), U128(0x25b5f, 0x948cbabe59bcd44c),
+    U128(0x330c0, 0xcf00f3033300a628), U128(0x2ace1, 0xa9948bc6aec4f4b4),
+    U128(0x882, 0x228028808880310), U128(0x194a3, 0x64bc7a4d954c518c),
+    U128(0x10144, 0x4150541100106439), U128(0x9d65, 0x27c42cd49dd436a5),
+    U128(0x23906, 0x8c78a59a3b98c101), U128(0x3a527, 0xeaecdd5fa65c939d),
+    U128(0x312c8, 0xc7a0f9231120aa6b), U128(0x28ee9, 0xa13481e68ce4f8f7),
+    U128(0x2a8a, 0xa8808a82aa80f53), U128(0x1b6ab, 0x6c1c706db76c5dcf),
+    U128(0x1234c, 0x49f05e312230687a), U128(0xbf6d, 0x2f6426f4bff43ae6),
+    U128(0x21b0e, 0x84d8afba19b8cd42), U128(0x3872f, 0xe24cd77f847c9fde),
+    U128(0x374d0, 0xde40e7437740beae), U128(0x2e8f1, 0xb8d49f86ea84ec32),
+    U128(0x4c92, 0x136816c84cc81b96), U128(0x1d0b3, 0x75fc6e0dd10c490a),
+    U128(0x14554, 0x5010405144507cbf), U128(0xd975, 0x36843894d9942e23),
+    U128(0x27d16, 0x9d38b1da7fd8d987), U128(0x3e137, 0xfbacc91fe21c8b1b),
+    U128(0x356d8, 0xd6e0ed635560b2ed), U128(0x2caf9, 0xb07495a6c8a4e071),
+    U128(0x6e9a, 0x1bc81ce86ee817d5), U128(0x1f2bb, 0x7d5c642df32c4549),
+    U128(0x1675c, 0x58b04a71667070fc), U128(0xfb7d, 0x3e2432b4fbb42260),
+    U128(0x25f1e, 0x9598bbfa5df8d5c4), U128(0x3c33f, 0xf30cc33fc03c8758),
+    U128(0x3b8e0, 0xed80db83bb809724), U128(0x224c1, 0x8b14a3462644c5b8),
+    U128(0x80a2, 0x20a82a088008321c), U128(0x11c83, 0x463c52cd1dcc6080),
+    U128(0x18964, 0x63d07c9188905535), U128(0x1545, 0x5440454155407a9),
+    U128(0x2b126, 0xaef88d1ab318f00d), U128(0x32d07, 0xc86cf5df2edca291),
+    U128(0x39ae8, 0xe520d1a399a09b67), U128(0x206c9, 0x83b4a9660464c9fb),
+    U128(0xa2aa, 0x28082028a2283e5f), U128(0x13e8b, 0x4e9c58ed3fec6cc3),
+    U128(0x1ab6c, 0x6b7076b1aab05976), U128(0x374d, 0xde40e7437740bea),
+    U128(0x2932e, 0xa658873a9138fc4e), U128(0x30f0f, 0xc0ccffff0cfcaed2),
+    U128(0x3fcf0, 0xfcc0cfc3ffc08fa2), U128(0x260d1, 0x9a54b7066204dd3e),
+    U128(0xc4b2, 0x31e83e48c4482a9a), U128(0x15893, 0x577c468d598c7806),
+    U128(0x1cd74, 0x729068d1ccd04db3), U128(0x5155, 0x1404101451141f2f),
+    U128(0x2f536, 0xbfb8995af758e88b), U128(0x36917, 0xd92ce19f6a9cba17),
+    U128(0x3def8, 0xf460c5e3dde083e1), U128(0x242d9, 0x92f4bd264024d17d),
+    U128(0xe6ba, 0x39483468e66826d9), U128(0x17a9b, 0x5fdc4cad7bac7445),
+    U128(0x1ef7c, 0x7a3062f1eef041f0), U128(0x735d, 0x1ca41a347334136c),
+    U128(0x2d73e, 0xb718937ad578e4c8), U128(0x34b1f, 0xd18cebbf48bcb654),
+};
+
+#define CRC_CATALOGO_N 18
+
+static const CrcCatEntry crc_catalogo[CRC_CATALOGO_N] = {
+    { "CRC-3/GSM", 3, U128(0, 0x3), 0, 0, crc_cat_t0, &crc_cat_f0, NULL },
+    { "CRC-5/USB", 5, U128(0, 0x5), 1, 1, crc_cat_t1, &crc_cat_f1, NULL },
+    { "CRC-8/SMBUS", 8, U128(0, 0x7), 0, 0, crc_cat_t2, &crc_cat_f2, NULL },
+    { "CRC-8/MAXIM-DOW", 8, U128(0, 0x31), 1, 1, crc_cat_t3, &crc_cat_f3, NULL },
+    { "CRC-12/UMTS", 12, U128(0, 0x80f), 0, 1, crc_cat_t4, &crc_cat_f4, NULL },
+    { "CRC-16/ARC", 16, U128(0, 0x8005), 1, 1, crc_cat_t5, &crc_cat_f5, NULL },
+    { "CRC-16/IBM-3740", 16, U128(0, 0x1021), 0, 0, crc_cat_t6, &crc_cat_f6, NULL },
+    { "CRC-16/MODBUS", 16, U128(0, 0x8005), 1, 1, crc_cat_t5, &crc_cat_f5, NULL },
+    { "CRC-16/XMODEM", 16, U128(0, 0x1021), 0, 0, crc_cat_t6, &crc_cat_f6, NULL },
+    { "CRC-16/X-25", 16, U128(0, 0x1021), 1, 1, crc_cat_t9, &crc_cat_f9, NULL },
+    { "CRC-24/OPENPGP", 24, U128(0, 0x864cfb), 0, 0, crc_cat_t10, &crc_cat_f10, NULL },
+    { "CRC-32/ISO-HDLC", 32, U128(0, 0x4c11db7), 1, 1, crc_cat_t11, &crc_cat_f11, NULL },
+    { "CRC-32/BZIP2", 32, U128(0, 0x4c11db7), 0, 0, crc_cat_t12, &crc_cat_f12, NULL },
+    { "CRC-32/MPEG-2", 32, U128(0, 0x4c11db7), 0, 0, crc_cat_t12, &crc_cat_f12, NULL },
+    { "CRC-32/ISCSI", 32, U128(0, 0x1edc6f41), 1, 1, crc_cat_t14, &crc_cat_f14, NULL },
+    { "CRC-64/ECMA-182", 64, U128(0, 0x42f0e1eba9ea3693), 0, 0, crc_cat_t15, &crc_cat_f15, NULL },
+    { "CRC-64/XZ", 64, U128(0, 0x42f0e1eba9ea3693), 1, 1, crc_cat_t16, &crc_cat_f16, NULL },
+    { "CRC-82/DARC", 82, U128(0x308c, 0x111011401440411), 1, 1, NULL, NULL, crc_cat_w17 },
+};
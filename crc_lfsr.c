@@ -7,39 +7,355 @@
  *  (1) Faz a divisão em GF(2) mostrando os passos (quociente e resto).
  *  (2) Calcula a mensagem transmitida (codeword) e verifica o resto = 0.
  *  (3) Gera a tabela de evolução do LFSR (32 bits + 6 zeros) e compara FCS.
- * Também grava toda a saída em um arquivo texto além do stdout.
+ *  (4) Recalcula o FCS com um motor por tabela (byte a byte) e com tabelas
+ *      fatiadas (4/8/16 bytes por iteração, escolhido em --slices) e compara.
+ *  (5) Em x86-64 com PCLMULQDQ, dobra buffers longos 64 bytes por iteração
+ *      (multiplicação sem vai-um) e fecha com redução de Barrett; com
+ *      VPCLMULQDQ/AVX-512, 256 bytes por iteração. O motor é escolhido por
+ *      CPUID (ou --kernel) e --bench N mede todos sobre N MiB pseudoaleatórios.
+ *  (6) Se --poly for o polinômio de Castagnoli, --bench mede também o
+ *      CRC-32C com a instrução crc32 do SSE4.2 (3 fluxos intercalados).
+ *  (7) Mensagens de qualquer tamanho: ponteiro + número de bits, sem montar
+ *      o dividendo inteiro em memória.
+ *  (8) Geradores de grau 64 a 128 (CRC-64, CRC-82...): o termo x^m fica
+ *      implícito e há registradores de 64 e de 128 bits (--poly/--width).
+ *  (9) Modelo completo (init, refin, refout, xorout): tabela, fatias e dobra
+ *      têm variante refletida; --selftest confere o check de "123456789" de
+ *      cada modelo do catálogo em todos os caminhos.
+ * (10) Catálogo de modelos com nome (--model CRC-32C, --list-models), com as
+ *      tabelas pré-calculadas em crc_catalogo.h (só constantes, em .rodata).
+ * (11) crc_combine: crc(A||B) a partir de crc(A), crc(B) e |B| em O(log |B|).
+ * (12) --threads N e --chunk KiB: --bench calcula também o buffer em N threads,
+ *      um pedaço por vez, e junta os CRCs com crc_combine.
+ * (13) --scan LISTA: CRC de muitos arquivos (um caminho por linha) num pool de
+ *      threads com roubo de tarefas; arquivos grandes viram pedaços roubáveis.
+ * (14) Leitura assíncrona com io_uring (fila de buffers registrados) ou, na
+ *      falta dele, pread numa thread com buffer duplo (--io uring|pread);
+ *      --io direct lê com O_DIRECT para buffers em hugepages, sem sujar o cache.
+ * (15) --file ARQ: CRC de um arquivo mapeado com mmap (sem cópia) ou lido
+ *      por (14), com --model ou o FCS cru de --poly, e a vazão obtida;
+ *      pipes, FIFOs e arquivos de /proc são lidos com read() até o EOF.
+ * (16) Contexto incremental (crc_ctx_init/update/final) que aceita pedaços de
+ *      qualquer tamanho em bits, para checar um quadro à medida que chega.
+ * (17) LFSR direto: o bit da mensagem entra na realimentação e o FCS sai sem
+ *      os m clocks de zeros; converte init entre as formas direta e aumentada.
+ * (18) Sequências de zeros: n bits zero avançam o registrador por x^n mod g em
+ *      O(log n); --file, --scan, --threads e o contexto pulam blocos zerados.
+ * (19) Arquivos esparsos: --file pergunta os buracos com SEEK_DATA/SEEK_HOLE e
+ *      não os lê; cada buraco entra no CRC como um salto sobre zeros.
+ * (20) LFSR fatiado por bits: 64 registros curtos do mesmo tamanho por clock
+ *      (256/512 com AVX2/AVX-512); --bench compara com o cálculo um a um.
+ * (21) Traço compacto da divisão (uma linha por passo) para dividendos acima
+ *      de 40 bits e para --trace ARQ; a escada em ASCII fica para os curtos.
+ * (22) O LFSR só copia cada passo cru para um anel sem trava; uma thread
+ *      escritora monta o texto (tabela do item 3 e --trace-lfsr ARQ).
+ * (23) --trace-out SAIDA: traço binário (bits da mensagem + registrador a cada
+ *      4096 passos); --query SAIDA N devolve o passo N sem varrer o arquivo.
+ * Também grava toda a saída em um arquivo texto além do stdout: cada linha é
+ * formatada uma vez e vai aos dois destinos em lotes de writev; com
+ * --log-thread o arquivo é escrito por uma thread à parte.
  *
- * Compile:  gcc -std=c11 -O2 -Wall -Wextra -o crc_lfsr crc_lfsr.c
+ * Compile:  gcc -std=c11 -O2 -Wall -Wextra -pthread -o crc_lfsr crc_lfsr.c
+ * Ao mudar crc_models[], regenere as tabelas:
+ *   gcc -std=c11 -O2 -DCRC_SEM_CATALOGO -o crc_gen crc_lfsr.c
+ *   ./crc_gen --gen-catalogo > crc_catalogo.h
  */
 
+#define _POSIX_C_SOURCE 200809L
+#define _GNU_SOURCE                 /* syscall() do io_uring, O_DIRECT, MADV_HUGEPAGE */
+
 #include <stdio.h>
 #include <stdint.h>
 #include <stdarg.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#define HAVE_IO_URING 1
+#endif
+#endif
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#include <immintrin.h>
+#define HAVE_X86_CLMUL 1
+#endif
 
 /* ===================== util: logger duplo (stdout + arquivo) ===================== */
-typedef struct {
-    FILE *fp;
+/* Cada registro é formatado uma só vez, direto no bloco corrente de um anel de
+ * LOG_NBLK blocos; a cada LOG_LOTE blocos cheios um writev leva o lote ao
+ * stdout e outro ao arquivo. Com logger_open(..., 1) o arquivo fica a cargo de
+ * uma thread, que devolve os blocos ao anel à medida que os grava.
+ * Logger L = {0} escreve só no stdout; logger_close() descarrega o resto.
+ * so_arq = 1 depois de logger_open cala o stdout (o autoteste usa).
+ * Um logger com texto fica numa lista até logger_close; se o processo sair
+ * antes por exit() (erro fatal de um motor, falta de memória), um atexit
+ * descarrega o que estiver nos anéis. */
+#define LOG_BLK  (64 * 1024)
+#define LOG_NBLK 8
+#define LOG_LOTE 4
+
+typedef struct Logger {
+    char *blk[LOG_NBLK];
+    size_t used[LOG_NBLK];
+    size_t len;                 /* bytes no bloco corrente, blk[fechados % LOG_NBLK] */
+    uint64_t fechados;          /* blocos cheios (contadores só crescem) */
+    uint64_t no_stdout;         /* ... já escritos no stdout */
+    uint64_t publicados;        /* ... entregues à thread do arquivo */
+    _Atomic uint64_t no_arq;    /* ... já escritos no arquivo (a thread escreve sob mu) */
+    int fd, arq, async, parar;
+    int so_arq;                 /* sem stdout: só o arquivo */
+    int na_lista;
+    struct Logger *prox;        /* lista de log_no_exit */
+    pthread_t tid;
+    pthread_mutex_t mu;
+    pthread_cond_t cv;
 } Logger;
 
+static Logger *log_lista;
+static pthread_mutex_t log_lista_mu = PTHREAD_MUTEX_INITIALIZER;
+
+static int write_all_v(int fd, struct iovec *iov, int n) {
+    while (n > 0) {
+        ssize_t w = writev(fd, iov, n);
+        if (w < 0) {
+            if (errno == EINTR) continue;
+            return -1;
+        }
+        while (n > 0 && (size_t)w >= iov->iov_len) { w -= (ssize_t)iov->iov_len; ++iov; --n; }
+        if (n > 0) { iov->iov_base = (char*)iov->iov_base + w; iov->iov_len -= (size_t)w; }
+    }
+    return 0;
+}
+
+/* Escreve os blocos [de, ate) do anel em fd com um writev. */
+static void log_write_blocks(Logger *L, int fd, uint64_t de, uint64_t ate) {
+    struct iovec iov[LOG_NBLK];
+    int n = 0;
+    for (uint64_t b = de; b < ate; ++b) {
+        iov[n].iov_base = L->blk[b % LOG_NBLK];
+        iov[n].iov_len = L->used[b % LOG_NBLK];
+        ++n;
+    }
+    write_all_v(fd, iov, n);
+}
+
+static void *log_arq_worker(void *arg) {
+    Logger *L = (Logger*)arg;
+    pthread_mutex_lock(&L->mu);
+    for (;;) {
+        while (L->no_arq == L->publicados && !L->parar)
+            pthread_cond_wait(&L->cv, &L->mu);
+        if (L->no_arq == L->publicados) break;
+        uint64_t de = L->no_arq, ate = L->publicados;
+        pthread_mutex_unlock(&L->mu);
+        log_write_blocks(L, L->fd, de, ate);
+        pthread_mutex_lock(&L->mu);
+        atomic_store_explicit(&L->no_arq, ate, memory_order_release);
+        pthread_cond_broadcast(&L->cv);
+    }
+    pthread_mutex_unlock(&L->mu);
+    return NULL;
+}
+
+/* Leva os blocos cheios ao stdout e ao arquivo (ou à thread do arquivo). */
+static void log_lote(Logger *L) {
+    if (L->no_stdout == L->fechados) return;
+    if (!L->so_arq) {
+        fflush(stdout);         /* o que saiu por printf vem antes */
+        log_write_blocks(L, STDOUT_FILENO, L->no_stdout, L->fechados);
+    }
+    L->no_stdout = L->fechados;
+    if (!L->arq) {
+        L->no_arq = L->fechados;
+    } else if (L->async) {
+        pthread_mutex_lock(&L->mu);
+        L->publicados = L->fechados;
+        pthread_cond_signal(&L->cv);
+        pthread_mutex_unlock(&L->mu);
+    } else {
+        log_write_blocks(L, L->fd, L->no_arq, L->fechados);
+        L->no_arq = L->fechados;
+    }
+}
+
+/* atexit: fecha o bloco corrente de cada logger aberto e o escreve, sem alocar. */
+static void log_no_exit(void) {
+    pthread_mutex_lock(&log_lista_mu);
+    for (Logger *L = log_lista; L; L = L->prox) {
+        if (L->len) {
+            L->used[L->fechados % LOG_NBLK] = L->len;
+            L->fechados++;
+            L->len = 0;
+        }
+        log_lote(L);
+        if (L->async) {
+            pthread_mutex_lock(&L->mu);
+            while (L->no_arq != L->publicados)
+                pthread_cond_wait(&L->cv, &L->mu);
+            pthread_mutex_unlock(&L->mu);
+        }
+    }
+    pthread_mutex_unlock(&log_lista_mu);
+}
+
+static void log_registra(Logger *L) {
+    static int instalado;
+    pthread_mutex_lock(&log_lista_mu);
+    if (!instalado) instalado = atexit(log_no_exit) == 0;
+    L->prox = log_lista;
+    log_lista = L;
+    L->na_lista = 1;
+    pthread_mutex_unlock(&log_lista_mu);
+}
+
+static void log_desregistra(Logger *L) {
+    pthread_mutex_lock(&log_lista_mu);
+    for (Logger **p = &log_lista; *p; p = &(*p)->prox)
+        if (*p == L) { *p = L->prox; break; }
+    L->na_lista = 0;
+    pthread_mutex_unlock(&log_lista_mu);
+}
+
+/* Garante um bloco corrente livre: espera a thread do arquivo soltá-lo. */
+static void log_bloco(Logger *L) {
+    if (L->async &&
+        L->fechados - atomic_load_explicit(&L->no_arq, memory_order_acquire) >= LOG_NBLK) {
+        pthread_mutex_lock(&L->mu);
+        while (L->fechados - L->no_arq >= LOG_NBLK)
+            pthread_cond_wait(&L->cv, &L->mu);
+        pthread_mutex_unlock(&L->mu);
+    }
+    char **b = &L->blk[L->fechados % LOG_NBLK];
+    if (!*b) {
+        if (!L->na_lista) log_registra(L);
+        if (!(*b = (char*)malloc(LOG_BLK))) {
+            fprintf(stderr, "Erro: sem memória.\n");
+            exit(1);
+        }
+    }
+}
+
+static void log_fecha_bloco(Logger *L) {
+    L->used[L->fechados % LOG_NBLK] = L->len;
+    L->fechados++;
+    L->len = 0;
+    if (L->fechados - L->no_stdout >= LOG_LOTE) log_lote(L);
+    log_bloco(L);
+}
+
+/* Descarrega tudo; com thread, espera o arquivo alcançar o stdout. */
+static void lflush(Logger *L) {
+    if (!L) return;
+    if (L->len) log_fecha_bloco(L);
+    log_lote(L);
+    if (L->async) {
+        pthread_mutex_lock(&L->mu);
+        while (L->no_arq != L->publicados)
+            pthread_cond_wait(&L->cv, &L->mu);
+        pthread_mutex_unlock(&L->mu);
+    }
+}
+
 static void lprint(Logger *L, const char *fmt, ...) {
     va_list ap;
+    if (!L) {
+        va_start(ap, fmt);
+        vprintf(fmt, ap);
+        va_end(ap);
+        return;
+    }
+    log_bloco(L);
+    char *p = L->blk[L->fechados % LOG_NBLK];
     va_start(ap, fmt);
-    vprintf(fmt, ap);
+    int n = vsnprintf(p + L->len, LOG_BLK - L->len, fmt, ap);
     va_end(ap);
+    if (n < 0) return;
+    if ((size_t)n < LOG_BLK - L->len) { L->len += (size_t)n; return; }
 
-    if (L && L->fp) {
+    if ((size_t)n < LOG_BLK) {  /* não coube no resto: vai para um bloco novo */
+        log_fecha_bloco(L);
+        p = L->blk[L->fechados % LOG_NBLK];
         va_start(ap, fmt);
-        vfprintf(L->fp, fmt, ap);
+        vsnprintf(p, LOG_BLK, fmt, ap);
         va_end(ap);
+        L->len = (size_t)n;
+        return;
+    }
+
+    /* Registro maior que um bloco: descarrega e escreve direto. */
+    char *big = (char*)malloc((size_t)n + 1);
+    if (!big) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    va_start(ap, fmt);
+    vsnprintf(big, (size_t)n + 1, fmt, ap);
+    va_end(ap);
+    lflush(L);
+    struct iovec v = { big, (size_t)n };
+    if (!L->so_arq) write_all_v(STDOUT_FILENO, &v, 1);
+    if (L->arq) { v.iov_base = big; v.iov_len = (size_t)n; write_all_v(L->fd, &v, 1); }
+    free(big);
+}
+
+/* Abre o arquivo (truncando); async != 0 põe a escrita dele numa thread. */
+static int logger_open(Logger *L, const char *path, int async) {
+    memset(L, 0, sizeof *L);
+    L->fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (L->fd < 0) return -1;
+    L->arq = 1;
+    if (async) {
+        pthread_mutex_init(&L->mu, NULL);
+        pthread_cond_init(&L->cv, NULL);
+        L->async = pthread_create(&L->tid, NULL, log_arq_worker, L) == 0;
+        if (!L->async) {
+            pthread_cond_destroy(&L->cv);
+            pthread_mutex_destroy(&L->mu);
+        }
+    }
+    return 0;
+}
+
+static void logger_close(Logger *L) {
+    lflush(L);
+    if (L->async) {
+        pthread_mutex_lock(&L->mu);
+        L->parar = 1;
+        pthread_cond_signal(&L->cv);
+        pthread_mutex_unlock(&L->mu);
+        pthread_join(L->tid, NULL);
+        pthread_cond_destroy(&L->cv);
+        pthread_mutex_destroy(&L->mu);
     }
+    if (L->na_lista) log_desregistra(L);
+    if (L->arq) close(L->fd);
+    for (int i = 0; i < LOG_NBLK; ++i) free(L->blk[i]);
+    memset(L, 0, sizeof *L);
 }
 
 static void print_repeat(Logger *L, char c, int n) {
-    for (int i = 0; i < n; ++i) lprint(L, "%c", c);
+    char s[128];
+    while (n > 0) {
+        int k = (n < (int)sizeof s) ? n : (int)sizeof s;
+        memset(s, c, (size_t)k);
+        lprint(L, "%.*s", k, s);
+        n -= k;
+    }
 }
 
+/* Inteiro de 128 bits do GCC/Clang, para registradores de grau > 64. */
+__extension__ typedef unsigned __int128 u128;
+
 static int bitlen_u64(uint64_t x) {
     if (x == 0) return 0;
     int n = 0;
@@ -47,11 +363,43 @@ static int bitlen_u64(uint64_t x) {
     return n;
 }
 
-/* Constrói string "0b" + <width bits de x> (com zeros à esquerda). Retorna malloc'd. */
-static char* bits_str(uint64_t x, int width) {
+static int bitlen_u128(u128 x) {
+    uint64_t hi = (uint64_t)(x >> 64);
+    return hi ? 64 + bitlen_u64(hi) : bitlen_u64((uint64_t)x);
+}
+
+/*
+ * Polinômio gerador com o termo x^m implícito: lo/hi guardam os coeficientes
+ * de x^0..x^(m-1). Com o bit de x^m dentro do inteiro (como em `polinomio`)
+ * o maior grau possível em 64 bits é 63; assim cabe o CRC-64 e até grau 128.
+ */
+typedef struct {
+    int m;
+    uint64_t lo, hi;
+} CrcPoly;
+
+static CrcPoly crc_poly_from_u64(uint64_t polinomio) {
+    CrcPoly g = {0};
+    g.m = bitlen_u64(polinomio) - 1;
+    g.lo = (g.m > 0) ? polinomio ^ (1ULL << g.m) : 0;
+    return g;
+}
+
+static u128 crc_poly_low(const CrcPoly *g) {
+    return ((u128)g->hi << 64) | g->lo;
+}
+
+/* "0b" + até 64 bits + '\0': tamanho do buffer de bits_str. */
+#define BITS_STR_LEN 67
+
+/*
+ * Escreve "0b" + <width bits de x> (com zeros à esquerda) em s, que tem
+ * BITS_STR_LEN bytes, e devolve s. Sem alocação: os traços chamam isto
+ * duas ou três vezes por passo.
+ */
+static char *bits_str(char s[BITS_STR_LEN], uint64_t x, int width) {
+    if (width > 64) width = 64;
     int len = 2 + (width > 0 ? width : 1);
-    char *s = (char*)malloc((len + 1) * sizeof(char));
-    if (!s) return NULL;
     s[0] = '0'; s[1] = 'b';
     if (width <= 0) {
         s[2] = '0'; s[3] = '\0';
@@ -66,12 +414,20 @@ static char* bits_str(uint64_t x, int width) {
 }
 
 /* ===================== (1) Divisão em GF(2) com passos ===================== */
+/*
+ * O desenho em escada recua cada passo pela coluna e completa com '|' até o
+ * fim do dividendo: são O(k) caracteres por passo e O(k²) no total. Acima de
+ * DIV_ARTE_MAX bits do dividendo o traço passa a ser compacto, uma linha de
+ * tamanho fixo por passo (coluna, bit do quociente e resto), O(k·m) no total.
+ */
+#define DIV_ARTE_MAX 40
+
 static void divide_mod2_show(uint64_t dividendo, uint64_t divisor,
                              uint64_t *q_out, uint64_t *r_out,
                              Logger *L, int verbose)
 {
     if (divisor == 0) {
-        lprint(L, "Erro: divisor não pode ser zero.\n");
+        fprintf(stderr, "Erro: divisor não pode ser zero.\n");
         exit(1);
     }
     uint64_t quoc = 0;
@@ -81,19 +437,16 @@ static void divide_mod2_show(uint64_t dividendo, uint64_t divisor,
     int aux = k - r;                         
 
     int binw = 2 + r;                        /* largura '0b' + r bits */
+    int arte = verbose && k <= DIV_ARTE_MAX;
+    char s1[BITS_STR_LEN], s2[BITS_STR_LEN];
 
     if (aux < 0) {
         uint64_t resto = dividendo;
         if (verbose) {
             lprint(L, "Divisão módulo 2 (dividendo menor que divisor)\n");
-            char *sd = bits_str(dividendo, k);
-            char *sr = bits_str(divisor,   r);
-            lprint(L, "%s |__ %s\n", sd, sr);
-            free(sd); free(sr);
+            lprint(L, "%s |__ %s\n", bits_str(s1, dividendo, k), bits_str(s2, divisor, r));
             lprint(L, "Quociente: 0b0\n");
-            char *sre = bits_str(resto, r);
-            lprint(L, "Resto:     %s\n", sre);
-            free(sre);
+            lprint(L, "Resto:     %s\n", bits_str(s1, resto, r));
         }
         if (q_out) *q_out = 0;
         if (r_out) *r_out = resto;
@@ -103,11 +456,10 @@ static void divide_mod2_show(uint64_t dividendo, uint64_t divisor,
     uint64_t resto = dividendo >> aux;
 
     if (verbose) {
-        lprint(L, "Divisão módulo 2\n");
-        char *sd = bits_str(dividendo, k);
-        char *sr = bits_str(divisor,   r);
-        lprint(L, "%s |__ %s\n", sd, sr);
-        free(sd); free(sr);
+        lprint(L, arte ? "Divisão módulo 2\n"
+                       : "Divisão módulo 2 (traço compacto, um passo por linha)\n");
+        lprint(L, "%s |__ %s\n", bits_str(s1, dividendo, k), bits_str(s2, divisor, r));
+        if (!arte) lprint(L, "coluna | q | resto\n");
     }
 
     while (aux > -1) {
@@ -116,30 +468,28 @@ static void divide_mod2_show(uint64_t dividendo, uint64_t divisor,
         if (nbits_resto == r) {
             quoc |= 1;
             resto ^= divisor;
-            if (verbose) {
+            if (arte) {
                 print_repeat(L, ' ', k - r - aux);
-                char *s = bits_str(divisor, r);
-                lprint(L, "%*s", binw, s);
-                free(s);
+                lprint(L, "%*s", binw, bits_str(s1, divisor, r));
                 print_repeat(L, '|', aux);
                 lprint(L, "\n");
             }
         } else {
-            if (verbose) {
+            if (arte) {
                 print_repeat(L, ' ', k - r - aux);
-                char *zero_line = bits_str(0, r);
-                lprint(L, "%*s", binw, zero_line);
-                free(zero_line);
+                lprint(L, "%*s", binw, bits_str(s1, 0, r));
                 print_repeat(L, '|', aux);
                 lprint(L, "\n");
             }
         }
 
-        if (verbose) {
+        if (arte) {
             print_repeat(L, ' ', k - r - aux);
             print_repeat(L, '-', binw);
             print_repeat(L, '|', aux);
             lprint(L, "\n");
+        } else if (verbose) {
+            lprint(L, "%6d | %d | %s\n", k - 1 - aux, (int)(quoc & 1), bits_str(s1, resto, m) + 2);
         }
 
         aux -= 1;
@@ -148,35 +498,58 @@ static void divide_mod2_show(uint64_t dividendo, uint64_t divisor,
             resto = (resto << 1) | next_bit;
         }
 
-        if (verbose) {
+        if (arte) {
             print_repeat(L, ' ', k - r - aux);
-            char *sr = bits_str(resto, r);
-            lprint(L, "%*s", binw, sr);
-            free(sr);
+            lprint(L, "%*s", binw, bits_str(s1, resto, r));
             print_repeat(L, '|', aux);
             lprint(L, "\n");
         }
     }
 
     if (verbose) {
-        lprint(L, "\nQuociente: ");
-        char *sq = bits_str(quoc, r);
-        lprint(L, "%s\n", sq); free(sq);
-        lprint(L, "Resto: ");
-        char *sr = bits_str(resto, r);
-        lprint(L, "%s\n", sr); free(sr);
+        lprint(L, "\nQuociente: %s\n", bits_str(s1, quoc, r));
+        lprint(L, "Resto: %s\n", bits_str(s1, resto, r));
     }
 
     if (q_out) *q_out = quoc;
     if (r_out) *r_out = resto;
 }
 
+/*
+ * Traço compacto da divisão de M(x)·x^m por g para mensagens de qualquer
+ * tamanho (bits MSB primeiro, como em (7)). O resto parcial anda como no
+ * LFSR aumentado de (2/3); a coluna é a posição no dividendo do último bit
+ * baixado, como no traço compacto de divide_mod2_show. Devolve o FCS.
+ */
+static uint64_t divide_mod2_trace_bits(const uint8_t *msg, size_t nbits,
+                                       const CrcPoly *g, Logger *L)
+{
+    int m = g->m;
+    uint64_t mask = (m >= 64) ? ~0ULL : (1ULL << m) - 1;
+    uint64_t reg = 0;
+    char s[BITS_STR_LEN];
+    lprint(L, "coluna | q | resto\n");
+    for (size_t i = 0; i < nbits + (size_t)m; ++i) {
+        int bit = (i < nbits) ? (msg[i / 8] >> (7 - i % 8)) & 1 : 0;
+        int q = (int)((reg >> (m - 1)) & 1);
+        reg = ((reg << 1) | (uint64_t)bit) & mask;
+        if (q) reg ^= g->lo;
+        if (i >= (size_t)m)                /* antes disso só se baixam bits */
+            lprint(L, "%6zu | %d | %s\n", i, q, bits_str(s, reg, m) + 2);
+    }
+    return reg;
+}
+
 /* ===================== (1b) Constrói codeword e FCS ===================== */
 static void make_crc_transmission(uint64_t mensagem, uint64_t polinomio,
                                   uint64_t *codeword_out, uint64_t *fcs_out,
                                   Logger *L, int verbose)
 {
     int m = bitlen_u64(polinomio) - 1;
+    if (bitlen_u64(mensagem) + m > 64) {
+        fprintf(stderr, "Erro: mensagem + %d bits de FCS não cabe em 64 bits; use crc_fcs_bits.\n", m);
+        exit(1);
+    }
     uint64_t shifted = mensagem << m;
     uint64_t quo=0, rem=0;
     divide_mod2_show(shifted, polinomio, &quo, &rem, L, verbose);
@@ -185,6 +558,351 @@ static void make_crc_transmission(uint64_t mensagem, uint64_t polinomio,
     if (fcs_out) *fcs_out = rem;
 }
 
+/* ===================== (22) Anel de passos do LFSR: o texto sai numa thread ===================== */
+/*
+ * Num traço longo o custo é formatar e escrever, não o clock. O laço do LFSR só
+ * copia o passo cru (LfsrStep, 32 bytes) para um anel SPSC sem trava; uma thread
+ * escritora tira lotes contíguos do anel e os entrega a um StepSink, que decide
+ * o que fazer com eles (step_sink_text monta a tabela de trace_lfsr_crc).
+ * head é do produtor e tail do consumidor, cada um na sua linha de cache; o
+ * produtor só publica head a cada STEP_PUBLISH passos e, com o anel cheio,
+ * cede a CPU até a escritora liberar espaço (o traço não perde passos).
+ * Com o anel vazio por STEP_SPIN voltas a escritora dorme numa condvar, que o
+ * produtor só sinaliza se ela estiver dormindo. Traços curtos (menos de
+ * STEP_RING_SYNC passos, como os 38 da demonstração) nem criam a thread.
+ */
+typedef struct {
+    uint64_t step;
+    uint64_t before, after;         /* registrador antes e depois do clock */
+    uint8_t bit, msb;               /* bit de entrada e msb(old) */
+} LfsrStep;
+
+typedef void (*StepSink)(void *ctx, const LfsrStep *s, size_t n);
+
+#define STEP_RING_LOG2 16
+#define STEP_PUBLISH 64
+#define STEP_SPIN 64
+#define STEP_RING_SYNC 4096
+
+typedef struct {
+    _Alignas(64) _Atomic uint64_t head;     /* passos publicados */
+    _Alignas(64) _Atomic uint64_t tail;     /* passos já entregues ao sink */
+    _Alignas(64) uint64_t prod;             /* cópias privadas do produtor */
+    uint64_t tail_visto;
+    LfsrStep *slot;
+    size_t cap;
+    _Atomic int fim;
+    _Atomic int dorme;              /* escritora parada em cv */
+    int sync;                       /* sem thread: o sink roda no produtor */
+    StepSink sink;
+    void *ctx;
+    pthread_t tid;
+    pthread_mutex_t mu;
+    pthread_cond_t cv;
+} StepRing;
+
+static void *step_ring_worker(void *arg) {
+    StepRing *R = (StepRing*)arg;
+    uint64_t t = atomic_load_explicit(&R->tail, memory_order_relaxed);
+    int vazias = 0;
+    for (;;) {
+        /* fim antes de head: se fim já vale, este head é o último */
+        int fim = atomic_load_explicit(&R->fim, memory_order_acquire);
+        uint64_t h = atomic_load_explicit(&R->head, memory_order_acquire);
+        if (h == t) {
+            if (fim) break;
+            if (++vazias < STEP_SPIN) {
+                sched_yield();
+                continue;
+            }
+            /* dorme marcado antes de reler head; o produtor publica antes de ler dorme */
+            pthread_mutex_lock(&R->mu);
+            atomic_store(&R->dorme, 1);
+            while (atomic_load(&R->head) == t && !atomic_load(&R->fim))
+                pthread_cond_wait(&R->cv, &R->mu);
+            atomic_store(&R->dorme, 0);
+            pthread_mutex_unlock(&R->mu);
+            vazias = 0;
+            continue;
+        }
+        vazias = 0;
+        while (t < h) {
+            size_t i = (size_t)(t & (R->cap - 1));
+            size_t n = R->cap - i;                  /* até o fim do anel */
+            if (n > h - t) n = (size_t)(h - t);
+            R->sink(R->ctx, &R->slot[i], n);
+            t += n;
+            atomic_store_explicit(&R->tail, t, memory_order_release);
+        }
+    }
+    return NULL;
+}
+
+/* passos: quantos virão, se já se sabe (0 se não); poucos rodam sem thread. */
+static void step_ring_start(StepRing *R, StepSink sink, void *ctx, uint64_t passos) {
+    memset(R, 0, sizeof *R);
+    R->cap = (size_t)1 << STEP_RING_LOG2;
+    R->sink = sink;
+    R->ctx = ctx;
+    if (passos > 0 && passos < STEP_RING_SYNC) {
+        R->sync = 1;
+        return;
+    }
+    R->slot = (LfsrStep*)malloc(R->cap * sizeof *R->slot);
+    if (!R->slot) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    pthread_mutex_init(&R->mu, NULL);
+    pthread_cond_init(&R->cv, NULL);
+    R->sync = pthread_create(&R->tid, NULL, step_ring_worker, R) != 0;
+}
+
+/* head visível à escritora; acorda-a se estiver dormindo. */
+static void step_ring_publish(StepRing *R, uint64_t h) {
+    atomic_store(&R->head, h);
+    if (atomic_load(&R->dorme)) {
+        pthread_mutex_lock(&R->mu);
+        pthread_cond_signal(&R->cv);
+        pthread_mutex_unlock(&R->mu);
+    }
+}
+
+static inline void step_ring_push(StepRing *R, uint64_t step, int bit, int msb,
+                                  uint64_t before, uint64_t after)
+{
+    LfsrStep s = { step, before, after, (uint8_t)bit, (uint8_t)msb };
+    if (R->sync) { R->sink(R->ctx, &s, 1); return; }
+    uint64_t h = R->prod;
+    if (h - R->tail_visto == R->cap) {
+        step_ring_publish(R, h);
+        while (h - (R->tail_visto = atomic_load_explicit(&R->tail, memory_order_acquire)) == R->cap)
+            sched_yield();
+    }
+    R->slot[h & (R->cap - 1)] = s;
+    R->prod = ++h;
+    if ((h & (STEP_PUBLISH - 1)) == 0)
+        step_ring_publish(R, h);
+}
+
+/* Publica o resto, espera a escritora esvaziar o anel e a encerra. */
+static void step_ring_stop(StepRing *R) {
+    if (R->slot) {
+        if (!R->sync) {
+            atomic_store(&R->head, R->prod);
+            atomic_store(&R->fim, 1);
+            pthread_mutex_lock(&R->mu);
+            pthread_cond_signal(&R->cv);
+            pthread_mutex_unlock(&R->mu);
+            pthread_join(R->tid, NULL);
+        }
+        pthread_cond_destroy(&R->cv);
+        pthread_mutex_destroy(&R->mu);
+    }
+    free(R->slot);
+    R->slot = NULL;
+}
+
+/* Sink de texto: uma linha da tabela de trace_lfsr_crc por passo. */
+typedef struct {
+    Logger *L;
+    int m;
+} StepText;
+
+static void step_sink_text(void *ctx, const LfsrStep *s, size_t n) {
+    const StepText *T = (const StepText*)ctx;
+    char b1[BITS_STR_LEN], b2[BITS_STR_LEN];
+    for (size_t k = 0; k < n; ++k)
+        lprint(T->L, "%5llu | %d |     %d     |  %-16s ->   %s\n",
+               (unsigned long long)s[k].step, s[k].bit, s[k].msb,
+               bits_str(b1, s[k].before, T->m) + 2, bits_str(b2, s[k].after, T->m) + 2);
+}
+
+/*
+ * Forma aumentada (mensagem MSB-first + m zeros), grau até 64, com cada clock
+ * registrado em R; devolve o FCS. É o laço de trace_lfsr_crc sem o texto.
+ */
+static uint64_t lfsr_trace_bits(const CrcPoly *g, const uint8_t *msg, uint64_t nbits, StepRing *R) {
+    int m = g->m;
+    uint64_t mask_m = (m >= 64) ? ~0ULL : ((1ULL << m) - 1ULL);
+    uint64_t poly_lo = g->lo & mask_m;
+    uint64_t reg = 0;
+    for (uint64_t step = 0; step < nbits + (uint64_t)m; ++step) {
+        int i = (step < nbits) ? (msg[step / 8] >> (7 - step % 8)) & 1 : 0;
+        int msb_old = (int)((reg >> (m - 1)) & 1ULL);
+        uint64_t before = reg;
+        reg = ((reg << 1) | (uint64_t)i) & mask_m;
+        if (msb_old) reg ^= poly_lo;
+        step_ring_push(R, step, i, msb_old, before, reg);
+    }
+    return reg;
+}
+
+/* ===================== (23) Traço binário do LFSR com checkpoints ===================== */
+/*
+ * Em vez de uma linha de texto por passo, o arquivo guarda só o que não se
+ * deduz: os bits da mensagem e, a cada TRACE_K passos, o registrador antes do
+ * passo (o checkpoint). O passo n sai de um pread no checkpoint n/K e de até
+ * K clocks refeitos a partir dos bits: O(1) por consulta, com ~1,6% a mais
+ * que a própria mensagem. Layout, com todos os inteiros em little-endian
+ * (o traço gravado numa máquina é consultado em qualquer outra):
+ *   cabeçalho (TRACE_HDR_LEN bytes) | bits da mensagem (MSB-first) | ncheck x u64
+ */
+#define TRACE_MAGIC "CRCLFSR1"
+#define TRACE_K 4096
+#define TRACE_HDR_LEN 56
+
+typedef struct {
+    char magic[8];
+    uint32_t m, k;                  /* grau e passos entre checkpoints */
+    uint64_t poly_lo;               /* g sem o termo x^m */
+    uint64_t nbits;                 /* bits da mensagem; passos = nbits + m */
+    uint64_t ncheck;                /* registrador antes dos passos 0, K, 2K, ... */
+    uint64_t fcs;
+    uint64_t off_check;
+} TraceHdr;
+
+static void le_put(uint8_t *p, uint64_t x, int n) {
+    for (int i = 0; i < n; ++i) p[i] = (uint8_t)(x >> (8 * i));
+}
+
+static uint64_t le_get(const uint8_t *p, int n) {
+    uint64_t x = 0;
+    for (int i = n - 1; i >= 0; --i) x = (x << 8) | p[i];
+    return x;
+}
+
+static void trace_hdr_pack(uint8_t b[TRACE_HDR_LEN], const TraceHdr *h) {
+    memcpy(b, h->magic, 8);
+    le_put(b + 8, h->m, 4);
+    le_put(b + 12, h->k, 4);
+    le_put(b + 16, h->poly_lo, 8);
+    le_put(b + 24, h->nbits, 8);
+    le_put(b + 32, h->ncheck, 8);
+    le_put(b + 40, h->fcs, 8);
+    le_put(b + 48, h->off_check, 8);
+}
+
+static void trace_hdr_unpack(TraceHdr *h, const uint8_t b[TRACE_HDR_LEN]) {
+    memcpy(h->magic, b, 8);
+    h->m = (uint32_t)le_get(b + 8, 4);
+    h->k = (uint32_t)le_get(b + 12, 4);
+    h->poly_lo = le_get(b + 16, 8);
+    h->nbits = le_get(b + 24, 8);
+    h->ncheck = le_get(b + 32, 8);
+    h->fcs = le_get(b + 40, 8);
+    h->off_check = le_get(b + 48, 8);
+}
+
+/* Sink do anel (22) que grava o arquivo; trace_bin_close escreve o cabeçalho. */
+typedef struct {
+    FILE *fp;
+    TraceHdr h;
+    uint8_t acc;                    /* bits ainda sem byte completo */
+    int nacc;
+    uint64_t *chk;
+    size_t cap;
+} TraceBin;
+
+static void step_sink_bin(void *ctx, const LfsrStep *s, size_t n) {
+    TraceBin *B = (TraceBin*)ctx;
+    for (size_t k = 0; k < n; ++k) {
+        if (s[k].step % B->h.k == 0) {
+            if (B->h.ncheck == B->cap) {
+                B->cap = B->cap ? 2 * B->cap : 1024;
+                uint64_t *p = (uint64_t*)realloc(B->chk, B->cap * sizeof *p);
+                if (!p) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+                B->chk = p;
+            }
+            B->chk[B->h.ncheck++] = s[k].before;
+        }
+        if (s[k].step < B->h.nbits) {
+            B->acc = (uint8_t)(B->acc << 1 | s[k].bit);
+            if (++B->nacc == 8) { putc(B->acc, B->fp); B->acc = 0; B->nacc = 0; }
+        } else {
+            B->h.fcs = s[k].after;
+        }
+    }
+}
+
+static int trace_bin_open(TraceBin *B, const char *path, const CrcPoly *g, uint64_t nbits) {
+    memset(B, 0, sizeof *B);
+    if (!(B->fp = fopen(path, "wb"))) return -1;
+    memcpy(B->h.magic, TRACE_MAGIC, 8);
+    B->h.m = (uint32_t)g->m;
+    B->h.k = TRACE_K;
+    B->h.poly_lo = g->lo;
+    B->h.nbits = nbits;
+    uint8_t hb[TRACE_HDR_LEN];
+    trace_hdr_pack(hb, &B->h);
+    fwrite(hb, sizeof hb, 1, B->fp);        /* reescrito no fim */
+    return 0;
+}
+
+static int trace_bin_close(TraceBin *B) {
+    if (B->nacc) putc(B->acc << (8 - B->nacc), B->fp);
+    B->h.off_check = TRACE_HDR_LEN + (B->h.nbits + 7) / 8;
+    for (uint64_t c = 0; c < B->h.ncheck; ++c) {
+        uint8_t v[8];
+        le_put(v, B->chk[c], 8);
+        fwrite(v, sizeof v, 1, B->fp);
+    }
+    uint8_t hb[TRACE_HDR_LEN];
+    trace_hdr_pack(hb, &B->h);
+    int ok = fseek(B->fp, 0, SEEK_SET) == 0 && fwrite(hb, sizeof hb, 1, B->fp) == 1;
+    ok = ok && !ferror(B->fp);
+    if (fclose(B->fp) != 0) ok = 0;
+    free(B->chk);
+    return ok ? 0 : -1;
+}
+
+/* Lê e confere o cabeçalho de um traço aberto em fd; -1 se não for um traço. */
+static int trace_bin_load(int fd, TraceHdr *h) {
+    struct stat st;
+    uint8_t hb[TRACE_HDR_LEN];
+    if (pread(fd, hb, sizeof hb, 0) != (ssize_t)sizeof hb) return -1;
+    trace_hdr_unpack(h, hb);
+    if (memcmp(h->magic, TRACE_MAGIC, 8) != 0 ||
+        h->m < 1 || h->m > 64 || h->k == 0 || h->k % 8 || h->k > TRACE_K ||
+        h->ncheck != (h->nbits + h->m + h->k - 1) / h->k ||
+        h->off_check != TRACE_HDR_LEN + (h->nbits + 7) / 8 ||
+        fstat(fd, &st) < 0 || (uint64_t)st.st_size < h->off_check + 8 * h->ncheck)
+        return -1;
+    return 0;
+}
+
+/* Passo n do traço em fd: checkpoint n/K e os clocks até n. -1 se não houver. */
+static int trace_bin_step(int fd, const TraceHdr *h, uint64_t n, LfsrStep *out) {
+    uint64_t c = n / h->k;
+    uint8_t v[8];
+    if (n >= h->nbits + h->m || c >= h->ncheck ||
+        pread(fd, v, sizeof v, (off_t)(h->off_check + 8 * c)) != (ssize_t)sizeof v)
+        return -1;
+    uint64_t reg = le_get(v, 8);
+
+    uint64_t s0 = c * h->k;
+    uint8_t bits[TRACE_K / 8 + 1];
+    size_t nb = 0;
+    if (s0 < h->nbits) {
+        uint64_t last = (n < h->nbits) ? n : h->nbits - 1;
+        nb = (size_t)(last / 8 - s0 / 8 + 1);
+        if (pread(fd, bits, nb, (off_t)(TRACE_HDR_LEN + s0 / 8)) != (ssize_t)nb) return -1;
+    }
+
+    int m = (int)h->m;
+    uint64_t mask_m = (m >= 64) ? ~0ULL : ((1ULL << m) - 1ULL);
+    uint64_t poly_lo = h->poly_lo & mask_m;
+    for (uint64_t s = s0; ; ++s) {
+        uint64_t j = s - (s0 & ~7ULL);
+        int i = (s < h->nbits) ? (bits[j / 8] >> (7 - j % 8)) & 1 : 0;
+        int msb_old = (int)((reg >> (m - 1)) & 1ULL);
+        uint64_t before = reg;
+        reg = ((reg << 1) | (uint64_t)i) & mask_m;
+        if (msb_old) reg ^= poly_lo;
+        if (s == n) {
+            *out = (LfsrStep){ s, before, reg, (uint8_t)i, (uint8_t)msb_old };
+            return 0;
+        }
+    }
+}
+
 /* ===================== (2/3) LFSR: shift-in + XOR (MSB-old) ===================== */
 
 static uint64_t trace_lfsr_crc(uint64_t mensagem, int msg_width,
@@ -196,11 +914,13 @@ static uint64_t trace_lfsr_crc(uint64_t mensagem, int msg_width,
     uint64_t poly_lo = polinomio & mask_m;
     uint64_t reg = 0;
 
-    /* helper: imprime registrador como m bits */
-    char *(*reg_str)(uint64_t, int) = bits_str;
+    /* cada clock vai cru para o anel; a tabela é montada pela escritora (22) */
+    StepText T = { L, m };
+    StepRing R;
 
     if (verbose) {
         lprint(L, "passo | i | msb(old) |  r[m-1]..r[0]      ->   r'[m-1]..r'[0]\n");
+        step_ring_start(&R, step_sink_text, &T, (uint64_t)(msg_width + m));
     }
 
     for (int step = 0; step < msg_width; ++step) {
@@ -210,12 +930,7 @@ static uint64_t trace_lfsr_crc(uint64_t mensagem, int msg_width,
         reg = ((reg << 1) | (uint64_t)i) & mask_m;
         if (msb_old) reg ^= poly_lo;
 
-        if (verbose) {
-            char *b1 = reg_str(before, m);
-            char *b2 = reg_str(reg,    m);
-            lprint(L, "%5d | %d |     %d     |  %-16s ->   %s\n", step, i, msb_old, b1+2, b2+2);
-            free(b1); free(b2);
-        }
+        if (verbose) step_ring_push(&R, (uint64_t)step, i, msb_old, before, reg);
     }
 
     for (int z = 0; z < m; ++z) {
@@ -224,66 +939,3660 @@ static uint64_t trace_lfsr_crc(uint64_t mensagem, int msg_width,
         reg = (reg << 1) & mask_m;
         if (msb_old) reg ^= poly_lo;
 
-        if (verbose) {
-            char *b1 = reg_str(before, m);
-            char *b2 = reg_str(reg,    m);
-            lprint(L, "%5d | 0 |     %d     |  %-16s ->   %s\n", msg_width+z, msb_old, b1+2, b2+2);
-            free(b1); free(b2);
-        }
+        if (verbose) step_ring_push(&R, (uint64_t)(msg_width + z), 0, msb_old, before, reg);
     }
 
+    if (verbose) step_ring_stop(&R);
     return reg; /* FCS */
 }
 
 
-static void print_bits(Logger *L, const char *label, uint64_t x, int width) {
-    char *s = bits_str(x, width);
-    lprint(L, "%s%s\n", label, s);
-    free(s);
+/* ===================== (4) CRC por tabela (Sarwate, byte a byte) ===================== */
+/*
+ * O registrador fica alinhado à esquerda em 64 bits (r[m-1] no bit 63), assim o
+ * mesmo laço serve para qualquer grau 1..64: o índice da tabela é sempre o byte
+ * mais alto do registrador XOR o byte de entrada. É a forma "direta" do LFSR:
+ * o bit de entrada entra na realimentação, então não há os m zeros do final.
+ *
+ * Na forma refletida (bit 0 de cada byte entra primeiro, como CRC-32 e CRC-16/X-25)
+ * tudo é espelhado: registrador alinhado à direita, índice no byte mais baixo.
+ */
+typedef struct {
+    int m;                 /* grau do polinômio */
+    int refl;              /* 0: MSB primeiro; 1: refletido */
+    uint64_t poly_top;     /* coeficientes abaixo de x^m, alinhados à esquerda (ou espelhados) */
+    uint64_t t[256];
+} CrcTable;
+
+static uint64_t reflect_u64(uint64_t x) {
+    x = ((x >> 1) & 0x5555555555555555ULL) | ((x & 0x5555555555555555ULL) << 1);
+    x = ((x >> 2) & 0x3333333333333333ULL) | ((x & 0x3333333333333333ULL) << 2);
+    x = ((x >> 4) & 0x0F0F0F0F0F0F0F0FULL) | ((x & 0x0F0F0F0F0F0F0F0FULL) << 4);
+    x = ((x >> 8) & 0x00FF00FF00FF00FFULL) | ((x & 0x00FF00FF00FF00FFULL) << 8);
+    x = ((x >> 16) & 0x0000FFFF0000FFFFULL) | ((x & 0x0000FFFF0000FFFFULL) << 16);
+    return (x >> 32) | (x << 32);
 }
 
+static uint64_t crc_step_msb(uint64_t reg, int bit, uint64_t poly_top) {
+    reg ^= (uint64_t)bit << 63;
+    return (reg >> 63) ? (reg << 1) ^ poly_top : (reg << 1);
+}
 
-int main(void) {
-    /* Dados do enunciado */
-    uint64_t mensagem  = 0b10001000100010001000000110000001ULL; /* 32 bits */
-    uint64_t polinomio = 0b1011011ULL;                          /* x^6 + x^4 + x^3 + x + 1 */
+static uint64_t crc_step_lsb(uint64_t reg, int bit, uint64_t poly_ref) {
+    reg ^= (uint64_t)bit;
+    return (reg & 1) ? (reg >> 1) ^ poly_ref : (reg >> 1);
+}
 
-    Logger logger = {0};
-    logger.fp = fopen("resultado_crc.txt", "w");
-    if (!logger.fp) {
-        fprintf(stderr, "Aviso: não consegui abrir resultado_crc.txt para escrita.\n");
+static void crc_table_init(CrcTable *T, const CrcPoly *g, int refl) {
+    if (g->m < 1 || g->m > 64) {
+        fprintf(stderr, "Erro: este motor aceita polinômios de grau 1 a 64.\n");
+        exit(1);
     }
+    T->m = g->m;
+    T->refl = refl;
+    T->poly_top = g->lo << (64 - g->m);
+    if (refl) T->poly_top = reflect_u64(T->poly_top);
+    for (int i = 0; i < 256; ++i) {
+        uint64_t c = refl ? (uint64_t)i : (uint64_t)i << 56;
+        for (int b = 0; b < 8; ++b)
+            c = refl ? crc_step_lsb(c, 0, T->poly_top) : crc_step_msb(c, 0, T->poly_top);
+        T->t[i] = c;
+    }
+}
 
-    int m = bitlen_u64(polinomio) - 1;
-    int msgw = 32;
+/* Avança o registrador (alinhado à esquerda, ou à direita se refletido) sobre len bytes. */
+static uint64_t crc_table_bytes(const CrcTable *T, uint64_t reg,
+                                const uint8_t *buf, size_t len)
+{
+    if (T->refl)
+        while (len--) reg = (reg >> 8) ^ T->t[(reg ^ *buf++) & 0xff];
+    else
+        while (len--) reg = (reg << 8) ^ T->t[(reg >> 56) ^ *buf++];
+    return reg;
+}
 
-    lprint(&logger, "\n=== ITEM 1: CRC por divisão em módulo 2 (com passos) ===\n\n");
-    uint64_t codeword = 0, fcs_div = 0;
-    make_crc_transmission(mensagem, polinomio, &codeword, &fcs_div, &logger, 1);
+/* Mesmo FCS de make_crc_transmission, sem passos impressos (tabela MSB primeiro). */
+static uint64_t crc_table_fcs(const CrcTable *T, uint64_t mensagem, int msg_width)
+{
+    uint64_t reg = 0;
+    int head = msg_width % 8;           /* bits que sobram antes do 1º byte cheio */
+    for (int b = msg_width - 1; b >= msg_width - head; --b)
+        reg = crc_step_msb(reg, (int)((mensagem >> b) & 1ULL), T->poly_top);
+    for (int b = msg_width - head - 8; b >= 0; b -= 8) {
+        uint8_t byte = (uint8_t)(mensagem >> b);
+        reg = crc_table_bytes(T, reg, &byte, 1);
+    }
+    return reg >> (64 - T->m);
+}
 
-    lprint(&logger, "\n");
-    print_bits(&logger, "FCS (divisão): ", fcs_div, m);
-    {
-        int cw_w = msgw + m;
-        char *cw = bits_str(codeword, cw_w);
-        lprint(&logger, "Mensagem transmitida (codeword): %s\n\n", cw);
-        free(cw);
+
+/* ===================== (4b) Slice-by-4/8/16 ===================== */
+/*
+ * Tabela k = efeito de um byte seguido de k bytes zero. Com elas o laço consome
+ * 4, 8 ou 16 bytes por iteração e as consultas são independentes entre si, em
+ * vez de uma cadeia de 1 consulta por byte. Mais fatias = mais memória
+ * (2/8/32 KiB a mais sobre a tabela simples), por isso a escolha é em runtime.
+ * As tabelas ficam fora da estrutura: alocadas por crc_slices_init ou, para os
+ * modelos do catálogo, apontando direto para as constantes de crc_catalogo.h.
+ */
+typedef struct {
+    int m;
+    int refl;
+    int slices;                 /* 4, 8 ou 16 */
+    uint64_t poly_top;
+    const uint64_t (*t)[256];   /* slices tabelas; t[0] é a de Sarwate */
+    uint64_t (*own)[256];       /* não nulo se alocadas aqui */
+} CrcSlices;
+
+static uint64_t load_be32(const uint8_t *p) {
+    return ((uint64_t)p[0] << 24) | ((uint64_t)p[1] << 16) |
+           ((uint64_t)p[2] << 8)  |  (uint64_t)p[3];
+}
+
+static uint64_t load_be64(const uint8_t *p) {
+    return (load_be32(p) << 32) | load_be32(p + 4);
+}
+
+static uint64_t load_le32(const uint8_t *p) {
+    return ((uint64_t)p[3] << 24) | ((uint64_t)p[2] << 16) |
+           ((uint64_t)p[1] << 8)  |  (uint64_t)p[0];
+}
+
+static uint64_t load_le64(const uint8_t *p) {
+    return (load_le32(p + 4) << 32) | load_le32(p);
+}
+
+static void crc_slices_init(CrcSlices *S, const CrcTable *T, int slices) {
+    if (slices != 4 && slices != 8 && slices != 16) {
+        fprintf(stderr, "Erro: número de fatias deve ser 4, 8 ou 16.\n");
+        exit(1);
     }
+    uint64_t (*t)[256] = (uint64_t (*)[256])malloc((size_t)slices * sizeof *t);
+    if (!t) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    S->m = T->m;
+    S->refl = T->refl;
+    S->slices = slices;
+    S->poly_top = T->poly_top;
+    memcpy(t[0], T->t, sizeof T->t);
+    for (int k = 1; k < slices; ++k)
+        for (int i = 0; i < 256; ++i) {
+            uint64_t c = t[k-1][i];
+            t[k][i] = T->refl ? (c >> 8) ^ t[0][c & 0xff]
+                              : (c << 8) ^ t[0][c >> 56];
+        }
+    S->t = (const uint64_t (*)[256])t;
+    S->own = t;
+}
 
-    lprint(&logger, "Verificação na recepção (codeword ÷ polinômio):\n");
-    {
-        uint64_t q=0, r=0;
-        divide_mod2_show(codeword, polinomio, &q, &r, &logger, 1);
-        lprint(&logger, "\n%s\n", (r == 0) ? "Transmissão com sucesso!" : "Falha na transmissão.");
+static void crc_slices_free(CrcSlices *S) {
+    free(S->own);
+    S->own = NULL;
+    S->t = NULL;
+}
+
+#define B(x, n) (((x) >> (n)) & 0xff)
+
+/* Forma refletida: bytes em little-endian, o primeiro byte no fundo do registrador. */
+static uint64_t crc_slice_bytes_refl(const CrcSlices *S, uint64_t reg,
+                                     const uint8_t *buf, size_t len)
+{
+    const uint64_t (*t)[256] = S->t;
+    switch (S->slices) {
+    case 4:
+        for (; len >= 4; len -= 4, buf += 4) {
+            reg ^= load_le32(buf);
+            reg = (reg >> 32) ^ t[3][B(reg,0)] ^ t[2][B(reg,8)]
+                              ^ t[1][B(reg,16)] ^ t[0][B(reg,24)];
+        }
+        break;
+    case 8:
+        for (; len >= 8; len -= 8, buf += 8) {
+            reg ^= load_le64(buf);
+            reg = t[7][B(reg,0)]  ^ t[6][B(reg,8)]  ^ t[5][B(reg,16)] ^ t[4][B(reg,24)]
+                ^ t[3][B(reg,32)] ^ t[2][B(reg,40)] ^ t[1][B(reg,48)] ^ t[0][B(reg,56)];
+        }
+        break;
+    case 16:
+        for (; len >= 16; len -= 16, buf += 16) {
+            uint64_t lo = reg ^ load_le64(buf);
+            uint64_t hi = load_le64(buf + 8);
+            reg = t[15][B(lo,0)]  ^ t[14][B(lo,8)]  ^ t[13][B(lo,16)] ^ t[12][B(lo,24)]
+                ^ t[11][B(lo,32)] ^ t[10][B(lo,40)] ^ t[9][B(lo,48)]  ^ t[8][B(lo,56)]
+                ^ t[7][B(hi,0)]   ^ t[6][B(hi,8)]   ^ t[5][B(hi,16)]  ^ t[4][B(hi,24)]
+                ^ t[3][B(hi,32)]  ^ t[2][B(hi,40)]  ^ t[1][B(hi,48)]  ^ t[0][B(hi,56)];
+        }
+        break;
     }
+    while (len--) reg = (reg >> 8) ^ t[0][(reg ^ *buf++) & 0xff];
+    return reg;
+}
 
-    lprint(&logger, "\n=== ITEM 2 e 3: LFSR simplificado + tabela de evolução ===\n\n");
-    uint64_t fcs_lfsr = trace_lfsr_crc(mensagem, msgw, polinomio, &logger, 1);
+static uint64_t crc_slice_bytes(const CrcSlices *S, uint64_t reg,
+                                const uint8_t *buf, size_t len)
+{
+    if (S->refl) return crc_slice_bytes_refl(S, reg, buf, len);
 
-    lprint(&logger, "\n");
-    print_bits(&logger, "FCS (LFSR):     ", fcs_lfsr, m);
-    lprint(&logger, "Comparação:     %s\n\n", (fcs_lfsr == fcs_div) ? "OK" : "DIVERGE");
+    const uint64_t (*t)[256] = S->t;
+    switch (S->slices) {
+    case 4:
+        for (; len >= 4; len -= 4, buf += 4) {
+            reg ^= load_be32(buf) << 32;
+            reg = (reg << 32) ^ t[3][B(reg,56)] ^ t[2][B(reg,48)]
+                              ^ t[1][B(reg,40)] ^ t[0][B(reg,32)];
+        }
+        break;
+    case 8:
+        for (; len >= 8; len -= 8, buf += 8) {
+            reg ^= load_be64(buf);
+            reg = t[7][B(reg,56)] ^ t[6][B(reg,48)] ^ t[5][B(reg,40)] ^ t[4][B(reg,32)]
+                ^ t[3][B(reg,24)] ^ t[2][B(reg,16)] ^ t[1][B(reg,8)]  ^ t[0][B(reg,0)];
+        }
+        break;
+    case 16:
+        for (; len >= 16; len -= 16, buf += 16) {
+            uint64_t hi = reg ^ load_be64(buf);
+            uint64_t lo = load_be64(buf + 8);
+            reg = t[15][B(hi,56)] ^ t[14][B(hi,48)] ^ t[13][B(hi,40)] ^ t[12][B(hi,32)]
+                ^ t[11][B(hi,24)] ^ t[10][B(hi,16)] ^ t[9][B(hi,8)]   ^ t[8][B(hi,0)]
+                ^ t[7][B(lo,56)]  ^ t[6][B(lo,48)]  ^ t[5][B(lo,40)]  ^ t[4][B(lo,32)]
+                ^ t[3][B(lo,24)]  ^ t[2][B(lo,16)]  ^ t[1][B(lo,8)]   ^ t[0][B(lo,0)];
+        }
+        break;
+    }
+    while (len--) reg = (reg << 8) ^ t[0][(reg >> 56) ^ *buf++];
+    return reg;
+}
+
+#undef B
+
+static uint64_t crc_slice_fcs(const CrcSlices *S, uint64_t mensagem, int msg_width)
+{
+    uint64_t reg = 0;
+    uint8_t buf[8];
+    size_t n = 0;
+    int head = msg_width % 8;
+    for (int b = msg_width - 1; b >= msg_width - head; --b)
+        reg = crc_step_msb(reg, (int)((mensagem >> b) & 1ULL), S->poly_top);
+    for (int b = msg_width - head - 8; b >= 0; b -= 8) buf[n++] = (uint8_t)(mensagem >> b);
+    reg = crc_slice_bytes(S, reg, buf, n);
+    return reg >> (64 - S->m);
+}
+
+
+/* ===================== (5) Dobramento com PCLMULQDQ + Barrett ===================== */
+/*
+ * Trabalha com Q(x) = g(x)·x^(64-m), de grau 64: o resto módulo Q é o resto
+ * módulo g deslocado para o topo, que é justamente o registrador alinhado à
+ * esquerda dos motores por tabela. Assim as constantes servem para qualquer g.
+ *
+ * Quatro acumuladores de 128 bits andam 64 bytes por vez:
+ *   A·x^512 = A_hi·x^576 + A_lo·x^512 ≡ A_hi·(x^576 mod Q) + A_lo·(x^512 mod Q)
+ * No fim, A·x^64 mod Q sai por uma multiplicação e uma redução de Barrett com
+ * mu = floor(x^128 / Q).
+ *
+ * Refletido: os bytes entram sem inversão e cada metade do vetor guarda os
+ * coeficientes espelhados (a metade baixa é a de grau alto). O produto sem
+ * vai-um de dois valores espelhados sai multiplicado por x, por isso as
+ * constantes são x^(n-1) espelhadas, e o Barrett final ajusta os deslocamentos.
+ */
+typedef struct {
+    int m;
+    int refl;
+    uint64_t q_lo;                    /* Q sem o termo x^64 (espelhado se refl) */
+    uint64_t k16[2];                  /* dobra de 4 zmm (256 bytes), (hi, lo) */
+    uint64_t k4[2];                   /* dobra de 4 blocos (64 bytes)  */
+    uint64_t k1[2];                   /* dobra de 1 bloco (16 bytes)   */
+    uint64_t kf;                      /* x^128 mod Q, para A_hi no fim */
+    uint64_t mu;                      /* floor(x^128 / Q) sem o termo x^64 */
+} CrcFold;
+
+/* x^n mod Q, com Q = x^64 + q_lo. */
+static uint64_t xpow_mod_q(unsigned n, uint64_t q_lo) {
+    uint64_t r = 1;
+    while (n--) r = (r >> 63) ? (r << 1) ^ q_lo : (r << 1);
+    return r;
+}
+
+static void crc_fold_pair(uint64_t k[2], unsigned t, uint64_t q, int refl) {
+    if (refl) {
+        k[0] = reflect_u64(xpow_mod_q(t - 1, q));
+        k[1] = reflect_u64(xpow_mod_q(t + 63, q));
+    } else {
+        k[0] = xpow_mod_q(t + 64, q);
+        k[1] = xpow_mod_q(t, q);
+    }
+}
+
+static void crc_fold_init(CrcFold *F, const CrcTable *T) {
+    uint64_t q = T->refl ? reflect_u64(T->poly_top) : T->poly_top;
+    F->m = T->m;
+    F->refl = T->refl;
+    crc_fold_pair(F->k16, 2048, q, T->refl);
+    crc_fold_pair(F->k4, 512, q, T->refl);
+    crc_fold_pair(F->k1, 128, q, T->refl);
+    F->kf = T->refl ? reflect_u64(xpow_mod_q(127, q)) : xpow_mod_q(128, q);
+
+    /* divisão longa de x^128 por Q: 65 bits de quociente, o de x^64 é implícito */
+    uint64_t rem = 0, mu = 0;
+    int lead = 1;
+    for (int i = 64; i >= 0; --i) {
+        if (lead) {
+            if (i < 64) mu |= 1ULL << i;
+            rem ^= q;
+        }
+        lead = (int)(rem >> 63);
+        rem <<= 1;
+    }
+    F->mu = T->refl ? reflect_u64(mu) : mu;
+    F->q_lo = T->refl ? reflect_u64(q) : q;
+}
+
+typedef enum {
+    KERNEL_SLICE,                     /* tabelas fatiadas, C portável */
+    KERNEL_PCLMUL,                    /* 4 x 128 bits, SSE */
+    KERNEL_VPCLMUL                    /* 4 x 512 bits, AVX-512 */
+} CrcKernel;
+
+static const char *kernel_name(CrcKernel k) {
+    switch (k) {
+    case KERNEL_PCLMUL:  return "pclmul";
+    case KERNEL_VPCLMUL: return "vpclmul";
+    default:             return "slice";
+    }
+}
+
+static int kernel_supported(CrcKernel k) {
+#ifdef HAVE_X86_CLMUL
+    __builtin_cpu_init();
+    switch (k) {
+    case KERNEL_PCLMUL:
+        return __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("ssse3");
+    case KERNEL_VPCLMUL:
+        return __builtin_cpu_supports("vpclmulqdq") && __builtin_cpu_supports("avx512f") &&
+               __builtin_cpu_supports("avx512bw") && kernel_supported(KERNEL_PCLMUL);
+    default:
+        return 1;
+    }
+#else
+    return k == KERNEL_SLICE;
+#endif
+}
+
+/* O mais largo que a CPU suporta. */
+static CrcKernel crc_select_kernel(void) {
+    if (kernel_supported(KERNEL_VPCLMUL)) return KERNEL_VPCLMUL;
+    if (kernel_supported(KERNEL_PCLMUL))  return KERNEL_PCLMUL;
+    return KERNEL_SLICE;
+}
+
+#ifdef HAVE_X86_CLMUL
+#define CLMUL_TARGET __attribute__((target("pclmul,ssse3")))
+#define CLMUL_INLINE CLMUL_TARGET static inline __attribute__((always_inline))
+
+/* 16 bytes em um vetor; MSB primeiro precisa inverter a ordem dos bytes. */
+CLMUL_INLINE __m128i load_lane128(const uint8_t *p, int refl) {
+    const __m128i rev = _mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15);
+    __m128i x = _mm_loadu_si128((const __m128i*)p);
+    return refl ? x : _mm_shuffle_epi8(x, rev);
+}
+
+/* Registrador na metade de grau alto do primeiro bloco. */
+CLMUL_INLINE __m128i reg_lane128(uint64_t reg, int refl) {
+    return refl ? _mm_set_epi64x(0, (long long)reg) : _mm_set_epi64x((long long)reg, 0);
+}
+
+/* A·x^T + B, com k = (x^(T+64) mod Q, x^T mod Q) em (hi, lo) */
+CLMUL_TARGET static inline __m128i fold128(__m128i a, __m128i k, __m128i b) {
+    return _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(a, k, 0x11),
+                                       _mm_clmulepi64_si128(a, k, 0x00)), b);
+}
+
+CLMUL_TARGET static inline uint64_t hi64(__m128i x) {
+    return (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(x, x));
+}
+
+CLMUL_TARGET static inline uint64_t lo64(__m128i x) {
+    return (uint64_t)_mm_cvtsi128_si64(x);
+}
+
+CLMUL_TARGET static inline __m128i clmul64(uint64_t a, uint64_t b) {
+    return _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)a),
+                                _mm_cvtsi64_si128((long long)b), 0x00);
+}
+
+/* A·x^64 mod Q, com A de 128 bits. */
+CLMUL_TARGET static uint64_t fold_barrett(const CrcFold *F, __m128i a) {
+    __m128i t = _mm_clmulepi64_si128(a, _mm_cvtsi64_si128((long long)F->kf), 0x01);
+    t = _mm_xor_si128(t, _mm_slli_si128(a, 8));           /* + A_lo·x^64 */
+    uint64_t t_hi = hi64(t), t_lo = lo64(t);
+    uint64_t q = t_hi ^ hi64(clmul64(t_hi, F->mu));
+    return t_lo ^ lo64(clmul64(q, F->q_lo));
+}
+
+/* O mesmo com coeficientes espelhados: grau alto na metade baixa. */
+CLMUL_TARGET static uint64_t fold_barrett_refl(const CrcFold *F, __m128i a) {
+    __m128i t = _mm_clmulepi64_si128(a, _mm_cvtsi64_si128((long long)F->kf), 0x00);
+    t = _mm_xor_si128(t, _mm_srli_si128(a, 8));           /* + A_lo·x^64 */
+    uint64_t t_hi = lo64(t), t_lo = hi64(t);
+    uint64_t q = t_hi ^ (lo64(clmul64(t_hi, F->mu)) << 1);
+    __m128i p = clmul64(q, F->q_lo);
+    return t_lo ^ ((lo64(p) >> 63) | (hi64(p) << 1));
+}
+
+/* len múltiplo de 16 e >= 64. reg e retorno no formato do CrcTable. */
+CLMUL_INLINE uint64_t crc_fold_pclmul_impl(const CrcFold *F, uint64_t reg,
+                                           const uint8_t *buf, size_t len, int refl)
+{
+    const __m128i k4 = _mm_set_epi64x((long long)F->k4[0], (long long)F->k4[1]);
+    const __m128i k1 = _mm_set_epi64x((long long)F->k1[0], (long long)F->k1[1]);
+
+    __m128i a0 = _mm_xor_si128(load_lane128(buf, refl), reg_lane128(reg, refl));
+    __m128i a1 = load_lane128(buf + 16, refl);
+    __m128i a2 = load_lane128(buf + 32, refl);
+    __m128i a3 = load_lane128(buf + 48, refl);
+    buf += 64; len -= 64;
+
+    for (; len >= 64; buf += 64, len -= 64) {
+        a0 = fold128(a0, k4, load_lane128(buf, refl));
+        a1 = fold128(a1, k4, load_lane128(buf + 16, refl));
+        a2 = fold128(a2, k4, load_lane128(buf + 32, refl));
+        a3 = fold128(a3, k4, load_lane128(buf + 48, refl));
+    }
+
+    a0 = fold128(a0, k1, a1);
+    a0 = fold128(a0, k1, a2);
+    a0 = fold128(a0, k1, a3);
+    for (; len >= 16; buf += 16, len -= 16)
+        a0 = fold128(a0, k1, load_lane128(buf, refl));
+
+    return refl ? fold_barrett_refl(F, a0) : fold_barrett(F, a0);
+}
+
+CLMUL_TARGET static uint64_t crc_fold_pclmul(const CrcFold *F, uint64_t reg,
+                                             const uint8_t *buf, size_t len)
+{
+    return F->refl ? crc_fold_pclmul_impl(F, reg, buf, len, 1)
+                   : crc_fold_pclmul_impl(F, reg, buf, len, 0);
+}
+
+#define VCLMUL_TARGET __attribute__((target("pclmul,ssse3,vpclmulqdq,avx512f,avx512bw")))
+#define VCLMUL_INLINE VCLMUL_TARGET static inline __attribute__((always_inline))
+
+VCLMUL_INLINE __m512i load_lane512(const uint8_t *p, int refl) {
+    const __m512i rev = _mm512_broadcast_i32x4(
+        _mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15));
+    __m512i x = _mm512_loadu_si512((const void*)p);
+    return refl ? x : _mm512_shuffle_epi8(x, rev);
+}
+
+VCLMUL_TARGET static inline __m512i fold512(__m512i a, __m512i k, __m512i b) {
+    return _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(a, k, 0x11),
+                                     _mm512_clmulepi64_epi128(a, k, 0x00), b, 0x96);
+}
+
+/* Mesmo esquema com 4 blocos por zmm. len múltiplo de 16 e >= 256. */
+VCLMUL_INLINE uint64_t crc_fold_vpclmul_impl(const CrcFold *F, uint64_t reg,
+                                             const uint8_t *buf, size_t len, int refl)
+{
+    const __m512i k16 = _mm512_broadcast_i32x4(
+        _mm_set_epi64x((long long)F->k16[0], (long long)F->k16[1]));
+    const __m512i k4 = _mm512_broadcast_i32x4(
+        _mm_set_epi64x((long long)F->k4[0], (long long)F->k4[1]));
+    const __m128i k1 = _mm_set_epi64x((long long)F->k1[0], (long long)F->k1[1]);
+
+    __m512i z0 = _mm512_xor_si512(load_lane512(buf, refl),
+        _mm512_inserti32x4(_mm512_setzero_si512(), reg_lane128(reg, refl), 0));
+    __m512i z1 = load_lane512(buf + 64, refl);
+    __m512i z2 = load_lane512(buf + 128, refl);
+    __m512i z3 = load_lane512(buf + 192, refl);
+    buf += 256; len -= 256;
+
+    for (; len >= 256; buf += 256, len -= 256) {
+        z0 = fold512(z0, k16, load_lane512(buf, refl));
+        z1 = fold512(z1, k16, load_lane512(buf + 64, refl));
+        z2 = fold512(z2, k16, load_lane512(buf + 128, refl));
+        z3 = fold512(z3, k16, load_lane512(buf + 192, refl));
+    }
+
+    z0 = fold512(z0, k4, z1);
+    z0 = fold512(z0, k4, z2);
+    z0 = fold512(z0, k4, z3);
+    for (; len >= 64; buf += 64, len -= 64)
+        z0 = fold512(z0, k4, load_lane512(buf, refl));
+
+    __m128i a = _mm512_extracti32x4_epi32(z0, 0);
+    a = fold128(a, k1, _mm512_extracti32x4_epi32(z0, 1));
+    a = fold128(a, k1, _mm512_extracti32x4_epi32(z0, 2));
+    a = fold128(a, k1, _mm512_extracti32x4_epi32(z0, 3));
+    for (; len >= 16; buf += 16, len -= 16)
+        a = fold128(a, k1, load_lane128(buf, refl));
+
+    return refl ? fold_barrett_refl(F, a) : fold_barrett(F, a);
+}
+
+VCLMUL_TARGET static uint64_t crc_fold_vpclmul(const CrcFold *F, uint64_t reg,
+                                               const uint8_t *buf, size_t len)
+{
+    return F->refl ? crc_fold_vpclmul_impl(F, reg, buf, len, 1)
+                   : crc_fold_vpclmul_impl(F, reg, buf, len, 0);
+}
+#endif
+
+/* Dobra o que der com o motor escolhido e termina o resto com as tabelas fatiadas. */
+static uint64_t crc_fold_bytes(const CrcFold *F, const CrcSlices *S, CrcKernel kernel,
+                               uint64_t reg, const uint8_t *buf, size_t len)
+{
+#ifdef HAVE_X86_CLMUL
+    size_t n = len & ~(size_t)15;
+    if (kernel == KERNEL_VPCLMUL && len >= 256) {
+        reg = crc_fold_vpclmul(F, reg, buf, n);
+        buf += n; len -= n;
+    } else if (kernel != KERNEL_SLICE && len >= 64) {
+        reg = crc_fold_pclmul(F, reg, buf, n);
+        buf += n; len -= n;
+    }
+#else
+    (void)F; (void)kernel;
+#endif
+    return crc_slice_bytes(S, reg, buf, len);
+}
+
+/* ===================== (6) CRC-32C com a instrução crc32 (SSE4.2) ===================== */
+/*
+ * A instrução calcula o CRC-32C refletido (bit 0 de cada byte entra primeiro),
+ * que é a forma catalogada do CRC-32C; com os motores acima só coincide na
+ * divisão, não na ordem dos bits, por isso ele tem caminho próprio.
+ *
+ * A instrução tem latência 3 e vazão 1 por ciclo: três fluxos independentes
+ * sobre blocos vizinhos deixam a unidade cheia. No fim, crc(A||B) =
+ * crc(A)·x^(8·|B|) mod P ^ crc(B), e a multiplicação por x^(8·|B|) de um
+ * valor de 32 bits é feita com 4 tabelas (um byte cada) montadas no início.
+ */
+#define CRC32C_POLY     0x11EDC6F41ULL    /* com o termo x^32 */
+#define CRC32C_POLY_REF 0x82F63B78u       /* refletido, sem x^32 */
+#define CRC32C_LONG     8192              /* bytes por fluxo, blocos longos */
+#define CRC32C_SHORT    256               /* bytes por fluxo, blocos curtos */
+
+typedef struct {
+    int hw;
+    uint32_t tab[256];              /* Sarwate refletido (sem SSE4.2) */
+    uint32_t op_long[4][256];       /* ·x^(8·LONG)  mod P */
+    uint32_t op_short[4][256];      /* ·x^(8·SHORT) mod P */
+} Crc32c;
+
+/* a·b mod P no domínio refletido (x^0 no bit 31). */
+static uint32_t crc32c_mulmod(uint32_t a, uint32_t b) {
+    uint32_t p = 0;
+    for (uint32_t m = 1u << 31; m && a; m >>= 1) {
+        if (a & m) {
+            p ^= b;
+            a ^= m;
+        }
+        b = (b & 1) ? (b >> 1) ^ CRC32C_POLY_REF : (b >> 1);
+    }
+    return p;
+}
+
+static void crc32c_zeros_op(uint32_t op[4][256], size_t len) {
+    uint32_t xn = 1u << 31;                       /* x^0 */
+    for (size_t i = 0; i < 8 * len; ++i)
+        xn = (xn & 1) ? (xn >> 1) ^ CRC32C_POLY_REF : (xn >> 1);
+    for (int k = 0; k < 4; ++k)
+        for (uint32_t i = 0; i < 256; ++i)
+            op[k][i] = crc32c_mulmod(i << (8 * k), xn);
+}
+
+static uint32_t crc32c_shift(const uint32_t op[4][256], uint32_t crc) {
+    return op[0][crc & 0xff] ^ op[1][(crc >> 8) & 0xff] ^
+           op[2][(crc >> 16) & 0xff] ^ op[3][crc >> 24];
+}
+
+static int cpu_has_sse42(void) {
+#ifdef HAVE_X86_CLMUL
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("sse4.2");
+#else
+    return 0;
+#endif
+}
+
+static void crc32c_init(Crc32c *C) {
+    C->hw = cpu_has_sse42();
+    for (uint32_t i = 0; i < 256; ++i) {
+        uint32_t c = i;
+        for (int b = 0; b < 8; ++b) c = (c & 1) ? (c >> 1) ^ CRC32C_POLY_REF : (c >> 1);
+        C->tab[i] = c;
+    }
+    crc32c_zeros_op(C->op_long, CRC32C_LONG);
+    crc32c_zeros_op(C->op_short, CRC32C_SHORT);
+}
+
+static uint32_t crc32c_sw(const Crc32c *C, uint32_t crc, const uint8_t *buf, size_t len) {
+    while (len--) crc = (crc >> 8) ^ C->tab[(crc ^ *buf++) & 0xff];
+    return crc;
+}
+
+#ifdef HAVE_X86_CLMUL
+__attribute__((target("sse4.2")))
+static uint64_t crc32c_u64(uint64_t crc, const uint8_t *p) {
+    uint64_t v;
+    memcpy(&v, p, 8);
+    return _mm_crc32_u64(crc, v);
+}
+
+/* Três fluxos de blk bytes cada; consome 3·blk bytes por volta. */
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_hw_3way(const uint32_t op[4][256], size_t blk,
+                               uint32_t crc, const uint8_t **pbuf, size_t *plen)
+{
+    const uint8_t *buf = *pbuf;
+    size_t len = *plen;
+    while (len >= 3 * blk) {
+        uint64_t c0 = crc, c1 = 0, c2 = 0;
+        const uint8_t *end = buf + blk;
+        do {
+            c0 = crc32c_u64(c0, buf);
+            c1 = crc32c_u64(c1, buf + blk);
+            c2 = crc32c_u64(c2, buf + 2 * blk);
+            buf += 8;
+        } while (buf < end);
+        crc = crc32c_shift(op, (uint32_t)c0) ^ (uint32_t)c1;
+        crc = crc32c_shift(op, crc) ^ (uint32_t)c2;
+        buf += 2 * blk;
+        len -= 3 * blk;
+    }
+    *pbuf = buf;
+    *plen = len;
+    return crc;
+}
+
+__attribute__((target("sse4.2")))
+static uint32_t crc32c_hw(const Crc32c *C, uint32_t crc, const uint8_t *buf, size_t len) {
+    while (len && ((uintptr_t)buf & 7)) {
+        crc = _mm_crc32_u8(crc, *buf++);
+        --len;
+    }
+    crc = crc32c_hw_3way(C->op_long, CRC32C_LONG, crc, &buf, &len);
+    crc = crc32c_hw_3way(C->op_short, CRC32C_SHORT, crc, &buf, &len);
+    uint64_t c = crc;
+    for (; len >= 8; buf += 8, len -= 8) c = crc32c_u64(c, buf);
+    crc = (uint32_t)c;
+    while (len--) crc = _mm_crc32_u8(crc, *buf++);
+    return crc;
+}
+#endif
+
+/* Registrador cru (sem inversões): CRC-32C padrão = ~crc32c_update(C, ~0, ...). */
+static uint32_t crc32c_update(const Crc32c *C, uint32_t crc, const uint8_t *buf, size_t len) {
+#ifdef HAVE_X86_CLMUL
+    if (C->hw) return crc32c_hw(C, crc, buf, len);
+#endif
+    return crc32c_sw(C, crc, buf, len);
+}
+
+/* ===================== (7) Mensagens de qualquer tamanho ===================== */
+/*
+ * A mensagem é um fluxo de bits MSB-first: o bit i é o bit 7-(i%8) do byte i/8.
+ * Os bytes inteiros passam pelo motor escolhido e os bits que sobram, um a um;
+ * nada depende do tamanho total, então serve de um quadro Ethernet a um arquivo.
+ */
+typedef struct {
+    CrcTable tab;
+    CrcSlices sl;
+    CrcFold fold;
+    CrcKernel kernel;
+} CrcEngine;
+
+static void crc_engine_init(CrcEngine *E, const CrcPoly *g, int refl,
+                            int slices, CrcKernel kernel)
+{
+    crc_table_init(&E->tab, g, refl);
+    crc_slices_init(&E->sl, &E->tab, slices);
+    crc_fold_init(&E->fold, &E->tab);
+    E->kernel = kernel;
+}
+
+/* Monta o motor sobre tabelas (slice-by-8) e constantes já prontas, sem cálculo. */
+static void crc_engine_init_static(CrcEngine *E, const CrcPoly *g, int refl,
+                                   const uint64_t (*t)[256], const CrcFold *fold,
+                                   CrcKernel kernel)
+{
+    E->tab.m = g->m;
+    E->tab.refl = refl;
+    E->tab.poly_top = g->lo << (64 - g->m);
+    if (refl) E->tab.poly_top = reflect_u64(E->tab.poly_top);
+    memcpy(E->tab.t, t[0], sizeof E->tab.t);
+    E->sl.m = g->m;
+    E->sl.refl = refl;
+    E->sl.slices = 8;
+    E->sl.poly_top = E->tab.poly_top;
+    E->sl.t = t;
+    E->sl.own = NULL;
+    E->fold = *fold;
+    E->kernel = kernel;
+}
+
+static void crc_engine_free(CrcEngine *E) {
+    crc_slices_free(&E->sl);
+}
+
+/*
+ * Registrador no formato do CrcTable. No modo refletido o fluxo é LSB-first
+ * (bit i = bit i%8 do byte i/8), como a linha serial entrega.
+ */
+static uint64_t crc_engine_bits(const CrcEngine *E, uint64_t reg,
+                                const uint8_t *msg, size_t nbits)
+{
+    size_t nbytes = nbits / 8;
+    reg = crc_fold_bytes(&E->fold, &E->sl, E->kernel, reg, msg, nbytes);
+    for (unsigned b = 0; b < nbits % 8; ++b)
+        reg = E->tab.refl ? crc_step_lsb(reg, (msg[nbytes] >> b) & 1, E->tab.poly_top)
+                          : crc_step_msb(reg, (msg[nbytes] >> (7 - b)) & 1, E->tab.poly_top);
+    return reg;
+}
+
+/* FCS = M(x)·x^m mod g(x), igual a make_crc_transmission sem o limite de 64 bits (motor MSB). */
+static uint64_t crc_fcs_bits(const CrcEngine *E, const uint8_t *msg, size_t nbits) {
+    return crc_engine_bits(E, 0, msg, nbits) >> (64 - E->tab.m);
+}
+
+/*
+ * Resto de um dividendo qualquer D(x) (ex.: o codeword recebido). Com D = H·x^m + L,
+ * onde L são os últimos m bits, D mod g = (H·x^m mod g) ^ L = FCS(H) ^ L.
+ */
+static uint64_t mod2_remainder_bits(const CrcEngine *E, const uint8_t *buf, size_t nbits) {
+    int m = E->tab.m;
+    size_t head = (nbits > (size_t)m) ? nbits - (size_t)m : 0;
+    uint64_t rem = crc_fcs_bits(E, buf, head);
+    uint64_t low = 0;
+    for (size_t i = head; i < nbits; ++i)
+        low = (low << 1) | ((buf[i / 8] >> (7 - i % 8)) & 1);
+    return rem ^ low;
+}
+
+/* Os width bits de x viram um fluxo MSB-first em out (último byte completado com zeros). */
+static size_t pack_bits_msb(uint64_t x, int width, uint8_t *out) {
+    size_t n = ((size_t)width + 7) / 8;
+    memset(out, 0, n);
+    for (int i = 0; i < width; ++i)
+        if ((x >> (width - 1 - i)) & 1ULL) out[i / 8] |= (uint8_t)(0x80 >> (i % 8));
+    return n;
+}
+
+/* ===================== (8) Graus 64..128: registradores de 64 e 128 bits ===================== */
+/*
+ * Caminho LFSR (forma aumentada, como trace_lfsr_crc: mensagem + m zeros) com
+ * registrador de 64 bits; serve até grau 64 porque a máscara não usa 1 << m.
+ */
+static uint64_t lfsr_bits64(const CrcPoly *g, const uint8_t *msg, size_t nbits) {
+    int m = g->m;
+    uint64_t mask_m = (m >= 64) ? ~0ULL : ((1ULL << m) - 1ULL);
+    uint64_t reg = 0;
+    for (size_t i = 0; i < nbits + (size_t)m; ++i) {
+        int bit = (i < nbits) ? (msg[i / 8] >> (7 - i % 8)) & 1 : 0;
+        int msb_old = (int)((reg >> (m - 1)) & 1ULL);
+        reg = ((reg << 1) | (uint64_t)bit) & mask_m;
+        if (msb_old) reg ^= g->lo;
+    }
+    return reg;
+}
+
+/* O mesmo LFSR com registrador de 128 bits (grau até 128). */
+static u128 lfsr_bits128(const CrcPoly *g, const uint8_t *msg, size_t nbits) {
+    int m = g->m;
+    u128 mask_m = (m >= 128) ? ~(u128)0 : (((u128)1 << m) - 1);
+    u128 poly_lo = crc_poly_low(g);
+    u128 reg = 0;
+    for (size_t i = 0; i < nbits + (size_t)m; ++i) {
+        int bit = (i < nbits) ? (msg[i / 8] >> (7 - i % 8)) & 1 : 0;
+        int msb_old = (int)((reg >> (m - 1)) & 1);
+        reg = ((reg << 1) | (u128)bit) & mask_m;
+        if (msb_old) reg ^= poly_lo;
+    }
+    return reg;
+}
+
+/*
+ * Caminho da divisão com registrador de 128 bits: tabela de Sarwate alinhada à
+ * esquerda (ou à direita, refletida), como CrcTable.
+ */
+typedef struct {
+    int m;
+    int refl;
+    u128 poly_top;
+    u128 t[256];
+} Crc128Table;
+
+static u128 reflect_u128(u128 x) {
+    return ((u128)reflect_u64((uint64_t)x) << 64) | reflect_u64((uint64_t)(x >> 64));
+}
+
+static u128 crc_step_msb128(u128 reg, int bit, u128 poly_top) {
+    reg ^= (u128)bit << 127;
+    return (reg >> 127) ? (reg << 1) ^ poly_top : (reg << 1);
+}
+
+static u128 crc_step_lsb128(u128 reg, int bit, u128 poly_ref) {
+    reg ^= (u128)bit;
+    return (reg & 1) ? (reg >> 1) ^ poly_ref : (reg >> 1);
+}
+
+static void crc128_table_init(Crc128Table *T, const CrcPoly *g, int refl) {
+    if (g->m < 1 || g->m > 128) {
+        fprintf(stderr, "Erro: este motor aceita polinômios de grau 1 a 128.\n");
+        exit(1);
+    }
+    T->m = g->m;
+    T->refl = refl;
+    T->poly_top = crc_poly_low(g) << (128 - g->m);
+    if (refl) T->poly_top = reflect_u128(T->poly_top);
+    for (int i = 0; i < 256; ++i) {
+        u128 c = refl ? (u128)i : (u128)i << 120;
+        for (int b = 0; b < 8; ++b)
+            c = refl ? crc_step_lsb128(c, 0, T->poly_top) : crc_step_msb128(c, 0, T->poly_top);
+        T->t[i] = c;
+    }
+}
+
+static u128 crc128_engine_bits(const Crc128Table *T, u128 reg, const uint8_t *msg, size_t nbits) {
+    size_t nbytes = nbits / 8;
+    if (T->refl) {
+        for (size_t i = 0; i < nbytes; ++i)
+            reg = (reg >> 8) ^ T->t[(uint8_t)reg ^ msg[i]];
+        for (unsigned b = 0; b < nbits % 8; ++b)
+            reg = crc_step_lsb128(reg, (msg[nbytes] >> b) & 1, T->poly_top);
+        return reg;
+    }
+    for (size_t i = 0; i < nbytes; ++i)
+        reg = (reg << 8) ^ T->t[(uint8_t)(reg >> 120) ^ msg[i]];
+    for (unsigned b = 0; b < nbits % 8; ++b)
+        reg = crc_step_msb128(reg, (msg[nbytes] >> (7 - b)) & 1, T->poly_top);
+    return reg;
+}
+
+static u128 crc128_fcs_bits(const Crc128Table *T, const uint8_t *msg, size_t nbits) {
+    return crc128_engine_bits(T, 0, msg, nbits) >> (128 - T->m);
+}
+
+/* Como mod2_remainder_bits: D mod g = FCS(H) ^ L. */
+static u128 mod2_remainder128_bits(const Crc128Table *T, const uint8_t *buf, size_t nbits) {
+    size_t head = (nbits > (size_t)T->m) ? nbits - (size_t)T->m : 0;
+    u128 low = 0;
+    for (size_t i = head; i < nbits; ++i)
+        low = (low << 1) | ((buf[i / 8] >> (7 - i % 8)) & 1);
+    return crc128_fcs_bits(T, buf, head) ^ low;
+}
+
+/* "0x" + ceil(width/4) dígitos hexadecimais. */
+static void u128_hex(char *out, u128 x, int width) {
+    int nd = (width + 3) / 4;
+    out[0] = '0'; out[1] = 'x';
+    for (int i = 0; i < nd; ++i)
+        out[2 + i] = "0123456789abcdef"[(int)(x >> (4 * (nd - 1 - i))) & 0xf];
+    out[2 + nd] = '\0';
+}
+
+/* ===================== (17) LFSR direto (sem os m zeros) e conversão de init ===================== */
+/*
+ * Forma aumentada (trace_lfsr_crc, lfsr_bits64/128): o bit da mensagem entra
+ * no fundo do registrador e só sai pelo topo m clocks depois, daí os m zeros
+ * no fim. Forma direta: o bit entra somado ao bit que sai pelo topo, ou seja,
+ * direto na realimentação; em n clocks o registrador já tem
+ *   D·x^n + M(x)·x^m mod g,
+ * o mesmo que a forma aumentada dá em n + m clocks com A·x^(n+m) + M(x)·x^m.
+ * As duas coincidem quando D = A·x^m mod g: o init direto é o que o registrador
+ * aumentado guarda depois de m clocks de zeros a partir de A. A volta anda o
+ * LFSR para trás m clocks (multiplica por x^-m), o que exige g(0) = 1.
+ * Em quadros curtos são m clocks a menos por mensagem.
+ */
+static uint64_t trace_lfsr_direct(uint64_t mensagem, int msg_width,
+                                  uint64_t polinomio, Logger *L, int verbose)
+{
+    int m = bitlen_u64(polinomio) - 1;
+    uint64_t mask_m = (m > 0) ? ((1ULL << m) - 1ULL) : 0;
+    uint64_t poly_lo = polinomio & mask_m;
+    uint64_t reg = 0;
+    char b1[BITS_STR_LEN], b2[BITS_STR_LEN];
+
+    if (verbose) {
+        lprint(L, "passo | i | msb^i |  r[m-1]..r[0]      ->   r'[m-1]..r'[0]\n");
+    }
+
+    for (int step = 0; step < msg_width; ++step) {
+        int i = (int)((mensagem >> (msg_width - 1 - step)) & 1ULL);
+        int fb = (int)((reg >> (m-1)) & 1ULL) ^ i;   /* realimentação já com o bit de entrada */
+        uint64_t before = reg;
+        reg = (reg << 1) & mask_m;
+        if (fb) reg ^= poly_lo;
+
+        if (verbose) {
+            lprint(L, "%5d | %d |   %d   |  %-16s ->   %s\n", step, i, fb,
+                   bits_str(b1, before, m) + 2, bits_str(b2, reg, m) + 2);
+        }
+    }
+    return reg; /* FCS, sem clocks extras */
+}
+
+/* Forma direta sobre um fluxo de bits MSB-first, init D, grau até 128. */
+static u128 lfsr_direct_bits128(const CrcPoly *g, u128 init, const uint8_t *msg, size_t nbits) {
+    int m = g->m;
+    u128 mask_m = (m >= 128) ? ~(u128)0 : (((u128)1 << m) - 1);
+    u128 poly_lo = crc_poly_low(g);
+    u128 reg = init & mask_m;
+    for (size_t i = 0; i < nbits; ++i) {
+        int fb = (int)((reg >> (m - 1)) & 1) ^ ((msg[i / 8] >> (7 - i % 8)) & 1);
+        reg = (reg << 1) & mask_m;
+        if (fb) reg ^= poly_lo;
+    }
+    return reg;
+}
+
+/* Forma aumentada com init A (lfsr_bits128 é o caso A = 0). */
+static u128 lfsr_aug_bits128(const CrcPoly *g, u128 init, const uint8_t *msg, size_t nbits) {
+    int m = g->m;
+    u128 mask_m = (m >= 128) ? ~(u128)0 : (((u128)1 << m) - 1);
+    u128 poly_lo = crc_poly_low(g);
+    u128 reg = init & mask_m;
+    for (size_t i = 0; i < nbits + (size_t)m; ++i) {
+        int bit = (i < nbits) ? (msg[i / 8] >> (7 - i % 8)) & 1 : 0;
+        int msb_old = (int)((reg >> (m - 1)) & 1);
+        reg = ((reg << 1) | (u128)bit) & mask_m;
+        if (msb_old) reg ^= poly_lo;
+    }
+    return reg;
+}
+
+/* D = A·x^m mod g: m clocks de zeros na forma aumentada. */
+static u128 lfsr_init_aug_to_direct(const CrcPoly *g, u128 aug) {
+    return lfsr_aug_bits128(g, aug, NULL, 0);
+}
+
+/* A = D·x^-m mod g, andando o LFSR para trás; 0 em *ok se g(0) = 0 (não há inversa). */
+static u128 lfsr_init_direct_to_aug(const CrcPoly *g, u128 direct, int *ok) {
+    int m = g->m;
+    u128 poly_lo = crc_poly_low(g);
+    *ok = (int)(poly_lo & 1);
+    if (!*ok) return 0;
+    u128 reg = direct;
+    for (int i = 0; i < m; ++i) {
+        /* o clock anterior saiu com msb_old = bit 0 atual (g0 = 1) */
+        int msb_old = (int)(reg & 1);
+        if (msb_old) reg ^= poly_lo;
+        reg = (reg >> 1) | ((u128)msb_old << (m - 1));
+    }
+    return reg;
+}
+
+/* ===================== (20) LFSR fatiado por bits: 64 mensagens por clock ===================== */
+/*
+ * Para muitos registros curtos do mesmo tamanho (quadros de sensor, payloads
+ * CAN) o LFSR de trace_lfsr_crc roda "de lado": cada um dos m bits do
+ * registrador é uma palavra de 64 bits e o bit i da palavra pertence à
+ * mensagem i (aqui a mensagem r fica no bit 63-r). Um clock da forma direta
+ * de (17) vira m operações de palavra que avançam 64 FCS ao mesmo tempo:
+ *   fb = r[m-1] ^ entrada;  r[j] = r[j-1] ^ (fb & g_j);  r[0] = fb & g_0
+ * A entrada de cada clock é uma coluna de bits das 64 mensagens: blocos de
+ * 64×64 bits são transpostos (6 passos de troca de sub-blocos) antes de
+ * clocar, e o registrador é transposto de volta no fim para dar um FCS por
+ * mensagem. Com W palavras por bit (W = 4 ou 8) o mesmo laço leva 256 ou 512
+ * mensagens; compilado com AVX2/AVX-512 cada operação vira uma instrução
+ * vetorial, escolhida por CPUID como em (5).
+ */
+/* Bits [c, c+64) do registro i (MSB primeiro), zeros além do fim ou se i >= n. */
+static uint64_t sliced_word(const uint8_t *recs, size_t stride, size_t nbits,
+                            size_t n, size_t i, size_t c)
+{
+    if (i >= n) return 0;
+    size_t rec_bytes = (nbits + 7) / 8, at = c / 8;
+    const uint8_t *p = recs + i * stride + at;
+    if (rec_bytes - at >= 8) return load_be64(p);
+    uint8_t b[8] = {0};
+    memcpy(b, p, rec_bytes - at);
+    return load_be64(b);
+}
+
+/*
+ * Uma versão por largura: V é um vetor (extensão do GCC) de W palavras e
+ * cada operação de V vale para 64·W mensagens; a palavra l do vetor leva as
+ * mensagens first + 64·l ... first + 64·l + 63.
+ *
+ * A transposta de 64×64 (linha r = a[r], coluna c = bit 63-c) troca
+ * sub-blocos de 32, 16, ..., 1 bits em 6 passos; aplicada a vetores,
+ * transpõe W matrizes de uma vez.
+ */
+#define SLICED_RUN(NAME, V, W, ATTR)                                                        \
+ATTR static inline void NAME##_transpose(V a[64]) {                                          \
+    uint64_t mk = 0x00000000FFFFFFFFULL;                                                     \
+    for (int j = 32; j != 0; j >>= 1, mk ^= mk << j)                                         \
+        for (int k = 0; k < 64; k = ((k | j) + 1) & ~j) {                                    \
+            V t = (a[k] ^ (a[k | j] >> j)) & mk;                                             \
+            a[k] ^= t;                                                                       \
+            a[k | j] ^= t << j;                                                              \
+        }                                                                                    \
+}                                                                                            \
+                                                                                             \
+ATTR static void NAME(const CrcPoly *g, const uint8_t *recs, size_t stride, size_t nbits,    \
+                      size_t n, uint64_t *fcs)                                               \
+{                                                                                            \
+    int m = g->m, ntap = 0, tap[64];                                                         \
+    uint64_t g0 = (g->lo & 1) ? ~0ULL : 0;                                                   \
+    for (int j = 1; j < m; ++j)                                                              \
+        if ((g->lo >> j) & 1) tap[ntap++] = j;                                               \
+    for (size_t first = 0; first < n; first += 64 * W) {                                     \
+        V s[64 + 64], col[64];           /* r[j] em s[b + m-1-j] no clock b */                \
+        uint64_t w[64][W];                                                                   \
+        memset(s, 0, sizeof s);                                                              \
+        for (size_t c = 0; c < nbits; c += 64) {                                             \
+            int nb = (nbits - c < 64) ? (int)(nbits - c) : 64;                               \
+            for (int r = 0; r < 64; ++r)                                                     \
+                for (int l = 0; l < W; ++l)                                                  \
+                    w[r][l] = sliced_word(recs, stride, nbits, n, first + 64 * l + r, c);    \
+            memcpy(col, w, sizeof col);                                                      \
+            NAME##_transpose(col);             /* col[b] = bit c+b das 64·W mensagens */     \
+            for (int b = 0; b < nb; ++b) {                                                   \
+                V fb = s[b] ^ col[b];                                                        \
+                s[b + m] = fb & g0;                                                          \
+                for (int t = 0; t < ntap; ++t) s[b + m - tap[t]] ^= fb;                      \
+            }                                                                                \
+            memmove(s, s + nb, (size_t)m * sizeof s[0]);                                     \
+        }                                                                                    \
+        /* de volta: linha 63-j = r[j] = s[m-1-j], e a transposta dá um FCS por linha */    \
+        for (int r = 0; r < 64; ++r) col[r] = s[r + m - 64 >= 0 ? r + m - 64 : 0] &         \
+                                               (r + m - 64 >= 0 ? ~0ULL : 0);                \
+        NAME##_transpose(col);                                                               \
+        memcpy(w, col, sizeof w);                                                            \
+        for (int l = 0; l < W; ++l)                                                          \
+            for (int r = 0; r < 64; ++r)                                                     \
+                if (first + 64 * l + r < n) fcs[first + 64 * l + r] = w[r][l];               \
+    }                                                                                        \
+}
+
+SLICED_RUN(sliced_run_64, uint64_t, 1, )
+
+#ifdef HAVE_X86_CLMUL
+typedef uint64_t SlicedV4 __attribute__((vector_size(32)));
+typedef uint64_t SlicedV8 __attribute__((vector_size(64)));
+SLICED_RUN(sliced_run_256, SlicedV4, 4, __attribute__((target("avx2"))))
+SLICED_RUN(sliced_run_512, SlicedV8, 8, __attribute__((target("avx512f"))))
+#endif
+
+#undef SLICED_RUN
+
+/* Maior largura disponível (64, 256 ou 512 mensagens por clock). */
+static int sliced_lanes_best(void) {
+#ifdef HAVE_X86_CLMUL
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f")) return 512;
+    if (__builtin_cpu_supports("avx2")) return 256;
+#endif
+    return 64;
+}
+
+/*
+ * FCS (forma de trace_lfsr_crc: init 0, sem xorout) de n registros de nbits
+ * cada, MSB primeiro, o registro i em recs + i·stride. lanes = 64, 256, 512
+ * ou 0 para a maior disponível. Grau 1..64.
+ */
+static void lfsr_sliced_fcs(const CrcPoly *g, const uint8_t *recs, size_t stride, size_t nbits,
+                            size_t n, uint64_t *fcs, int lanes)
+{
+    if (g->m < 1 || g->m > 64) {
+        fprintf(stderr, "Erro: o LFSR fatiado aceita polinômios de grau 1 a 64.\n");
+        exit(1);
+    }
+    if (lanes == 0) lanes = sliced_lanes_best();
+#ifdef HAVE_X86_CLMUL
+    if (lanes == 512) { sliced_run_512(g, recs, stride, nbits, n, fcs); return; }
+    if (lanes == 256) { sliced_run_256(g, recs, stride, nbits, n, fcs); return; }
+#endif
+    sliced_run_64(g, recs, stride, nbits, n, fcs);
+}
+
+/* ===================== (9) Modelo parametrizado (width, poly, init, refin, refout, xorout) ===================== */
+/*
+ * Parâmetros no formato dos catálogos de CRC: poly sem o termo x^width, init e
+ * xorout como aparecem no registrador não refletido, check = CRC de "123456789".
+ * Todos os motores acima rodam sob o modelo: o registrador começa em init
+ * (espelhado se refin), e no fim é espelhado se refout != refin e recebe xorout.
+ */
+typedef struct {
+    const char *name;
+    const char *alias;             /* outro nome comum, ou NULL */
+    int width;
+    u128 poly, init, xorout, check;
+    int refin, refout;
+} CrcModel;
+
+#define U128(hi, lo) (((u128)(hi) << 64) | (u128)(lo))
+
+static const CrcModel crc_models[] = {
+    { "CRC-3/GSM",        NULL,           3, 0x3, 0x0, 0x7, 0x4, 0, 0 },
+    { "CRC-5/USB",        NULL,           5, 0x05, 0x1f, 0x1f, 0x19, 1, 1 },
+    { "CRC-8/SMBUS",      "CRC-8",        8, 0x07, 0x00, 0x00, 0xf4, 0, 0 },
+    { "CRC-8/MAXIM-DOW",  "CRC-8/MAXIM",  8, 0x31, 0x00, 0x00, 0xa1, 1, 1 },
+    { "CRC-12/UMTS",      NULL,          12, 0x80f, 0x000, 0x000, 0xdaf, 0, 1 },
+    { "CRC-16/ARC",       "CRC-16",      16, 0x8005, 0x0000, 0x0000, 0xbb3d, 1, 1 },
+    { "CRC-16/IBM-3740",  "CRC-16/CCITT-FALSE",
+                                         16, 0x1021, 0xffff, 0x0000, 0x29b1, 0, 0 },
+    { "CRC-16/MODBUS",    NULL,          16, 0x8005, 0xffff, 0x0000, 0x4b37, 1, 1 },
+    { "CRC-16/XMODEM",    NULL,          16, 0x1021, 0x0000, 0x0000, 0x31c3, 0, 0 },
+    { "CRC-16/X-25",      "CRC-16/IBM-SDLC",
+                                         16, 0x1021, 0xffff, 0xffff, 0x906e, 1, 1 },
+    { "CRC-24/OPENPGP",   NULL,          24, 0x864cfb, 0xb704ce, 0x000000, 0x21cf02, 0, 0 },
+    { "CRC-32/ISO-HDLC",  "CRC-32",      32, 0x04c11db7, 0xffffffff, 0xffffffff, 0xcbf43926, 1, 1 },
+    { "CRC-32/BZIP2",     NULL,          32, 0x04c11db7, 0xffffffff, 0xffffffff, 0xfc891918, 0, 0 },
+    { "CRC-32/MPEG-2",    NULL,          32, 0x04c11db7, 0xffffffff, 0x00000000, 0x0376e6e7, 0, 0 },
+    { "CRC-32/ISCSI",     "CRC-32C",     32, 0x1edc6f41, 0xffffffff, 0xffffffff, 0xe3069283, 1, 1 },
+    { "CRC-64/ECMA-182",  NULL,          64, 0x42f0e1eba9ea3693ULL, 0, 0, 0x6c40df5f0b497347ULL, 0, 0 },
+    { "CRC-64/XZ",        "CRC-64/GO-ECMA",
+                                         64, 0x42f0e1eba9ea3693ULL, ~0ULL, ~0ULL, 0x995dc9bbdf1939faULL, 1, 1 },
+    { "CRC-82/DARC",      NULL,          82, U128(0x0308c, 0x0111011401440411ULL), 0, 0,
+                                             U128(0x09ea8, 0x3f625023801fd612ULL), 1, 1 },
+};
+
+#define N_CRC_MODELS (sizeof crc_models / sizeof crc_models[0])
+
+/* Aceita o nome do catálogo ou o apelido, sem diferenciar maiúsculas. */
+static const CrcModel *crc_model_find(const char *name) {
+    for (size_t i = 0; i < N_CRC_MODELS; ++i) {
+        const char *cand[2] = { crc_models[i].name, crc_models[i].alias };
+        for (int c = 0; c < 2; ++c) {
+            const char *a = cand[c], *b = name;
+            if (!a) continue;
+            while (*a && *b && (*a | 0x20) == (*b | 0x20)) { ++a; ++b; }
+            if (!*a && !*b) return &crc_models[i];
+        }
+    }
+    return NULL;
+}
+
+/*
+ * Tabelas prontas de cada modelo, na mesma ordem de crc_models[]: slice-by-8 e
+ * constantes de dobra (largura <= 64) ou a tabela de 128 bits. Ficam em
+ * crc_catalogo.h, gerado pelo próprio programa (--gen-catalogo), e vão para
+ * .rodata: escolher um modelo não calcula nada e as páginas são compartilhadas
+ * entre processos. Sem o cabeçalho (-DCRC_SEM_CATALOGO) tudo é montado em runtime.
+ * Cada entrada guarda também os parâmetros de que as tabelas dependem: se um
+ * modelo de crc_models[] mudou e o cabeçalho não foi regerado, a entrada não
+ * bate e o modelo volta a ter as tabelas montadas em runtime.
+ */
+typedef struct {
+    const char *name;
+    int width;
+    u128 poly;
+    int refin, refout;
+    const uint64_t (*t)[256];      /* 8 tabelas, formato de CrcSlices */
+    const CrcFold *fold;
+    const u128 *t128;              /* largura > 64: tabela de Crc128Table */
+} CrcCatEntry;
+
+#ifndef CRC_SEM_CATALOGO
+#include "crc_catalogo.h"
+_Static_assert(CRC_CATALOGO_N == sizeof crc_models / sizeof crc_models[0],
+               "crc_catalogo.h desatualizado: rode --gen-catalogo");
+#endif
+
+/* Entrada do catálogo para M, ou NULL se M não é de crc_models[] ou não há cabeçalho. */
+static const CrcCatEntry *crc_catalog_entry(const CrcModel *M) {
+#ifndef CRC_SEM_CATALOGO
+    for (size_t i = 0; i < N_CRC_MODELS; ++i) {
+        if (M != &crc_models[i]) continue;
+        const CrcCatEntry *e = &crc_catalogo[i];
+        if (e->width != M->width || e->poly != M->poly ||
+            e->refin != M->refin || e->refout != M->refout)
+            return NULL;            /* cabeçalho desatualizado */
+        return e;
+    }
+#else
+    (void)M;
+#endif
+    return NULL;
+}
+
+/* Espelha os w bits de baixo de x. */
+static u128 reflect_bits(u128 x, int w) {
+    return reflect_u128(x) >> (128 - w);
+}
+
+static u128 width_mask(int w) {
+    return (w >= 128) ? ~(u128)0 : (((u128)1 << w) - 1);
+}
+
+/* Referência bit a bit, direto da definição; só para conferir os motores. */
+static u128 crc_model_bitwise(const CrcModel *M, const uint8_t *buf, size_t len) {
+    int w = M->width;
+    u128 reg = M->init;
+    for (size_t i = 0; i < len; ++i) {
+        uint8_t byte = M->refin ? (uint8_t)(reflect_u64(buf[i]) >> 56) : buf[i];
+        for (int b = 7; b >= 0; --b) {
+            int top = (int)((reg >> (w - 1)) & 1) ^ ((byte >> b) & 1);
+            reg = (reg << 1) & width_mask(w);
+            if (top) reg ^= M->poly;
+        }
+    }
+    if (M->refout) reg = reflect_bits(reg, w);
+    return reg ^ M->xorout;
+}
+
+/*
+ * Motor completo para um modelo: largura <= 64 usa CrcEngine (tabela, fatias,
+ * PCLMULQDQ/VPCLMULQDQ); acima disso o registrador de 128 bits; o CRC-32C
+ * refletido vai para a instrução crc32 do SSE4.2 quando existe. Modelos do
+ * catálogo com 8 fatias usam as tabelas de crc_catalogo.h.
+ */
+typedef struct {
+    const CrcModel *model;
+    CrcPoly g;
+    CrcEngine *e64;
+    Crc128Table *e128;
+    Crc32c *c32c;
+    int catalog;                    /* tabelas vieram de crc_catalogo.h */
+} CrcCalc;
+
+static void crc_calc_init(CrcCalc *C, const CrcModel *M, int slices, CrcKernel kernel) {
+    memset(C, 0, sizeof *C);
+    C->model = M;
+    C->g.m = M->width;
+    C->g.lo = (uint64_t)M->poly;
+    C->g.hi = (uint64_t)(M->poly >> 64);
+    const CrcCatEntry *cat = crc_catalog_entry(M);
+    if (M->width <= 64) {
+        C->e64 = (CrcEngine*)malloc(sizeof *C->e64);
+        if (!C->e64) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+        if ((C->catalog = cat && slices == 8))
+            crc_engine_init_static(C->e64, &C->g, M->refin, cat->t, cat->fold, kernel);
+        else
+            crc_engine_init(C->e64, &C->g, M->refin, slices, kernel);
+    } else {
+        C->e128 = (Crc128Table*)malloc(sizeof *C->e128);
+        if (!C->e128) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+        if ((C->catalog = cat != NULL)) {
+            C->e128->m = M->width;
+            C->e128->refl = M->refin;
+            C->e128->poly_top = M->poly << (128 - M->width);
+            if (M->refin) C->e128->poly_top = reflect_u128(C->e128->poly_top);
+            memcpy(C->e128->t, cat->t128, sizeof C->e128->t);
+        } else {
+            crc128_table_init(C->e128, &C->g, M->refin);
+        }
+    }
+    if (M->width == 32 && M->refin && (uint64_t)M->poly == (CRC32C_POLY & 0xFFFFFFFFu)) {
+        C->c32c = (Crc32c*)malloc(sizeof *C->c32c);
+        if (!C->c32c) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+        crc32c_init(C->c32c);
+    }
+}
+
+static void crc_calc_free(CrcCalc *C) {
+    if (C->e64) crc_engine_free(C->e64);
+    free(C->e64);
+    free(C->e128);
+    free(C->c32c);
+}
+
+/* Registrador inicial no formato do motor (alinhado à esquerda, ou espelhado). */
+static u128 crc_calc_start(const CrcCalc *C) {
+    const CrcModel *M = C->model;
+    if (M->refin) return reflect_bits(M->init, M->width);
+    return M->init << ((M->width <= 64 ? 64 : 128) - M->width);
+}
+
+static u128 crc_calc_update(const CrcCalc *C, u128 reg, const uint8_t *buf, size_t len) {
+    if (C->c32c) return crc32c_update(C->c32c, (uint32_t)reg, buf, len);
+    if (C->e64) return crc_engine_bits(C->e64, (uint64_t)reg, buf, 8 * len);
+    return crc128_engine_bits(C->e128, reg, buf, 8 * len);
+}
+
+/* Como crc_calc_update, em bits (ordem de (7): LSB-first se o modelo é refletido). */
+static u128 crc_calc_update_bits(const CrcCalc *C, u128 reg, const uint8_t *buf, size_t nbits) {
+    if (C->c32c) {
+        size_t n = nbits / 8;
+        uint64_t r = crc32c_update(C->c32c, (uint32_t)reg, buf, n);
+        for (unsigned b = 0; b < nbits % 8; ++b)
+            r = crc_step_lsb(r, (buf[n] >> b) & 1, CRC32C_POLY_REF);
+        return r;
+    }
+    if (C->e64) return crc_engine_bits(C->e64, (uint64_t)reg, buf, nbits);
+    return crc128_engine_bits(C->e128, reg, buf, nbits);
+}
+
+static u128 crc_calc_finish(const CrcCalc *C, u128 reg) {
+    const CrcModel *M = C->model;
+    u128 crc = M->refin ? reg : reg >> ((M->width <= 64 ? 64 : 128) - M->width);
+    if (M->refout != M->refin) crc = reflect_bits(crc, M->width);
+    return crc ^ M->xorout;
+}
+
+static u128 crc_calc_bytes(const CrcCalc *C, const uint8_t *buf, size_t len) {
+    return crc_calc_finish(C, crc_calc_update(C, crc_calc_start(C), buf, len));
+}
+
+/* ===================== (11) Combinação: crc(A||B) a partir de crc(A), crc(B) e |B| ===================== */
+/*
+ * Processar B depois de A equivale a multiplicar o registrador de A por
+ * x^(8·|B|) mod g (é a redução de divide_mod2_show sobre A seguido de |B|
+ * bytes zero) e somar o registrador de B. Com init I e xorout X:
+ *   reg(A||B) = (reg(A) ^ I)·x^(8·|B|) mod g ^ reg(B)
+ * e x^(8·|B|) sai por quadrados sucessivos: O(log |B|) multiplicações, sem
+ * reler os dados. Serve para juntar pedaços calculados em paralelo ou em
+ * outras máquinas.
+ */
+
+/* a·b mod g, polinômios de grau < m (coeficientes de g sem o termo x^m). */
+static u128 gf2_mulmod(u128 a, u128 b, const CrcModel *M) {
+    int w = M->width;
+    u128 r = 0;
+    for (int i = w - 1; i >= 0; --i) {
+        int top = (int)((r >> (w - 1)) & 1);
+        r = (r << 1) & width_mask(w);
+        if (top) r ^= M->poly;
+        if ((b >> i) & 1) r ^= a;
+    }
+    return r;
+}
+
+/* x^n mod g por quadrados sucessivos. */
+static u128 gf2_xpow_mod(uint64_t n, const CrcModel *M) {
+    int w = M->width;
+    u128 r = 1, base = 2;              /* x^0, x^1 */
+    if (w == 1) base = M->poly & 1;    /* x ≡ g0 quando g tem grau 1 */
+    for (; n; n >>= 1) {
+        if (n & 1) r = gf2_mulmod(r, base, M);
+        base = gf2_mulmod(base, base, M);
+    }
+    return r;
+}
+
+/* Como crc_combine, com x^(8·|B|) mod g já calculado (pedaços de tamanho fixo). */
+static u128 crc_combine_pow(const CrcModel *M, u128 crc_a, u128 crc_b, u128 xpow_b) {
+    u128 v = crc_a ^ M->xorout;
+    if (M->refout) v = reflect_bits(v, M->width);
+    v = gf2_mulmod(v ^ M->init, xpow_b, M);
+    if (M->refout) v = reflect_bits(v, M->width);
+    return v ^ crc_b;
+}
+
+/* crc(A||B) com os CRCs finais do modelo M (init, refout e xorout incluídos). */
+static u128 crc_combine(const CrcModel *M, u128 crc_a, u128 crc_b, uint64_t len_b) {
+    return crc_combine_pow(M, crc_a, crc_b, gf2_xpow_mod(8 * len_b, M));
+}
+
+/* ===================== (18) Saltos sobre sequências de zeros ===================== */
+/*
+ * Na forma direta, um bit zero só multiplica o registrador por x mod g; n
+ * zeros seguidos multiplicam por x^n mod g, que gf2_xpow_mod acha em
+ * O(log n) multiplicações. Imagens de disco, arquivos pré-alocados e
+ * preenchimento têm trechos zerados enormes: em vez de passar cada byte pelo
+ * motor, crc_calc_update_sparse procura blocos de CRC_ZERO_RUN bytes zerados
+ * (memcmp sai no primeiro byte não nulo, então em dados densos o custo é um
+ * teste por bloco) e pula cada sequência de blocos de uma vez.
+ */
+#define CRC_ZERO_RUN (64 * 1024)
+
+/* Avança o registrador do motor (formato de crc_calc_start) por nbits zeros. */
+static u128 crc_calc_zeros(const CrcCalc *C, u128 reg, uint64_t nbits) {
+    const CrcModel *M = C->model;
+    int w = M->width;
+    int s = (w <= 64 ? 64 : 128) - w;
+    u128 v = M->refin ? reflect_bits(reg, w) : reg >> s;
+    v = gf2_mulmod(v, gf2_xpow_mod(nbits, M), M);
+    return M->refin ? reflect_bits(v, w) : v << s;
+}
+
+static int bytes_zero(const uint8_t *p, size_t n) {
+    return n == 0 || (p[0] == 0 && memcmp(p, p + 1, n - 1) == 0);
+}
+
+/* Como crc_calc_update, pulando sequências de blocos zerados. */
+static u128 crc_calc_update_sparse(const CrcCalc *C, u128 reg, const uint8_t *buf, size_t len) {
+    size_t dense = 0, off = 0;
+    while (len - off >= CRC_ZERO_RUN) {
+        size_t z = off;
+        while (len - z >= CRC_ZERO_RUN && bytes_zero(buf + z, CRC_ZERO_RUN)) z += CRC_ZERO_RUN;
+        if (z == off) { off += CRC_ZERO_RUN; continue; }
+        reg = crc_calc_update(C, reg, buf + dense, off - dense);
+        reg = crc_calc_zeros(C, reg, 8 * (uint64_t)(z - off));
+        dense = off = z;
+    }
+    return crc_calc_update(C, reg, buf + dense, len - dense);
+}
+
+static u128 crc_calc_bytes_sparse(const CrcCalc *C, const uint8_t *buf, size_t len) {
+    return crc_calc_finish(C, crc_calc_update_sparse(C, crc_calc_start(C), buf, len));
+}
+
+/* ===================== (12) CRC de um buffer grande em várias threads ===================== */
+/*
+ * O buffer é cortado em pedaços de `chunk` bytes; a thread t calcula os pedaços
+ * t, t+N, t+2N... com o motor mais rápido disponível (CrcCalc é só leitura) e
+ * no fim os CRCs são juntados em ordem com crc_combine_pow. Como todo pedaço
+ * cheio tem o mesmo tamanho, x^(8·chunk) mod g é calculado uma vez só.
+ * O resultado é idêntico ao de uma passada serial.
+ */
+typedef struct {
+    const CrcCalc *calc;
+    const uint8_t *buf;
+    size_t len, chunk;
+    size_t first, step;             /* pedaços first, first+step, ... */
+    u128 *crcs;
+} CrcJob;
+
+static void *crc_job_run(void *arg) {
+    const CrcJob *J = (const CrcJob*)arg;
+    size_t n = (J->len + J->chunk - 1) / J->chunk;
+    for (size_t i = J->first; i < n; i += J->step) {
+        size_t off = i * J->chunk;
+        size_t len = (J->len - off < J->chunk) ? J->len - off : J->chunk;
+        J->crcs[i] = crc_calc_bytes_sparse(J->calc, J->buf + off, len);
+    }
+    return NULL;
+}
+
+static int cpu_count(void) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return (n > 0) ? (int)n : 1;
+}
+
+static u128 crc_calc_parallel(const CrcCalc *C, const uint8_t *buf, size_t len,
+                              int threads, size_t chunk)
+{
+    if (chunk == 0) chunk = 1;
+    size_t n = (len + chunk - 1) / chunk;
+    if (n <= 1 || threads <= 1) return crc_calc_bytes(C, buf, len);
+    if ((size_t)threads > n) threads = (int)n;
+
+    u128 *crcs = (u128*)malloc(n * sizeof *crcs);
+    CrcJob *jobs = (CrcJob*)malloc((size_t)threads * sizeof *jobs);
+    pthread_t *tid = (pthread_t*)malloc((size_t)threads * sizeof *tid);
+    if (!crcs || !jobs || !tid) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+
+    for (int t = 0; t < threads; ++t)
+        jobs[t] = (CrcJob){ C, buf, len, chunk, (size_t)t, (size_t)threads, crcs };
+    int started = 1;                /* a thread principal é a 0 */
+    while (started < threads &&
+           pthread_create(&tid[started], NULL, crc_job_run, &jobs[started]) == 0)
+        ++started;
+    /* se pthread_create falhou, a principal faz também a parte das que faltaram */
+    crc_job_run(&jobs[0]);
+    for (int t = started; t < threads; ++t) crc_job_run(&jobs[t]);
+    for (int t = 1; t < started; ++t) pthread_join(tid[t], NULL);
+
+    const CrcModel *M = C->model;
+    u128 xc = gf2_xpow_mod(8 * (uint64_t)chunk, M);
+    u128 crc = crcs[0];
+    for (size_t i = 1; i < n; ++i) {
+        size_t l = (i == n - 1) ? len - i * chunk : chunk;
+        crc = crc_combine_pow(M, crc, crcs[i], (l == chunk) ? xc : gf2_xpow_mod(8 * (uint64_t)l, M));
+    }
+    free(tid);
+    free(jobs);
+    free(crcs);
+    return crc;
+}
+
+static void print_bits(Logger *L, const char *label, uint64_t x, int width) {
+    char s[BITS_STR_LEN];
+    lprint(L, "%s%s\n", label, bits_str(s, x, width));
+}
+
+
+/* ===================== (16) Contexto incremental: init / update / final ===================== */
+/*
+ * trace_lfsr_crc precisa da mensagem inteira e só no fim empurra os m zeros;
+ * aqui os motores já são da forma direta (sem zeros), então basta guardar o
+ * registrador entre chamadas. O que falta é aceitar pedaços que não terminam
+ * em fronteira de byte: os até 7 bits que sobram ficam em `pend` e os bytes
+ * seguintes são remontados deslocados (num buffer na pilha) antes de ir para
+ * o motor, que continua rodando por blocos. Ordem dos bits como em (7):
+ * MSB-first, ou LSB-first nos modelos refletidos.
+ */
+typedef struct {
+    const CrcCalc *calc;
+    u128 reg;
+    uint8_t pend;                   /* bits ainda sem byte completo, na posição em que entram */
+    int npend;                      /* 0..7 */
+    uint64_t nbits;                 /* total recebido */
+} CrcCtx;
+
+static void crc_ctx_init(CrcCtx *X, const CrcCalc *C) {
+    X->calc = C;
+    X->reg = crc_calc_start(C);
+    X->pend = 0;
+    X->npend = 0;
+    X->nbits = 0;
+}
+
+/* Um bit (0/1) no fim de pend; fecha o byte quando chega a 8. */
+static void crc_ctx_bit(CrcCtx *X, int bit) {
+    int refl = X->calc->model->refin;
+    X->pend |= (uint8_t)(refl ? bit << X->npend : bit << (7 - X->npend));
+    if (++X->npend == 8) {
+        X->reg = crc_calc_update(X->calc, X->reg, &X->pend, 1);
+        X->pend = 0;
+        X->npend = 0;
+    }
+}
+
+/* nbits bits de data na ordem do modelo; qualquer tamanho, qualquer alinhamento. */
+static void crc_ctx_update_bits(CrcCtx *X, const uint8_t *data, size_t nbits) {
+    const CrcCalc *C = X->calc;
+    int refl = C->model->refin;
+    size_t nbytes = nbits / 8;
+    const uint8_t *tail = data + nbytes;
+    X->nbits += nbits;
+
+    if (X->npend == 0) {
+        X->reg = crc_calc_update_sparse(C, X->reg, data, nbytes);
+    } else {
+        /* cada byte montado = bits pendentes + começo do byte novo */
+        uint8_t tmp[4096];
+        int s = X->npend;
+        uint8_t pend = X->pend;
+        while (nbytes) {
+            size_t n = (nbytes < sizeof tmp) ? nbytes : sizeof tmp;
+            for (size_t i = 0; i < n; ++i) {
+                uint8_t b = data[i];
+                tmp[i] = refl ? (uint8_t)(pend | (b << s)) : (uint8_t)(pend | (b >> s));
+                pend = refl ? (uint8_t)(b >> (8 - s)) : (uint8_t)(b << (8 - s));
+            }
+            X->reg = crc_calc_update(C, X->reg, tmp, n);
+            data += n;
+            nbytes -= n;
+        }
+        X->pend = pend;
+    }
+    for (unsigned b = 0; b < nbits % 8; ++b)
+        crc_ctx_bit(X, refl ? (*tail >> b) & 1 : (*tail >> (7 - b)) & 1);
+}
+
+static void crc_ctx_update(CrcCtx *X, const uint8_t *data, size_t len) {
+    crc_ctx_update_bits(X, data, 8 * len);
+}
+
+/* CRC de tudo o que entrou até agora; o contexto continua utilizável. */
+static u128 crc_ctx_final(const CrcCtx *X) {
+    return crc_calc_finish(X->calc, crc_calc_update_bits(X->calc, X->reg, &X->pend,
+                                                         (size_t)X->npend));
+}
+
+/*
+ * Lê fd com read() até o EOF, passando tudo por X. Para pipes, FIFOs e
+ * arquivos de /proc, em que st_size não diz quanto há para ler. Devolve 0 ou
+ * o errno da leitura.
+ */
+static int crc_ctx_read_fd(CrcCtx *X, int fd) {
+    uint8_t buf[1 << 16];
+    for (;;) {
+        ssize_t n = read(fd, buf, sizeof buf);
+        if (n == 0) return 0;
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return errno;
+        }
+        crc_ctx_update(X, buf, (size_t)n);
+    }
+}
+
+/* ===================== Benchmark (--bench) ===================== */
+static double now_sec(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/* Grau > 64: só há o motor de 128 bits; o LFSR confere o primeiro MiB. */
+static u128 run_bench_wide(const CrcPoly *g, const uint8_t *buf, size_t len) {
+    Crc128Table *T = (Crc128Table*)malloc(sizeof *T);
+    if (!T) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    crc128_table_init(T, g, 0);
+    char hex[40];
+
+    double t0 = now_sec();
+    u128 f = crc128_fcs_bits(T, buf, 8 * len);
+    double t1 = now_sec();
+    u128_hex(hex, f, g->m);
+    printf("* %-10s %8.3f GB/s  FCS=%s\n", "table128", len / (t1 - t0) / 1e9, hex);
+
+    size_t n = (len < (1u << 20)) ? len : (1u << 20);
+    int ok = crc128_fcs_bits(T, buf, 8 * n) == lfsr_bits128(g, buf, 8 * n);
+    printf("  %-10s conferido com o LFSR de 128 bits em %zu bytes: %s\n", "table128",
+           n, ok ? "OK" : "DIVERGE");
+    free(T);
+    return f;
+}
+
+/* O mesmo FCS em `threads` threads, pedaços de `chunk` bytes, contra o serial. */
+static void bench_parallel(const CrcPoly *g, const uint8_t *buf, size_t len, int slices,
+                           CrcKernel kernel, int threads, size_t chunk, u128 serial)
+{
+    CrcModel raw = { "FCS", NULL, g->m, crc_poly_low(g), 0, 0, 0, 0, 0 };
+    CrcCalc C;
+    crc_calc_init(&C, &raw, slices, kernel);
+    char hex[40], rotulo[32];
+    double t0 = now_sec();
+    u128 f = crc_calc_parallel(&C, buf, len, threads, chunk);
+    double t1 = now_sec();
+    u128_hex(hex, f, g->m);
+    snprintf(rotulo, sizeof rotulo, "%dx%zuK", threads, chunk >> 10);
+    printf("  %-10s %8.3f GB/s  FCS=%s  %s\n", rotulo, len / (t1 - t0) / 1e9, hex,
+           (f == serial) ? "OK" : "DIVERGE");
+    crc_calc_free(&C);
+}
+
+/* Registros de 8 bytes (payload CAN): um a um nas fatias x LFSR fatiado em 64/256/512. */
+static void bench_sliced(const CrcPoly *g, const CrcSlices *sl, const uint8_t *buf, size_t len) {
+    size_t n = len / 8;
+    uint64_t *ref = (uint64_t*)malloc((n ? n : 1) * sizeof *ref);
+    uint64_t *fcs = (uint64_t*)malloc((n ? n : 1) * sizeof *fcs);
+    if (!ref || !fcs) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+
+    printf("Registros de 64 bits (%zu):\n", n);
+    double t0 = now_sec();
+    for (size_t i = 0; i < n; ++i) ref[i] = crc_slice_bytes(sl, 0, buf + 8 * i, 8) >> (64 - g->m);
+    double t1 = now_sec();
+    printf("  %-10s %8.1f Mreg/s\n", "um a um", n / (t1 - t0) / 1e6);
+    for (int lanes = 64; lanes <= sliced_lanes_best(); lanes = (lanes == 64) ? 256 : 2 * lanes) {
+        t0 = now_sec();
+        lfsr_sliced_fcs(g, buf, 8, 64, n, fcs, lanes);
+        t1 = now_sec();
+        char nome[16];
+        snprintf(nome, sizeof nome, "fatiado-%d", lanes);
+        printf("  %-10s %8.1f Mreg/s  %s\n", nome, n / (t1 - t0) / 1e6,
+               memcmp(ref, fcs, n * sizeof *fcs) ? "DIVERGE" : "OK");
+    }
+    free(ref);
+    free(fcs);
+}
+
+static int run_bench(const CrcPoly *g, size_t mib, int slices, CrcKernel selected,
+                     int threads, size_t chunk)
+{
+    size_t len = mib << 20;
+    uint8_t *buf = (uint8_t*)malloc(len ? len : 1);
+    if (!buf) { fprintf(stderr, "Erro: sem memória.\n"); return 1; }
+
+    uint64_t x = 0x9E3779B97F4A7C15ULL;          /* xorshift64: dados reproduzíveis */
+    for (size_t i = 0; i < len; ++i) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        buf[i] = (uint8_t)x;
+    }
+
+    if (g->m > 64) {
+        u128 f = run_bench_wide(g, buf, len);
+        bench_parallel(g, buf, len, slices, selected, threads, chunk, f);
+        free(buf);
+        return 0;
+    }
+
+    CrcTable tab;
+    CrcSlices sl;
+    CrcFold fold;
+    crc_table_init(&tab, g, 0);
+    crc_slices_init(&sl, &tab, slices);
+    crc_fold_init(&fold, &tab);
+    int m = tab.m;
+
+    printf("Kernel selecionado: %s (fatias: %d)\n", kernel_name(selected), slices);
+
+    uint64_t ref = 0;
+    for (CrcKernel k = KERNEL_SLICE; k <= KERNEL_VPCLMUL; ++k) {
+        if (!kernel_supported(k)) {
+            printf("  %-10s indisponível nesta CPU\n", kernel_name(k));
+            continue;
+        }
+        double t0 = now_sec();
+        uint64_t f = crc_fold_bytes(&fold, &sl, k, 0, buf, len) >> (64 - m);
+        double t1 = now_sec();
+        if (k == KERNEL_SLICE) ref = f;
+        printf("%c %-10s %8.3f GB/s  FCS=0x%0*llx  %s\n", (k == selected) ? '*' : ' ',
+               kernel_name(k), len / (t1 - t0) / 1e9, (m + 3) / 4,
+               (unsigned long long)f, (f == ref) ? "OK" : "DIVERGE");
+    }
+    bench_parallel(g, buf, len, slices, selected, threads, chunk, ref);
+    bench_sliced(g, &sl, buf, len);
+
+    if (g->m == 32 && g->lo == (CRC32C_POLY & 0xFFFFFFFFu)) {
+        static const uint8_t check_msg[] = "123456789";
+        Crc32c c32;
+        crc32c_init(&c32);
+        uint32_t check = ~crc32c_update(&c32, ~0u, check_msg, 9);
+        printf("CRC-32C (refletido, init/xorout 0xFFFFFFFF): check=0x%08x  %s\n",
+               check, (check == 0xE3069283u) ? "OK" : "DIVERGE");
+
+        double t0 = now_sec();
+        uint32_t sw = ~crc32c_sw(&c32, ~0u, buf, len);
+        double t1 = now_sec();
+        printf("%c %-10s %8.3f GB/s  CRC=0x%08x\n", c32.hw ? ' ' : '*', "crc32c-sw",
+               len / (t1 - t0) / 1e9, sw);
+        if (c32.hw) {
+            t0 = now_sec();
+            uint32_t hw = ~crc32c_update(&c32, ~0u, buf, len);
+            t1 = now_sec();
+            printf("* %-10s %8.3f GB/s  CRC=0x%08x  %s\n", "crc32c-hw",
+                   len / (t1 - t0) / 1e9, hw, (hw == sw) ? "OK" : "DIVERGE");
+        } else {
+            printf("  %-10s indisponível nesta CPU\n", "crc32c-hw");
+        }
+    }
+
+    crc_slices_free(&sl);
+    free(buf);
+    return 0;
+}
+
+/* CRC dos nbits primeiros bits de buf entregues a um CrcCtx em fragmentos de 1 a 300 bits. */
+static u128 crc_ctx_fragmented(const CrcCalc *C, const uint8_t *buf, size_t nbits, uint64_t seed) {
+    int refl = C->model->refin;
+    CrcCtx X;
+    crc_ctx_init(&X, C);
+    uint8_t frag[40];
+    for (size_t pos = 0; pos < nbits; ) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        size_t n = 1 + (size_t)(seed % 300);
+        if (n > nbits - pos) n = nbits - pos;
+        memset(frag, 0, sizeof frag);
+        for (size_t i = 0; i < n; ++i) {
+            size_t s = pos + i;
+            int bit = refl ? (buf[s / 8] >> (s % 8)) & 1 : (buf[s / 8] >> (7 - s % 8)) & 1;
+            frag[i / 8] |= (uint8_t)(refl ? bit << (i % 8) : bit << (7 - i % 8));
+        }
+        crc_ctx_update_bits(&X, frag, n);
+        pos += n;
+    }
+    return crc_ctx_final(&X);
+}
+
+/* 1 se os dois arquivos têm o mesmo conteúdo. */
+static int files_equal(const char *a, const char *b) {
+    FILE *fa = fopen(a, "rb"), *fb = fopen(b, "rb");
+    int eq = fa && fb;
+    char ba[1 << 14], bb[1 << 14];
+    while (eq) {
+        size_t na = fread(ba, 1, sizeof ba, fa), nb = fread(bb, 1, sizeof bb, fb);
+        eq = na == nb && memcmp(ba, bb, na) == 0;
+        if (na < sizeof ba) break;
+    }
+    if (fa) fclose(fa);
+    if (fb) fclose(fb);
+    return eq;
+}
+
+/*
+ * mkstemp em $TMPDIR (ou P_tmpdir, se não definido): path recebe o nome
+ * criado. Devolve o descritor ou -1.
+ */
+static int tmp_file(char *path, size_t cap) {
+    const char *dir = getenv("TMPDIR");
+    if (!dir || !*dir) dir = P_tmpdir;
+    if ((size_t)snprintf(path, cap, "%s/crc_lfsr_XXXXXX", dir) >= cap) {
+        errno = ENAMETOOLONG;
+        return -1;
+    }
+    return mkstemp(path);
+}
+
+/*
+ * Anel (22) com a thread escritora: três passadas de lfsr_trace_bits sobre msg
+ * (mais passos do que o anel comporta) vão por step_sink_text a um arquivo, que
+ * tem de sair igual ao escrito com o sink rodando no produtor, na mesma ordem.
+ */
+static int selftest_step_ring(const uint8_t *msg, size_t len) {
+    CrcPoly g = crc_poly_from_u64(0x5B);
+    uint64_t nbits = 8 * (uint64_t)len;
+    char p_anel[4096], p_sync[4096];
+    int fa = tmp_file(p_anel, sizeof p_anel), fs = tmp_file(p_sync, sizeof p_sync);
+    if (fa >= 0) close(fa);
+    if (fs >= 0) close(fs);
+    Logger La, Ls;
+    int ok = fa >= 0 && fs >= 0 && 3 * (nbits + (uint64_t)g.m) > ((uint64_t)1 << STEP_RING_LOG2) &&
+             logger_open(&La, p_anel, 0) == 0;
+    if (ok && logger_open(&Ls, p_sync, 0) < 0) { logger_close(&La); ok = 0; }
+    if (ok) {
+        La.so_arq = Ls.so_arq = 1;
+        StepText Ta = { &La, g.m }, Ts = { &Ls, g.m };
+        StepRing R, S;
+        step_ring_start(&R, step_sink_text, &Ta, 3 * (nbits + (uint64_t)g.m));
+        memset(&S, 0, sizeof S);    /* sem thread: step_ring_push chama o sink */
+        S.sync = 1;
+        S.sink = step_sink_text;
+        S.ctx = &Ts;
+        for (int k = 0; k < 3; ++k)
+            ok &= lfsr_trace_bits(&g, msg, nbits, &R) == lfsr_trace_bits(&g, msg, nbits, &S);
+        step_ring_stop(&R);
+        logger_close(&La);
+        logger_close(&Ls);
+        ok = ok && files_equal(p_anel, p_sync);
+    }
+    if (fa >= 0) unlink(p_anel);
+    if (fs >= 0) unlink(p_sync);
+    return ok;
+}
+
+/* Sink do autoteste: guarda os passos em ordem (v tem espaço para todos). */
+typedef struct {
+    LfsrStep *v;
+    size_t n;
+} StepVec;
+
+static void step_sink_vec(void *ctx, const LfsrStep *s, size_t n) {
+    StepVec *V = (StepVec*)ctx;
+    memcpy(V->v + V->n, s, n * sizeof *s);
+    V->n += n;
+}
+
+static int step_eq(const LfsrStep *a, const LfsrStep *b) {
+    return a->step == b->step && a->before == b->before && a->after == b->after &&
+           a->bit == b->bit && a->msb == b->msb;
+}
+
+/*
+ * Traço binário (23) de msg num arquivo temporário, pelo anel com thread, e
+ * --query (trace_bin_load + trace_bin_step) nos passos 0, K-1, K e no último,
+ * contra o mesmo LFSR refeito com o sink rodando no produtor.
+ */
+static int selftest_trace_bin(const uint8_t *msg, size_t len) {
+    const CrcModel *M = crc_model_find("CRC-32");
+    CrcPoly g = { M->width, (uint64_t)M->poly, 0 };
+    uint64_t nbits = 8 * (uint64_t)len, steps = nbits + (uint64_t)g.m;
+    StepVec V = { (LfsrStep*)malloc(steps * sizeof(LfsrStep)), 0 };
+    if (!V.v) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    StepRing S;                     /* sem thread: step_ring_push chama o sink */
+    memset(&S, 0, sizeof S);
+    S.sync = 1;
+    S.sink = step_sink_vec;
+    S.ctx = &V;
+    uint64_t fcs = lfsr_trace_bits(&g, msg, nbits, &S);
+
+    char path[4096];
+    int fd = tmp_file(path, sizeof path);
+    if (fd < 0) { free(V.v); return 0; }
+    close(fd);
+    TraceBin B;
+    StepRing R;
+    int ok = V.n == steps && trace_bin_open(&B, path, &g, nbits) == 0;
+    if (ok) {
+        step_ring_start(&R, step_sink_bin, &B, steps);
+        ok = lfsr_trace_bits(&g, msg, nbits, &R) == fcs;
+        step_ring_stop(&R);
+        ok &= trace_bin_close(&B) == 0;
+    }
+
+    TraceHdr h;
+    LfsrStep r;
+    fd = open(path, O_RDONLY | O_CLOEXEC);
+    ok = ok && fd >= 0 && trace_bin_load(fd, &h) == 0 && h.nbits == nbits && h.fcs == fcs;
+    const uint64_t passos[] = { 0, TRACE_K - 1, TRACE_K, steps - 1 };
+    for (size_t i = 0; i < sizeof passos / sizeof passos[0]; ++i)
+        ok = ok && trace_bin_step(fd, &h, passos[i], &r) == 0 && step_eq(&r, &V.v[passos[i]]);
+    ok = ok && trace_bin_step(fd, &h, steps, &r) < 0;
+    if (fd >= 0) close(fd);
+    unlink(path);
+    free(V.v);
+    return ok;
+}
+
+/*
+ * --file num pipe: msg escrita num pipe (cabe no buffer do kernel, então não
+ * precisa de outra thread) e lida por crc_ctx_read_fd até o EOF, como
+ * run_file_read faz com /dev/stdin ou uma FIFO; tem de dar o CRC-32 de msg.
+ */
+static int selftest_pipe(const uint8_t *msg, size_t len) {
+    const CrcModel *M = crc_model_find("CRC-32");
+    int pfd[2];
+    if (pipe(pfd) != 0) return 0;
+    int ok = write(pfd[1], msg, len) == (ssize_t)len;
+    close(pfd[1]);
+    CrcCalc C;
+    crc_calc_init(&C, M, 8, KERNEL_SLICE);
+    CrcCtx X;
+    crc_ctx_init(&X, &C);
+    ok = ok && crc_ctx_read_fd(&X, pfd[0]) == 0 && X.nbits == 8 * (uint64_t)len &&
+         crc_ctx_final(&X) == crc_calc_bytes(&C, msg, len);
+    crc_calc_free(&C);
+    close(pfd[0]);
+    return ok;
+}
+
+/*
+ * --selftest: cada modelo do catálogo em cada caminho disponível (fatias 4/8/16,
+ * PCLMULQDQ, VPCLMULQDQ, CRC-32C por hardware e software) contra o check de
+ * "123456789" e contra crc_model_bitwise em mensagens de 0 a 4 KiB. As
+ * tabelas de crc_catalogo.h são conferidas com as montadas em runtime e
+ * crc_combine com a mensagem partida em vários pontos; cada caminho roda
+ * também em 3 threads com pedaços de 1000 bytes e num CrcCtx alimentado em
+ * fragmentos de tamanhos aleatórios em bits. O anel de passos (22) é
+ * conferido contra o sink síncrono, o traço binário (23) é gravado num
+ * arquivo temporário e consultado como em --query, e a leitura até o EOF de
+ * --file é conferida num pipe.
+ */
+static int run_selftest(void) {
+    enum { LEN = 4096, ZLEN = 5 * CRC_ZERO_RUN + 333 };
+    static const uint8_t check_msg[] = "123456789";
+    static const size_t lens[] = { 0, 1, 3, 15, 63, 64, 65, 127, 255, 256, 300, 1000, LEN };
+    uint8_t *buf = (uint8_t*)malloc(LEN);
+    uint8_t *zbuf = (uint8_t*)calloc(ZLEN, 1);
+    if (!buf || !zbuf) { fprintf(stderr, "Erro: sem memória.\n"); return 1; }
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    for (size_t i = 0; i < LEN; ++i) {
+        x ^= x << 13; x ^= x >> 7; x ^= x << 17;
+        buf[i] = (uint8_t)x;
+    }
+    /* dados só nas pontas: o meio zerado passa por crc_calc_zeros */
+    memcpy(zbuf, buf, 1000);
+    memcpy(zbuf + ZLEN - 1000, buf + 1000, 1000);
+
+    int falhas = 0;
+    for (size_t i = 0; i < N_CRC_MODELS; ++i) {
+        const CrcModel *M = &crc_models[i];
+        const CrcCatEntry *cat = crc_catalog_entry(M);
+        if (cat) {
+            CrcPoly g = { M->width, (uint64_t)M->poly, (uint64_t)(M->poly >> 64) };
+            int ok = strcmp(cat->name, M->name) == 0;
+            if (M->width <= 64) {
+                CrcEngine *E = (CrcEngine*)malloc(sizeof *E);
+                if (!E) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+                crc_engine_init(E, &g, M->refin, 8, KERNEL_SLICE);
+                ok &= memcmp(E->sl.t, cat->t, 8 * sizeof E->sl.t[0]) == 0 &&
+                      memcmp(&E->fold, cat->fold, sizeof E->fold) == 0;
+                crc_engine_free(E);
+                free(E);
+            } else {
+                Crc128Table *T = (Crc128Table*)malloc(sizeof *T);
+                if (!T) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+                crc128_table_init(T, &g, M->refin);
+                ok &= memcmp(T->t, cat->t128, sizeof T->t) == 0;
+                free(T);
+            }
+            printf("%-16s %-10s %s\n", M->name, "catálogo", ok ? "OK" : "DIVERGE");
+            falhas += !ok;
+        }
+        u128 ref[sizeof lens / sizeof lens[0]];
+        for (size_t j = 0; j < sizeof lens / sizeof lens[0]; ++j)
+            ref[j] = crc_model_bitwise(M, buf, lens[j]);
+
+        /* crc_combine: A = buf[0, s), B = buf[s, LEN) */
+        {
+            int ok = 1;
+            for (size_t j = 0; j < sizeof lens / sizeof lens[0]; ++j) {
+                size_t s = lens[j];
+                u128 a = crc_model_bitwise(M, buf, s);
+                u128 b = crc_model_bitwise(M, buf + s, LEN - s);
+                ok &= (crc_combine(M, a, b, LEN - s) == ref[sizeof lens / sizeof lens[0] - 1]);
+            }
+            printf("%-16s %-10s %s\n", M->name, "combine", ok ? "OK" : "DIVERGE");
+            falhas += !ok;
+        }
+
+        /* LFSR direto: init convertido dá o mesmo resto que a forma aumentada */
+        {
+            CrcPoly g = { M->width, (uint64_t)M->poly, (uint64_t)(M->poly >> 64) };
+            u128 mask = width_mask(M->width);
+            u128 aug = (((u128)x << 64) | (x >> 3)) & mask;
+            u128 dir = lfsr_init_aug_to_direct(&g, aug);
+            int inv;
+            int ok = lfsr_init_direct_to_aug(&g, dir, &inv) == aug && inv;
+            ok &= lfsr_direct_bits128(&g, dir, buf, 8 * 300 - 3) ==
+                  lfsr_aug_bits128(&g, aug, buf, 8 * 300 - 3);
+            if (!M->refin && !M->refout)
+                ok &= ((lfsr_direct_bits128(&g, M->init, check_msg, 72) ^ M->xorout) & mask) == M->check;
+            printf("%-16s %-10s %s\n", M->name, "direto", ok ? "OK" : "DIVERGE");
+            falhas += !ok;
+        }
+
+        /* LFSR fatiado: 600 registros (passo de 6 bytes) contra lfsr_bits64, em cada largura */
+        if (M->width <= 64) {
+            static const size_t nb[] = { 1, 7, 32, 64, 65, 200 };
+            CrcPoly g = { M->width, (uint64_t)M->poly, 0 };
+            uint64_t fcs[600];
+            int ok = 1;
+            for (int lanes = 64; lanes <= sliced_lanes_best(); lanes = (lanes == 64) ? 256 : 2 * lanes) {
+                for (size_t j = 0; j < sizeof nb / sizeof nb[0]; ++j) {
+                    lfsr_sliced_fcs(&g, buf, 6, nb[j], 600, fcs, lanes);
+                    for (size_t i = 0; i < 600; ++i)
+                        ok &= (fcs[i] == lfsr_bits64(&g, buf + 6 * i, nb[j]));
+                }
+            }
+            printf("%-16s %-10s %s\n", M->name, "fatiado", ok ? "OK" : "DIVERGE");
+            falhas += !ok;
+        }
+
+        /* caminho: 0..2 fatias 4/8/16, 3 pclmul, 4 vpclmul, 5 crc32c-sw, 6 crc32c-hw */
+        for (int p = 0; p < 7; ++p) {
+            static const int fatias[3] = { 4, 8, 16 };
+            static const char *nomes[7] = {
+                "slice-4", "slice-8", "slice-16", "pclmul", "vpclmul", "crc32c-sw", "crc32c-hw"
+            };
+            CrcKernel k = (p == 3) ? KERNEL_PCLMUL : (p == 4) ? KERNEL_VPCLMUL : KERNEL_SLICE;
+            if (!kernel_supported(k) || (M->width > 64 && p > 0)) continue;
+
+            CrcCalc C;
+            crc_calc_init(&C, M, (p < 3) ? fatias[p] : 8, k);
+            if (C.c32c && p < 5) { free(C.c32c); C.c32c = NULL; }
+            if (p >= 5) {
+                if (!C.c32c || (p == 6 && !C.c32c->hw)) { crc_calc_free(&C); continue; }
+                if (p == 5) C.c32c->hw = 0;
+            }
+
+            u128 check = crc_calc_bytes(&C, check_msg, 9);
+            int ok = (check == M->check);
+            for (size_t j = 0; j < sizeof lens / sizeof lens[0]; ++j)
+                ok &= (crc_calc_bytes(&C, buf, lens[j]) == ref[j]);
+            ok &= (crc_calc_parallel(&C, buf, LEN, 3, 1000) == ref[sizeof lens / sizeof lens[0] - 1]);
+            ok &= (crc_calc_bytes_sparse(&C, zbuf, ZLEN) == crc_calc_bytes(&C, zbuf, ZLEN));
+            ok &= (crc_calc_bytes_sparse(&C, zbuf + 1001, ZLEN - 1001) ==
+                   crc_calc_bytes(&C, zbuf + 1001, ZLEN - 1001));
+            CrcCtx X;
+            crc_ctx_init(&X, &C);
+            for (size_t off = 0; off < LEN; off += 1000)
+                crc_ctx_update(&X, buf + off, (LEN - off < 1000) ? LEN - off : 1000);
+            ok &= (crc_ctx_final(&X) == ref[sizeof lens / sizeof lens[0] - 1]);
+            ok &= (crc_ctx_fragmented(&C, buf, 8 * LEN, 1 + (uint64_t)p) ==
+                   ref[sizeof lens / sizeof lens[0] - 1]);
+            ok &= (crc_ctx_fragmented(&C, buf, 8 * LEN - 5, 7 + (uint64_t)p) ==
+                   crc_calc_finish(&C, crc_calc_update_bits(&C, crc_calc_start(&C), buf, 8 * LEN - 5)));
+            char hex[40];
+            u128_hex(hex, check, M->width);
+            printf("%-16s %-10s check=%s  %s\n", M->name,
+                   (M->width > 64) ? "table128" : nomes[p], hex, ok ? "OK" : "DIVERGE");
+            falhas += !ok;
+            crc_calc_free(&C);
+        }
+    }
+    {
+        int ok = selftest_step_ring(buf, LEN);
+        printf("%-16s %-10s %s\n", "LFSR", "anel", ok ? "OK" : "DIVERGE");
+        falhas += !ok;
+    }
+    {
+        int ok = selftest_trace_bin(buf, LEN);
+        printf("%-16s %-10s %s\n", "LFSR", "traço-bin", ok ? "OK" : "DIVERGE");
+        falhas += !ok;
+    }
+    {
+        int ok = selftest_pipe(buf, LEN);
+        printf("%-16s %-10s %s\n", "CRC-32", "pipe", ok ? "OK" : "DIVERGE");
+        falhas += !ok;
+    }
+    printf("%s\n", falhas ? "Autoteste: FALHOU." : "Autoteste: todos os caminhos OK.");
+    free(buf);
+    free(zbuf);
+    return falhas ? 1 : 0;
+}
+
+/* --model: parâmetros do modelo e o CRC de "123456789" pelo motor escolhido. */
+static int show_model(const CrcModel *M, int slices, CrcKernel kernel) {
+    static const uint8_t check_msg[] = "123456789";
+    char poly[40], init[40], xorout[40], check[40];
+    CrcCalc C;
+    crc_calc_init(&C, M, slices, kernel);
+    u128 crc = crc_calc_bytes(&C, check_msg, 9);
+    /* o rótulo segue o motor que crc_calc_update de fato usa */
+    const char *via = C.c32c ? (C.c32c->hw ? "  (crc32 do SSE4.2)" : "  (CRC-32C em software)")
+                    : C.catalog ? "  (tabelas do catálogo)" : "";
+    crc_calc_free(&C);
+    u128_hex(poly, M->poly, M->width);
+    u128_hex(init, M->init, M->width);
+    u128_hex(xorout, M->xorout, M->width);
+    u128_hex(check, crc, M->width);
+    printf("%s: width=%d poly=%s init=%s refin=%s refout=%s xorout=%s\n",
+           M->name, M->width, poly, init, M->refin ? "true" : "false",
+           M->refout ? "true" : "false", xorout);
+    printf("CRC(\"123456789\") = %s  %s%s\n", check, (crc == M->check) ? "OK" : "DIVERGE", via);
+    return (crc == M->check) ? 0 : 1;
+}
+
+/*
+ * Primeiro modelo de crc_models[] com as mesmas tabelas de i: elas só dependem
+ * de (width, poly, refin), então ARC e MODBUS, por exemplo, dividem uma cópia.
+ */
+static size_t catalogo_dono(size_t i) {
+    const CrcModel *M = &crc_models[i];
+    for (size_t j = 0; j < i; ++j)
+        if (crc_models[j].width == M->width && crc_models[j].poly == M->poly &&
+            crc_models[j].refin == M->refin)
+            return j;
+    return i;
+}
+
+/* --gen-catalogo: escreve crc_catalogo.h (tabelas de crc_models[]) no stdout. */
+static int gen_catalogo(FILE *out) {
+    fprintf(out, "/* crc_catalogo.h -- gerado por `crc_lfsr --gen-catalogo`; não editar à mão.\n"
+                 " * Tabelas slice-by-8 e constantes de dobra de cada modelo de crc_models[]. */\n");
+    for (size_t i = 0; i < N_CRC_MODELS; ++i) {
+        const CrcModel *M = &crc_models[i];
+        CrcPoly g = { M->width, (uint64_t)M->poly, (uint64_t)(M->poly >> 64) };
+        size_t dono = catalogo_dono(i);
+        if (dono != i) {
+            fprintf(out, "\n/* %s: mesmas tabelas de %s */\n", M->name, crc_models[dono].name);
+            continue;
+        }
+        fprintf(out, "\n/* %s */\n", M->name);
+        if (M->width > 64) {
+            Crc128Table *T = (Crc128Table*)malloc(sizeof *T);
+            if (!T) { fprintf(stderr, "Erro: sem memória.\n"); return 1; }
+            crc128_table_init(T, &g, M->refin);
+            fprintf(out, "static const u128 crc_cat_w%zu[256] = {\n", i);
+            for (int j = 0; j < 256; ++j)
+                fprintf(out, "%sU128(%#llx, %#llx),%s", (j % 2) ? " " : "    ",
+                        (unsigned long long)(T->t[j] >> 64), (unsigned long long)T->t[j],
+                        (j % 2) ? "\n" : "");
+            fprintf(out, "};\n");
+            free(T);
+            continue;
+        }
+        CrcEngine *E = (CrcEngine*)malloc(sizeof *E);
+        if (!E) { fprintf(stderr, "Erro: sem memória.\n"); return 1; }
+        crc_engine_init(E, &g, M->refin, 8, KERNEL_SLICE);
+        fprintf(out, "static const uint64_t crc_cat_t%zu[8][256] = {\n", i);
+        for (int k = 0; k < 8; ++k) {
+            fprintf(out, "  {\n");
+            for (int j = 0; j < 256; ++j)
+                fprintf(out, "%s%#llx,%s", (j % 4) ? " " : "    ",
+                        (unsigned long long)E->sl.t[k][j], (j % 4 == 3) ? "\n" : "");
+            fprintf(out, "  },\n");
+        }
+        fprintf(out, "};\n");
+        const CrcFold *F = &E->fold;
+        fprintf(out, "static const CrcFold crc_cat_f%zu = {\n"
+                     "    %d, %d, %#llx,\n"
+                     "    { %#llx, %#llx }, { %#llx, %#llx }, { %#llx, %#llx },\n"
+                     "    %#llx, %#llx\n};\n", i, F->m, F->refl,
+                (unsigned long long)F->q_lo,
+                (unsigned long long)F->k16[0], (unsigned long long)F->k16[1],
+                (unsigned long long)F->k4[0], (unsigned long long)F->k4[1],
+                (unsigned long long)F->k1[0], (unsigned long long)F->k1[1],
+                (unsigned long long)F->kf, (unsigned long long)F->mu);
+        crc_engine_free(E);
+        free(E);
+    }
+    fprintf(out, "\n#define CRC_CATALOGO_N %zu\n\n", N_CRC_MODELS);
+    fprintf(out, "static const CrcCatEntry crc_catalogo[CRC_CATALOGO_N] = {\n");
+    for (size_t i = 0; i < N_CRC_MODELS; ++i) {
+        const CrcModel *M = &crc_models[i];
+        fprintf(out, "    { \"%s\", %d, U128(%#llx, %#llx), %d, %d, ", M->name, M->width,
+                (unsigned long long)(M->poly >> 64), (unsigned long long)M->poly,
+                M->refin, M->refout);
+        size_t dono = catalogo_dono(i);
+        if (M->width > 64)
+            fprintf(out, "NULL, NULL, crc_cat_w%zu },\n", dono);
+        else
+            fprintf(out, "crc_cat_t%zu, &crc_cat_f%zu, NULL },\n", dono, dono);
+    }
+    fprintf(out, "};\n");
+    return 0;
+}
+
+/* ===================== (13) Muitos arquivos: pool com roubo de tarefas (--scan) ===================== */
+/*
+ * Cada thread tem uma deque de tarefas. A dona empilha e desempilha no fim
+ * (LIFO, dados ainda quentes); quem ficou sem trabalho rouba do começo de outra
+ * deque, onde estão as tarefas mais antigas e maiores. Uma tarefa é:
+ *   - um intervalo de um arquivo grande: se passa de `chunk`, a thread corta
+ *     ao meio (em múltiplo de chunk), deixa a segunda metade na deque para
+ *     ser roubada e segue com a primeira;
+ *   - um lote de arquivos pequenos consecutivos (até ~chunk bytes somados),
+ *     para não pagar uma tarefa por arquivo de poucos bytes.
+ * Cada pedaço gera (arquivo, offset, tamanho, crc) na lista da thread; no fim
+ * os pedaços de cada arquivo são ordenados e juntados com crc_combine.
+ * As deques são protegidas por mutex: a disputa é rara, uma tarefa é um
+ * pedaço inteiro de arquivo.
+ */
+typedef struct {
+    char *path;
+    uint64_t size;
+    int err;                        /* errno do stat, 0 se ok */
+} ScanFile;
+
+typedef struct {
+    size_t file;                    /* primeiro arquivo */
+    size_t count;                   /* 0: intervalo [off, off+len) de `file`; >0: lote */
+    uint64_t off, len;
+} ScanTask;
+
+typedef struct {
+    pthread_mutex_t mu;
+    ScanTask *v;
+    size_t head, tail, cap;         /* tarefas em v[head, tail) */
+} TaskDeque;
+
+typedef struct {
+    size_t file;
+    uint64_t off, len;
+    u128 crc;
+    int err;                        /* errno da leitura, 0 se ok */
+} ScanPiece;
+
+struct ScanCtx;
+
+typedef struct {
+    struct ScanCtx *ctx;
+    int id;
+    pthread_t tid;
+    uint8_t *buf;                   /* chunk bytes */
+    ScanPiece *pieces;
+    size_t np, cap;
+    unsigned long stolen;
+} ScanWorker;
+
+typedef struct ScanCtx {
+    const CrcCalc *calc;
+    ScanFile *files;
+    size_t nfiles;
+    size_t chunk;
+    int nworkers;
+    TaskDeque *dq;
+    ScanWorker *w;
+    atomic_size_t pending;          /* tarefas criadas e ainda não terminadas */
+} ScanCtx;
+
+static void deque_push(TaskDeque *D, ScanTask t) {
+    pthread_mutex_lock(&D->mu);
+    if (D->tail == D->cap) {
+        if (D->head > 0) {
+            memmove(D->v, D->v + D->head, (D->tail - D->head) * sizeof *D->v);
+            D->tail -= D->head;
+            D->head = 0;
+        } else {
+            D->cap = D->cap ? 2 * D->cap : 64;
+            D->v = (ScanTask*)realloc(D->v, D->cap * sizeof *D->v);
+            if (!D->v) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+        }
+    }
+    D->v[D->tail++] = t;
+    pthread_mutex_unlock(&D->mu);
+}
+
+/* Dona: tira do fim. Ladrão (steal != 0): tira do começo. */
+static int deque_pop(TaskDeque *D, ScanTask *t, int steal) {
+    int ok = 0;
+    pthread_mutex_lock(&D->mu);
+    if (D->head < D->tail) {
+        *t = steal ? D->v[D->head++] : D->v[--D->tail];
+        ok = 1;
+    }
+    pthread_mutex_unlock(&D->mu);
+    return ok;
+}
+
+static void scan_piece(ScanWorker *W, size_t file, uint64_t off, uint64_t len, u128 crc, int err) {
+    if (W->np == W->cap) {
+        W->cap = W->cap ? 2 * W->cap : 256;
+        W->pieces = (ScanPiece*)realloc(W->pieces, W->cap * sizeof *W->pieces);
+        if (!W->pieces) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    }
+    W->pieces[W->np++] = (ScanPiece){ file, off, len, crc, err };
+}
+
+/* Lê [off, off+len) de path (len <= chunk) e registra o CRC do pedaço. */
+static void scan_range(ScanWorker *W, size_t file, uint64_t off, uint64_t len) {
+    const ScanFile *F = &W->ctx->files[file];
+    int err = 0;
+    int fd = open(F->path, O_RDONLY);
+    size_t got = 0;
+    if (fd < 0) {
+        err = errno;
+    } else {
+        while (got < len) {
+            ssize_t n = pread(fd, W->buf + got, (size_t)len - got, (off_t)(off + got));
+            if (n < 0 && errno == EINTR) continue;
+            if (n <= 0) { err = (n < 0) ? errno : EIO; break; }   /* encolheu no meio */
+            got += (size_t)n;
+        }
+        close(fd);
+    }
+    u128 crc = err ? 0 : crc_calc_bytes_sparse(W->ctx->calc, W->buf, (size_t)len);
+    scan_piece(W, file, off, len, crc, err);
+}
+
+static void scan_task(ScanWorker *W, ScanTask t) {
+    ScanCtx *X = W->ctx;
+    if (t.count) {
+        for (size_t f = t.file; f < t.file + t.count; ++f)
+            scan_range(W, f, 0, X->files[f].size);
+        return;
+    }
+    while (t.len > X->chunk) {
+        uint64_t half = ((t.len + X->chunk - 1) / X->chunk / 2) * X->chunk;
+        ScanTask rest = { t.file, 0, t.off + half, t.len - half };
+        atomic_fetch_add(&X->pending, 1);
+        deque_push(&X->dq[W->id], rest);
+        t.len = half;
+    }
+    scan_range(W, t.file, t.off, t.len);
+}
+
+static void *scan_worker(void *arg) {
+    ScanWorker *W = (ScanWorker*)arg;
+    ScanCtx *X = W->ctx;
+    unsigned victim = (unsigned)W->id;
+    while (atomic_load(&X->pending) > 0) {
+        ScanTask t;
+        int got = deque_pop(&X->dq[W->id], &t, 0);
+        for (int k = 1; !got && k < X->nworkers; ++k) {
+            victim = (victim + 1) % (unsigned)X->nworkers;
+            if ((int)victim != W->id && deque_pop(&X->dq[victim], &t, 1)) {
+                got = 1;
+                ++W->stolen;
+            }
+        }
+        if (!got) { sched_yield(); continue; }
+        scan_task(W, t);
+        atomic_fetch_sub(&X->pending, 1);
+    }
+    return NULL;
+}
+
+static int piece_cmp(const void *a, const void *b) {
+    const ScanPiece *p = (const ScanPiece*)a, *q = (const ScanPiece*)b;
+    if (p->file != q->file) return (p->file < q->file) ? -1 : 1;
+    return (p->off < q->off) ? -1 : (p->off > q->off);
+}
+
+/* Lê a lista de caminhos (um por linha; "-" = stdin) e faz o stat de cada um. */
+static int scan_read_list(const char *lista, ScanFile **out, size_t *nfiles) {
+    FILE *in = strcmp(lista, "-") == 0 ? stdin : fopen(lista, "r");
+    if (!in) { fprintf(stderr, "Erro: não consegui abrir %s.\n", lista); return 0; }
+    ScanFile *files = NULL;
+    size_t n = 0, cap = 0;
+    char *line = NULL;
+    size_t lcap = 0;
+    ssize_t l;
+    while ((l = getline(&line, &lcap, in)) >= 0) {
+        while (l > 0 && (line[l-1] == '\n' || line[l-1] == '\r')) line[--l] = '\0';
+        if (l == 0) continue;
+        if (n == cap) {
+            cap = cap ? 2 * cap : 256;
+            files = (ScanFile*)realloc(files, cap * sizeof *files);
+            if (!files) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+        }
+        struct stat st;
+        files[n].path = strdup(line);
+        files[n].err = (stat(line, &st) != 0) ? errno
+                     : S_ISREG(st.st_mode) ? 0 : EINVAL;
+        files[n].size = files[n].err ? 0 : (uint64_t)st.st_size;
+        ++n;
+    }
+    free(line);
+    if (in != stdin) fclose(in);
+    *out = files;
+    *nfiles = n;
+    return 1;
+}
+
+static int run_scan(const char *lista, const CrcModel *M, int slices, CrcKernel kernel,
+                    int threads, size_t chunk)
+{
+    ScanCtx X;
+    memset(&X, 0, sizeof X);
+    if (!scan_read_list(lista, &X.files, &X.nfiles)) return 1;
+    CrcCalc C;
+    crc_calc_init(&C, M, slices, kernel);
+    X.calc = &C;
+    X.chunk = chunk;
+    X.nworkers = threads;
+    X.dq = (TaskDeque*)calloc((size_t)threads, sizeof *X.dq);
+    X.w = (ScanWorker*)calloc((size_t)threads, sizeof *X.w);
+    if (!X.dq || !X.w) { fprintf(stderr, "Erro: sem memória.\n"); return 1; }
+    for (int t = 0; t < threads; ++t) {
+        pthread_mutex_init(&X.dq[t].mu, NULL);
+        X.w[t].ctx = &X;
+        X.w[t].id = t;
+        X.w[t].buf = (uint8_t*)malloc(chunk);
+        if (!X.w[t].buf) { fprintf(stderr, "Erro: sem memória.\n"); return 1; }
+    }
+
+    /* tarefas iniciais, distribuídas em rodízio: lotes de pequenos e arquivos grandes */
+    uint64_t total = 0;
+    size_t ntasks = 0;
+    for (size_t f = 0; f < X.nfiles; ) {
+        ScanTask t = { f, 0, 0, X.files[f].size };
+        if (X.files[f].err) { ++f; continue; }
+        if (X.files[f].size <= chunk) {
+            uint64_t soma = 0;
+            while (f < X.nfiles && !X.files[f].err && X.files[f].size <= chunk &&
+                   soma + X.files[f].size <= chunk && t.count < 1024) {
+                soma += X.files[f].size;
+                ++t.count;
+                ++f;
+            }
+            total += soma;
+        } else {
+            total += X.files[f].size;
+            ++f;
+        }
+        atomic_fetch_add(&X.pending, 1);
+        deque_push(&X.dq[ntasks++ % (size_t)threads], t);
+    }
+
+    double t0 = now_sec();
+    int started = 1;
+    while (started < threads &&
+           pthread_create(&X.w[started].tid, NULL, scan_worker, &X.w[started]) == 0)
+        ++started;
+    scan_worker(&X.w[0]);
+    for (int t = 1; t < started; ++t) pthread_join(X.w[t].tid, NULL);
+    double t1 = now_sec();
+
+    /* junta os pedaços de cada arquivo, em ordem de offset */
+    size_t np = 0;
+    unsigned long stolen = 0;
+    for (int t = 0; t < threads; ++t) { np += X.w[t].np; stolen += X.w[t].stolen; }
+    ScanPiece *all = (ScanPiece*)malloc((np ? np : 1) * sizeof *all);
+    if (!all) { fprintf(stderr, "Erro: sem memória.\n"); return 1; }
+    np = 0;
+    for (int t = 0; t < threads; ++t) {
+        memcpy(all + np, X.w[t].pieces, X.w[t].np * sizeof *all);
+        np += X.w[t].np;
+    }
+    qsort(all, np, sizeof *all, piece_cmp);
+
+    int falhas = 0;
+    size_t p = 0;
+    for (size_t f = 0; f < X.nfiles; ++f) {
+        ScanFile *F = &X.files[f];
+        int err = F->err;
+        uint64_t pos = 0;
+        u128 crc = 0;
+        for (; p < np && all[p].file == f; ++p) {
+            if (all[p].err) err = all[p].err;
+            crc = (pos == 0) ? all[p].crc : crc_combine(M, crc, all[p].crc, all[p].len);
+            pos += all[p].len;
+        }
+        if (!err && pos != F->size) err = EIO;
+        if (err) {
+            printf("%-*s  %s: %s\n", (M->width + 3) / 4 + 2, "ERRO", F->path, strerror(err));
+            ++falhas;
+        } else {
+            char hex[40];
+            u128_hex(hex, crc, M->width);
+            printf("%s  %12llu  %s\n", hex, (unsigned long long)F->size, F->path);
+        }
+    }
+    fprintf(stderr, "%s: %zu arquivos, %llu bytes em %.3f s (%.3f GB/s), %d threads, "
+                    "pedaços de %zu KiB, %lu tarefas roubadas\n",
+            M->name, X.nfiles, (unsigned long long)total, t1 - t0,
+            total / (t1 - t0 > 0 ? t1 - t0 : 1e-9) / 1e9, threads, chunk >> 10, stolen);
+
+    free(all);
+    for (int t = 0; t < threads; ++t) {
+        pthread_mutex_destroy(&X.dq[t].mu);
+        free(X.dq[t].v);
+        free(X.w[t].buf);
+        free(X.w[t].pieces);
+    }
+    for (size_t f = 0; f < X.nfiles; ++f) free(X.files[f].path);
+    free(X.files);
+    free(X.dq);
+    free(X.w);
+    crc_calc_free(&C);
+    return falhas ? 1 : 0;
+}
+
+/* ===================== (14) Leitura assíncrona: io_uring ou pread em thread (--io) ===================== */
+/*
+ * Em vez de mapear, o arquivo é lido em blocos de `chunk` bytes para um
+ * conjunto de buffers enquanto o motor consome os que já chegaram, de modo
+ * que E/S e cálculo se sobrepõem.
+ *
+ * io_uring (chamadas de sistema diretas, sem liburing): `qd` buffers
+ * registrados no kernel (IORING_REGISTER_BUFFERS, leitura com READ_FIXED)
+ * ficam em voo ao mesmo tempo. O buffer i recebe os blocos i, i+qd, i+2qd...,
+ * então o próximo bloco a consumir está sempre no buffer seguinte do rodízio;
+ * assim que é consumido ele volta para a fila com o próximo bloco a pedir.
+ * Leituras curtas são completadas com um novo pedido para o resto.
+ *
+ * Sem io_uring (kernel antigo, seccomp, outro SO) cai numa thread leitora com
+ * pread e dois buffers: enquanto um é lido o outro é consumido.
+ *
+ * --io direct usa o mesmo caminho com O_DIRECT: nada passa pelo cache de
+ * páginas (arquivos frios não expulsam o que está quente), e por isso os
+ * buffers, offsets e tamanhos pedidos são múltiplos de 4 KiB.
+ */
+typedef enum { IO_MMAP, IO_URING, IO_PREAD, IO_DIRECT } IoMode;
+
+static const char *io_name(IoMode io) {
+    return io == IO_URING ? "uring" : io == IO_PREAD ? "pread" :
+           io == IO_DIRECT ? "direct" : "mmap";
+}
+
+/*
+ * Conjunto de n buffers de `size` bytes (múltiplo de 4 KiB) numa região só,
+ * alinhada a 2 MiB. Com huge != 0 tenta hugepages de verdade (MAP_HUGETLB) e,
+ * sem reserva, pede hugepages transparentes com MADV_HUGEPAGE: menos falhas
+ * de TLB ao varrer os buffers e menos páginas para o kernel fixar no O_DIRECT.
+ * `recycled` conta quantas vezes um buffer já consumido recebeu outro bloco.
+ */
+#define IO_ALIGN ((size_t)4096)
+#define HUGE_SZ  ((size_t)2 << 20)
+
+typedef struct {
+    uint8_t *base;
+    void *map;
+    size_t map_len;
+    size_t size;                    /* bytes por buffer */
+    int n;
+    const char *pages;              /* "hugetlb", "thp" ou "4k" */
+    unsigned long recycled;
+} BufPool;
+
+static void pool_init(BufPool *P, int n, size_t size, int huge) {
+    memset(P, 0, sizeof *P);
+    P->n = n;
+    P->size = (size + IO_ALIGN - 1) & ~(IO_ALIGN - 1);
+    size_t len = ((size_t)n * P->size + HUGE_SZ - 1) & ~(HUGE_SZ - 1);
+    P->pages = "4k";
+    if (huge) {
+        P->map = mmap(NULL, len, PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (P->map != MAP_FAILED) {
+            P->map_len = len;
+            P->base = (uint8_t*)P->map;
+            P->pages = "hugetlb";
+            return;
+        }
+    }
+    P->map_len = len + (huge ? HUGE_SZ : 0);
+    P->map = mmap(NULL, P->map_len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (P->map == MAP_FAILED) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    P->base = (uint8_t*)P->map;
+    if (huge) {
+        P->base = (uint8_t*)(((uintptr_t)P->map + HUGE_SZ - 1) & ~(uintptr_t)(HUGE_SZ - 1));
+        if (madvise(P->base, len, MADV_HUGEPAGE) == 0) P->pages = "thp";
+    }
+}
+
+static uint8_t *pool_buf(const BufPool *P, int i) {
+    return P->base + (size_t)i * P->size;
+}
+
+static void pool_free(BufPool *P) {
+    munmap(P->map, P->map_len);
+}
+
+/* Bytes a pedir para o bloco [off, off+len): no O_DIRECT o tamanho vai até o próximo múltiplo de 4 KiB. */
+static size_t io_request_len(size_t len, int direct) {
+    return direct ? (len + IO_ALIGN - 1) & ~(IO_ALIGN - 1) : len;
+}
+
+/*
+ * Leitura curta: *got é de onde recomeçar. No O_DIRECT volta ao último bloco
+ * de 4 KiB inteiro, para endereço, offset e tamanho seguirem alinhados e o
+ * pedido não passar do fim do buffer; 0, ou EIO se isso não avançou de was.
+ */
+static int io_resume(size_t *got, size_t was, int direct) {
+    if (direct) *got &= ~(IO_ALIGN - 1);
+    return (*got > was) ? 0 : EIO;
+}
+
+/* ===================== (19) Arquivos esparsos: SEEK_DATA / SEEK_HOLE ===================== */
+/*
+ * Imagens de VM e arquivos pré-alocados são quase só buracos: trechos que o
+ * sistema de arquivos nem guarda e que se leem como zeros. lseek com
+ * SEEK_DATA/SEEK_HOLE lista os trechos com dados; só eles são lidos (ou
+ * tocados no mapeamento) e cada buraco vira crc_calc_zeros, com o mesmo CRC
+ * de ler os zeros. Os trechos são arredondados para 4 KiB (para o O_DIRECT);
+ * a folga, se houver, é lida como dado comum. Sem suporte a SEEK_DATA o
+ * arquivo inteiro é um trecho só.
+ */
+typedef struct {
+    uint64_t off, len;
+} FileExtent;
+
+/* Trechos com dados de [0, size), em ordem e sem sobreposição; malloc'd. */
+static FileExtent *file_extents(int fd, uint64_t size, size_t *n) {
+    size_t cap = 16;
+    FileExtent *ext = (FileExtent*)malloc(cap * sizeof *ext);
+    if (!ext) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    *n = 0;
+    for (uint64_t off = 0; off < size; ) {
+        off_t d = lseek(fd, (off_t)off, SEEK_DATA);
+        if (d < 0 && errno == ENXIO) break;           /* só buraco até o fim */
+        if (d < 0) {                                  /* sem suporte: tudo é dado */
+            ext[0].off = 0;
+            ext[0].len = size;
+            *n = 1;
+            break;
+        }
+        off_t h = lseek(fd, d, SEEK_HOLE);
+        uint64_t a = (uint64_t)d & ~(uint64_t)(IO_ALIGN - 1);
+        uint64_t b = (h < 0) ? size : ((uint64_t)h + IO_ALIGN - 1) & ~(uint64_t)(IO_ALIGN - 1);
+        if (b > size) b = size;
+        if (*n && a <= ext[*n - 1].off + ext[*n - 1].len) {
+            ext[*n - 1].len = b - ext[*n - 1].off;
+        } else {
+            if (*n == cap) {
+                FileExtent *p = (FileExtent*)realloc(ext, 2 * cap * sizeof *ext);
+                if (!p) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+                ext = p;
+                cap *= 2;
+            }
+            ext[*n].off = a;
+            ext[*n].len = b - a;
+            ++*n;
+        }
+        off = b;
+    }
+    return ext;
+}
+
+static uint64_t extents_bytes(const FileExtent *ext, size_t n) {
+    uint64_t s = 0;
+    for (size_t i = 0; i < n; ++i) s += ext[i].len;
+    return s;
+}
+
+/* Percorre os trechos em pedaços de até `max` bytes, sem atravessar buracos. */
+typedef struct {
+    const FileExtent *ext;
+    size_t n, i;
+    uint64_t off;
+} ExtCursor;
+
+/* Próximo pedaço: tamanho (0 no fim) e offset em *off. */
+static size_t ext_next(ExtCursor *X, size_t max, uint64_t *off) {
+    for (; X->i < X->n; ++X->i) {
+        const FileExtent *E = &X->ext[X->i];
+        if (X->off < E->off) X->off = E->off;
+        if (X->off < E->off + E->len) {
+            uint64_t left = E->off + E->len - X->off;
+            size_t len = (left < max) ? (size_t)left : max;
+            *off = X->off;
+            X->off += len;
+            return len;
+        }
+    }
+    return 0;
+}
+
+/* Consome o pedaço lido em off; o buraco desde *pos (fim do anterior) entra como zeros. */
+static u128 crc_calc_extent(const CrcCalc *C, u128 reg, uint64_t *pos, uint64_t off,
+                            const uint8_t *buf, size_t len)
+{
+    if (off > *pos) reg = crc_calc_zeros(C, reg, 8 * (off - *pos));
+    *pos = off + len;
+    return crc_calc_update_sparse(C, reg, buf, len);
+}
+
+/*
+ * Sem O_DIRECT (--io direct recusado): a cada IO_DROP_STEP bytes consumidos,
+ * devolve ao kernel as páginas de [*dropped, pos) com POSIX_FADV_DONTNEED, para
+ * um arquivo grande não empurrar o resto do cache para fora enquanto é lido.
+ */
+#define IO_DROP_STEP ((uint64_t)8 << 20)
+
+static void io_drop_cache(int fd, uint64_t *dropped, uint64_t pos) {
+    if (pos - *dropped < IO_DROP_STEP) return;
+    posix_fadvise(fd, (off_t)*dropped, (off_t)(pos - *dropped), POSIX_FADV_DONTNEED);
+    *dropped = pos;
+}
+
+#ifdef HAVE_IO_URING
+typedef struct {
+    int fd;
+    unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+    unsigned *cq_head, *cq_tail, *cq_mask;
+    struct io_uring_sqe *sqes;
+    struct io_uring_cqe *cqes;
+    void *sq_ptr, *cq_ptr;
+    size_t sq_sz, cq_sz, sqes_sz;
+    unsigned to_submit;             /* enfileiradas, ainda não entregues ao kernel */
+    unsigned pending;               /* entregues ou não, ainda sem conclusão */
+    int read_fixed;                 /* o kernel tem IORING_OP_READ_FIXED */
+} Uring;
+
+/*
+ * Pergunta ao kernel (IORING_REGISTER_PROBE) quais operações ele conhece: o
+ * io_uring_setup existe desde o 5.1, mas IORING_OP_READ só chegou no 5.6 (junto
+ * com o probe). 1 se op é suportada.
+ */
+static int uring_probe_op(const struct io_uring_probe *pr, unsigned op) {
+    return op <= pr->last_op && op < pr->ops_len &&
+           (pr->ops[op].flags & IO_URING_OP_SUPPORTED);
+}
+
+static int uring_init(Uring *R, unsigned entries) {
+    struct io_uring_params p;
+    memset(&p, 0, sizeof p);
+    memset(R, 0, sizeof *R);
+    R->fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+    if (R->fd < 0) return -1;
+
+    R->sq_sz = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    R->cq_sz = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP)
+        R->sq_sz = R->cq_sz = (R->sq_sz > R->cq_sz) ? R->sq_sz : R->cq_sz;
+    R->sq_ptr = mmap(NULL, R->sq_sz, PROT_READ | PROT_WRITE, MAP_SHARED, R->fd, IORING_OFF_SQ_RING);
+    R->cq_ptr = (p.features & IORING_FEAT_SINGLE_MMAP) ? R->sq_ptr :
+                mmap(NULL, R->cq_sz, PROT_READ | PROT_WRITE, MAP_SHARED, R->fd, IORING_OFF_CQ_RING);
+    R->sqes_sz = p.sq_entries * sizeof(struct io_uring_sqe);
+    R->sqes = (struct io_uring_sqe*)mmap(NULL, R->sqes_sz, PROT_READ | PROT_WRITE, MAP_SHARED,
+                                         R->fd, IORING_OFF_SQES);
+    if (R->sq_ptr == MAP_FAILED || R->cq_ptr == MAP_FAILED || R->sqes == MAP_FAILED) {
+        close(R->fd);
+        return -1;
+    }
+    uint8_t *sq = (uint8_t*)R->sq_ptr, *cq = (uint8_t*)R->cq_ptr;
+    R->sq_head = (unsigned*)(sq + p.sq_off.head);
+    R->sq_tail = (unsigned*)(sq + p.sq_off.tail);
+    R->sq_mask = (unsigned*)(sq + p.sq_off.ring_mask);
+    R->sq_array = (unsigned*)(sq + p.sq_off.array);
+    R->cq_head = (unsigned*)(cq + p.cq_off.head);
+    R->cq_tail = (unsigned*)(cq + p.cq_off.tail);
+    R->cq_mask = (unsigned*)(cq + p.cq_off.ring_mask);
+    R->cqes = (struct io_uring_cqe*)(cq + p.cq_off.cqes);
+
+    /* sem probe ou sem IORING_OP_READ: -1, e o chamador usa pread */
+    enum { PROBE_OPS = 256 };
+    struct io_uring_probe *pr = (struct io_uring_probe*)
+        calloc(1, sizeof *pr + PROBE_OPS * sizeof(struct io_uring_probe_op));
+    int ok = pr && syscall(__NR_io_uring_register, R->fd, IORING_REGISTER_PROBE, pr, PROBE_OPS) == 0 &&
+             uring_probe_op(pr, IORING_OP_READ);
+    R->read_fixed = ok && uring_probe_op(pr, IORING_OP_READ_FIXED);
+    free(pr);
+    if (!ok) {
+        munmap(R->sqes, R->sqes_sz);
+        if (R->cq_ptr != R->sq_ptr) munmap(R->cq_ptr, R->cq_sz);
+        munmap(R->sq_ptr, R->sq_sz);
+        close(R->fd);
+        return -1;
+    }
+    return 0;
+}
+
+static void uring_free(Uring *R) {
+    munmap(R->sqes, R->sqes_sz);
+    if (R->cq_ptr != R->sq_ptr) munmap(R->cq_ptr, R->cq_sz);
+    munmap(R->sq_ptr, R->sq_sz);
+    close(R->fd);
+}
+
+/* Enfileira uma leitura; vai para o kernel no próximo uring_wait. */
+static void uring_read(Uring *R, int fd, int fixed, unsigned buf_index,
+                       void *dst, unsigned len, uint64_t off, uint64_t tag)
+{
+    unsigned tail = *R->sq_tail;
+    unsigned idx = tail & *R->sq_mask;
+    struct io_uring_sqe *s = &R->sqes[idx];
+    memset(s, 0, sizeof *s);
+    s->opcode = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    s->fd = fd;
+    s->addr = (uint64_t)(uintptr_t)dst;
+    s->len = len;
+    s->off = off;
+    s->buf_index = (uint16_t)buf_index;
+    s->user_data = tag;
+    R->sq_array[idx] = idx;
+    __atomic_store_n(R->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ++R->to_submit;
+    ++R->pending;
+}
+
+/* Submete o que houver e espera pelo menos uma conclusão. */
+static int uring_wait(Uring *R) {
+    for (;;) {
+        long n = syscall(__NR_io_uring_enter, R->fd, R->to_submit, 1u,
+                         IORING_ENTER_GETEVENTS, NULL, 0);
+        if (n >= 0) { R->to_submit -= (unsigned)n; return 0; }
+        if (errno != EINTR) return errno;
+    }
+}
+
+/* Próxima conclusão já disponível, sem bloquear; 0 se não há. */
+static int uring_reap(Uring *R, uint64_t *tag, int *res) {
+    unsigned head = *R->cq_head;
+    if (head == __atomic_load_n(R->cq_tail, __ATOMIC_ACQUIRE)) return 0;
+    struct io_uring_cqe *c = &R->cqes[head & *R->cq_mask];
+    *tag = c->user_data;
+    *res = c->res;
+    __atomic_store_n(R->cq_head, head + 1, __ATOMIC_RELEASE);
+    --R->pending;
+    return 1;
+}
+
+/*
+ * Devolve 0 se leu tudo, -1 se não há io_uring (o chamador cai no pread) ou
+ * o errno de uma falha de leitura. Usa os P->n buffers do conjunto como fila.
+ * O suporte a IORING_OP_READ é conferido em uring_init; aqui qualquer erro
+ * numa conclusão é erro de leitura.
+ */
+static int stream_uring(int fd, uint64_t size, const FileExtent *ext, size_t next,
+                        const CrcCalc *C, u128 *reg, BufPool *P, int direct, int dontneed)
+{
+    Uring R;
+    int qd = P->n;
+    if (uring_init(&R, (unsigned)qd) != 0) return -1;
+
+    typedef struct { uint64_t off; size_t len, got; int ready; } Slot;
+    Slot *slot = (Slot*)calloc((size_t)qd, sizeof *slot);
+    struct iovec *iov = (struct iovec*)calloc((size_t)qd, sizeof *iov);
+    if (!slot || !iov) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    for (int i = 0; i < qd; ++i) {
+        iov[i].iov_base = pool_buf(P, i);
+        iov[i].iov_len = P->size;
+    }
+    /* buffers registrados evitam mapear as páginas a cada leitura; sem
+       memlock suficiente (ou sem READ_FIXED) seguimos com leituras comuns */
+    int fixed = R.read_fixed &&
+                syscall(__NR_io_uring_register, R.fd, IORING_REGISTER_BUFFERS, iov, qd) == 0;
+
+    ExtCursor cur = { ext, next, 0, 0 };
+    uint64_t total = extents_bytes(ext, next), pos = 0, dropped = 0;
+    int err = 0;
+    for (int i = 0; i < qd; ++i) {
+        Slot *S = &slot[i];
+        if ((S->len = ext_next(&cur, P->size, &S->off)) == 0) break;
+        uring_read(&R, fd, fixed, (unsigned)i, pool_buf(P, i),
+                   (unsigned)io_request_len(S->len, direct), S->off, (uint64_t)i);
+    }
+
+    for (uint64_t k = 0, consumed = 0; consumed < total && !err; ) {
+        int i = (int)(k % (uint64_t)qd);
+        Slot *S = &slot[i];
+        if (S->ready) {
+            *reg = crc_calc_extent(C, *reg, &pos, S->off, pool_buf(P, i), S->len);
+            if (dontneed) io_drop_cache(fd, &dropped, pos);
+            consumed += S->len;
+            ++k;
+            if ((S->len = ext_next(&cur, P->size, &S->off)) != 0) {
+                S->got = 0;
+                S->ready = 0;
+                uring_read(&R, fd, fixed, (unsigned)i, pool_buf(P, i),
+                           (unsigned)io_request_len(S->len, direct), S->off, (uint64_t)i);
+                ++P->recycled;
+            }
+            continue;
+        }
+        if ((err = uring_wait(&R)) != 0) break;
+        uint64_t tag;
+        int res;
+        while (uring_reap(&R, &tag, &res)) {
+            Slot *T = &slot[tag];
+            if (res == -EINTR || res == -EAGAIN) {
+                res = 0;
+            } else if (res < 0) {
+                err = -res;
+                break;
+            } else if (res == 0) {
+                err = EIO;                           /* arquivo encolheu */
+                break;
+            }
+            size_t was = T->got;
+            T->got += (size_t)res;
+            if (T->got >= T->len) {
+                T->ready = 1;
+                continue;
+            }
+            if (res > 0 && (err = io_resume(&T->got, was, direct)) != 0) break;
+            uring_read(&R, fd, fixed, (unsigned)tag, pool_buf(P, (int)tag) + T->got,
+                       (unsigned)io_request_len(T->len - T->got, direct),
+                       T->off + T->got, tag);
+        }
+    }
+
+    /* com erro ainda pode haver leituras em voo escrevendo nos buffers */
+    while (R.pending > 0) {
+        uint64_t tag;
+        int res;
+        if (uring_wait(&R) != 0) break;
+        while (uring_reap(&R, &tag, &res)) {}
+    }
+    if (!err && size > pos) *reg = crc_calc_zeros(C, *reg, 8 * (size - pos));
+    uring_free(&R);
+    free(slot);
+    free(iov);
+    return err;
+}
+#endif
+
+/* Lê [off, off+len) inteiro em dst; 0 ou errno (EIO se o arquivo acabou antes). */
+static int pread_full(int fd, uint8_t *dst, size_t len, uint64_t off, int direct) {
+    size_t got = 0;
+    while (got < len) {
+        ssize_t n = pread(fd, dst + got, io_request_len(len - got, direct), (off_t)(off + got));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return (n < 0) ? errno : EIO;
+        size_t was = got;
+        got += (size_t)n;
+        if (got < len) {
+            int err = io_resume(&got, was, direct);
+            if (err) return err;
+        }
+    }
+    return 0;
+}
+
+/*
+ * pread em thread: a leitora enche os buffers do conjunto em rodízio enquanto
+ * o consumidor usa os já cheios (com dois buffers, o buffer duplo clássico).
+ */
+typedef struct {
+    int fd, direct;
+    ExtCursor cur;
+    BufPool *pool;
+    uint64_t *off;
+    size_t *len;
+    int *full;
+    int err;
+    pthread_mutex_t mu;
+    pthread_cond_t cv;
+} PreadPipe;
+
+static void *pread_reader(void *arg) {
+    PreadPipe *P = (PreadPipe*)arg;
+    uint64_t off;
+    size_t want;
+    for (uint64_t k = 0; (want = ext_next(&P->cur, P->pool->size, &off)) != 0; ++k) {
+        int i = (int)(k % (uint64_t)P->pool->n);
+        pthread_mutex_lock(&P->mu);
+        while (P->full[i] && !P->err) pthread_cond_wait(&P->cv, &P->mu);
+        int stop = P->err;
+        pthread_mutex_unlock(&P->mu);
+        if (stop) break;
+
+        int err = pread_full(P->fd, pool_buf(P->pool, i), want, off, P->direct);
+        if (k >= (uint64_t)P->pool->n) ++P->pool->recycled;
+
+        pthread_mutex_lock(&P->mu);
+        if (err) P->err = err;
+        P->off[i] = off;
+        P->len[i] = want;
+        P->full[i] = 1;
+        pthread_cond_broadcast(&P->cv);
+        pthread_mutex_unlock(&P->mu);
+        if (err) break;
+    }
+    return NULL;
+}
+
+static int stream_pread(int fd, uint64_t size, const FileExtent *ext, size_t next,
+                        const CrcCalc *C, u128 *reg, BufPool *pool, int direct, int dontneed)
+{
+    int n = pool->n;
+    uint64_t total = extents_bytes(ext, next), pos = 0, dropped = 0;
+    PreadPipe P;
+    memset(&P, 0, sizeof P);
+    P.fd = fd;
+    P.direct = direct;
+    P.cur = (ExtCursor){ ext, next, 0, 0 };
+    P.pool = pool;
+    P.off = (uint64_t*)calloc((size_t)n, sizeof *P.off);
+    P.len = (size_t*)calloc((size_t)n, sizeof *P.len);
+    P.full = (int*)calloc((size_t)n, sizeof *P.full);
+    if (!P.off || !P.len || !P.full) { fprintf(stderr, "Erro: sem memória.\n"); exit(1); }
+    pthread_mutex_init(&P.mu, NULL);
+    pthread_cond_init(&P.cv, NULL);
+
+    int err = 0;
+    pthread_t tid;
+    int threaded = pthread_create(&tid, NULL, pread_reader, &P) == 0;
+    if (!threaded) {
+        /* sem thread: lê e consome em sequência, sem sobreposição */
+        uint64_t off;
+        size_t want;
+        while (!err && (want = ext_next(&P.cur, pool->size, &off)) != 0) {
+            if ((err = pread_full(fd, pool_buf(pool, 0), want, off, direct)) != 0) break;
+            *reg = crc_calc_extent(C, *reg, &pos, off, pool_buf(pool, 0), want);
+            if (dontneed) io_drop_cache(fd, &dropped, pos);
+        }
+    }
+    for (uint64_t consumed = 0; threaded && consumed < total; ) {
+        for (int i = 0; i < n && consumed < total; ++i) {
+            pthread_mutex_lock(&P.mu);
+            while (!P.full[i] && !P.err) pthread_cond_wait(&P.cv, &P.mu);
+            err = P.err;
+            pthread_mutex_unlock(&P.mu);
+            if (err) break;
+            *reg = crc_calc_extent(C, *reg, &pos, P.off[i], pool_buf(pool, i), P.len[i]);
+            if (dontneed) io_drop_cache(fd, &dropped, pos);
+            consumed += P.len[i];
+            pthread_mutex_lock(&P.mu);
+            P.full[i] = 0;
+            pthread_cond_broadcast(&P.cv);
+            pthread_mutex_unlock(&P.mu);
+        }
+        if (err) break;
+    }
+    if (threaded) pthread_join(tid, NULL);
+    if (!err && size > pos) *reg = crc_calc_zeros(C, *reg, 8 * (size - pos));
+    pthread_cond_destroy(&P.cv);
+    pthread_mutex_destroy(&P.mu);
+    free(P.off);
+    free(P.len);
+    free(P.full);
+    return err;
+}
+
+/*
+ * --io uring|pread|direct: lê em blocos de `chunk` bytes. Em direct o arquivo
+ * é aberto com O_DIRECT (o cache de páginas não é tocado) e os buffers vêm de
+ * hugepages; se o sistema de arquivos recusa O_DIRECT, lê pelo cache e descarta
+ * as páginas com POSIX_FADV_DONTNEED à medida que são consumidas (io_drop_cache).
+ */
+static int run_file_stream(const char *path, int fd, uint64_t len, const CrcModel *M,
+                           int slices, CrcKernel kernel, IoMode io, int qd, size_t chunk)
+{
+    int direct = 0, dontneed = 0;
+    if (io == IO_DIRECT) {
+        int dfd = open(path, O_RDONLY | O_DIRECT);
+        if (dfd >= 0) {
+            close(fd);
+            fd = dfd;
+            direct = 1;
+        } else {
+            fprintf(stderr, "Aviso: O_DIRECT recusado (%s); lendo pelo cache e descartando "
+                            "as páginas com POSIX_FADV_DONTNEED.\n", strerror(errno));
+            dontneed = 1;
+        }
+    }
+    BufPool pool;
+    pool_init(&pool, (io == IO_PREAD) ? 2 : qd, chunk, io == IO_DIRECT);
+    size_t next;
+    FileExtent *ext = file_extents(fd, len, &next);
+    uint64_t holes = len - extents_bytes(ext, next);
+
+    CrcCalc C;
+    crc_calc_init(&C, M, slices, kernel);
+    u128 reg = crc_calc_start(&C);
+    double t0 = now_sec();
+    int err = -1;
+    const char *via = "pread";
+#ifdef HAVE_IO_URING
+    if (io != IO_PREAD) { err = stream_uring(fd, len, ext, next, &C, &reg, &pool, direct, dontneed); via = "io_uring"; }
+#endif
+    if (err == -1) {
+        if (io != IO_PREAD)
+            fprintf(stderr, "Aviso: io_uring indisponível; usando pread numa thread.\n");
+        via = "pread";
+        reg = crc_calc_start(&C);
+        pool.recycled = 0;
+        err = stream_pread(fd, len, ext, next, &C, &reg, &pool, direct, dontneed);
+    }
+    free(ext);
+    double t1 = now_sec();
+    if (dontneed) posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);   /* resto e buracos */
+    u128 crc = crc_calc_finish(&C, reg);
+    crc_calc_free(&C);
+    close(fd);
+    if (err) {
+        fprintf(stderr, "Erro: leitura de %s: %s\n", path, strerror(err));
+        pool_free(&pool);
+        return 1;
+    }
+
+    char hex[40];
+    u128_hex(hex, crc, M->width);
+    printf("%s  %12llu  %s\n", hex, (unsigned long long)len, path);
+    fprintf(stderr, "%s: %llu bytes em %.3f s (%.0f bytes/s, %.3f GB/s), %s%s, "
+                    "%d buffers de %zu KiB (%s), %lu reciclados, %llu bytes em buracos\n", M->name,
+            (unsigned long long)len, t1 - t0, len / (t1 - t0 > 0 ? t1 - t0 : 1e-9),
+            len / (t1 - t0 > 0 ? t1 - t0 : 1e-9) / 1e9, via,
+            direct ? " + O_DIRECT" : "", pool.n, pool.size >> 10, pool.pages, pool.recycled,
+            (unsigned long long)holes);
+    pool_free(&pool);
+    return 0;
+}
+
+/*
+ * --file sobre algo que não é arquivo regular (pipe, FIFO, /dev/stdin) ou com
+ * st_size 0 (os de /proc): o tamanho não diz quanto há para ler, então não há mapeamento nem extents;
+ * lê com read() até o EOF por um CrcCtx, qualquer que seja o --io.
+ */
+static int run_file_read(const char *path, int fd, const CrcModel *M, int slices,
+                         CrcKernel kernel)
+{
+    CrcCalc C;
+    crc_calc_init(&C, M, slices, kernel);
+    CrcCtx X;
+    crc_ctx_init(&X, &C);
+    double t0 = now_sec();
+    int err = crc_ctx_read_fd(&X, fd);
+    double t1 = now_sec();
+    u128 crc = crc_ctx_final(&X);
+    crc_calc_free(&C);
+    close(fd);
+    if (err) {
+        fprintf(stderr, "Erro: leitura de %s: %s\n", path, strerror(err));
+        return 1;
+    }
+
+    uint64_t len = X.nbits / 8;
+    char hex[40];
+    u128_hex(hex, crc, M->width);
+    printf("%s  %12llu  %s\n", hex, (unsigned long long)len, path);
+    fprintf(stderr, "%s: %llu bytes em %.3f s (%.3f GB/s), read() até o EOF (tamanho desconhecido)\n",
+            M->name, (unsigned long long)len, t1 - t0, len / (t1 - t0 > 0 ? t1 - t0 : 1e-9) / 1e9);
+    return 0;
+}
+
+/* ===================== (15) Arquivo mapeado em memória (--file) ===================== */
+/*
+ * O arquivo é mapeado só para leitura e o motor lê direto do cache de páginas,
+ * sem a cópia de read() para um buffer. POSIX_MADV_SEQUENTIAL deixa o kernel
+ * ler adiante de forma agressiva e descartar o que ficou para trás; a cada
+ * janela pedimos POSIX_MADV_WILLNEED da próxima, para o disco já estar
+ * trabalhando enquanto a atual é processada. Com --threads > 1 o mapeamento
+ * inteiro vai para crc_calc_parallel.
+ */
+#define FILE_WINDOW ((size_t)8 << 20)
+
+static int run_file(const char *path, const CrcModel *M, int slices, CrcKernel kernel,
+                    int threads, size_t chunk, IoMode io, int qd)
+{
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0) {
+        fprintf(stderr, "Erro: %s: %s\n", path, strerror(errno));
+        if (fd >= 0) close(fd);
+        return 1;
+    }
+    if (!S_ISREG(st.st_mode) || st.st_size == 0)   /* /proc diz 0 mesmo com conteúdo */
+        return run_file_read(path, fd, M, slices, kernel);
+    if (io != IO_MMAP)
+        return run_file_stream(path, fd, (uint64_t)st.st_size, M, slices, kernel, io, qd, chunk);
+    size_t len = (size_t)st.st_size;
+    const uint8_t *map = NULL;
+    if (len > 0) {
+        void *p = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (p == MAP_FAILED) {
+            fprintf(stderr, "Erro: mmap de %s: %s\n", path, strerror(errno));
+            close(fd);
+            return 1;
+        }
+        map = (const uint8_t*)p;
+        posix_madvise(p, len, POSIX_MADV_SEQUENTIAL);
+    }
+    size_t next;
+    FileExtent *ext = file_extents(fd, len, &next);
+    uint64_t holes = len - extents_bytes(ext, next);
+    close(fd);                       /* o mapeamento continua válido */
+
+    CrcCalc C;
+    crc_calc_init(&C, M, slices, kernel);
+    double t0 = now_sec();
+    u128 crc;
+    if (threads > 1 && len > chunk) {
+        /* cada trecho em paralelo; trechos e buracos juntados com crc_combine */
+        uint64_t pos = 0;
+        crc = crc_calc_finish(&C, crc_calc_start(&C));
+        for (size_t e = 0; e <= next; ++e) {
+            uint64_t off = (e < next) ? ext[e].off : len;
+            if (off > pos) {
+                u128 z = crc_calc_finish(&C, crc_calc_zeros(&C, crc_calc_start(&C), 8 * (off - pos)));
+                crc = crc_combine(M, crc, z, off - pos);
+            }
+            if (e == next) break;
+            posix_madvise((void*)(map + off), (size_t)ext[e].len, POSIX_MADV_WILLNEED);
+            crc = crc_combine(M, crc, crc_calc_parallel(&C, map + off, (size_t)ext[e].len,
+                                                        threads, chunk), ext[e].len);
+            pos = off + ext[e].len;
+        }
+    } else {
+        u128 reg = crc_calc_start(&C);
+        ExtCursor cur = { ext, next, 0, 0 };
+        uint64_t off, pos = 0;
+        size_t n;
+        while ((n = ext_next(&cur, FILE_WINDOW, &off)) != 0) {
+            uint64_t ahead_off;
+            ExtCursor peek = cur;
+            size_t ahead = ext_next(&peek, FILE_WINDOW, &ahead_off);
+            if (ahead) posix_madvise((void*)(map + ahead_off), ahead, POSIX_MADV_WILLNEED);
+            reg = crc_calc_extent(&C, reg, &pos, off, map + off, n);
+        }
+        if (len > pos) reg = crc_calc_zeros(&C, reg, 8 * (len - pos));
+        crc = crc_calc_finish(&C, reg);
+    }
+    double t1 = now_sec();
+    free(ext);
+    crc_calc_free(&C);
+    if (map) munmap((void*)map, len);
+
+    char hex[40];
+    u128_hex(hex, crc, M->width);
+    printf("%s  %12llu  %s\n", hex, (unsigned long long)len, path);
+    fprintf(stderr, "%s: %zu bytes em %.3f s (%.3f GB/s), %d thread%s, %llu bytes em buracos\n",
+            M->name, len, t1 - t0, len / (t1 - t0 > 0 ? t1 - t0 : 1e-9) / 1e9,
+            (threads > 1 && len > chunk) ? threads : 1,
+            (threads > 1 && len > chunk) ? "s" : "", (unsigned long long)holes);
+    return 0;
+}
+
+/*
+ * --trace ARQ: traço compacto da divisão do conteúdo de ARQ por --poly, na
+ * saída padrão (uma linha por bit: um quadro Ethernet de 12 KB dá ~100 mil
+ * linhas, não gigabytes de escada), conferido com o motor por tabela.
+ * --trace-lfsr ARQ: a tabela passo a passo do LFSR (2/3), com os passos
+ * passando pelo anel de (22); no stderr, o tempo do laço e o do texto.
+ * Com --trace-out SAIDA, o anel grava o traço binário de (23) em vez da tabela.
+ */
+static int run_trace(const char *path, const CrcPoly *g, int lfsr, const char *out,
+                     int slices, CrcKernel kernel)
+{
+    if (g->m > 64) {
+        fprintf(stderr, "Erro: o traço guarda o resto em uint64_t (grau até 64).\n");
+        return 2;
+    }
+    FILE *fp = fopen(path, "rb");
+    if (!fp) {
+        fprintf(stderr, "Erro: %s: %s\n", path, strerror(errno));
+        return 1;
+    }
+    size_t len = 0, cap = 1 << 16;
+    uint8_t *buf = (uint8_t*)malloc(cap);
+    size_t n;
+    while (buf && (n = fread(buf + len, 1, cap - len, fp)) > 0) {
+        len += n;
+        if (len == cap) {
+            uint8_t *p = (uint8_t*)realloc(buf, cap *= 2);
+            if (!p) { free(buf); buf = NULL; }
+            else buf = p;
+        }
+    }
+    fclose(fp);
+    if (!buf) { fprintf(stderr, "Erro: sem memória.\n"); return 1; }
+
+    Logger L = {0};
+    uint64_t fcs;
+    if (lfsr) {
+        lprint(&L, "LFSR sobre %s (%zu bits + %d zeros)\n", path, 8 * len, g->m);
+        StepText T = { &L, g->m };
+        TraceBin B;
+        StepRing R;
+        if (out) {
+            if (trace_bin_open(&B, out, g, 8 * (uint64_t)len) < 0) {
+                fprintf(stderr, "Erro: %s: %s\n", out, strerror(errno));
+                free(buf);
+                logger_close(&L);
+                return 1;
+            }
+            step_ring_start(&R, step_sink_bin, &B, 8 * (uint64_t)len + (uint64_t)g->m);
+        } else {
+            lprint(&L, "passo | i | msb(old) |  r[m-1]..r[0]      ->   r'[m-1]..r'[0]\n");
+            step_ring_start(&R, step_sink_text, &T, 8 * (uint64_t)len + (uint64_t)g->m);
+        }
+        double t0 = now_sec();
+        fcs = lfsr_trace_bits(g, buf, 8 * (uint64_t)len, &R);
+        double t1 = now_sec();
+        step_ring_stop(&R);
+        if (out && trace_bin_close(&B) < 0) {
+            fprintf(stderr, "Erro: falha ao gravar %s.\n", out);
+            free(buf);
+            logger_close(&L);
+            return 1;
+        }
+        if (!out) lflush(&L);       /* a tabela inteira já escrita, não só formatada */
+        double t2 = now_sec();
+        if (out)
+            lprint(&L, "Traço binário em %s: %llu checkpoints (1 a cada %d passos)\n",
+                   out, (unsigned long long)B.h.ncheck, TRACE_K);
+        fprintf(stderr, "%llu passos: laço do LFSR em %.3f s, %s em %.3f s\n",
+                (unsigned long long)(8 * (uint64_t)len + (uint64_t)g->m), t1 - t0,
+                out ? "arquivo fechado" : "tabela escrita", t2 - t0);
+    } else {
+        lprint(&L, "Divisão de %s (%zu bits) · x^%d por g, traço compacto\n", path, 8 * len, g->m);
+        fcs = divide_mod2_trace_bits(buf, 8 * len, g, &L);
+    }
+
+    CrcModel raw = { "FCS", NULL, g->m, crc_poly_low(g), 0, 0, 0, 0, 0 };
+    CrcCalc C;
+    crc_calc_init(&C, &raw, slices, kernel);
+    uint64_t ref = (uint64_t)crc_calc_bytes(&C, buf, len);
+    crc_calc_free(&C);
+    free(buf);
+    lprint(&L, "FCS (traço): 0x%0*llx\nFCS (motor): 0x%0*llx  %s\n",
+           (g->m + 3) / 4, (unsigned long long)fcs, (g->m + 3) / 4, (unsigned long long)ref,
+           (fcs == ref) ? "OK" : "DIVERGE");
+    logger_close(&L);
+    return fcs != ref;
+}
+
+/* --query SAIDA PASSO: o passo PASSO de um traço binário de --trace-out. */
+static int run_query(const char *path, const char *passo) {
+    char *end;
+    errno = 0;
+    unsigned long long n = strtoull(passo, &end, 0);
+    if (errno || end == passo || *end) {
+        fprintf(stderr, "Erro: passo inválido: %s\n", passo);
+        return 2;
+    }
+    int fd = open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        fprintf(stderr, "Erro: %s: %s\n", path, strerror(errno));
+        return 1;
+    }
+    TraceHdr h;
+    if (trace_bin_load(fd, &h) < 0) {
+        fprintf(stderr, "Erro: %s não é um traço de --trace-out.\n", path);
+        close(fd);
+        return 1;
+    }
+    LfsrStep r;
+    if (trace_bin_step(fd, &h, n, &r) < 0) {
+        fprintf(stderr, "Erro: passo %llu fora do traço (0..%llu).\n",
+                n, (unsigned long long)(h.nbits + h.m - 1));
+        close(fd);
+        return 1;
+    }
+    close(fd);
+
+    Logger L = {0};
+    StepText T = { &L, (int)h.m };
+    lprint(&L, "passo | i | msb(old) |  r[m-1]..r[0]      ->   r'[m-1]..r'[0]\n");
+    step_sink_text(&T, &r, 1);
+    logger_close(&L);
+    return 0;
+}
+
+/*
+ * Aceita 0b..., 0x... ou decimal. Sem --width o valor traz o termo x^m (como
+ * `polinomio`, grau até 127); com --width W são só os W coeficientes de baixo
+ * (notação dos catálogos, ex.: --width 64 --poly 0x42F0E1EBA9EA3693).
+ */
+static int parse_poly(const char *txt, int width, CrcPoly *out) {
+    int base = 10;
+    if (txt[0] == '0' && (txt[1] == 'x' || txt[1] == 'X')) { base = 16; txt += 2; }
+    else if (txt[0] == '0' && (txt[1] == 'b' || txt[1] == 'B')) { base = 2; txt += 2; }
+    if (!*txt) return 0;
+
+    u128 v = 0;
+    for (; *txt; ++txt) {
+        int d = (*txt >= '0' && *txt <= '9') ? *txt - '0' :
+                (*txt >= 'a' && *txt <= 'f') ? *txt - 'a' + 10 :
+                (*txt >= 'A' && *txt <= 'F') ? *txt - 'A' + 10 : 99;
+        if (d >= base || v > (~(u128)0 - (u128)d) / (u128)base) return 0;
+        v = v * (u128)base + (u128)d;
+    }
+
+    u128 low;
+    int m;
+    if (width) {
+        if (width < 1 || width > 128 || (width < 128 && (v >> width))) return 0;
+        m = width;
+        low = v;
+    } else {
+        m = bitlen_u128(v) - 1;
+        if (m < 1) return 0;
+        low = v ^ ((u128)1 << m);
+    }
+    out->m = m;
+    out->lo = (uint64_t)low;
+    out->hi = (uint64_t)(low >> 64);
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    /* Dados do enunciado */
+    uint64_t mensagem  = 0b10001000100010001000000110000001ULL; /* 32 bits */
+    uint64_t polinomio = 0b1011011ULL;                          /* x^6 + x^4 + x^3 + x + 1 */
+    const char *poly_txt = NULL;
+    int poly_width = 0;
+    int slices = 8;
+    long bench_mib = -1;
+    int selftest = 0, log_thread = 0, trace_lfsr = 0;
+    int threads = cpu_count();
+    long chunk_kib = 1024;
+    const CrcModel *model = NULL;
+    const char *scan_list = NULL;
+    const char *file_path = NULL;
+    const char *trace_path = NULL;
+    const char *trace_out = NULL, *query_path = NULL, *query_step = NULL;
+    IoMode io = IO_MMAP;
+    int qd = 8;
+    CrcKernel kernel = crc_select_kernel();
+
+    for (int a = 1; a < argc; ++a) {
+        if (strcmp(argv[a], "--slices") == 0 && a + 1 < argc &&
+            ((slices = atoi(argv[a + 1])) == 4 || slices == 8 || slices == 16)) {
+            ++a;
+        } else if (strcmp(argv[a], "--bench") == 0 && a + 1 < argc &&
+                   (bench_mib = atol(argv[a + 1])) > 0) {
+            ++a;
+        } else if (strcmp(argv[a], "--kernel") == 0 && a + 1 < argc) {
+            const char *k = argv[++a];
+            for (kernel = KERNEL_SLICE; kernel <= KERNEL_VPCLMUL; ++kernel)
+                if (strcmp(k, kernel_name(kernel)) == 0) break;
+            if (kernel > KERNEL_VPCLMUL || !kernel_supported(kernel)) {
+                fprintf(stderr, "Erro: kernel '%s' desconhecido ou não suportado nesta CPU.\n", k);
+                return 2;
+            }
+        } else if (strcmp(argv[a], "--threads") == 0 && a + 1 < argc &&
+                   (threads = atoi(argv[a + 1])) >= 1) {
+            ++a;
+        } else if (strcmp(argv[a], "--chunk") == 0 && a + 1 < argc &&
+                   (chunk_kib = atol(argv[a + 1])) >= 1) {
+            ++a;
+        } else if (strcmp(argv[a], "--file") == 0 && a + 1 < argc) {
+            file_path = argv[++a];
+        } else if ((strcmp(argv[a], "--trace") == 0 || strcmp(argv[a], "--trace-lfsr") == 0) &&
+                   a + 1 < argc) {
+            trace_lfsr = strcmp(argv[a], "--trace-lfsr") == 0;
+            trace_path = argv[++a];
+        } else if (strcmp(argv[a], "--trace-out") == 0 && a + 1 < argc) {
+            trace_out = argv[++a];
+        } else if (strcmp(argv[a], "--query") == 0 && a + 2 < argc) {
+            query_path = argv[++a];
+            query_step = argv[++a];
+        } else if (strcmp(argv[a], "--io") == 0 && a + 1 < argc) {
+            const char *s = argv[++a];
+            for (io = IO_MMAP; io <= IO_DIRECT; ++io)
+                if (strcmp(s, io_name(io)) == 0) break;
+            if (io > IO_DIRECT) {
+                fprintf(stderr, "Erro: --io deve ser mmap, uring, pread ou direct.\n");
+                return 2;
+            }
+        } else if (strcmp(argv[a], "--qd") == 0 && a + 1 < argc &&
+                   (qd = atoi(argv[a + 1])) >= 1 && qd <= 4096) {
+            ++a;
+        } else if (strcmp(argv[a], "--scan") == 0 && a + 1 < argc) {
+            scan_list = argv[++a];
+        } else if (strcmp(argv[a], "--selftest") == 0) {
+            selftest = 1;
+        } else if (strcmp(argv[a], "--log-thread") == 0) {
+            log_thread = 1;
+        } else if (strcmp(argv[a], "--gen-catalogo") == 0) {
+            return gen_catalogo(stdout);
+        } else if (strcmp(argv[a], "--list-models") == 0) {
+            for (size_t i = 0; i < N_CRC_MODELS; ++i)
+                printf("%-16s %s\n", crc_models[i].name,
+                       crc_models[i].alias ? crc_models[i].alias : "");
+            return 0;
+        } else if (strcmp(argv[a], "--model") == 0 && a + 1 < argc) {
+            if (!(model = crc_model_find(argv[++a]))) {
+                fprintf(stderr, "Erro: modelo '%s' desconhecido (veja --list-models).\n", argv[a]);
+                return 2;
+            }
+        } else if (strcmp(argv[a], "--poly") == 0 && a + 1 < argc) {
+            poly_txt = argv[++a];
+        } else if (strcmp(argv[a], "--width") == 0 && a + 1 < argc &&
+                   (poly_width = atoi(argv[a + 1])) >= 1 && poly_width <= 128) {
+            ++a;
+        } else {
+            fprintf(stderr, "Uso: %s [--poly G [--width W]] [--slices 4|8|16]"
+                            " [--kernel slice|pclmul|vpclmul]\n"
+                            "       [--bench MiB [--threads N] [--chunk KiB]] [--selftest] [--log-thread]\n"
+                            "       %s --model NOME | --list-models | --gen-catalogo\n"
+                            "       %s --file ARQ [--model NOME | --poly G] [--threads N] [--chunk KiB]\n"
+                            "                 [--io mmap|uring|pread|direct [--qd N]]\n"
+                            "       %s --scan LISTA [--model NOME] [--threads N] [--chunk KiB]\n"
+                            "       %s --trace|--trace-lfsr ARQ [--poly G [--width W]] [--trace-out SAIDA]\n"
+                            "       %s --query SAIDA PASSO\n",
+                    argv[0], argv[0], argv[0], argv[0], argv[0], argv[0]);
+            return 2;
+        }
+    }
+
+    CrcPoly gpoly = crc_poly_from_u64(polinomio);
+    if (poly_txt && !parse_poly(poly_txt, poly_width, &gpoly)) {
+        fprintf(stderr, "Erro: polinômio inválido: %s\n", poly_txt);
+        return 2;
+    }
+
+    if (selftest) return run_selftest();
+    if (query_path) return run_query(query_path, query_step);
+    if (trace_path) return run_trace(trace_path, &gpoly, trace_lfsr, trace_out, slices, kernel);
+    if (file_path) {
+        CrcModel raw = { "FCS", NULL, gpoly.m, crc_poly_low(&gpoly), 0, 0, 0, 0, 0 };
+        return run_file(file_path, model ? model : &raw, slices, kernel,
+                        threads, (size_t)chunk_kib << 10, io, qd);
+    }
+    if (scan_list)
+        return run_scan(scan_list, model ? model : crc_model_find("CRC-32"), slices, kernel,
+                        threads, (size_t)chunk_kib << 10);
+    if (model) return show_model(model, slices, kernel);
+    if (bench_mib > 0) return run_bench(&gpoly, (size_t)bench_mib, slices, kernel,
+                                      threads, (size_t)chunk_kib << 10);
+
+    /* a mensagem de 32 bits e o FCS dividem um uint64_t na codeword */
+    int msgw = 32;
+    if (gpoly.m > 64 - msgw) {
+        fprintf(stderr, "Erro: a demonstração passo a passo guarda mensagem + FCS em uint64_t "
+                        "(grau até %d); use --bench para grau %d.\n", 64 - msgw, gpoly.m);
+        return 2;
+    }
+    polinomio = (1ULL << gpoly.m) | gpoly.lo;
+
+    Logger logger;
+    if (logger_open(&logger, "resultado_crc.txt", log_thread) < 0) {
+        fprintf(stderr, "Aviso: não consegui abrir resultado_crc.txt para escrita.\n");
+    }
+
+    int m = bitlen_u64(polinomio) - 1;
+
+    lprint(&logger, "\n=== ITEM 1: CRC por divisão em módulo 2 (com passos) ===\n\n");
+    uint64_t codeword = 0, fcs_div = 0;
+    make_crc_transmission(mensagem, polinomio, &codeword, &fcs_div, &logger, 1);
+
+    lprint(&logger, "\n");
+    print_bits(&logger, "FCS (divisão): ", fcs_div, m);
+    {
+        int cw_w = msgw + m;
+        char cw[BITS_STR_LEN];
+        lprint(&logger, "Mensagem transmitida (codeword): %s\n\n", bits_str(cw, codeword, cw_w));
+    }
+
+    lprint(&logger, "Verificação na recepção (codeword ÷ polinômio):\n");
+    {
+        uint64_t q=0, r=0;
+        divide_mod2_show(codeword, polinomio, &q, &r, &logger, 1);
+        lprint(&logger, "\n%s\n", (r == 0) ? "Transmissão com sucesso!" : "Falha na transmissão.");
+    }
+
+    lprint(&logger, "\n=== ITEM 2 e 3: LFSR simplificado + tabela de evolução ===\n\n");
+    uint64_t fcs_lfsr = trace_lfsr_crc(mensagem, msgw, polinomio, &logger, 1);
+
+    lprint(&logger, "\n");
+    print_bits(&logger, "FCS (LFSR):     ", fcs_lfsr, m);
+    lprint(&logger, "Comparação:     %s\n\n", (fcs_lfsr == fcs_div) ? "OK" : "DIVERGE");
+
+    lprint(&logger, "=== ITEM 4: CRC por tabela (byte a byte e fatiado) ===\n\n");
+    CrcTable tab;
+    crc_table_init(&tab, &gpoly, 0);
+    uint64_t fcs_tab = crc_table_fcs(&tab, mensagem, msgw);
+    print_bits(&logger, "FCS (tabela):   ", fcs_tab, m);
+    lprint(&logger, "Comparação:     %s\n\n", (fcs_tab == fcs_div) ? "OK" : "DIVERGE");
+
+    CrcSlices sl;
+    crc_slices_init(&sl, &tab, slices);
+    uint64_t fcs_sl = crc_slice_fcs(&sl, mensagem, msgw);
+    lprint(&logger, "FCS (%d fatias): ", slices);
+    print_bits(&logger, "", fcs_sl, m);
+    lprint(&logger, "Comparação:     %s\n\n", (fcs_sl == fcs_div) ? "OK" : "DIVERGE");
+    crc_slices_free(&sl);
+
+    lprint(&logger, "=== ITEM 5: mensagem como fluxo de bits (ponteiro + tamanho) ===\n\n");
+    CrcEngine *eng = (CrcEngine*)malloc(sizeof *eng);
+    if (!eng) { fprintf(stderr, "Erro: sem memória.\n"); logger_close(&logger); return 1; }
+    crc_engine_init(eng, &gpoly, 0, slices, kernel);
+    {
+        uint8_t bytes[8];
+        pack_bits_msb(mensagem, msgw, bytes);
+        uint64_t fcs_bits = crc_fcs_bits(eng, bytes, (size_t)msgw);
+        print_bits(&logger, "FCS (bits):     ", fcs_bits, m);
+        lprint(&logger, "Comparação:     %s\n", (fcs_bits == fcs_div) ? "OK" : "DIVERGE");
+
+        pack_bits_msb(codeword, msgw + m, bytes);
+        uint64_t r = mod2_remainder_bits(eng, bytes, (size_t)(msgw + m));
+        print_bits(&logger, "Resto codeword: ", r, m);
+        lprint(&logger, "%s\n\n", (r == 0) ? "Transmissão com sucesso!" : "Falha na transmissão.");
+    }
+    crc_engine_free(eng);
+    free(eng);
+
+    lprint(&logger, "=== ITEM 6: grau 64 (CRC-64/ECMA-182, \"123456789\") ===\n\n");
+    {
+        static const uint8_t check_msg[] = "123456789";
+        const uint64_t check = 0x6C40DF5F0B497347ULL;
+        CrcPoly ecma = { 64, 0x42F0E1EBA9EA3693ULL, 0 };
+        CrcEngine *e64 = (CrcEngine*)malloc(sizeof *e64);
+        Crc128Table *t128 = (Crc128Table*)malloc(sizeof *t128);
+        if (!e64 || !t128) { fprintf(stderr, "Erro: sem memória.\n"); logger_close(&logger); return 1; }
+        crc_engine_init(e64, &ecma, 0, slices, kernel);
+        crc128_table_init(t128, &ecma, 0);
+
+        uint64_t r[4];
+        r[0] = crc_fcs_bits(e64, check_msg, 72);
+        r[1] = lfsr_bits64(&ecma, check_msg, 72);
+        r[2] = (uint64_t)crc128_fcs_bits(t128, check_msg, 72);
+        r[3] = (uint64_t)lfsr_bits128(&ecma, check_msg, 72);
+        static const char *rotulos[4] = {
+            "FCS (divisão 64):  ", "FCS (LFSR 64):     ",
+            "FCS (divisão 128): ", "FCS (LFSR 128):    "
+        };
+        for (int i = 0; i < 4; ++i)
+            lprint(&logger, "%s0x%016llx  %s\n", rotulos[i],
+                   (unsigned long long)r[i], (r[i] == check) ? "OK" : "DIVERGE");
+
+        uint8_t cw[9 + 8];
+        memcpy(cw, check_msg, 9);
+        for (int i = 0; i < 8; ++i) cw[9 + i] = (uint8_t)(check >> (56 - 8 * i));
+        int ok = mod2_remainder_bits(e64, cw, 8 * sizeof cw) == 0 &&
+                 mod2_remainder128_bits(t128, cw, 8 * sizeof cw) == 0;
+        lprint(&logger, "Resto (mensagem||FCS), 64 e 128 bits: %s\n\n",
+               ok ? "zero, transmissão com sucesso!" : "diferente de zero, falha.");
+        crc_engine_free(e64);
+        free(e64);
+        free(t128);
+    }
+
+    lprint(&logger, "=== ITEM 7: mensagem em fragmentos (init/update/final) ===\n\n");
+    {
+        static const int frag[4] = { 5, 11, 3, 13 };
+        CrcModel raw = { "FCS", NULL, gpoly.m, crc_poly_low(&gpoly), 0, 0, 0, 0, 0 };
+        CrcCalc C;
+        crc_calc_init(&C, &raw, slices, kernel);
+        CrcCtx X;
+        crc_ctx_init(&X, &C);
+        int pos = 0;
+        for (int i = 0; i < 4; ++i) {
+            /* bits [pos, pos+frag[i]) da mensagem, alinhados ao começo do fragmento */
+            uint8_t bytes[8];
+            uint64_t bits = (mensagem >> (msgw - pos - frag[i])) & ((1ULL << frag[i]) - 1);
+            pack_bits_msb(bits, frag[i], bytes);
+            crc_ctx_update_bits(&X, bytes, (size_t)frag[i]);
+            char s[BITS_STR_LEN];
+            lprint(&logger, "Fragmento %d (%2d bits): %s\n", i + 1, frag[i], bits_str(s, bits, frag[i]));
+            pos += frag[i];
+        }
+        uint64_t fcs_ctx = (uint64_t)crc_ctx_final(&X);
+        crc_calc_free(&C);
+        print_bits(&logger, "FCS (contexto): ", fcs_ctx, m);
+        lprint(&logger, "Comparação:     %s\n\n", (fcs_ctx == fcs_div) ? "OK" : "DIVERGE");
+    }
+
+    lprint(&logger, "=== ITEM 8: LFSR direto (sem os m zeros finais) ===\n\n");
+    {
+        uint64_t fcs_dir = trace_lfsr_direct(mensagem, msgw, polinomio, &logger, 1);
+        lprint(&logger, "\n");
+        print_bits(&logger, "FCS (direto):   ", fcs_dir, m);
+        lprint(&logger, "Comparação:     %s\n", (fcs_dir == fcs_div) ? "OK" : "DIVERGE");
+        lprint(&logger, "Clocks:         %d (direto) x %d (aumentado)\n\n", msgw, msgw + m);
+
+        /* CRC-16/CCITT: o clássico init aumentado 0xFFFF equivale ao direto 0x1D0F */
+        CrcPoly ccitt = { 16, 0x1021, 0 };
+        static const uint16_t inits[2] = { 0xFFFF, 0x1D0F };
+        for (int i = 0; i < 2; ++i) {
+            int inv;
+            uint16_t dir = (uint16_t)lfsr_init_aug_to_direct(&ccitt, inits[i]);
+            uint16_t aug = (uint16_t)lfsr_init_direct_to_aug(&ccitt, inits[i], &inv);
+            lprint(&logger, "CRC-16/CCITT init 0x%04X: aumentado -> direto 0x%04X, "
+                   "direto -> aumentado 0x%04X\n", inits[i], dir, aug);
+        }
+        static const uint8_t check_msg[] = "123456789";
+        uint16_t a = (uint16_t)lfsr_aug_bits128(&ccitt, 0xFFFF, check_msg, 72);
+        uint16_t d = (uint16_t)lfsr_direct_bits128(&ccitt, 0x1D0F, check_msg, 72);
+        lprint(&logger, "\"123456789\": aumentado(0xFFFF) = 0x%04X, direto(0x1D0F) = 0x%04X  %s\n\n",
+               a, d, (a == d) ? "OK" : "DIVERGE");
+    }
+
+    lprint(&logger, "=== ITEM 9: salto sobre zeros (x^n mod g) ===\n\n");
+    {
+        CrcModel raw = { "FCS", NULL, gpoly.m, crc_poly_low(&gpoly), 0, 0, 0, 0, 0 };
+        CrcCalc C;
+        crc_calc_init(&C, &raw, slices, kernel);
+        uint8_t bytes[8];
+        pack_bits_msb(mensagem, msgw, bytes);
+        u128 reg = crc_calc_update_bits(&C, crc_calc_start(&C), bytes, (size_t)msgw);
+
+        /* mensagem || 1 MiB de zeros: motor byte a byte x salto */
+        enum { ZB = 1 << 20 };
+        uint8_t *z = (uint8_t*)calloc(ZB, 1);
+        if (!z) { fprintf(stderr, "Erro: sem memória.\n"); logger_close(&logger); return 1; }
+        uint64_t f_motor = (uint64_t)crc_calc_finish(&C, crc_calc_update(&C, reg, z, ZB));
+        uint64_t f_salto = (uint64_t)crc_calc_finish(&C, crc_calc_zeros(&C, reg, 8ULL * ZB));
+        free(z);
+        print_bits(&logger, "FCS + 2^23 zeros (motor): ", f_motor, m);
+        print_bits(&logger, "FCS + 2^23 zeros (salto): ", f_salto, m);
+        lprint(&logger, "Comparação:               %s\n", (f_motor == f_salto) ? "OK" : "DIVERGE");
+
+        /* 1 TiB de zeros: ~8,8·10^12 clocks, ou 45 multiplicações mod g */
+        uint64_t nbits = 8ULL << 40;
+        uint64_t xp = (uint64_t)gf2_xpow_mod(nbits, &raw);
+        uint64_t f_tib = (uint64_t)crc_calc_finish(&C, crc_calc_zeros(&C, reg, nbits));
+        print_bits(&logger, "x^(2^43) mod g:           ", xp, m);
+        print_bits(&logger, "FCS + 1 TiB de zeros:     ", f_tib, m);
+        crc_calc_free(&C);
+    }
+    lprint(&logger, "\n");
 
-    if (logger.fp) fclose(logger.fp);
+    logger_close(&logger);
     return 0;
 }